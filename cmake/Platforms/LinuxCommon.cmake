@@ -58,6 +58,14 @@ else ()
     )
 endif ()
 
+set(RE_NO_ALLOC_CHECKS OFF CACHE BOOL "Should allocations inside BE_ASSERT_NO_ALLOC scopes be reported?")
+if (RE_NO_ALLOC_CHECKS)
+  set(LINUX_COMPILE_DEFS
+    ${LINUX_COMPILE_DEFS}
+    BE_NO_ALLOC_CHECKS
+    )
+endif ()
+
 ################################################################################
 # Compiler flags
 ################################################################################
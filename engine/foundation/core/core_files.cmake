@@ -75,9 +75,13 @@ set(FILES
   private/input/virtual/virtual_standard_controller.cpp
 
   # private/io
+  private/io/async_file_io.cpp
   private/io/binary_reader.cpp
   private/io/binary_writer.cpp
+  private/io/chained_memory_stream.cpp
+  private/io/chunked_compressed_stream.cpp
   private/io/compressed_file.cpp
+  private/io/directory_scanner.cpp
   private/io/compressed_reader.cpp
   private/io/compressed_stream.cpp
   private/io/compressed_writer.cpp
@@ -85,6 +89,7 @@ set(FILES
   private/io/file_impl.cpp
   private/io/file_reader.cpp
   private/io/file_stream.cpp
+  private/io/file_watch_service.cpp
   private/io/file_watcher.cpp
   private/io/file_watcher_impl.cpp
   private/io/file_writer.cpp
@@ -92,12 +97,18 @@ set(FILES
   private/io/filesystem_helper.cpp
   private/io/io_server.cpp
   private/io/json_reader.cpp
+  private/io/json_stream_reader.cpp
+  private/io/json_stream_writer.cpp
   private/io/json_writer.cpp
   private/io/media_type.cpp
   private/io/memory_stream.cpp
   private/io/mount_point.cpp
   private/io/mount_point_registry.cpp
+  private/io/pack_archive.cpp
+  private/io/pack_archive_writer.cpp
+  private/io/pack_stream.cpp
   private/io/path.cpp
+  private/io/path_view.cpp
   private/io/stream.cpp
   private/io/stream_reader.cpp
   private/io/stream_writer.cpp
@@ -106,8 +117,12 @@ set(FILES
 
   # private/json
   private/json/json.cpp
+  private/json/json_binary.cpp
   private/json/json_builder.cpp
+  private/json/json_document.cpp
   private/json/json_parser.cpp
+  private/json/json_sax_handler.cpp
+  private/json/json_tape.cpp
   private/json/json_value.cpp
   private/json/json_writer.cpp
 
@@ -131,6 +146,7 @@ set(FILES
   private/memory/memory.cpp
   private/memory/memory_tracker.cpp
   private/memory/mimalloc_allocator.cpp
+  private/memory/no_alloc_scope.cpp
   private/memory/pool_allocator.cpp
   private/memory/stack_allocator.cpp
   private/memory/std_allocator.cpp
@@ -146,6 +162,11 @@ set(FILES
   # private/plugin
   private/plugin/plugin.cpp
 
+  # private/profiling
+  private/profiling/metrics.cpp
+  private/profiling/startup_tracer.cpp
+  private/profiling/telemetry_server.cpp
+
   # private/resource
   private/resource/resource.cpp
 
@@ -176,7 +197,13 @@ set(FILES
   private/std/any.cpp
 
   # private/string
+  private/string/format.cpp
+  private/string/name.cpp
+  private/string/number_conversion.cpp
+  private/string/regex.cpp
   private/string/string_hash.cpp
+  private/string/string_simd.cpp
+  private/string/view_tokenizer.cpp
 
   # private/threading
   private/threading/runnable.cpp
@@ -190,9 +217,12 @@ set(FILES
   # private/tools
   private/tools/command_line.cpp
   private/tools/command_line_option.cpp
+  private/tools/compression.cpp
   private/tools/compression_lz4.cpp
+  private/tools/compression_zlib.cpp
   private/tools/version.cpp
 
   # private/utility
+  private/utility/byte_swap.cpp
   private/utility/fnv1a.cpp
 )
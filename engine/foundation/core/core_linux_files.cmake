@@ -29,6 +29,7 @@ set(FILES
   private/linux/linux_file.cpp
   private/linux/linux_file_watcher.cpp
   private/linux/linux_filesystem.cpp
+  private/linux/linux_io_uring.cpp
   private/linux/linux_keyboard_device.cpp
   private/linux/linux_library.cpp
   private/linux/linux_mouse_device.cpp
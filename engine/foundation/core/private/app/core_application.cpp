@@ -23,6 +23,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/app/core_application.h"
+#include "core/profiling/startup_tracer.h"
+#include "core/profiling/telemetry_server.h"
 
 
 //[-------------------------------------------------------]
@@ -52,11 +54,22 @@ int CoreApplication::run(const String& executableName, const Vector<String>& arg
   // Initialize application
   mExitCode = 0;
 
-  if (on_start()) {
+  bool started = false;
+  {
+    BE_STARTUP_SCOPE("CoreApplication::on_start")
+    started = on_start();
+  }
+  if (started) {
     on_resume();
 
     // Call application-specific initialization routine
-    on_init();
+    {
+      BE_STARTUP_SCOPE("CoreApplication::on_init")
+      on_init();
+    }
+
+    // Startup is done, report what it did cost if requested
+    StartupTracer::instance().finish(mCommandLine.is_value_set("--trace-startup"));
 
     // Run application
     main();
@@ -86,6 +99,8 @@ CoreApplication::CoreApplication()
 
   mCommandLine.add_flag("Help", "-h", "--help", "Display help");
   mCommandLine.add_flag("About", "-v", "--version", "Display version");
+  mCommandLine.add_flag("TraceStartup", "", "--trace-startup", "Log the cost of the startup until the main loop is reached");
+  mCommandLine.add_parameter("Telemetry", "", "--telemetry", "Stream telemetry to a Unix domain socket at the given path", "");
 }
 
 CoreApplication::~CoreApplication() {
@@ -167,6 +182,11 @@ bool CoreApplication::on_start() {
     return mRunning;
   }
 
+  // Start streaming telemetry, if requested
+  if (mCommandLine.is_value_set("--telemetry")) {
+    TelemetryServer::instance().start(mCommandLine.get_value("--telemetry"));
+  }
+
   return mRunning;
 }
 
@@ -179,7 +199,8 @@ void CoreApplication::on_pause() {
 }
 
 void CoreApplication::on_stop() {
-
+  // Stop streaming telemetry
+  TelemetryServer::instance().stop();
 }
 
 void CoreApplication::on_destroy() {
@@ -25,6 +25,8 @@
 #include "core/config/config_reader.h"
 #include "core/config/config.h"
 #include "core/io/file_stream.h"
+#include "core/io/filesystem.h"
+#include "core/json/json_binary.h"
 
 
 //[-------------------------------------------------------]
@@ -42,7 +44,11 @@ ConfigReader::ConfigReader() {
 ConfigReader::~ConfigReader() {
 }
 
-bool ConfigReader::read(const String& configFilename, Config& config) {
+bool ConfigReader::read(const String& configFilename, Config& config, bool useBinaryCache) {
+  if (useBinaryCache && read_binary_cache(configFilename, config)) {
+    return true;
+  }
+
   Ptr<FileStream> file = Ptr<FileStream>(new FileStream());
   file->set_path(Path(configFilename));
   file->set_access_mode(EFileMode::Read);
@@ -55,6 +61,10 @@ bool ConfigReader::read(const String& configFilename, Config& config) {
     // We are done, close the json reader
     mJsonReader.close();
 
+    if (useBinaryCache) {
+      write_binary_cache(configFilename, config);
+    }
+
     // Done
     return true;
   }
@@ -63,6 +73,48 @@ bool ConfigReader::read(const String& configFilename, Config& config) {
   return false;
 }
 
+String ConfigReader::get_binary_cache_filename(const String& configFilename) {
+  return configFilename + ".bin";
+}
+
+bool ConfigReader::read_binary_cache(const String& configFilename, Config& config) const {
+  const String cacheFilename = get_binary_cache_filename(configFilename);
+  const Filesystem filesystem;
+  const String nativeConfigFilename = Path(configFilename).get_native_path();
+  const String nativeCacheFilename = Path(cacheFilename).get_native_path();
+  if (!filesystem.file_exists(nativeCacheFilename)) {
+    return false;
+  }
+
+  // Modification times have a resolution of seconds, a cache written within the same second as
+  // the config might miss the last change, so it has to be strictly newer
+  if (filesystem.file_exists(nativeConfigFilename) &&
+      filesystem.get_last_modification_time(nativeCacheFilename) <= filesystem.get_last_modification_time(nativeConfigFilename)) {
+    return false;
+  }
+
+  JsonBinaryDocument document;
+  if (!document.open(cacheFilename)) {
+    return false;
+  }
+  config.mConfig = JsonBinary::decode(document.get_root());
+  return true;
+}
+
+void ConfigReader::write_binary_cache(const String& configFilename, const Config& config) const {
+  Vector<uint8> encoded;
+  JsonBinary::encode(config.mConfig, encoded);
+
+  // The cache is optional, failing to write it is no error
+  FileStream file;
+  file.set_path(Path(get_binary_cache_filename(configFilename)));
+  file.set_access_mode(EFileMode::Write);
+  if (file.open()) {
+    file.write(encoded.data(), encoded.size());
+    file.close();
+  }
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
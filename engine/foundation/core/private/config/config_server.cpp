@@ -38,7 +38,8 @@ namespace core {
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 ConfigServer::ConfigServer()
-: mConfig(nullptr) {
+: mConfig(nullptr)
+, mUseBinaryCache(false) {
 }
 
 ConfigServer::~ConfigServer() {
@@ -52,7 +53,7 @@ bool ConfigServer::read(const String& configFilename) {
 
   mConfig = new Config();
 
-  if (ConfigReader reader; reader.read(configFilename, *mConfig)) {
+  if (ConfigReader reader; reader.read(configFilename, *mConfig, mUseBinaryCache)) {
     return true;
   }
 
@@ -60,6 +61,14 @@ bool ConfigServer::read(const String& configFilename) {
   return false;
 }
 
+void ConfigServer::set_use_binary_cache(bool useBinaryCache) {
+  mUseBinaryCache = useBinaryCache;
+}
+
+bool ConfigServer::get_use_binary_cache() const {
+  return mUseBinaryCache;
+}
+
 bool ConfigServer::write(const String& configFilename) const {
   if (mConfig != nullptr) {
 
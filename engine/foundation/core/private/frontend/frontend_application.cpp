@@ -27,6 +27,8 @@
 #include "core/frontend/cursor_device.h"
 #include "core/frontend/display_device.h"
 #include "core/frontend/window_device.h"
+#include "core/profiling/metrics.h"
+#include "core/profiling/telemetry_server.h"
 
 
 //[-------------------------------------------------------]
@@ -78,8 +80,20 @@ void FrontendApplication::on_draw() {
 }
 
 void FrontendApplication::on_update() {
+  BE_TELEMETRY_ZONE("FrontendApplication::on_update")
+
   // Update the window system here
   mFrontend->get_window_device()->update();
+
+  // Take the per-frame snapshot of all runtime metrics and stream it to attached viewers
+  Metrics& metrics = Metrics::instance();
+  metrics.snapshot();
+  // There's no frame while the metrics history is disabled (history size 0)
+  TelemetryServer& telemetryServer = TelemetryServer::instance();
+  const MetricsFrame* frame = metrics.get_frame();
+  if (nullptr != frame && telemetryServer.has_clients()) {
+    telemetryServer.publish_metrics(*frame);
+  }
 }
 
 void FrontendApplication::on_drop(const Vector<String> &lstFiles) {
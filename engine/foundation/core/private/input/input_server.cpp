@@ -31,6 +31,8 @@
 #endif
 #include "core/platform/mutex.h"
 #include "core/threading/lock_guard.h"
+#include "core/memory/no_alloc_scope.h"
+#include "core/profiling/startup_tracer.h"
 
 
 //[-------------------------------------------------------]
@@ -46,6 +48,8 @@ InputServer &InputServer::instance() {
 
 InputServer::InputServer()
 : mMutex(new Mutex()) {
+  BE_STARTUP_SCOPE("InputServer::detect_devices")
+
   // We are starting, let's see if we can find any device
   detect_devices();
 }
@@ -60,21 +64,25 @@ InputServer::~InputServer() {
 
 void InputServer::update() {
   // Update all controls
-  Vector<Control*> updatedControls;
   {
     LockGuard<Mutex> mutexLock(*mMutex);
 
-    // Copy list of controls that have changed
-    updatedControls = mUpdatedControls;
+    // Copy list of controls that have changed, the list is reused so this only allocates when it has to grow
+    mInformedControls.clear();
+    for (sizeT i = 0; i < mUpdatedControls.size(); ++i) {
+      mInformedControls.push_back(mUpdatedControls[i]);
+    }
 
     // Clear list
     mUpdatedControls.clear();
   }
 
+  BE_ASSERT_NO_ALLOC("InputServer::update")
+
   // Now inform controllers
-  for (sizeT i = 0; i < updatedControls.size(); ++i) {
+  for (sizeT i = 0; i < mInformedControls.size(); ++i) {
     // Inform controller
-    Control* control = updatedControls[i];
+    Control* control = mInformedControls[i];
     control->get_controller().inform_control(control);
   }
 
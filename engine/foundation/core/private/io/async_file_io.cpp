@@ -0,0 +1,502 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/async_file_io.h"
+#include "core/profiling/metrics.h"
+#include "core/threading/lock_guard.h"
+#include "core/threading/thread.h"
+#include "core/log/log.h"
+#if defined(LINUX)
+#include "core/linux/linux_io_uring.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Maximum number of bytes of a single read system call, larger reads are split */
+static constexpr uint64 MaxChunkSize = 1024 * 1024 * 1024;
+/** Number of failed io_uring submissions in a row after which the unsubmitted reads are failed */
+static constexpr uint32 MaxSubmitRetries = 5;
+/** Upper bound of the wait between failed io_uring submissions, in milliseconds */
+static constexpr uint64 MaxSubmitBackoff = 100;
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+EAsyncIoStatus AsyncFileRead::wait() {
+  AsyncFileIo::instance().wait(*this);
+  return get_status();
+}
+
+bool AsyncFileRead::cancel() {
+  return AsyncFileIo::instance().cancel(*this);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+AsyncFileRead::AsyncFileRead(const AsyncReadRequest& request)
+: mRequest(request)
+, mStatus(EAsyncIoStatus::Pending)
+, mNumberOfReadBytes(0)
+, mError(0)
+, mFileDescriptor(-1)
+, mIsFinished(false) {
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+AsyncFileIo& AsyncFileIo::instance() {
+  static AsyncFileIo SInstance;
+  return SInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+bool AsyncFileIo::start(EAsyncIoBackend backend, uint32 numberOfThreads) {
+  // Held while starting, so concurrent first users can't start twice
+  LockGuard<Mutex> lock(mMutex);
+  if (is_running() || EAsyncIoBackend::None == backend) {
+    return false;
+  }
+
+#if defined(LINUX)
+  if (EAsyncIoBackend::IoUring == backend) {
+    mRing = new LinuxIoUring();
+    if (mRing->initialize(QueueDepth)) {
+      mBackend = EAsyncIoBackend::IoUring;
+      numberOfThreads = 1;
+    } else {
+      BE_LOG(Info, "io_uring is unavailable, falling back to thread pool file reads")
+      delete mRing;
+      mRing = nullptr;
+      backend = EAsyncIoBackend::ThreadPool;
+    }
+  }
+  if (EAsyncIoBackend::ThreadPool == backend) {
+    mBackend = EAsyncIoBackend::ThreadPool;
+    numberOfThreads = (numberOfThreads > 0) ? numberOfThreads : 1;
+  }
+  mRunning.store(true);
+
+  for (uint32 i = 0; i < numberOfThreads; ++i) {
+    Thread* thread = (EAsyncIoBackend::IoUring == mBackend) ? new Thread(&AsyncFileIo::run_ring_thread, this) : new Thread(&AsyncFileIo::run_worker_thread, this);
+    thread->set_name("AsyncFileIo");
+    thread->start();
+    mThreads.push_back(thread);
+  }
+  return true;
+#else
+  BE_LOG(Error, "Asynchronous file reads are not supported on this platform")
+  return false;
+#endif
+}
+
+void AsyncFileIo::stop() {
+  if (!is_running()) {
+    return;
+  }
+
+  // Take all reads which haven't been started yet, the threads only finish what's in flight
+  Vector<AsyncFileRead*> cancelledReads;
+  {
+    LockGuard<Mutex> lock(mMutex);
+    mRunning.store(false);
+    while (AsyncFileRead* read = pop_pending()) {
+      cancelledReads.push_back(read);
+    }
+    mWorkCondition.wake_all();
+  }
+  for (AsyncFileRead* read : cancelledReads) {
+    finish(*read, EAsyncIoStatus::Cancelled);
+    read->release();
+  }
+
+  for (Thread* thread : mThreads) {
+    thread->join();
+    delete thread;
+  }
+  mThreads.clear();
+
+#if defined(LINUX)
+  delete mRing;
+  mRing = nullptr;
+#endif
+  mBackend = EAsyncIoBackend::None;
+}
+
+Ptr<AsyncFileRead> AsyncFileIo::read(const AsyncReadRequest& request) {
+  Ptr<AsyncFileRead> read(new AsyncFileRead(request));
+  {
+    LockGuard<Mutex> lock(mMutex);
+    enqueue(*read);
+  }
+  mWorkCondition.wake_one();
+  return read;
+}
+
+void AsyncFileIo::read(const AsyncReadRequest* requests, uint32 numberOfRequests, Vector<Ptr<AsyncFileRead>>& reads) {
+  reads.reserve(reads.size() + numberOfRequests);
+  {
+    LockGuard<Mutex> lock(mMutex);
+    for (uint32 i = 0; i < numberOfRequests; ++i) {
+      Ptr<AsyncFileRead> read(new AsyncFileRead(requests[i]));
+      enqueue(*read);
+      reads.push_back(read);
+    }
+  }
+  mWorkCondition.wake_all();
+}
+
+Ptr<AsyncFileRead> AsyncFileIo::fail(const AsyncReadRequest& request, int32 error) {
+  Ptr<AsyncFileRead> read(new AsyncFileRead(request));
+  read->mError = error;
+  {
+    // Counted as outstanding, so "finish()" and "wait_all()" treat it like any other read
+    LockGuard<Mutex> lock(mMutex);
+    read->mStatus.store(EAsyncIoStatus::InFlight, std::memory_order_release);
+    ++mNumOutstanding;
+  }
+  finish(*read, EAsyncIoStatus::Failed);
+  return read;
+}
+
+bool AsyncFileIo::cancel(AsyncFileRead& read) {
+  {
+    // Threads only move reads out of the pending state while holding the lock, the read stays
+    // in its queue and is skipped there
+    LockGuard<Mutex> lock(mMutex);
+    if (EAsyncIoStatus::Pending != read.get_status()) {
+      return false;
+    }
+    read.mStatus.store(EAsyncIoStatus::InFlight, std::memory_order_release);
+  }
+  finish(read, EAsyncIoStatus::Cancelled);
+  return true;
+}
+
+void AsyncFileIo::wait(AsyncFileRead& read) {
+  LockGuard<Mutex> lock(mMutex);
+  while (!read.mIsFinished) {
+    mDoneCondition.wait(mMutex);
+  }
+}
+
+void AsyncFileIo::wait_all() {
+  LockGuard<Mutex> lock(mMutex);
+  while (mNumOutstanding > 0) {
+    mDoneCondition.wait(mMutex);
+  }
+}
+
+uint32 AsyncFileIo::get_num_outstanding() const {
+  LockGuard<Mutex> lock(mMutex);
+  return mNumOutstanding;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+AsyncFileIo::AsyncFileIo()
+: mRunning(false)
+, mBackend(EAsyncIoBackend::None)
+, mNumOutstanding(0)
+, mRing(nullptr) {
+
+}
+
+AsyncFileIo::~AsyncFileIo() {
+  stop();
+}
+
+void AsyncFileIo::enqueue(AsyncFileRead& read) {
+  BE_ASSERT(is_running(), "The asynchronous file I/O has not been started")
+  BE_ASSERT(read.mRequest.priority < EAsyncIoPriority::Count, "Invalid priority")
+
+  // The queue keeps its own reference until the read is done
+  read.add_ref();
+  mPending[static_cast<uint32>(read.mRequest.priority)].reads.push_back(&read);
+  ++mNumOutstanding;
+}
+
+bool AsyncFileIo::has_pending() const {
+  for (const PendingQueue& queue : mPending) {
+    if (queue.head < queue.reads.size()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+AsyncFileRead* AsyncFileIo::pop_pending() {
+  for (uint32 priority = static_cast<uint32>(EAsyncIoPriority::Count); priority > 0; --priority) {
+    PendingQueue& queue = mPending[priority - 1];
+    while (queue.head < queue.reads.size()) {
+      AsyncFileRead* read = queue.reads[queue.head++];
+      if (queue.head == queue.reads.size()) {
+        queue.reads.clear();
+        queue.head = 0;
+      }
+
+      if (EAsyncIoStatus::Pending == read->get_status()) {
+        read->mStatus.store(EAsyncIoStatus::InFlight, std::memory_order_release);
+        return read;
+      }
+
+      // Cancelled while it was queued, only the reference of the queue is left to drop
+      read->release();
+    }
+  }
+  return nullptr;
+}
+
+void AsyncFileIo::finish(AsyncFileRead& read, EAsyncIoStatus status) {
+  if (EAsyncIoStatus::Completed == status) {
+    BE_METRICS_INCREMENT("io.bytes_read", static_cast<int64>(read.mNumberOfReadBytes))
+  }
+
+  // The callback sees the final status, waiters are only woken up after it returned
+  read.mStatus.store(status, std::memory_order_release);
+  if (read.mRequest.callback) {
+    read.mRequest.callback(read);
+  }
+
+  LockGuard<Mutex> lock(mMutex);
+  read.mIsFinished = true;
+  --mNumOutstanding;
+  mDoneCondition.wake_all();
+}
+
+void AsyncFileIo::execute_read(AsyncFileRead& read) {
+#if defined(LINUX)
+  const int fileDescriptor = ::open(read.mRequest.filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fileDescriptor < 0) {
+    read.mError = errno;
+    return;
+  }
+
+  uint8* buffer = static_cast<uint8*>(read.mRequest.buffer);
+  while (read.mNumberOfReadBytes < read.mRequest.numberOfBytes) {
+    const uint64 remaining = read.mRequest.numberOfBytes - read.mNumberOfReadBytes;
+    const ssize_t result = ::pread(fileDescriptor, buffer + read.mNumberOfReadBytes, static_cast<size_t>(remaining < MaxChunkSize ? remaining : MaxChunkSize),
+                                   static_cast<off_t>(read.mRequest.offset + read.mNumberOfReadBytes));
+    if (result < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      read.mError = errno;
+      break;
+    }
+    if (0 == result) {
+      // End of file
+      break;
+    }
+    read.mNumberOfReadBytes += static_cast<uint64>(result);
+  }
+  ::close(fileDescriptor);
+#endif
+}
+
+int AsyncFileIo::run_worker_thread(void* data) {
+  static_cast<AsyncFileIo*>(data)->run_worker();
+  return 0;
+}
+
+void AsyncFileIo::run_worker() {
+  for (;;) {
+    AsyncFileRead* read = nullptr;
+    {
+      LockGuard<Mutex> lock(mMutex);
+      while (is_running() && nullptr == (read = pop_pending())) {
+        mWorkCondition.wait(mMutex);
+      }
+    }
+    if (nullptr == read) {
+      // Stopped
+      break;
+    }
+
+    execute_read(*read);
+    finish(*read, (0 == read->mError) ? EAsyncIoStatus::Completed : EAsyncIoStatus::Failed);
+    read->release();
+  }
+}
+
+int AsyncFileIo::run_ring_thread(void* data) {
+  static_cast<AsyncFileIo*>(data)->run_ring();
+  return 0;
+}
+
+void AsyncFileIo::run_ring() {
+#if defined(LINUX)
+  Vector<AsyncFileRead*> startedReads;
+  uint32 numInFlight = 0;
+  uint32 numSubmitErrors = 0;
+  for (;;) {
+    // Top up the ring, while reads are in flight new ones are picked up with each completion
+    startedReads.clear();
+    {
+      LockGuard<Mutex> lock(mMutex);
+      while (is_running() && 0 == numInFlight && !has_pending()) {
+        mWorkCondition.wait(mMutex);
+      }
+      if (!is_running() && 0 == numInFlight) {
+        break;
+      }
+      while (is_running() && numInFlight + startedReads.size() < mRing->get_num_entries()) {
+        AsyncFileRead* read = pop_pending();
+        if (nullptr == read) {
+          break;
+        }
+        startedReads.push_back(read);
+      }
+    }
+
+    // Opening is synchronous, the reads themselves are batched into the ring
+    for (AsyncFileRead* read : startedReads) {
+      if (0 == read->mRequest.numberOfBytes) {
+        finish(*read, EAsyncIoStatus::Completed);
+        read->release();
+      } else if (start_ring_read(*read)) {
+        ++numInFlight;
+      } else {
+        close_file(*read);
+        finish(*read, EAsyncIoStatus::Failed);
+        read->release();
+      }
+    }
+    if (0 == numInFlight) {
+      continue;
+    }
+
+    const int32 result = mRing->submit(1);
+    if (result >= 0) {
+      numSubmitErrors = 0;
+    } else {
+      // A failed submission returns right away, wait a little longer each time instead of spinning;
+      // stop() still wakes this thread up
+      ++numSubmitErrors;
+      {
+        const uint64 backoff = (numSubmitErrors < 7) ? (static_cast<uint64>(1) << numSubmitErrors) : MaxSubmitBackoff;
+        LockGuard<Mutex> lock(mMutex);
+        if (is_running()) {
+          mWorkCondition.wait(mMutex, backoff);
+        }
+      }
+
+      // Busy and out of memory resolve once reads in flight complete, anything else most likely won't,
+      // so the reads the kernel never got are failed instead of being retried forever
+      if (-EBUSY != result && -EAGAIN != result && numSubmitErrors >= MaxSubmitRetries) {
+        BE_LOG(Error, "io_uring submission keeps failing, failing the unsubmitted reads")
+        uint64 userData = 0;
+        while (mRing->pop_unsubmitted(userData)) {
+          AsyncFileRead& read = *reinterpret_cast<AsyncFileRead*>(userData);
+          read.mError = -result;
+          close_file(read);
+          --numInFlight;
+          finish(read, EAsyncIoStatus::Failed);
+          read.release();
+        }
+      }
+    }
+
+    uint64 userData = 0;
+    int32 numberOfBytes = 0;
+    while (mRing->pop_completion(userData, numberOfBytes)) {
+      AsyncFileRead& read = *reinterpret_cast<AsyncFileRead*>(userData);
+      if (numberOfBytes > 0) {
+        read.mNumberOfReadBytes += static_cast<uint64>(numberOfBytes);
+      } else if (numberOfBytes < 0 && -EINTR != numberOfBytes && -EAGAIN != numberOfBytes) {
+        read.mError = -numberOfBytes;
+      }
+
+      // Short reads before the end of the file are continued, a read of zero bytes is the end
+      const bool continueRead = (0 == read.mError && 0 != numberOfBytes && read.mNumberOfReadBytes < read.mRequest.numberOfBytes);
+      if (!continueRead || !start_ring_read(read)) {
+        close_file(read);
+        --numInFlight;
+        finish(read, (0 == read.mError) ? EAsyncIoStatus::Completed : EAsyncIoStatus::Failed);
+        read.release();
+      }
+    }
+  }
+#endif
+}
+
+bool AsyncFileIo::start_ring_read(AsyncFileRead& read) {
+#if defined(LINUX)
+  if (read.mFileDescriptor < 0) {
+    read.mFileDescriptor = ::open(read.mRequest.filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (read.mFileDescriptor < 0) {
+      read.mError = errno;
+      return false;
+    }
+  }
+
+  // The number of reads in flight never exceeds the ring size, so this only fails on misuse
+  const uint64 remaining = read.mRequest.numberOfBytes - read.mNumberOfReadBytes;
+  if (!mRing->prepare_read(read.mFileDescriptor, static_cast<uint8*>(read.mRequest.buffer) + read.mNumberOfReadBytes,
+                           static_cast<uint32>(remaining < MaxChunkSize ? remaining : MaxChunkSize), read.mRequest.offset + read.mNumberOfReadBytes,
+                           reinterpret_cast<uint64>(&read))) {
+    read.mError = EBUSY;
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void AsyncFileIo::close_file(AsyncFileRead& read) {
+#if defined(LINUX)
+  if (read.mFileDescriptor >= 0) {
+    ::close(read.mFileDescriptor);
+    read.mFileDescriptor = -1;
+  }
+#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -24,6 +24,9 @@
 //[-------------------------------------------------------]
 #include "core/io/binary_reader.h"
 #include "core/io/stream.h"
+#include "core/memory/memory.h"
+#include "core/utility/byte_swap.h"
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -38,8 +41,10 @@ namespace core {
 BinaryReader::BinaryReader()
 : mMapCursor(nullptr)
 , mMapEnd(nullptr)
+, mByteOrder(EByteOrder::Native)
 , mEnableMapping(false)
-, mIsMapped(false) {
+, mIsMapped(false)
+, mHasError(false) {
 }
 
 BinaryReader::~BinaryReader() {
@@ -48,14 +53,179 @@ BinaryReader::~BinaryReader() {
   }
 }
 
+void BinaryReader::set_memory_mapping_enabled(bool enable) {
+  BE_ASSERT(!is_open(), "The memory mapping can't be changed while the reader is open")
+  mEnableMapping = enable;
+}
+
+bool BinaryReader::is_memory_mapping_enabled() const {
+  return mEnableMapping;
+}
+
+bool BinaryReader::is_mapped() const {
+  return mIsMapped;
+}
+
+void BinaryReader::set_byte_order(EByteOrder byteOrder) {
+  mByteOrder = byteOrder;
+}
+
+EByteOrder BinaryReader::get_byte_order() const {
+  return mByteOrder;
+}
+
+bool BinaryReader::has_error() const {
+  return mHasError;
+}
+
 bool BinaryReader::open() {
-  return StreamReader::open();
+  if (StreamReader::open()) {
+    mIsMapped = false;
+    mHasError = false;
+    mMapCursor = nullptr;
+    mMapEnd = nullptr;
+    if (mEnableMapping && mStream->can_be_mapped() && !mStream->is_mapped()) {
+      unsigned char* data = static_cast<unsigned char*>(mStream->map());
+      if (data) {
+        mIsMapped = true;
+        mMapCursor = data + mStream->get_position();
+        mMapEnd = data + mStream->get_size();
+      }
+    }
+    // Done
+    return true;
+  }
+  // Done
+  return false;
 }
 
 void BinaryReader::close() {
+  if (mIsMapped) {
+    // Leave the stream positioned behind the consumed data, as if it had been read through it
+    mStream->seek(mStream->get_size() - static_cast<sizeT>(mMapEnd - mMapCursor), EFileSeek::Set);
+    mStream->unmap();
+  }
   StreamReader::close();
+  mIsMapped = false;
+  mMapCursor = nullptr;
+  mMapEnd = nullptr;
+}
+
+
+uint64 BinaryReader::read_bytes(void* buffer, uint64 numberOfBytes) {
+  return read_values(buffer, numberOfBytes, 1, false);
+}
+
+const void* BinaryReader::map_bytes(uint64 numberOfBytes) {
+  if (!mIsMapped) {
+    return nullptr;
+  }
+  if (static_cast<uint64>(mMapEnd - mMapCursor) < numberOfBytes) {
+    mHasError = true;
+    mMapCursor = mMapEnd;
+    return nullptr;
+  }
+  const void* data = mMapCursor;
+  mMapCursor += numberOfBytes;
+  return data;
 }
 
+bool BinaryReader::skip(uint64 numberOfBytes) {
+  const uint64 numberOfLeftBytes = mIsMapped ? static_cast<uint64>(mMapEnd - mMapCursor) : static_cast<uint64>(mStream->get_size() - mStream->get_position());
+  const uint64 numberOfSkippedBytes = (numberOfBytes < numberOfLeftBytes) ? numberOfBytes : numberOfLeftBytes;
+  if (mIsMapped) {
+    mMapCursor += numberOfSkippedBytes;
+  } else {
+    mStream->seek(static_cast<sizeT>(numberOfSkippedBytes), EFileSeek::Current);
+  }
+  if (numberOfSkippedBytes < numberOfBytes) {
+    mHasError = true;
+    return false;
+  }
+  return true;
+}
+
+uint64 BinaryReader::read_varuint() {
+  // Little endian groups of 7 bits, the top bit of a byte tells whether another one follows
+  uint64 value = 0;
+  for (uint32 shift = 0; shift < 64; shift += 7) {
+    uint8 byte = 0;
+    if (mIsMapped) {
+      if (mMapCursor == mMapEnd) {
+        break;
+      }
+      byte = *mMapCursor++;
+    } else if (1 != mStream->read(&byte, 1)) {
+      break;
+    }
+    value |= static_cast<uint64>(byte & 0x7f) << shift;
+    if (0 == (byte & 0x80)) {
+      // The tenth byte may only hold the topmost bit
+      if (63 == shift && byte > 1) {
+        break;
+      }
+      return value;
+    }
+  }
+
+  // Truncated or overlong
+  mHasError = true;
+  return 0;
+}
+
+int64 BinaryReader::read_varint() {
+  const uint64 value = read_varuint();
+  return static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+}
+
+
+char BinaryReader::read_char() {
+  return read<char>();
+}
+
+short BinaryReader::read_short() {
+  return read<short>();
+}
+
+int BinaryReader::read_int() {
+  return read<int>();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+uint64 BinaryReader::read_values(void* values, uint64 numberOfValues, uint32 valueSize, bool swap) {
+  uint64 numberOfReadValues = 0;
+  if (mIsMapped) {
+    // Straight out of the mapping, converted on the fly
+    const uint64 numberOfLeftValues = static_cast<uint64>(mMapEnd - mMapCursor) / valueSize;
+    numberOfReadValues = (numberOfValues < numberOfLeftValues) ? numberOfValues : numberOfLeftValues;
+    if (swap) {
+      ByteSwap::copy_swapped(values, mMapCursor, numberOfReadValues, valueSize);
+    } else {
+      memcpy(values, mMapCursor, numberOfReadValues * valueSize);
+    }
+    mMapCursor += numberOfReadValues * valueSize;
+  } else {
+    numberOfReadValues = mStream->read(values, static_cast<sizeT>(numberOfValues * valueSize)) / valueSize;
+    if (swap) {
+      ByteSwap::swap_array(values, numberOfReadValues, valueSize);
+    }
+  }
+
+  // Reading past the end consumes the rest and leaves zeroed values behind
+  if (numberOfReadValues < numberOfValues) {
+    memset(static_cast<uint8*>(values) + numberOfReadValues * valueSize, 0, (numberOfValues - numberOfReadValues) * valueSize);
+    mHasError = true;
+    if (mIsMapped) {
+      mMapCursor = mMapEnd;
+    }
+  }
+  return numberOfReadValues;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -24,6 +24,8 @@
 //[-------------------------------------------------------]
 #include "core/io/binary_writer.h"
 #include "core/io/stream.h"
+#include "core/utility/byte_swap.h"
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -38,6 +40,7 @@ namespace core {
 BinaryWriter::BinaryWriter()
 : mMapCursor(nullptr)
 , mMapEnd(nullptr)
+, mByteOrder(EByteOrder::Native)
 , mEnableMapping(false)
 , mIsMapped(false) {
 
@@ -52,9 +55,10 @@ BinaryWriter::~BinaryWriter() {
 bool BinaryWriter::open() {
   if (StreamWriter::open()) {
     if (mEnableMapping && mStream->can_be_mapped()) {
-      mIsMapped = true;
-      mMapCursor = (unsigned char*)mStream->map();
-      mMapEnd = mMapCursor + mStream->get_size();
+      unsigned char* data = static_cast<unsigned char*>(mStream->map());
+      mIsMapped = (nullptr != data);
+      mMapCursor = data ? data + mStream->get_position() : nullptr;
+      mMapEnd = data ? data + mStream->get_size() : nullptr;
     } else {
       mIsMapped = false;
       mMapCursor = nullptr;
@@ -68,6 +72,10 @@ bool BinaryWriter::open() {
 }
 
 void BinaryWriter::close() {
+  if (mIsMapped) {
+    mStream->seek(mStream->get_size() - static_cast<sizeT>(mMapEnd - mMapCursor), EFileSeek::Set);
+    mStream->unmap();
+  }
   StreamWriter::close();
   mIsMapped = false;
   mMapCursor = nullptr;
@@ -75,33 +83,78 @@ void BinaryWriter::close() {
 }
 
 
-void BinaryWriter::write_char(char c) {
-  if (mIsMapped) {
-    BE_ASSERT(mMapCursor < mMapEnd, "BinaryWriter::write_char: map cursor out of bounds")
-    *mMapCursor++ = c;
-  } else {
-    mStream->write(&c, sizeof(c));
+void BinaryWriter::set_byte_order(EByteOrder byteOrder) {
+  mByteOrder = byteOrder;
+}
+
+EByteOrder BinaryWriter::get_byte_order() const {
+  return mByteOrder;
+}
+
+void BinaryWriter::write_bytes(const void* buffer, uint64 numberOfBytes) {
+  write_values(buffer, numberOfBytes, 1, false);
+}
+
+void BinaryWriter::write_varuint(uint64 value) {
+  uint8 buffer[10];
+  uint32 numberOfBytes = 0;
+  while (value >= 0x80) {
+    buffer[numberOfBytes++] = static_cast<uint8>(value | 0x80);
+    value >>= 7;
   }
+  buffer[numberOfBytes++] = static_cast<uint8>(value);
+  write_values(buffer, numberOfBytes, 1, false);
+}
+
+void BinaryWriter::write_varint(int64 value) {
+  // Zigzag: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+  write_varuint((static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63));
+}
+
+
+void BinaryWriter::write_char(char c) {
+  write<char>(c);
 }
 
 void BinaryWriter::write_short(short s) {
-  if (mIsMapped) {
-    BE_ASSERT(mMapCursor < mMapEnd, "BinaryWriter::write_char: map cursor out of bounds")
-    Memory::copy(mMapCursor, &s, sizeof(s));
-  } else {
-    mStream->write(&s, sizeof(s));
-  }
+  write<short>(s);
 }
 
 void BinaryWriter::write_int(int i) {
+  write<int>(i);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void BinaryWriter::write_values(const void* values, uint64 numberOfValues, uint32 valueSize, bool swap) {
   if (mIsMapped) {
-    BE_ASSERT(mMapCursor < mMapEnd, "BinaryWriter::write_char: map cursor out of bounds")
-    Memory::copy(mMapCursor, &i, sizeof(i));
+    BE_ASSERT(numberOfValues * valueSize <= static_cast<uint64>(mMapEnd - mMapCursor), "BinaryWriter::write_values: map cursor out of bounds")
+    const uint64 numberOfLeftValues = static_cast<uint64>(mMapEnd - mMapCursor) / valueSize;
+    const uint64 numberOfWrittenValues = (numberOfValues < numberOfLeftValues) ? numberOfValues : numberOfLeftValues;
+    if (swap) {
+      ByteSwap::copy_swapped(mMapCursor, values, numberOfWrittenValues, valueSize);
+    } else {
+      memcpy(mMapCursor, values, numberOfWrittenValues * valueSize);
+    }
+    mMapCursor += numberOfWrittenValues * valueSize;
+  } else if (swap) {
+    // Converted chunk by chunk, the data of the caller stays untouched
+    uint8 buffer[4096];
+    const uint64 numberOfChunkValues = sizeof(buffer) / valueSize;
+    const uint8* source = static_cast<const uint8*>(values);
+    for (uint64 i = 0; i < numberOfValues; i += numberOfChunkValues) {
+      const uint64 numberOfConvertedValues = (numberOfValues - i < numberOfChunkValues) ? numberOfValues - i : numberOfChunkValues;
+      ByteSwap::copy_swapped(buffer, source + i * valueSize, numberOfConvertedValues, valueSize);
+      mStream->write(buffer, static_cast<sizeT>(numberOfConvertedValues * valueSize));
+    }
   } else {
-    mStream->write(&i, sizeof(i));
+    mStream->write(values, static_cast<sizeT>(numberOfValues * valueSize));
   }
 }
 
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/chained_memory_stream.h"
+#include "core/memory/memory.h"
+#include "core/platform/mutex.h"
+#include "core/threading/lock_guard.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local classes                                         ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Process wide cache of free segments, so short lived streams don't hit the allocator.
+ */
+class ChainedMemorySegmentPool {
+public:
+  static ChainedMemorySegmentPool& instance() {
+    static ChainedMemorySegmentPool SInstance;
+    return SInstance;
+  }
+
+public:
+  ~ChainedMemorySegmentPool() {
+    for (uint8* segment : mFreeSegments) {
+      Memory::free(segment);
+    }
+  }
+
+  uint8* acquire() {
+    {
+      LockGuard<Mutex> lock(mMutex);
+      if (!mFreeSegments.empty()) {
+        return mFreeSegments.pop_back();
+      }
+    }
+    return static_cast<uint8*>(Memory::allocate(ChainedMemoryStream::SegmentSize));
+  }
+
+  void release(uint8* segment) {
+    {
+      LockGuard<Mutex> lock(mMutex);
+      if (mFreeSegments.size() < ChainedMemoryStream::MaxNumberOfPooledSegments) {
+        mFreeSegments.push_back(segment);
+        return;
+      }
+    }
+    Memory::free(segment);
+  }
+
+private:
+  Mutex mMutex;
+  Vector<uint8*> mFreeSegments;
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+ChainedMemoryStream::ChainedMemoryStream()
+: mSize(0)
+, mPosition(0)
+, mFlattened(nullptr) {
+
+}
+
+ChainedMemoryStream::~ChainedMemoryStream() {
+  if (is_open()) {
+    close();
+  }
+  clear();
+}
+
+void ChainedMemoryStream::write_to(Stream& stream) const {
+  // One buffer per segment, the content is never copied on the way
+  const uint32 numberOfSegments = get_num_segments();
+  Vector<IoBuffer> buffers;
+  buffers.reserve(numberOfSegments);
+  for (uint32 i = 0; i < numberOfSegments; ++i) {
+    sizeT numberOfBytes = 0;
+    const void* data = get_segment(i, numberOfBytes);
+    buffers.push_back(IoBuffer{data, numberOfBytes});
+  }
+  stream.write_vectored(buffers.data(), numberOfSegments);
+}
+
+void ChainedMemoryStream::clear() {
+  BE_ASSERT(!is_mapped(), "The chained memory stream is mapped")
+  ChainedMemorySegmentPool& pool = ChainedMemorySegmentPool::instance();
+  for (uint8* segment : mSegments) {
+    pool.release(segment);
+  }
+  mSegments.clear();
+  mSize = 0;
+  mPosition = 0;
+}
+
+bool ChainedMemoryStream::can_read() const {
+  return true;
+}
+
+bool ChainedMemoryStream::can_write() const {
+  return true;
+}
+
+bool ChainedMemoryStream::can_seek() const {
+  return true;
+}
+
+bool ChainedMemoryStream::can_be_mapped() const {
+  return true;
+}
+
+sizeT ChainedMemoryStream::get_size() const {
+  return mSize;
+}
+
+sizeT ChainedMemoryStream::get_position() const {
+  return mPosition;
+}
+
+bool ChainedMemoryStream::open() {
+  BE_ASSERT(!is_open(), "Chained memory stream already open")
+
+  if (Stream::open()) {
+    mPosition = (EFileMode::Append == mFileAccessMode) ? mSize : 0;
+    return true;
+  }
+  return false;
+}
+
+void ChainedMemoryStream::close() {
+  BE_ASSERT(is_open(), "No need to close, was never opened")
+
+  if (is_mapped()) {
+    unmap();
+  }
+  Stream::close();
+}
+
+void ChainedMemoryStream::write(const void* ptr, sizeT numBytes) {
+  // Sanity check
+  BE_ASSERT(is_open(), "No need to write, was never opened")
+  BE_ASSERT(!is_mapped(), "Chained memory stream is mapped")
+  BE_ASSERT(EFileMode::Read != mFileAccessMode, "Chained memory stream isn't opened for writing")
+
+  const uint8* source = static_cast<const uint8*>(ptr);
+  while (numBytes > 0) {
+    const sizeT segmentIndex = mPosition / SegmentSize;
+    if (segmentIndex == mSegments.size()) {
+      mSegments.push_back(ChainedMemorySegmentPool::instance().acquire());
+    }
+    const sizeT segmentOffset = mPosition % SegmentSize;
+    const sizeT numberOfBytes = (numBytes < SegmentSize - segmentOffset) ? numBytes : SegmentSize - segmentOffset;
+    memcpy(mSegments[static_cast<uint32>(segmentIndex)] + segmentOffset, source, numberOfBytes);
+    source += numberOfBytes;
+    numBytes -= numberOfBytes;
+    mPosition += numberOfBytes;
+  }
+  if (mPosition > mSize) {
+    mSize = mPosition;
+  }
+}
+
+sizeT ChainedMemoryStream::read(void* ptr, sizeT numBytes) {
+  // Sanity check
+  BE_ASSERT(is_open(), "No need to read, was never opened")
+
+  uint8* destination = static_cast<uint8*>(ptr);
+  const sizeT numberOfReadBytes = (numBytes < mSize - mPosition) ? numBytes : mSize - mPosition;
+  sizeT numberOfLeftBytes = numberOfReadBytes;
+  while (numberOfLeftBytes > 0) {
+    const sizeT segmentOffset = mPosition % SegmentSize;
+    const sizeT numberOfBytes = (numberOfLeftBytes < SegmentSize - segmentOffset) ? numberOfLeftBytes : SegmentSize - segmentOffset;
+    memcpy(destination, mSegments[static_cast<uint32>(mPosition / SegmentSize)] + segmentOffset, numberOfBytes);
+    destination += numberOfBytes;
+    numberOfLeftBytes -= numberOfBytes;
+    mPosition += numberOfBytes;
+  }
+  return numberOfReadBytes;
+}
+
+void ChainedMemoryStream::seek(sizeT offset, EFileSeek seek) {
+  // Relative offsets are passed as two's complement, the result is clamped into the content
+  int64 position = 0;
+  switch (seek) {
+    case EFileSeek::Set:
+      position = static_cast<int64>(offset);
+      break;
+
+    case EFileSeek::Current:
+      position = static_cast<int64>(mPosition) + static_cast<int64>(offset);
+      break;
+
+    case EFileSeek::End:
+      position = static_cast<int64>(mSize) + static_cast<int64>(offset);
+      break;
+  }
+  mPosition = (position < 0) ? 0 : ((static_cast<sizeT>(position) > mSize) ? mSize : static_cast<sizeT>(position));
+}
+
+bool ChainedMemoryStream::eof() const {
+  return (mPosition == mSize);
+}
+
+String ChainedMemoryStream::get_content_as_string() {
+  String content;
+  content.resize(mSize);
+  for (uint32 i = 0; i < get_num_segments(); ++i) {
+    sizeT numberOfBytes = 0;
+    const void* data = get_segment(i, numberOfBytes);
+    memcpy(&content[static_cast<sizeT>(i) * SegmentSize], data, numberOfBytes);
+  }
+  return content;
+}
+
+void* ChainedMemoryStream::map() {
+  BE_ASSERT(!is_mapped(), "Chained memory stream already mapped")
+
+  mIsMapped = true;
+  if (mSegments.size() <= 1) {
+    return mSegments.empty() ? nullptr : mSegments[0];
+  }
+
+  // Flattened only now and only once, writes are refused while mapped
+  mFlattened = static_cast<uint8*>(Memory::allocate(mSize));
+  for (uint32 i = 0; i < get_num_segments(); ++i) {
+    sizeT numberOfBytes = 0;
+    const void* data = get_segment(i, numberOfBytes);
+    memcpy(mFlattened + static_cast<sizeT>(i) * SegmentSize, data, numberOfBytes);
+  }
+  return mFlattened;
+}
+
+void ChainedMemoryStream::unmap() {
+  if (mFlattened) {
+    Memory::free(mFlattened);
+    mFlattened = nullptr;
+  }
+  mIsMapped = false;
+}
+
+void* ChainedMemoryStream::memory_map() {
+  return map();
+}
+
+void ChainedMemoryStream::memory_unmap() {
+  unmap();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,570 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/chunked_compressed_stream.h"
+#include "core/memory/memory.h"
+#include "core/log/log.h"
+#include "core/platform/platform.h"
+#include "core/threading/lock_guard.h"
+#include "core/threading/thread.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+ChunkedCompressedStream::ChunkedCompressedStream()
+: mCompression(nullptr)
+, mCodec(ECompressionCodec::LZ4)
+, mLevel(0)
+, mBlockSize(DefaultBlockSize)
+, mNumberOfThreads(0)
+, mSize(0)
+, mPosition(0)
+, mCompressedCapacity(0)
+, mCache(nullptr)
+, mCachedBlock(0)
+, mScratch(nullptr)
+, mBatch(nullptr)
+, mBatchFill(0)
+, mBatchCompressed(nullptr)
+, mFileOffset(0)
+, mWriteFailed(false)
+, mJob(nullptr)
+, mJobGeneration(0)
+, mNumBusyWorkers(0)
+, mStopWorkers(false) {
+}
+
+ChunkedCompressedStream::~ChunkedCompressedStream() {
+  if (is_open()) {
+    close();
+  }
+}
+
+void ChunkedCompressedStream::set_codec(ECompressionCodec codec, int32 level) {
+  BE_ASSERT(!is_open(), "The codec can't be changed while the stream is open")
+  mCodec = codec;
+  mLevel = level;
+}
+
+void ChunkedCompressedStream::set_block_size(uint32 blockSize) {
+  BE_ASSERT(!is_open(), "The block size can't be changed while the stream is open")
+  mBlockSize = (blockSize < MinBlockSize) ? MinBlockSize : ((blockSize > MaxBlockSize) ? MaxBlockSize : blockSize);
+}
+
+void ChunkedCompressedStream::set_number_of_threads(uint32 numberOfThreads) {
+  BE_ASSERT(!is_open(), "The number of threads can't be changed while the stream is open")
+  mNumberOfThreads = numberOfThreads;
+}
+
+bool ChunkedCompressedStream::can_read() const {
+  return true;
+}
+
+bool ChunkedCompressedStream::can_write() const {
+  return true;
+}
+
+bool ChunkedCompressedStream::can_seek() const {
+  return (EFileMode::Read == mFileAccessMode);
+}
+
+bool ChunkedCompressedStream::can_be_mapped() const {
+  return false;
+}
+
+sizeT ChunkedCompressedStream::get_size() const {
+  return mSize;
+}
+
+sizeT ChunkedCompressedStream::get_position() const {
+  return mPosition;
+}
+
+bool ChunkedCompressedStream::open() {
+  BE_ASSERT(!is_open(), "There is already an opened file")
+
+  if (0 == mNumberOfThreads) {
+    mNumberOfThreads = Platform::instance().get_cpu_info().LogicalProcessorCount;
+    if (0 == mNumberOfThreads) {
+      mNumberOfThreads = 1;
+    }
+  }
+
+  bool result = false;
+  if (EFileMode::Read == mFileAccessMode) {
+    result = open_for_reading();
+  } else if (EFileMode::Write == mFileAccessMode) {
+    result = open_for_writing();
+  }
+  if (!result) {
+    if (mCompression) {
+      delete mCompression;
+      mCompression = nullptr;
+    }
+    mBlocks.clear();
+    mFile.close();
+    return false;
+  }
+
+  return Stream::open();
+}
+
+void ChunkedCompressedStream::close() {
+  BE_ASSERT(is_open(), "There is no file opened")
+
+  if (EFileMode::Write == mFileAccessMode) {
+    // Remaining blocks, block index and finally the header, which makes the file valid
+    write_batch();
+  }
+  stop_workers();
+
+  if (EFileMode::Write == mFileAccessMode && !mWriteFailed) {
+    ChunkedCompressedHeader header;
+    Memory::set(&header, 0, sizeof(ChunkedCompressedHeader));
+    header.magic = Magic;
+    header.version = Version;
+    header.codec = static_cast<uint8>(mCodec);
+    header.blockSize = mBlockSize;
+    header.numberOfBlocks = static_cast<uint32>(mBlocks.size());
+    header.size = mSize;
+    header.indexOffset = mFileOffset;
+
+    // Blocks went through the buffered file, get them out before writing positionally; without the
+    // complete index the header stays a placeholder
+    const uint64 indexSize = mBlocks.size() * sizeof(ChunkedCompressedBlock);
+    if (!mFile.flush() || (indexSize > 0 && mFile.write_at(mFileOffset, mBlocks.data(), indexSize) != indexSize) ||
+        mFile.write_at(0, &header, sizeof(ChunkedCompressedHeader)) != sizeof(ChunkedCompressedHeader)) {
+      mWriteFailed = true;
+    }
+  }
+  if (mWriteFailed) {
+    BE_LOG(Error, "Failed to write the chunked compressed file '" + mPath.get_native_path() + "'")
+  }
+  mFile.close();
+
+  delete mCompression;
+  mCompression = nullptr;
+  Memory::free(mCache);
+  mCache = nullptr;
+  Memory::free(mScratch);
+  mScratch = nullptr;
+  Memory::free(mBatch);
+  mBatch = nullptr;
+  Memory::free(mBatchCompressed);
+  mBatchCompressed = nullptr;
+  mBatchCompressedSizes.clear();
+  mBatchFill = 0;
+  mBlocks.clear();
+  mSize = 0;
+  mPosition = 0;
+  mFileOffset = 0;
+
+  Stream::close();
+}
+
+void ChunkedCompressedStream::write(const void* ptr, sizeT numBytes) {
+  BE_ASSERT(is_open(), "There is no file opened")
+  BE_ASSERT(EFileMode::Write == mFileAccessMode, "The stream wasn't opened for writing")
+
+  if (mWriteFailed) {
+    return;
+  }
+
+  const sizeT batchCapacity = static_cast<sizeT>(mBlockSize) * mNumberOfThreads;
+  const uint8* source = static_cast<const uint8*>(ptr);
+  while (numBytes > 0) {
+    const sizeT numberOfCopiedBytes = (numBytes < batchCapacity - mBatchFill) ? numBytes : batchCapacity - mBatchFill;
+    Memory::copy(mBatch + mBatchFill, source, numberOfCopiedBytes);
+    mBatchFill += numberOfCopiedBytes;
+    mSize += numberOfCopiedBytes;
+    source += numberOfCopiedBytes;
+    numBytes -= numberOfCopiedBytes;
+    if (mBatchFill == batchCapacity) {
+      write_batch();
+    }
+  }
+  mPosition = mSize;
+}
+
+sizeT ChunkedCompressedStream::read(void* ptr, sizeT numBytes) {
+  BE_ASSERT(is_open(), "There is no file opened")
+  BE_ASSERT(EFileMode::Read == mFileAccessMode, "The stream wasn't opened for reading")
+
+  uint8* destination = static_cast<uint8*>(ptr);
+  sizeT remaining = (numBytes <= mSize - mPosition) ? numBytes : mSize - mPosition;
+  sizeT numberOfReadBytes = 0;
+  while (remaining > 0) {
+    const uint32 block = static_cast<uint32>(mPosition / mBlockSize);
+    const sizeT offsetInBlock = mPosition % mBlockSize;
+
+    // Blocks covered completely are decompressed in parallel straight into the destination
+    const sizeT end = mPosition + remaining;
+    const uint32 endBlock = (end == mSize) ? get_number_of_blocks() : static_cast<uint32>(end / mBlockSize);
+    if (0 == offsetInBlock && endBlock > block && !(endBlock - block == 1 && block == mCachedBlock)) {
+      BlockJob job;
+      job.stream = this;
+      job.firstBlock = block;
+      job.numberOfBlocks = endBlock - block;
+      job.destination = destination;
+      job.nextBlock = 0;
+      job.failed = false;
+      run_job(job);
+      if (job.failed) {
+        break;
+      }
+
+      const sizeT numberOfBlockBytes = (endBlock == get_number_of_blocks()) ? mSize - mPosition : static_cast<sizeT>(endBlock - block) * mBlockSize;
+      destination += numberOfBlockBytes;
+      mPosition += numberOfBlockBytes;
+      numberOfReadBytes += numberOfBlockBytes;
+      remaining -= numberOfBlockBytes;
+      continue;
+    }
+
+    // Partially covered block, goes through the cache
+    if (!load_block(block)) {
+      break;
+    }
+    const sizeT available = get_block_raw_size(block) - offsetInBlock;
+    const sizeT numberOfCopiedBytes = (remaining < available) ? remaining : available;
+    Memory::copy(destination, mCache + offsetInBlock, numberOfCopiedBytes);
+    destination += numberOfCopiedBytes;
+    mPosition += numberOfCopiedBytes;
+    numberOfReadBytes += numberOfCopiedBytes;
+    remaining -= numberOfCopiedBytes;
+  }
+  return numberOfReadBytes;
+}
+
+void ChunkedCompressedStream::seek(sizeT offset, EFileSeek seek) {
+  BE_ASSERT(can_seek(), "Chunked compressed streams can only be seeked when reading")
+
+  if (!can_seek()) {
+    return;
+  }
+
+  // Relative seeks may move backwards, the unsigned offset wraps around accordingly
+  switch (seek) {
+    case EFileSeek::Set:
+      mPosition = offset;
+      break;
+
+    case EFileSeek::Current:
+      mPosition += offset;
+      break;
+
+    case EFileSeek::End:
+      mPosition = mSize + offset;
+      break;
+  }
+
+  if (mPosition > mSize) {
+    mPosition = mSize;
+  }
+}
+
+void ChunkedCompressedStream::flush() {
+  // Blocks are only written once complete, nothing to do in between
+}
+
+bool ChunkedCompressedStream::eof() const {
+  return (mPosition == mSize);
+}
+
+String ChunkedCompressedStream::get_content_as_string() {
+  String content;
+  if (mSize > mPosition) {
+    content.resize(mSize - mPosition);
+    content.resize(read(&content[0], mSize - mPosition));
+  }
+  return content;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+bool ChunkedCompressedStream::open_for_reading() {
+  if (!mFile.open(mPath.get_native_path(), EFileMode::Read)) {
+    return false;
+  }
+
+  ChunkedCompressedHeader header;
+  if (mFile.read_at(0, &header, sizeof(ChunkedCompressedHeader)) != sizeof(ChunkedCompressedHeader) ||
+      header.magic != Magic || header.version != Version || header.codec > static_cast<uint8>(ECompressionCodec::Zlib) ||
+      header.blockSize < MinBlockSize || header.blockSize > MaxBlockSize) {
+    return false;
+  }
+
+  // The block index has to be complete and describe exactly the content size
+  const uint64 numberOfBlocks = (header.size + header.blockSize - 1) / header.blockSize;
+  const uint64 indexSize = static_cast<uint64>(header.numberOfBlocks) * sizeof(ChunkedCompressedBlock);
+  if (numberOfBlocks != header.numberOfBlocks || header.indexOffset < sizeof(ChunkedCompressedHeader) ||
+      header.indexOffset + indexSize > mFile.get_number_of_bytes()) {
+    return false;
+  }
+  mBlocks.resize(header.numberOfBlocks);
+  if (indexSize > 0 && mFile.read_at(header.indexOffset, mBlocks.data(), indexSize) != indexSize) {
+    return false;
+  }
+
+  mCodec = static_cast<ECompressionCodec>(header.codec);
+  mBlockSize = header.blockSize;
+  mCompression = Compression::create(mCodec);
+  mCompressedCapacity = static_cast<uint32>(mCompression->compress_bound(mBlockSize));
+  for (const ChunkedCompressedBlock& block : mBlocks) {
+    if (block.storedSize > mCompressedCapacity || block.offset + block.storedSize > header.indexOffset) {
+      return false;
+    }
+  }
+
+  mCache = static_cast<uint8*>(Memory::allocate(mBlockSize));
+  mCachedBlock = header.numberOfBlocks;
+  mScratch = static_cast<uint8*>(Memory::allocate(mCompressedCapacity));
+  mSize = static_cast<sizeT>(header.size);
+  mPosition = 0;
+  return true;
+}
+
+bool ChunkedCompressedStream::open_for_writing() {
+  if (!mFile.open(mPath.get_native_path(), EFileMode::Write)) {
+    return false;
+  }
+
+  // Placeholder, the header is written once the file is complete
+  ChunkedCompressedHeader header;
+  Memory::set(&header, 0, sizeof(ChunkedCompressedHeader));
+  if (mFile.write(&header, sizeof(ChunkedCompressedHeader)) != sizeof(ChunkedCompressedHeader)) {
+    return false;
+  }
+
+  mCompression = Compression::create(mCodec, mLevel);
+  mCompressedCapacity = static_cast<uint32>(mCompression->compress_bound(mBlockSize));
+  mBatch = static_cast<uint8*>(Memory::allocate(static_cast<sizeT>(mBlockSize) * mNumberOfThreads));
+  mBatchCompressed = static_cast<uint8*>(Memory::allocate(static_cast<sizeT>(mCompressedCapacity) * mNumberOfThreads));
+  mBatchCompressedSizes.resize(mNumberOfThreads);
+  mBatchFill = 0;
+  mWriteFailed = false;
+  mFileOffset = sizeof(ChunkedCompressedHeader);
+  mSize = 0;
+  mPosition = 0;
+  return true;
+}
+
+uint32 ChunkedCompressedStream::get_block_raw_size(uint32 block) const {
+  return (block + 1 < get_number_of_blocks()) ? mBlockSize : static_cast<uint32>(mSize - static_cast<sizeT>(block) * mBlockSize);
+}
+
+bool ChunkedCompressedStream::load_block(uint32 block) {
+  if (block != mCachedBlock) {
+    if (!decompress_block(block, mCache, mScratch)) {
+      mCachedBlock = get_number_of_blocks();
+      return false;
+    }
+    mCachedBlock = block;
+  }
+  return true;
+}
+
+bool ChunkedCompressedStream::decompress_block(uint32 block, uint8* destination, uint8* scratch) {
+  // Positional reads, so several threads can load blocks of the same file at once
+  const ChunkedCompressedBlock& entry = mBlocks[block];
+  const uint32 rawSize = get_block_raw_size(block);
+  if (0 == (entry.flags & BlockCompressed)) {
+    return (entry.storedSize == rawSize && mFile.read_at(entry.offset, destination, rawSize) == rawSize);
+  }
+  return (mFile.read_at(entry.offset, scratch, entry.storedSize) == entry.storedSize &&
+          mCompression->decompress(destination, scratch, entry.storedSize, rawSize) == rawSize);
+}
+
+void ChunkedCompressedStream::compress_batch_block(uint32 batchBlock) {
+  const sizeT offset = static_cast<sizeT>(batchBlock) * mBlockSize;
+  const sizeT rawSize = (mBatchFill - offset < mBlockSize) ? mBatchFill - offset : mBlockSize;
+  mBatchCompressedSizes[batchBlock] = static_cast<uint32>(mCompression->compress(
+    mBatchCompressed + static_cast<sizeT>(batchBlock) * mCompressedCapacity, mBatch + offset, rawSize, mCompressedCapacity));
+}
+
+void ChunkedCompressedStream::write_batch() {
+  if (0 == mBatchFill || mWriteFailed) {
+    return;
+  }
+
+  BlockJob job;
+  job.stream = this;
+  job.firstBlock = 0;
+  job.numberOfBlocks = static_cast<uint32>((mBatchFill + mBlockSize - 1) / mBlockSize);
+  job.destination = nullptr;
+  job.nextBlock = 0;
+  job.failed = false;
+  run_job(job);
+
+  // Written in order, blocks which didn't get smaller are stored as is
+  for (uint32 i = 0; i < job.numberOfBlocks; ++i) {
+    const sizeT offset = static_cast<sizeT>(i) * mBlockSize;
+    const uint32 rawSize = static_cast<uint32>((mBatchFill - offset < mBlockSize) ? mBatchFill - offset : mBlockSize);
+    const uint32 compressedSize = mBatchCompressedSizes[i];
+
+    ChunkedCompressedBlock block;
+    block.offset = mFileOffset;
+    const uint8* storedData = nullptr;
+    if (compressedSize > 0 && compressedSize < rawSize) {
+      block.storedSize = compressedSize;
+      block.flags = BlockCompressed;
+      storedData = mBatchCompressed + static_cast<sizeT>(i) * mCompressedCapacity;
+    } else {
+      block.storedSize = rawSize;
+      block.flags = 0;
+      storedData = mBatch + offset;
+    }
+    if (mFile.write(storedData, block.storedSize) != block.storedSize) {
+      mWriteFailed = true;
+      break;
+    }
+    mFileOffset += block.storedSize;
+    mBlocks.push_back(block);
+  }
+  mBatchFill = 0;
+}
+
+void ChunkedCompressedStream::run_job(BlockJob& job) {
+  // The calling thread takes part, so a single block never needs the workers
+  if (job.numberOfBlocks < 2) {
+    process_job(job);
+    return;
+  }
+  start_workers();
+
+  {
+    LockGuard<Mutex> lock(mWorkerMutex);
+    mJob = &job;
+    ++mJobGeneration;
+    mWorkCondition.wake_all();
+  }
+  process_job(job);
+
+  // Once all blocks are taken, only workers already inside of the job can still touch it
+  LockGuard<Mutex> lock(mWorkerMutex);
+  mJob = nullptr;
+  while (mNumBusyWorkers > 0) {
+    mDoneCondition.wait(mWorkerMutex);
+  }
+}
+
+void ChunkedCompressedStream::start_workers() {
+  if (!mWorkers.empty()) {
+    return;
+  }
+  for (uint32 i = 1; i < mNumberOfThreads; ++i) {
+    Thread* thread = new Thread(&ChunkedCompressedStream::run_worker_thread, this);
+    thread->set_name("ChunkedCompressedStream");
+    if (thread->start()) {
+      mWorkers.push_back(thread);
+    } else {
+      delete thread;
+      break;
+    }
+  }
+}
+
+void ChunkedCompressedStream::stop_workers() {
+  if (mWorkers.empty()) {
+    return;
+  }
+  {
+    LockGuard<Mutex> lock(mWorkerMutex);
+    mStopWorkers = true;
+    mWorkCondition.wake_all();
+  }
+  for (Thread* thread : mWorkers) {
+    thread->join();
+    delete thread;
+  }
+  mWorkers.clear();
+  mStopWorkers = false;
+}
+
+int ChunkedCompressedStream::run_worker_thread(void* data) {
+  static_cast<ChunkedCompressedStream*>(data)->run_worker();
+  return 0;
+}
+
+void ChunkedCompressedStream::run_worker() {
+  uint32 jobGeneration = 0;
+  for (;;) {
+    BlockJob* job = nullptr;
+    {
+      LockGuard<Mutex> lock(mWorkerMutex);
+      while (!mStopWorkers && jobGeneration == mJobGeneration) {
+        mWorkCondition.wait(mWorkerMutex);
+      }
+      if (mStopWorkers) {
+        break;
+      }
+      // The job may already be done when this worker woke up too late
+      jobGeneration = mJobGeneration;
+      job = mJob;
+      if (nullptr == job) {
+        continue;
+      }
+      ++mNumBusyWorkers;
+    }
+
+    process_job(*job);
+
+    LockGuard<Mutex> lock(mWorkerMutex);
+    if (0 == --mNumBusyWorkers) {
+      mDoneCondition.wake_all();
+    }
+  }
+}
+
+void ChunkedCompressedStream::process_job(BlockJob& job) {
+  uint8* scratch = nullptr;
+  for (uint32 i = job.nextBlock.fetch_add(1); i < job.numberOfBlocks; i = job.nextBlock.fetch_add(1)) {
+    if (nullptr == job.destination) {
+      compress_batch_block(i);
+    } else {
+      if (nullptr == scratch) {
+        scratch = static_cast<uint8*>(Memory::allocate(mCompressedCapacity));
+      }
+      if (!decompress_block(job.firstBlock + i, job.destination + static_cast<sizeT>(i) * mBlockSize, scratch)) {
+        job.failed = true;
+      }
+    }
+  }
+  Memory::free(scratch);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -0,0 +1,715 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/directory_scanner.h"
+#include "core/container/hash_map.h"
+#include "core/io/file.h"
+#include "core/log/log.h"
+#include "core/memory/memory.h"
+#include "core/platform/platform.h"
+#include "core/string/string_simd.h"
+#include "core/threading/lock_guard.h"
+#include "core/threading/thread.h"
+#include <cstring>
+#if defined(LINUX)
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * DirectoryListing
+ *
+ * @brief
+ * Children a thread added for a directory, linked to the directory once all threads are done.
+ */
+struct DirectoryListing {
+  uint32 worker;           ///< Index of the thread owning the directory entry
+  uint32 index;            ///< Index of the directory entry within its thread
+  uint32 firstChild;       ///< Index of the first child within the listing thread
+  uint32 numberOfChildren; ///< Number of children
+};
+
+/**
+ * @struct
+ * SavedDirectoryHeader
+ *
+ * @brief
+ * Header of a saved result.
+ */
+struct SavedDirectoryHeader {
+  uint32 magic;
+  uint32 version;
+  uint32 numberOfEntries;
+  uint32 reserved;
+  int64 scanTime;
+};
+static_assert(sizeof(SavedDirectoryHeader) == 24, "Saved directory headers must be 24 bytes");
+
+/**
+ * @struct
+ * SavedDirectoryEntry
+ *
+ * @brief
+ * Entry of a saved result, followed by its name. Parents precede their children.
+ */
+struct SavedDirectoryEntry {
+  uint32 parent;
+  uint32 nameLength;
+  uint8 type;
+  uint8 reserved[7];
+  uint64 size;
+  int64 modificationTime;
+};
+static_assert(sizeof(SavedDirectoryEntry) == 32, "Saved directory entries must be 32 bytes");
+
+#if defined(LINUX)
+/**
+ * @struct
+ * LinuxDirectoryEntry
+ *
+ * @brief
+ * Record returned by getdents64.
+ */
+struct LinuxDirectoryEntry {
+  uint64 inode;
+  int64 offset;
+  uint16 recordLength;
+  uint8 type;
+  char name[1];
+};
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Allocates from the current arena block, starting a new one once it's used up.
+ */
+static char* allocate_path(Vector<uint8*>& blocks, uint8*& block, uint32& remaining, uint32 numberOfBytes) {
+  if (numberOfBytes > remaining) {
+    const uint32 blockSize = (numberOfBytes > DirectoryScanner::BlockSize) ? numberOfBytes : DirectoryScanner::BlockSize;
+    block = static_cast<uint8*>(Memory::allocate(blockSize));
+    remaining = blockSize;
+    blocks.push_back(block);
+  }
+  char* path = reinterpret_cast<char*>(block);
+  block += numberOfBytes;
+  remaining -= numberOfBytes;
+  return path;
+}
+
+/**
+ * @brief
+ * Returns the offset of the filename within a path without trailing separator.
+ */
+static uint32 get_name_offset(const char* path, uint32 pathLength) {
+  for (uint32 i = pathLength; i > 1; --i) {
+    if ('/' == path[i - 2]) {
+      return i - 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief
+ * Returns whether the views are equal.
+ */
+static bool is_same_name(const StringView& name, const char* otherName, uint32 otherNameLength) {
+  return name.size() == otherNameLength && 0 == memcmp(name.data(), otherName, otherNameLength);
+}
+
+/**
+ * @brief
+ * Returns whether a name is skipped, "." and ".." always and hidden entries if requested.
+ */
+static bool is_skipped_name(const char* name, bool skipHidden) {
+  return '.' == name[0] && (skipHidden || '\0' == name[1] || ('.' == name[1] && '\0' == name[2]));
+}
+
+#if defined(LINUX)
+static EDirectoryEntryType get_entry_type(mode_t mode) {
+  if (S_ISREG(mode)) {
+    return EDirectoryEntryType::File;
+  }
+  if (S_ISDIR(mode)) {
+    return EDirectoryEntryType::Directory;
+  }
+  return S_ISLNK(mode) ? EDirectoryEntryType::SymbolicLink : EDirectoryEntryType::Other;
+}
+
+static int64 get_modification_time(const struct stat& status) {
+  return static_cast<int64>(status.st_mtim.tv_sec) * 1000000000 + static_cast<int64>(status.st_mtim.tv_nsec);
+}
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * DirectoryScanner::Worker
+ *
+ * @brief
+ * State of one scanning thread, nothing in here is shared.
+ */
+struct DirectoryScanner::Worker {
+  DirectoryScanner* scanner;          ///< Owning scanner
+  uint32 index;                       ///< Index of the thread
+  Vector<DirectoryEntry> entries;     ///< Added entries, indices are local to the thread
+  Vector<DirectoryListing> listings;  ///< Listed directories
+  Vector<Job> jobs;                   ///< Subdirectories of the current directory, queued once it's done
+  Vector<uint8*> blocks;              ///< Arena blocks holding the paths
+  uint8* block = nullptr;             ///< Free space of the current block
+  uint32 remaining = 0;               ///< Number of free bytes of the current block
+  hash_map<uint64, uint32> cachedNames; ///< Name hash to index of the previous result, for the current directory
+  uint8* buffer = nullptr;            ///< getdents64 buffer
+  uint32 numReadDirectories = 0;
+  uint32 numReusedDirectories = 0;
+};
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+DirectoryScanResult::DirectoryScanResult()
+: mScanTime(0) {
+
+}
+
+DirectoryScanResult::~DirectoryScanResult() {
+  clear();
+}
+
+uint32 DirectoryScanResult::get_num_changed() const {
+  uint32 numChanged = 0;
+  for (const DirectoryEntry& entry : mEntries) {
+    numChanged += (entry.flags & DirectoryEntry::Changed) ? 1 : 0;
+  }
+  return numChanged;
+}
+
+void DirectoryScanResult::clear() {
+  for (uint8* block : mBlocks) {
+    Memory::free(block);
+  }
+  mBlocks.clear();
+  mEntries.clear();
+  mScanTime = 0;
+}
+
+bool DirectoryScanResult::save(const String& filename) const {
+  if (mEntries.empty()) {
+    return false;
+  }
+
+  // Breadth first, so parents precede their children and the children stay contiguous
+  const uint32 numberOfEntries = mEntries.size();
+  Vector<uint32> order;
+  Vector<uint32> newIndices;
+  order.reserve(numberOfEntries);
+  newIndices.resize(numberOfEntries);
+  order.push_back(0);
+  uint64 numberOfBytes = sizeof(SavedDirectoryHeader);
+  for (uint32 i = 0; i < order.size(); ++i) {
+    const DirectoryEntry& entry = mEntries[order[i]];
+    newIndices[order[i]] = i;
+    numberOfBytes += sizeof(SavedDirectoryEntry) + entry.pathLength;
+    if (EDirectoryEntryType::Directory == entry.type) {
+      for (uint32 child = 0; child < entry.numberOfChildren; ++child) {
+        order.push_back(entry.firstChild + child);
+      }
+    }
+  }
+
+  Vector<uint8> data;
+  data.resize(static_cast<uint32>(numberOfBytes));
+  uint8* position = data.data();
+  SavedDirectoryHeader header = {};
+  header.magic = Magic;
+  header.version = Version;
+  header.numberOfEntries = order.size();
+  header.scanTime = mScanTime;
+  memcpy(position, &header, sizeof(header));
+  position += sizeof(header);
+  for (uint32 i = 0; i < order.size(); ++i) {
+    const DirectoryEntry& entry = mEntries[order[i]];
+    SavedDirectoryEntry savedEntry = {};
+    savedEntry.parent = (InvalidIndex != entry.parent) ? newIndices[entry.parent] : InvalidIndex;
+    // The root keeps its whole path
+    savedEntry.nameLength = (0 == i) ? entry.pathLength : entry.pathLength - entry.nameOffset;
+    savedEntry.type = static_cast<uint8>(entry.type);
+    savedEntry.size = entry.size;
+    savedEntry.modificationTime = entry.modificationTime;
+    memcpy(position, &savedEntry, sizeof(savedEntry));
+    memcpy(position + sizeof(savedEntry), entry.path + entry.pathLength - savedEntry.nameLength, savedEntry.nameLength);
+    position += sizeof(savedEntry) + savedEntry.nameLength;
+  }
+  data.resize(static_cast<uint32>(position - data.data()));
+
+  File file;
+  if (!file.open(filename, EFileMode::Write)) {
+    return false;
+  }
+  const bool result = (file.write(data.data(), data.size()) == data.size());
+  file.close();
+  return result;
+}
+
+bool DirectoryScanResult::load(const String& filename) {
+  clear();
+
+  File file;
+  if (!file.open(filename, EFileMode::Read)) {
+    return false;
+  }
+  Vector<uint8> data;
+  data.resize(static_cast<uint32>(file.get_number_of_bytes()));
+  const bool isRead = (file.read(data.data(), data.size()) == data.size());
+  file.close();
+
+  SavedDirectoryHeader header;
+  if (!isRead || data.size() < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, data.data(), sizeof(header));
+  // Every entry takes at least its fixed size, which bounds what a corrupt count can make us reserve
+  if (Magic != header.magic || Version != header.version || 0 == header.numberOfEntries ||
+      header.numberOfEntries > (data.size() - sizeof(header)) / sizeof(SavedDirectoryEntry)) {
+    return false;
+  }
+
+  const uint8* position = data.data() + sizeof(header);
+  const uint8* end = data.data() + data.size();
+  uint8* block = nullptr;
+  uint32 remaining = 0;
+  mEntries.reserve(header.numberOfEntries);
+  for (uint32 i = 0; i < header.numberOfEntries; ++i) {
+    SavedDirectoryEntry savedEntry;
+    if (static_cast<uint64>(end - position) < sizeof(savedEntry)) {
+      break;
+    }
+    memcpy(&savedEntry, position, sizeof(savedEntry));
+    position += sizeof(savedEntry);
+    if (0 == savedEntry.nameLength || static_cast<uint64>(end - position) < savedEntry.nameLength || savedEntry.type > static_cast<uint8>(EDirectoryEntryType::Other) ||
+        (0 == i) != (InvalidIndex == savedEntry.parent) || (0 != i && savedEntry.parent >= i)) {
+      break;
+    }
+
+    DirectoryEntry entry = {};
+    entry.parent = savedEntry.parent;
+    entry.type = static_cast<EDirectoryEntryType>(savedEntry.type);
+    entry.size = savedEntry.size;
+    entry.modificationTime = savedEntry.modificationTime;
+    if (0 == i) {
+      char* path = allocate_path(mBlocks, block, remaining, savedEntry.nameLength + 1);
+      memcpy(path, position, savedEntry.nameLength);
+      path[savedEntry.nameLength] = '\0';
+      entry.path = path;
+      entry.pathLength = savedEntry.nameLength;
+      entry.nameOffset = get_name_offset(path, savedEntry.nameLength);
+    } else {
+      // Children of a directory have to be contiguous
+      DirectoryEntry& parent = mEntries[savedEntry.parent];
+      if (EDirectoryEntryType::Directory != parent.type || (parent.numberOfChildren > 0 && parent.firstChild + parent.numberOfChildren != i)) {
+        break;
+      }
+      if (0 == parent.numberOfChildren) {
+        parent.firstChild = i;
+      }
+      ++parent.numberOfChildren;
+
+      const bool hasSeparator = ('/' != parent.path[parent.pathLength - 1]);
+      entry.nameOffset = parent.pathLength + (hasSeparator ? 1 : 0);
+      entry.pathLength = entry.nameOffset + savedEntry.nameLength;
+      char* path = allocate_path(mBlocks, block, remaining, entry.pathLength + 1);
+      memcpy(path, parent.path, parent.pathLength);
+      path[parent.pathLength] = '/';
+      memcpy(path + entry.nameOffset, position, savedEntry.nameLength);
+      path[entry.pathLength] = '\0';
+      entry.path = path;
+    }
+    position += savedEntry.nameLength;
+    mEntries.push_back(entry);
+  }
+
+  if (mEntries.size() != header.numberOfEntries) {
+    clear();
+    return false;
+  }
+  mScanTime = header.scanTime;
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+DirectoryScanner::DirectoryScanner()
+: mNumberOfThreads(0)
+, mReadMetadata(false)
+, mSkipHidden(false)
+, mTimestampGranularity(DefaultTimestampGranularity)
+, mNumReadDirectories(0)
+, mNumReusedDirectories(0)
+, mPrevious(nullptr)
+, mNumBusyWorkers(0) {
+
+}
+
+DirectoryScanner::~DirectoryScanner() {
+
+}
+
+bool DirectoryScanner::scan(const String& directory, DirectoryScanResult& result, const DirectoryScanResult* previous) {
+  result.clear();
+  mNumReadDirectories = 0;
+  mNumReusedDirectories = 0;
+
+#if defined(LINUX)
+  uint32 pathLength = directory.length();
+  while (pathLength > 1 && '/' == directory[pathLength - 1]) {
+    --pathLength;
+  }
+  struct stat status;
+  if (0 == pathLength || 0 != stat(directory.c_str(), &status) || !S_ISDIR(status.st_mode)) {
+    return false;
+  }
+  timespec scanTime;
+  clock_gettime(CLOCK_REALTIME, &scanTime);
+  result.mScanTime = static_cast<int64>(scanTime.tv_sec) * 1000000000 + static_cast<int64>(scanTime.tv_nsec);
+
+  uint32 numberOfThreads = mNumberOfThreads;
+  if (0 == numberOfThreads) {
+    numberOfThreads = Platform::instance().get_cpu_info().LogicalProcessorCount;
+  }
+  numberOfThreads = (numberOfThreads > 0) ? numberOfThreads : 1;
+  for (uint32 i = 0; i < numberOfThreads; ++i) {
+    Worker* worker = new Worker();
+    worker->scanner = this;
+    worker->index = i;
+    worker->buffer = static_cast<uint8*>(Memory::allocate(BufferSize));
+    mWorkers.push_back(worker);
+  }
+
+  // The root is the first entry of the first thread, which is the calling one
+  Worker& mainWorker = *mWorkers[0];
+  char* rootPath = allocate_path(mainWorker.blocks, mainWorker.block, mainWorker.remaining, pathLength + 1);
+  memcpy(rootPath, directory.c_str(), pathLength);
+  rootPath[pathLength] = '\0';
+  DirectoryEntry root = {};
+  root.path = rootPath;
+  root.pathLength = pathLength;
+  root.nameOffset = get_name_offset(rootPath, pathLength);
+  root.parent = DirectoryScanResult::InvalidIndex;
+  root.type = EDirectoryEntryType::Directory;
+  root.modificationTime = get_modification_time(status);
+  mainWorker.entries.push_back(root);
+
+  // A previous result is only of use for the very same directory
+  mPrevious = (nullptr != previous && previous->get_num_entries() > 0 && is_same_name(previous->get_path(0), rootPath, pathLength)) ? previous : nullptr;
+  add_subdirectory(mainWorker, 0, mPrevious ? 0 : DirectoryScanResult::InvalidIndex);
+  mJobs.push_back(mainWorker.jobs[0]);
+  mainWorker.jobs.clear();
+  mNumBusyWorkers = 0;
+
+  Vector<Thread*> threads;
+  for (uint32 i = 1; i < numberOfThreads; ++i) {
+    Thread* thread = new Thread(&DirectoryScanner::run_worker_thread, mWorkers[i]);
+    thread->set_name("DirectoryScanner");
+    thread->start();
+    threads.push_back(thread);
+  }
+  run_worker(mainWorker);
+  for (Thread* thread : threads) {
+    thread->join();
+    delete thread;
+  }
+
+  // Merge the entries of all threads and link the directories to their children
+  Vector<uint32> bases;
+  uint32 numberOfEntries = 0;
+  for (const Worker* worker : mWorkers) {
+    bases.push_back(numberOfEntries);
+    numberOfEntries += worker->entries.size();
+  }
+  result.mEntries.resize(numberOfEntries);
+  for (Worker* worker : mWorkers) {
+    DirectoryEntry* entries = result.mEntries.data() + bases[worker->index];
+    memcpy(entries, worker->entries.data(), worker->entries.size() * sizeof(DirectoryEntry));
+    for (const DirectoryListing& listing : worker->listings) {
+      const uint32 parent = bases[listing.worker] + listing.index;
+      result.mEntries[parent].firstChild = bases[worker->index] + listing.firstChild;
+      result.mEntries[parent].numberOfChildren = listing.numberOfChildren;
+      for (uint32 i = 0; i < listing.numberOfChildren; ++i) {
+        entries[listing.firstChild + i].parent = parent;
+      }
+    }
+    for (uint8* block : worker->blocks) {
+      result.mBlocks.push_back(block);
+    }
+    mNumReadDirectories += worker->numReadDirectories;
+    mNumReusedDirectories += worker->numReusedDirectories;
+    Memory::free(worker->buffer);
+    delete worker;
+  }
+  mWorkers.clear();
+  mPrevious = nullptr;
+  return true;
+#else
+  BE_LOG(Error, "Scanning directories is not supported on this platform")
+  return false;
+#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+int DirectoryScanner::run_worker_thread(void* data) {
+  Worker* worker = static_cast<Worker*>(data);
+  worker->scanner->run_worker(*worker);
+  return 0;
+}
+
+void DirectoryScanner::run_worker(Worker& worker) {
+  bool isBusy = false;
+  for (;;) {
+    Job job;
+    {
+      LockGuard<Mutex> lock(mMutex);
+      // Queue the subdirectories of the previous directory, the last one is taken right away
+      if (isBusy) {
+        --mNumBusyWorkers;
+        for (const Job& newJob : worker.jobs) {
+          mJobs.push_back(newJob);
+        }
+        if (worker.jobs.size() > 1 || (mJobs.empty() && 0 == mNumBusyWorkers)) {
+          mCondition.wake_all();
+        }
+        worker.jobs.clear();
+      }
+      while (mJobs.empty() && mNumBusyWorkers > 0) {
+        mCondition.wait(mMutex);
+      }
+      if (mJobs.empty()) {
+        mCondition.wake_all();
+        return;
+      }
+      job = mJobs.back();
+      mJobs.pop_back();
+      ++mNumBusyWorkers;
+      isBusy = true;
+    }
+    process_job(worker, job);
+  }
+}
+
+void DirectoryScanner::process_job(Worker& worker, const Job& job) {
+  DirectoryListing listing;
+  listing.worker = job.worker;
+  listing.index = job.index;
+  listing.firstChild = worker.entries.size();
+  if (job.isUnchanged) {
+    reuse_directory(worker, job);
+  } else {
+    read_directory(worker, job);
+  }
+  listing.numberOfChildren = worker.entries.size() - listing.firstChild;
+  if (listing.numberOfChildren > 0) {
+    worker.listings.push_back(listing);
+  }
+}
+
+void DirectoryScanner::read_directory(Worker& worker, const Job& job) {
+#if defined(LINUX)
+  const int directoryHandle = ::open(job.path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (directoryHandle < 0) {
+    return;
+  }
+  ++worker.numReadDirectories;
+
+  // Children known from the previous result, by name
+  worker.cachedNames.clear();
+  if (DirectoryScanResult::InvalidIndex != job.cachedIndex) {
+    const DirectoryEntry& cachedEntry = mPrevious->get_entry(job.cachedIndex);
+    for (uint32 i = 0; i < cachedEntry.numberOfChildren; ++i) {
+      const StringView name = mPrevious->get_name(cachedEntry.firstChild + i);
+      worker.cachedNames[string_hash(name.data(), name.size())] = cachedEntry.firstChild + i;
+    }
+  }
+
+  for (;;) {
+    const long numberOfBytes = syscall(SYS_getdents64, directoryHandle, worker.buffer, BufferSize);
+    if (numberOfBytes <= 0) {
+      break;
+    }
+    for (long offset = 0; offset < numberOfBytes; ) {
+      const LinuxDirectoryEntry& directoryEntry = *reinterpret_cast<const LinuxDirectoryEntry*>(worker.buffer + offset);
+      offset += directoryEntry.recordLength;
+      const char* name = directoryEntry.name;
+      if (is_skipped_name(name, mSkipHidden)) {
+        continue;
+      }
+
+      // The listing tells the type on all common filesystems, stat only if it doesn't
+      struct stat status;
+      EDirectoryEntryType type = EDirectoryEntryType::Other;
+      bool hasStatus = false;
+      switch (directoryEntry.type) {
+        case DT_REG: type = EDirectoryEntryType::File; break;
+        case DT_DIR: type = EDirectoryEntryType::Directory; break;
+        case DT_LNK: type = EDirectoryEntryType::SymbolicLink; break;
+        case DT_UNKNOWN:
+          hasStatus = (0 == fstatat(directoryHandle, name, &status, AT_SYMLINK_NOFOLLOW));
+          if (!hasStatus) {
+            continue;
+          }
+          type = get_entry_type(status.st_mode);
+          break;
+        default: break;
+      }
+
+      const uint32 nameLength = static_cast<uint32>(strlen(name));
+      uint32 cachedIndex = DirectoryScanResult::InvalidIndex;
+      if (!worker.cachedNames.empty()) {
+        hash_map<uint64, uint32>::const_iterator cachedName = worker.cachedNames.find(string_hash(name, nameLength));
+        if (worker.cachedNames.end() != cachedName && is_same_name(mPrevious->get_name(cachedName->second), name, nameLength) &&
+            mPrevious->get_entry(cachedName->second).type == type) {
+          cachedIndex = cachedName->second;
+        }
+      }
+
+      const uint32 index = add_entry(worker, job, name, nameLength, type);
+      if (EDirectoryEntryType::Directory == type) {
+        if (hasStatus || 0 == fstatat(directoryHandle, name, &status, AT_SYMLINK_NOFOLLOW)) {
+          worker.entries[index].modificationTime = get_modification_time(status);
+        }
+        add_subdirectory(worker, index, cachedIndex);
+      } else {
+        DirectoryEntry& entry = worker.entries[index];
+        if (mReadMetadata && EDirectoryEntryType::File == type && (hasStatus || 0 == fstatat(directoryHandle, name, &status, AT_SYMLINK_NOFOLLOW))) {
+          entry.size = static_cast<uint64>(status.st_size);
+          entry.modificationTime = get_modification_time(status);
+        }
+        const bool isChanged = (DirectoryScanResult::InvalidIndex == cachedIndex || mPrevious->get_entry(cachedIndex).size != entry.size ||
+                                mPrevious->get_entry(cachedIndex).modificationTime != entry.modificationTime);
+        entry.flags = isChanged ? DirectoryEntry::Changed : 0;
+      }
+    }
+  }
+  ::close(directoryHandle);
+#endif
+}
+
+void DirectoryScanner::reuse_directory(Worker& worker, const Job& job) {
+#if defined(LINUX)
+  ++worker.numReusedDirectories;
+
+  // Nothing was added, removed or renamed, only the metadata of the children has to be read
+  const DirectoryEntry& cachedEntry = mPrevious->get_entry(job.cachedIndex);
+  for (uint32 i = 0; i < cachedEntry.numberOfChildren; ++i) {
+    const uint32 cachedIndex = cachedEntry.firstChild + i;
+    const DirectoryEntry& cachedChild = mPrevious->get_entry(cachedIndex);
+    const StringView name = mPrevious->get_name(cachedIndex);
+    if (mSkipHidden && '.' == name[0]) {
+      continue;
+    }
+
+    const uint32 index = add_entry(worker, job, name.data(), name.size(), cachedChild.type);
+    DirectoryEntry& entry = worker.entries[index];
+    struct stat status;
+    if (EDirectoryEntryType::Directory == cachedChild.type) {
+      if (0 == lstat(entry.path, &status)) {
+        entry.modificationTime = get_modification_time(status);
+      }
+      add_subdirectory(worker, index, cachedIndex);
+    } else {
+      if (mReadMetadata && EDirectoryEntryType::File == cachedChild.type && 0 == lstat(entry.path, &status)) {
+        entry.size = static_cast<uint64>(status.st_size);
+        entry.modificationTime = get_modification_time(status);
+      }
+      entry.flags = (cachedChild.size != entry.size || cachedChild.modificationTime != entry.modificationTime) ? DirectoryEntry::Changed : 0;
+    }
+  }
+#endif
+}
+
+uint32 DirectoryScanner::add_entry(Worker& worker, const Job& job, const char* name, uint32 nameLength, EDirectoryEntryType type) {
+  const bool hasSeparator = ('/' != job.path[job.pathLength - 1]);
+  DirectoryEntry entry = {};
+  entry.nameOffset = job.pathLength + (hasSeparator ? 1 : 0);
+  entry.pathLength = entry.nameOffset + nameLength;
+  char* path = allocate_path(worker.blocks, worker.block, worker.remaining, entry.pathLength + 1);
+  memcpy(path, job.path, job.pathLength);
+  path[job.pathLength] = '/';
+  memcpy(path + entry.nameOffset, name, nameLength);
+  path[entry.pathLength] = '\0';
+  entry.path = path;
+  entry.parent = DirectoryScanResult::InvalidIndex;
+  entry.type = type;
+  worker.entries.push_back(entry);
+  return worker.entries.size() - 1;
+}
+
+void DirectoryScanner::add_subdirectory(Worker& worker, uint32 index, uint32 cachedIndex) {
+  // Only trust timestamps which are older than the previous scan by more than their granularity
+  DirectoryEntry& entry = worker.entries[index];
+  const bool isUnchanged = (DirectoryScanResult::InvalidIndex != cachedIndex && mPrevious->get_entry(cachedIndex).modificationTime == entry.modificationTime &&
+                            entry.modificationTime + static_cast<int64>(mTimestampGranularity) * 1000000 < mPrevious->get_scan_time());
+  entry.flags = isUnchanged ? 0 : DirectoryEntry::Changed;
+
+  Job job;
+  job.path = entry.path;
+  job.pathLength = entry.pathLength;
+  job.worker = worker.index;
+  job.index = index;
+  job.cachedIndex = cachedIndex;
+  job.isUnchanged = isUnchanged;
+  worker.jobs.push_back(job);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
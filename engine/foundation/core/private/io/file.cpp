@@ -28,6 +28,7 @@
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 #include "core/io/file.h"
+#include "core/profiling/metrics.h"
 #if defined(LINUX)
 #include "core/linux/linux_file.h"
 #endif
@@ -86,15 +87,49 @@ void File::seek(uint64 seek) {
 }
 
 uint64 File::read(void *destinationBuffer, uint64 numberOfBytes) {
-  return mFileImpl->read(destinationBuffer, numberOfBytes);
+  const uint64 numberOfReadBytes = mFileImpl->read(destinationBuffer, numberOfBytes);
+  BE_METRICS_INCREMENT("io.bytes_read", static_cast<int64>(numberOfReadBytes))
+  return numberOfReadBytes;
 }
 
 void File::skip(core::uint64 numberOfBytes) {
   mFileImpl->skip(numberOfBytes);
 }
 
+uint64 File::read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes) {
+  const uint64 numberOfReadBytes = mFileImpl->read_at(offset, destinationBuffer, numberOfBytes);
+  BE_METRICS_INCREMENT("io.bytes_read", static_cast<int64>(numberOfReadBytes))
+  return numberOfReadBytes;
+}
+
+const void* File::map(EAccessPattern accessPattern, uint64& numberOfBytes) {
+  const void* data = mFileImpl->map(accessPattern, numberOfBytes);
+  if (data) {
+    BE_METRICS_INCREMENT("io.bytes_mapped", static_cast<int64>(numberOfBytes))
+  }
+  return data;
+}
+
+void File::unmap() {
+  mFileImpl->unmap();
+}
+
 uint64 File::write(const void *sourceBuffer, uint64 numberOfBytes) {
-  return mFileImpl->write(sourceBuffer, numberOfBytes);
+  const uint64 numberOfWrittenBytes = mFileImpl->write(sourceBuffer, numberOfBytes);
+  BE_METRICS_INCREMENT("io.bytes_written", static_cast<int64>(numberOfWrittenBytes))
+  return numberOfWrittenBytes;
+}
+
+uint64 File::write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes) {
+  const uint64 numberOfWrittenBytes = mFileImpl->write_at(offset, sourceBuffer, numberOfBytes);
+  BE_METRICS_INCREMENT("io.bytes_written", static_cast<int64>(numberOfWrittenBytes))
+  return numberOfWrittenBytes;
+}
+
+uint64 File::write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) {
+  const uint64 numberOfWrittenBytes = mFileImpl->write_vectored(buffers, numberOfBuffers);
+  BE_METRICS_INCREMENT("io.bytes_written", static_cast<int64>(numberOfWrittenBytes))
+  return numberOfWrittenBytes;
 }
 
 int64 File::get_last_modification_time() const {
@@ -107,14 +142,15 @@ int64 File::get_file_size() const {
 
 
 String File::get_content_as_string() {
-  const uint32 fileSize = get_number_of_bytes();
+  const uint64 fileSize = get_number_of_bytes();
+  const uint64 position = tell();
 
-  if (fileSize) {
-    char* data = new char[fileSize + 1];
-    read(data, fileSize);
-    data[fileSize] = '\0';
+  if (fileSize > position) {
+    String content;
+    content.resize(static_cast<sizeT>(fileSize - position));
+    content.resize(static_cast<sizeT>(read(&content[0], fileSize - position)));
 
-    return String(data);
+    return content;
   }
 
   return "";
@@ -28,6 +28,7 @@
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 #include "core/io/file_stream.h"
+#include <type_traits>
 
 
 //[-------------------------------------------------------]
@@ -40,7 +41,8 @@ namespace core {
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 FileStream::FileStream()
-: mMappedContent(nullptr) {
+: mMappedContent(nullptr)
+, mMappedSize(0) {
 
 }
 
@@ -52,6 +54,9 @@ FileStream::~FileStream() {
 
 
 String FileStream::get_content_as_string() {
+  if (is_mapped()) {
+    return String(static_cast<const char*>(mMappedContent), static_cast<sizeT>(mMappedSize));
+  }
   return mFileHandle.get_content_as_string();
 }
 
@@ -98,11 +103,7 @@ void FileStream::close() {
   BE_ASSERT(is_open(), "There is already a closed file")
 
   if (is_mapped()) {
-    if (!mMapFileHandle.is_invalid()) {
-      unmap();
-    } else {
-      memory_unmap();
-    }
+    memory_unmap();
   }
 
   mFileHandle.close();
@@ -118,6 +119,12 @@ void FileStream::write(const void* ptr, sizeT numBytes) {
   }
 }
 
+void FileStream::write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) {
+  BE_ASSERT(!is_mapped(), "The file is mapped")
+  BE_ASSERT(is_open(), "There is no file opened")
+  mFileHandle.write_vectored(buffers, numberOfBuffers);
+}
+
 sizeT FileStream::read(void* ptr, sizeT numBytes) {
   BE_ASSERT(is_open(), "There is no file opened")
   BE_ASSERT(ptr, "The pointer is null")
@@ -126,7 +133,21 @@ sizeT FileStream::read(void* ptr, sizeT numBytes) {
 }
 
 void FileStream::seek(sizeT offset, EFileSeek seek) {
-  mFileHandle.seek(offset);
+  // Relative offsets are passed as two's complement, reinterpret them as signed distance
+  const int64 distance = static_cast<int64>(static_cast<std::make_signed_t<sizeT>>(offset));
+  switch (seek) {
+    case EFileSeek::Set:
+      mFileHandle.seek(offset);
+      break;
+
+    case EFileSeek::Current:
+      mFileHandle.seek(static_cast<uint64>(static_cast<int64>(mFileHandle.tell()) + distance));
+      break;
+
+    case EFileSeek::End:
+      mFileHandle.seek(static_cast<uint64>(static_cast<int64>(mFileHandle.get_number_of_bytes()) + distance));
+      break;
+  }
 }
 
 void FileStream::flush() {
@@ -137,6 +158,33 @@ bool FileStream::eof() const {
   return mFileHandle.is_eof();
 }
 
+void* FileStream::map() {
+  return memory_map();
+}
+
+void FileStream::unmap() {
+  memory_unmap();
+}
+
+void* FileStream::memory_map() {
+  BE_ASSERT(is_open(), "There is no file opened")
+  BE_ASSERT(!is_mapped(), "The file is already mapped")
+
+  // The mapping is read-only, handing out a non-const pointer is owed to the stream interface
+  mMappedContent = const_cast<void*>(mFileHandle.map(mAccessPattern, mMappedSize));
+  mIsMapped = (nullptr != mMappedContent);
+  return mMappedContent;
+}
+
+void FileStream::memory_unmap() {
+  if (is_mapped()) {
+    mFileHandle.unmap();
+    mMappedContent = nullptr;
+    mMappedSize = 0;
+    mIsMapped = false;
+  }
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
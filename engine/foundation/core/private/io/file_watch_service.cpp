@@ -0,0 +1,723 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/file_watch_service.h"
+#include "core/io/io_server.h"
+#include "core/log/log.h"
+#include "core/platform/platform.h"
+#include "core/string/string_simd.h"
+#include "core/threading/lock_guard.h"
+#include "core/threading/thread.h"
+#if defined(LINUX)
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Number of bytes of inotify events read at once */
+static constexpr uint32 EventBufferSize = 16 * 1024;
+/** Set in the stamp of polled directory entries which are directories */
+static constexpr uint64 DirectoryStamp = uint64(1) << 63;
+/** Changes a batch entry is reported for, entries without any of them cancelled out */
+static constexpr uint32 ReportedChanges = FileChange::Added | FileChange::Modified | FileChange::Removed | FileChange::Overflow;
+#if defined(LINUX)
+/** Events of a watched directory, changes of the directory itself are reported by its parent */
+static constexpr uint32 WatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR | IN_EXCL_UNLINK;
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Returns the path without trailing separators, the root directory is kept.
+ */
+static String trim_path(const String& path) {
+  uint32 length = path.length();
+  while (length > 1 && ('/' == path[length - 1] || '\\' == path[length - 1])) {
+    --length;
+  }
+  return (length == path.length()) ? path : path.substr(0, length);
+}
+
+/**
+ * @brief
+ * Returns whether the path is the given directory or inside of it.
+ */
+static bool is_below(const String& path, const String& directory) {
+  return path.starts_with(directory) && (path.length() == directory.length() || '/' == path[directory.length()] || '/' == directory[directory.length() - 1]);
+}
+
+#if defined(LINUX)
+/**
+ * @brief
+ * Returns the modification time and size of a directory entry as one comparable value.
+ */
+static uint64 get_entry_stamp(int directoryHandle, const char* name) {
+  struct stat status;
+  if (0 != fstatat(directoryHandle, name, &status, AT_SYMLINK_NOFOLLOW)) {
+    return 0;
+  }
+  const uint64 time = static_cast<uint64>(status.st_mtim.tv_sec) * 1000000000 + static_cast<uint64>(status.st_mtim.tv_nsec);
+  return ((time * 31 + static_cast<uint64>(status.st_size)) & ~DirectoryStamp) | (S_ISDIR(status.st_mode) ? DirectoryStamp : 0);
+}
+
+/**
+ * @brief
+ * Returns whether a directory entry is a directory, without following symbolic links.
+ */
+static bool is_directory_entry(int directoryHandle, const dirent& entry) {
+  if (DT_UNKNOWN != entry.d_type) {
+    return DT_DIR == entry.d_type;
+  }
+  struct stat status;
+  return 0 == fstatat(directoryHandle, entry.d_name, &status, AT_SYMLINK_NOFOLLOW) && S_ISDIR(status.st_mode);
+}
+
+/**
+ * @brief
+ * Returns whether a directory entry is skipped, which are the dot entries and hidden directories like ".git".
+ */
+static bool is_skipped_entry(const char* name, bool isDirectory) {
+  return '.' == name[0] && (isDirectory || '\0' == name[1] || ('.' == name[1] && '\0' == name[2]));
+}
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+FileWatchService& FileWatchService::instance() {
+  static FileWatchService SInstance;
+  return SInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+bool FileWatchService::start() {
+  LockGuard<Mutex> lock(mMutex);
+  if (is_running()) {
+    return false;
+  }
+
+#if defined(LINUX)
+  mInotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  mEpollHandle = epoll_create1(EPOLL_CLOEXEC);
+  mWakeUpHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  bool result = (mInotifyHandle >= 0 && mEpollHandle >= 0 && mWakeUpHandle >= 0);
+  for (const int handle : { mInotifyHandle, mWakeUpHandle }) {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = handle;
+    result = result && 0 == epoll_ctl(mEpollHandle, EPOLL_CTL_ADD, handle, &event);
+  }
+  if (!result) {
+    BE_LOG(Error, "Failed to create the inotify handles of the file watch service")
+    for (int* handle : { &mInotifyHandle, &mEpollHandle, &mWakeUpHandle }) {
+      if (*handle >= 0) {
+        ::close(*handle);
+        *handle = -1;
+      }
+    }
+    return false;
+  }
+  mWatchLimitReached = false;
+  mRunning.store(true);
+
+  mThread = new Thread(&FileWatchService::run_thread, this);
+  mThread->set_name("FileWatchService");
+  mThread->start();
+  return true;
+#else
+  BE_LOG(Error, "Watching files is not supported on this platform")
+  return false;
+#endif
+}
+
+void FileWatchService::stop() {
+  if (!is_running()) {
+    return;
+  }
+  mRunning.store(false);
+  wake_up();
+  mThread->join();
+  delete mThread;
+  mThread = nullptr;
+
+  LockGuard<Mutex> lock(mMutex);
+#if defined(LINUX)
+  ::close(mInotifyHandle);
+  ::close(mEpollHandle);
+  ::close(mWakeUpHandle);
+#endif
+  mInotifyHandle = -1;
+  mEpollHandle = -1;
+  mWakeUpHandle = -1;
+  mRoots.clear();
+  mWatchPaths.clear();
+  mWatchHandles.clear();
+  mWatchedFiles.clear();
+  for (PolledDirectory* polledDirectory : mPolledDirectories) {
+    delete polledDirectory;
+  }
+  mPolledDirectories.clear();
+  mPendingChanges.clear();
+}
+
+void FileWatchService::set_debounce_time(uint32 debounceTime, uint32 maxLatency) {
+  {
+    LockGuard<Mutex> lock(mMutex);
+    mDebounceTime = debounceTime;
+    mMaxLatency = (maxLatency > debounceTime) ? maxLatency : debounceTime;
+  }
+  wake_up();
+}
+
+void FileWatchService::set_poll_interval(uint32 pollInterval) {
+  {
+    LockGuard<Mutex> lock(mMutex);
+    mPollInterval = (pollInterval > 0) ? pollInterval : 1;
+    mNextPollTime = Platform::instance().get_milliseconds() + mPollInterval;
+  }
+  wake_up();
+}
+
+bool FileWatchService::watch(const String& path) {
+  if (!is_running() && !start() && !is_running()) {
+    return false;
+  }
+
+#if defined(LINUX)
+  const String realPath = trim_path(IoServer::instance()->resolve_path(path));
+  struct stat status;
+  if (realPath.empty() || 0 != stat(realPath.c_str(), &status) || !S_ISDIR(status.st_mode)) {
+    return false;
+  }
+
+  LockGuard<Mutex> lock(mMutex);
+  bool isCovered = false;
+  for (const String& root : mRoots) {
+    if (root == realPath) {
+      return true;
+    }
+    isCovered = isCovered || is_below(realPath, root);
+  }
+  mRoots.push_back(realPath);
+  if (!isCovered) {
+    add_directory(realPath, false);
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void FileWatchService::unwatch(const String& path) {
+  const String realPath = trim_path(IoServer::instance()->resolve_path(path));
+
+  LockGuard<Mutex> lock(mMutex);
+  for (uint32 i = 0; i < mRoots.size(); ++i) {
+    if (mRoots[i] == realPath) {
+      mRoots.erase_at(i);
+
+      // Watches are shared between roots, an outer root still needs all of them
+      for (const String& root : mRoots) {
+        if (is_below(realPath, root)) {
+          return;
+        }
+      }
+      remove_directory(realPath);
+
+      // Nested roots lost their watches along with the removed one
+      for (const String& root : mRoots) {
+        if (is_below(root, realPath)) {
+          add_directory(root, false);
+        }
+      }
+      return;
+    }
+  }
+}
+
+uint32 FileWatchService::subscribe(const String& path, const FileChangeCallback& callback) {
+  Subscription* subscription = new Subscription();
+  subscription->path = trim_path(path);
+  subscription->realPath = trim_path(IoServer::instance()->resolve_path(path));
+  subscription->callback = callback;
+
+  LockGuard<Mutex> lock(mSubscriptionMutex);
+  subscription->id = mNextSubscription++;
+  mSubscriptions.push_back(subscription);
+  return subscription->id;
+}
+
+void FileWatchService::unsubscribe(uint32 subscription) {
+  LockGuard<Mutex> lock(mSubscriptionMutex);
+  for (uint32 i = 0; i < mSubscriptions.size(); ++i) {
+    if (mSubscriptions[i]->id == subscription) {
+      delete mSubscriptions[i];
+      mSubscriptions.erase_at(i);
+      return;
+    }
+  }
+}
+
+uint32 FileWatchService::get_num_watched_directories() const {
+  LockGuard<Mutex> lock(mMutex);
+  return static_cast<uint32>(mWatchPaths.size());
+}
+
+uint32 FileWatchService::get_num_polled_directories() const {
+  LockGuard<Mutex> lock(mMutex);
+  return mPolledDirectories.size();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+FileWatchService::FileWatchService()
+: mRunning(false)
+, mNumEvents(0)
+, mNumBatches(0)
+, mThread(nullptr)
+, mInotifyHandle(-1)
+, mEpollHandle(-1)
+, mWakeUpHandle(-1)
+, mDebounceTime(DefaultDebounceTime)
+, mMaxLatency(DefaultMaxLatency)
+, mPollInterval(DefaultPollInterval)
+, mWatchLimitReached(false)
+, mFirstPendingTime(0)
+, mLastPendingTime(0)
+, mNextPollTime(0)
+, mNextSubscription(InvalidSubscription + 1) {
+
+}
+
+FileWatchService::~FileWatchService() {
+  stop();
+  for (Subscription* subscription : mSubscriptions) {
+    delete subscription;
+  }
+}
+
+int FileWatchService::run_thread(void* data) {
+  static_cast<FileWatchService*>(data)->run();
+  return 0;
+}
+
+void FileWatchService::run() {
+#if defined(LINUX)
+  while (is_running()) {
+    // Sleep until an event arrives, the pending batch is due or polled directories have to be scanned
+    int timeout = -1;
+    {
+      LockGuard<Mutex> lock(mMutex);
+      const uint64 now = Platform::instance().get_milliseconds();
+      if (!mPendingChanges.empty()) {
+        const uint64 debounceTime = mLastPendingTime + mDebounceTime;
+        const uint64 latencyTime = mFirstPendingTime + mMaxLatency;
+        const uint64 dueTime = (debounceTime < latencyTime) ? debounceTime : latencyTime;
+        timeout = (dueTime > now) ? static_cast<int>(dueTime - now) : 0;
+      }
+      if (!mPolledDirectories.empty()) {
+        const int pollTimeout = (mNextPollTime > now) ? static_cast<int>(mNextPollTime - now) : 0;
+        timeout = (timeout < 0 || pollTimeout < timeout) ? pollTimeout : timeout;
+      }
+    }
+
+    epoll_event events[2];
+    const int numberOfEvents = epoll_wait(mEpollHandle, events, 2, timeout);
+    for (int i = 0; i < numberOfEvents; ++i) {
+      if (events[i].data.fd == mWakeUpHandle) {
+        uint64 value;
+        while (::read(mWakeUpHandle, &value, sizeof(value)) > 0) {
+        }
+      } else {
+        read_events();
+      }
+    }
+
+    bool isDue = false;
+    {
+      LockGuard<Mutex> lock(mMutex);
+      const uint64 now = Platform::instance().get_milliseconds();
+      if (!mPolledDirectories.empty() && now >= mNextPollTime) {
+        poll_directories();
+        mNextPollTime = now + mPollInterval;
+      }
+      isDue = !mPendingChanges.empty() && (now >= mLastPendingTime + mDebounceTime || now >= mFirstPendingTime + mMaxLatency);
+    }
+    if (isDue) {
+      deliver();
+    }
+  }
+#endif
+}
+
+void FileWatchService::read_events() {
+#if defined(LINUX)
+  alignas(inotify_event) char buffer[EventBufferSize];
+  for (;;) {
+    const ssize_t numberOfBytes = ::read(mInotifyHandle, buffer, sizeof(buffer));
+    if (numberOfBytes <= 0) {
+      if (numberOfBytes < 0 && EINTR == errno) {
+        continue;
+      }
+      // Drained
+      return;
+    }
+
+    LockGuard<Mutex> lock(mMutex);
+    for (ssize_t offset = 0; offset < numberOfBytes; ) {
+      const inotify_event& event = *reinterpret_cast<const inotify_event*>(buffer + offset);
+      offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+      mNumEvents.fetch_add(1, std::memory_order_relaxed);
+
+      if (event.mask & IN_Q_OVERFLOW) {
+        // The kernel queue was full, only a rescan can tell what happened
+        BE_LOG(Warning, "The inotify event queue overflowed, watched directories have to be rescanned")
+        for (const String& root : mRoots) {
+          add_change(String(root), FileChange::Overflow | FileChange::Directory);
+        }
+        continue;
+      }
+
+      hash_map<int32, String>::iterator watchPath = mWatchPaths.find(event.wd);
+      if (mWatchPaths.end() == watchPath) {
+        continue;
+      }
+      if (event.mask & IN_IGNORED) {
+        // The watch is gone, because its directory was removed or the watch was removed explicitly
+        hash_map<String, int32>::iterator watchHandle = mWatchHandles.find(watchPath->second);
+        if (mWatchHandles.end() != watchHandle && watchHandle->second == event.wd) {
+          mWatchHandles.erase(watchHandle);
+        }
+        mWatchedFiles.erase(event.wd);
+        mWatchPaths.erase(watchPath);
+        continue;
+      }
+      if (0 == event.len) {
+        continue;
+      }
+
+      const bool isDirectory = (0 != (event.mask & IN_ISDIR));
+      if (is_skipped_entry(event.name, isDirectory)) {
+        continue;
+      }
+      String path = watchPath->second;
+      path += '/';
+      path += event.name;
+      const uint32 directoryFlag = isDirectory ? FileChange::Directory : 0;
+      if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+        if (isDirectory) {
+          // Everything created before the watch is in place is reported as well
+          add_directory(path, true);
+          add_change(std::move(path), FileChange::Added | directoryFlag);
+        } else {
+          // Renaming onto an existing file, e.g. saving through a temporary file, only reports the target as moved to
+          const bool isReplaced = !mWatchedFiles[event.wd].insert(string_hash(event.name, strlen(event.name))).second;
+          add_change(std::move(path), isReplaced ? FileChange::Modified : FileChange::Added);
+        }
+      } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+        if (isDirectory) {
+          remove_directory(path);
+        } else {
+          mWatchedFiles[event.wd].erase(string_hash(event.name, strlen(event.name)));
+        }
+        add_change(std::move(path), FileChange::Removed | directoryFlag);
+      } else {
+        add_change(std::move(path), FileChange::Modified | directoryFlag);
+      }
+    }
+  }
+#endif
+}
+
+void FileWatchService::poll_directories() {
+#if defined(LINUX)
+  // Subdirectories are only added or removed after the scan, both modify the list of polled directories
+  Vector<String> addedDirectories;
+  Vector<String> removedDirectories;
+  hash_map<String, uint64> entries;
+  for (PolledDirectory* polledDirectory : mPolledDirectories) {
+    DIR* directory = opendir(polledDirectory->path.c_str());
+    if (nullptr == directory) {
+      continue;
+    }
+    const int directoryHandle = dirfd(directory);
+    entries.clear();
+    while (const dirent* entry = readdir(directory)) {
+      const uint64 stamp = get_entry_stamp(directoryHandle, entry->d_name);
+      const bool isDirectory = (0 != (stamp & DirectoryStamp));
+      if (is_skipped_entry(entry->d_name, isDirectory)) {
+        continue;
+      }
+      entries.emplace(entry->d_name, stamp);
+    }
+    closedir(directory);
+
+    for (const auto& entry : entries) {
+      const uint32 directoryFlag = (entry.second & DirectoryStamp) ? FileChange::Directory : 0;
+      String path = polledDirectory->path;
+      path += '/';
+      path += entry.first;
+      hash_map<String, uint64>::const_iterator previousEntry = polledDirectory->entries.find(entry.first);
+      if (polledDirectory->entries.end() == previousEntry) {
+        if (directoryFlag) {
+          addedDirectories.push_back(path);
+        }
+        add_change(std::move(path), FileChange::Added | directoryFlag);
+      } else if (previousEntry->second != entry.second && !directoryFlag) {
+        add_change(std::move(path), FileChange::Modified);
+      }
+    }
+    for (const auto& previousEntry : polledDirectory->entries) {
+      if (entries.end() == entries.find(previousEntry.first)) {
+        const bool isDirectory = (0 != (previousEntry.second & DirectoryStamp));
+        String path = polledDirectory->path;
+        path += '/';
+        path += previousEntry.first;
+        if (isDirectory) {
+          removedDirectories.push_back(path);
+        }
+        add_change(std::move(path), FileChange::Removed | (isDirectory ? FileChange::Directory : 0));
+      }
+    }
+    polledDirectory->entries.swap(entries);
+  }
+
+  for (const String& path : removedDirectories) {
+    remove_directory(path);
+  }
+  for (const String& path : addedDirectories) {
+    add_directory(path, true);
+  }
+#endif
+}
+
+void FileWatchService::deliver() {
+  hash_map<String, uint32> changes;
+  {
+    LockGuard<Mutex> lock(mMutex);
+    changes.swap(mPendingChanges);
+  }
+  mNumBatches.fetch_add(1, std::memory_order_relaxed);
+
+  // Each subscription gets the changes below its path, in its own spelling
+  LockGuard<Mutex> lock(mSubscriptionMutex);
+  Vector<FileChange> batch;
+  for (Subscription* subscription : mSubscriptions) {
+    batch.clear();
+    for (const auto& change : changes) {
+      if (0 == (change.second & ReportedChanges)) {
+        continue;
+      }
+      FileChange subscriptionChange;
+      subscriptionChange.flags = change.second;
+      if (is_below(change.first, subscription->realPath)) {
+        subscriptionChange.path = subscription->path;
+        subscriptionChange.path += change.first.substr(subscription->realPath.length());
+      } else if ((change.second & FileChange::Overflow) && is_below(subscription->realPath, change.first)) {
+        subscriptionChange.path = subscription->path;
+      } else {
+        continue;
+      }
+      batch.push_back(subscriptionChange);
+    }
+    if (!batch.empty()) {
+      subscription->callback(batch);
+    }
+  }
+}
+
+void FileWatchService::add_directory(const String& path, bool reportEntries) {
+#if defined(LINUX)
+  // Iterative walk, directory trees can be deeper than the stack likes
+  Vector<String> directories;
+  directories.push_back(path);
+  while (!directories.empty()) {
+    const String directoryPath = directories.back();
+    directories.pop_back();
+
+    bool isWatched = false;
+    if (!mWatchLimitReached) {
+      const int watchHandle = inotify_add_watch(mInotifyHandle, directoryPath.c_str(), WatchMask);
+      if (watchHandle >= 0) {
+        // Adding a watch twice returns the same handle
+        mWatchPaths[watchHandle] = directoryPath;
+        mWatchHandles[directoryPath] = watchHandle;
+        isWatched = true;
+      } else if (ENOSPC == errno) {
+        mWatchLimitReached = true;
+        BE_LOG(Warning, "The inotify watch limit has been reached (see /proc/sys/fs/inotify/max_user_watches), the remaining directories are polled")
+      } else {
+        // Removed in between or not accessible
+        continue;
+      }
+    }
+
+    DIR* directory = opendir(directoryPath.c_str());
+    if (nullptr == directory) {
+      continue;
+    }
+    const int directoryHandle = dirfd(directory);
+    hash_set<uint64>* watchedFiles = isWatched ? &mWatchedFiles[mWatchHandles[directoryPath]] : nullptr;
+    PolledDirectory* polledDirectory = nullptr;
+    if (!isWatched && !is_polled(directoryPath)) {
+      polledDirectory = new PolledDirectory();
+      polledDirectory->path = directoryPath;
+      if (mPolledDirectories.empty()) {
+        mNextPollTime = Platform::instance().get_milliseconds() + mPollInterval;
+      }
+      mPolledDirectories.push_back(polledDirectory);
+    }
+    while (const dirent* entry = readdir(directory)) {
+      const bool isDirectory = is_directory_entry(directoryHandle, *entry);
+      if (is_skipped_entry(entry->d_name, isDirectory)) {
+        continue;
+      }
+      if (polledDirectory) {
+        polledDirectory->entries.emplace(entry->d_name, get_entry_stamp(directoryHandle, entry->d_name));
+      }
+      if (watchedFiles && !isDirectory) {
+        watchedFiles->insert(string_hash(entry->d_name, strlen(entry->d_name)));
+      }
+      if (reportEntries || isDirectory) {
+        String entryPath = directoryPath;
+        entryPath += '/';
+        entryPath += entry->d_name;
+        if (isDirectory) {
+          directories.push_back(entryPath);
+        }
+        if (reportEntries) {
+          add_change(std::move(entryPath), FileChange::Added | (isDirectory ? FileChange::Directory : 0));
+        }
+      }
+    }
+    closedir(directory);
+  }
+#endif
+}
+
+bool FileWatchService::is_polled(const String& path) const {
+  for (const PolledDirectory* polledDirectory : mPolledDirectories) {
+    if (polledDirectory->path == path) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FileWatchService::remove_directory(const String& path) {
+#if defined(LINUX)
+  Vector<int32> watchHandles;
+  for (const auto& watchHandle : mWatchHandles) {
+    if (is_below(watchHandle.first, path)) {
+      watchHandles.push_back(watchHandle.second);
+    }
+  }
+  for (const int32 watchHandle : watchHandles) {
+    // Fails for directories which are already gone, their watch was removed by the kernel
+    inotify_rm_watch(mInotifyHandle, watchHandle);
+    hash_map<int32, String>::iterator watchPath = mWatchPaths.find(watchHandle);
+    if (mWatchPaths.end() != watchPath) {
+      mWatchHandles.erase(watchPath->second);
+      mWatchPaths.erase(watchPath);
+      mWatchedFiles.erase(watchHandle);
+    }
+  }
+#endif
+
+  for (uint32 i = 0; i < mPolledDirectories.size(); ) {
+    if (is_below(mPolledDirectories[i]->path, path)) {
+      delete mPolledDirectories[i];
+      mPolledDirectories.erase_at(i);
+    } else {
+      ++i;
+    }
+  }
+}
+
+void FileWatchService::add_change(String&& path, uint32 flags) {
+  const uint64 now = Platform::instance().get_milliseconds();
+  if (mPendingChanges.empty()) {
+    mFirstPendingTime = now;
+  }
+  mLastPendingTime = now;
+
+  const auto result = mPendingChanges.try_emplace(std::move(path), flags);
+  if (result.second) {
+    return;
+  }
+
+  // Merge with the changes already pending for the path
+  uint32& pendingFlags = result.first.value();
+  const uint32 otherFlags = (pendingFlags | flags) & (FileChange::Directory | FileChange::Overflow);
+  if (flags & FileChange::Removed) {
+    // Created and removed within one batch cancels out
+    pendingFlags = (pendingFlags & FileChange::Added) ? otherFlags : (FileChange::Removed | otherFlags);
+  } else if (flags & FileChange::Added) {
+    // Removed and created again, e.g. deleted and written anew by a tool
+    pendingFlags = (pendingFlags & FileChange::Removed) ? (FileChange::Modified | otherFlags) : (FileChange::Added | otherFlags);
+  } else if (0 == (pendingFlags & (FileChange::Added | FileChange::Removed))) {
+    // Modifications of a new file are implied by it being added
+    pendingFlags |= flags;
+  }
+}
+
+void FileWatchService::wake_up() {
+#if defined(LINUX)
+  if (mWakeUpHandle >= 0) {
+    const uint64 value = 1;
+    [[maybe_unused]] const ssize_t result = ::write(mWakeUpHandle, &value, sizeof(value));
+  }
+#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
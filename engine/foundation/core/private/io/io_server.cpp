@@ -28,8 +28,11 @@
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 #include "core/io/io_server.h"
+#include "core/io/file_stream.h"
 #include "core/io/filesystem.h"
 #include "core/io/mount_point_registry.h"
+#include "core/io/pack_archive.h"
+#include <cerrno>
 
 
 //[-------------------------------------------------------]
@@ -66,7 +69,17 @@ Ptr<MountPointRegistry> &IoServer::get_mount_point_registry() {
 
 bool IoServer::mount(const String &realDirectory, const String &mountPoint, bool appendToPath) {
   if (!mMountPointRegistry->has_mount_point(mountPoint)) {
-    mMountPointRegistry->add_mount_point(mountPoint, realDirectory);
+    // A file is mounted as pack archive, stored with its resolved filename for "find_archive()"
+    const String realPath = mMountPointRegistry->resolve_path(realDirectory);
+    if (mFilesystem->is_file(realPath)) {
+      Ptr<PackArchive> archive(new PackArchive());
+      if (!archive->open(realPath)) {
+        return false;
+      }
+      mMountPointRegistry->add_mount_point(MountPoint(mountPoint, realPath, archive));
+    } else {
+      mMountPointRegistry->add_mount_point(mountPoint, realDirectory);
+    }
 
     return true;
   }
@@ -97,6 +110,68 @@ String IoServer::resolve_path(const String& path) const {
   return mMountPointRegistry->resolve_path(path);
 }
 
+String IoServer::resolve_path(PathView path) const {
+  return mMountPointRegistry->resolve_path(path);
+}
+
+
+Ptr<Stream> IoServer::create_stream(const Path& path, EFileMode fileMode) const {
+  String realPath;
+  String entryName;
+  PackArchive* archive = resolve(path.get_native_path(), realPath, entryName);
+  if (archive) {
+    const uint32 index = archive->find_entry(entryName);
+    return (EFileMode::Read == fileMode && PackArchive::InvalidIndex != index) ? archive->create_stream(index) : Ptr<Stream>();
+  }
+
+  Ptr<Stream> stream(new FileStream());
+  stream->set_path(Path(realPath));
+  stream->set_access_mode(fileMode);
+  return stream;
+}
+
+
+Ptr<AsyncFileRead> IoServer::read_async(const AsyncReadRequest& request) const {
+  AsyncFileIo& asyncFileIo = AsyncFileIo::instance();
+  if (!asyncFileIo.is_running()) {
+    asyncFileIo.start();
+  }
+
+  AsyncReadRequest resolvedRequest = request;
+  if (!resolve_request(resolvedRequest)) {
+    return asyncFileIo.fail(request, ENOTSUP);
+  }
+  return asyncFileIo.read(resolvedRequest);
+}
+
+void IoServer::read_async(const AsyncReadRequest* requests, uint32 numberOfRequests, Vector<Ptr<AsyncFileRead>>& reads) const {
+  AsyncFileIo& asyncFileIo = AsyncFileIo::instance();
+  if (!asyncFileIo.is_running()) {
+    asyncFileIo.start();
+  }
+
+  // Resolve up front so the queue lock is taken only once
+  AsyncReadRequest* resolvedRequests = new AsyncReadRequest[numberOfRequests];
+  bool* isResolved = new bool[numberOfRequests];
+  bool resolvedAll = true;
+  for (uint32 i = 0; i < numberOfRequests; ++i) {
+    resolvedRequests[i] = requests[i];
+    isResolved[i] = resolve_request(resolvedRequests[i]);
+    resolvedAll = resolvedAll && isResolved[i];
+  }
+  if (resolvedAll) {
+    asyncFileIo.read(resolvedRequests, numberOfRequests, reads);
+  } else {
+    // Keep the request order of the handles, the unreadable ones fail right away
+    reads.reserve(reads.size() + numberOfRequests);
+    for (uint32 i = 0; i < numberOfRequests; ++i) {
+      reads.push_back(isResolved[i] ? asyncFileIo.read(resolvedRequests[i]) : asyncFileIo.fail(requests[i], ENOTSUP));
+    }
+  }
+  delete [] isResolved;
+  delete [] resolvedRequests;
+}
+
 
 bool IoServer::create_directory(const Path &path) const {
   return mFilesystem->create_directory(mMountPointRegistry->resolve_path(path.get_native_path()));
@@ -107,20 +182,44 @@ bool IoServer::delete_directory(const Path &path) const {
 }
 
 bool IoServer::is_directory(const core::Path &path) const {
-  return mFilesystem->is_directory(mMountPointRegistry->resolve_path(path.get_native_path()));
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(path.get_native_path(), realPath, entryName);
+  if (archive) {
+    return archive->has_directory(entryName);
+  }
+  return mFilesystem->is_directory(realPath);
 }
 
 bool IoServer::directory_exists(const Path &path) const {
-  return mFilesystem->directory_exists(mMountPointRegistry->resolve_path(path.get_native_path()));
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(path.get_native_path(), realPath, entryName);
+  if (archive) {
+    return archive->has_directory(entryName);
+  }
+  return mFilesystem->directory_exists(realPath);
 }
 
 
 bool IoServer::is_file(const Path &path) const {
-  return mFilesystem->is_file(mMountPointRegistry->resolve_path(path.get_native_path()));
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(path.get_native_path(), realPath, entryName);
+  if (archive) {
+    return archive->has_entry(entryName);
+  }
+  return mFilesystem->is_file(realPath);
 }
 
 bool IoServer::file_exists(const Path &path) const {
-  return mFilesystem->file_exists(mMountPointRegistry->resolve_path(path.get_native_path()));
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(path.get_native_path(), realPath, entryName);
+  if (archive) {
+    return archive->has_entry(entryName);
+  }
+  return mFilesystem->file_exists(realPath);
 }
 
 bool IoServer::copy_file(const Path &from, const Path &to) const {
@@ -134,9 +233,17 @@ bool IoServer::delete_file(const Path &path) {
 void IoServer::enumerate_files(const String &directoryName, const String &realDirectoryName,
                                EEnumerationMode enumerationMode, Vector<String> &entries, bool recursive,
                                bool returnAsRelativePaths) const {
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(realDirectoryName, realPath, entryName);
+  if (archive) {
+    archive->enumerate(directoryName, entryName, enumerationMode, entries, recursive, returnAsRelativePaths);
+    return;
+  }
+
   mFilesystem->enumerate_files(
     directoryName,
-    mMountPointRegistry->resolve_path(realDirectoryName),
+    realPath,
     enumerationMode,
     entries,
     recursive,
@@ -155,11 +262,56 @@ Ptr<Filesystem>& IoServer::get_filesystem() {
 }
 
 core::int64 IoServer::get_last_modification_time(const String &filename) const {
-  return mFilesystem->get_last_modification_time(mMountPointRegistry->resolve_path(filename));
+  // Entries of an archive share the modification time of the archive
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(filename, realPath, entryName);
+  return mFilesystem->get_last_modification_time(archive ? archive->get_filename() : realPath);
 }
 
 core::int64 IoServer::get_file_size(const String &filename) const {
-  return mFilesystem->get_file_size(mMountPointRegistry->resolve_path(filename));
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(filename, realPath, entryName);
+  if (archive) {
+    const uint32 index = archive->find_entry(entryName);
+    return (PackArchive::InvalidIndex != index) ? static_cast<int64>(archive->get_entry(index).size) : -1;
+  }
+  return mFilesystem->get_file_size(realPath);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+PackArchive* IoServer::resolve(PathView path, String& realPath, String& entryName) const {
+  return mMountPointRegistry->resolve_path(path, realPath, entryName);
+}
+
+bool IoServer::resolve_request(AsyncReadRequest& request) const {
+  String realPath;
+  String entryName;
+  const PackArchive* archive = resolve(request.filename, realPath, entryName);
+  if (nullptr == archive) {
+    request.filename = realPath;
+    return true;
+  }
+
+  // Stored entries are plain ranges of the archive file, unknown entries are left to fail on open
+  const uint32 index = archive->find_entry(entryName);
+  if (PackArchive::InvalidIndex == index) {
+    request.filename = realPath;
+    return true;
+  }
+  const PackEntry& entry = archive->get_entry(index);
+  if (EPackCompression::None != entry.compression) {
+    return false;
+  }
+  const uint64 offset = (request.offset < entry.size) ? request.offset : entry.size;
+  request.filename = archive->get_filename();
+  request.numberOfBytes = (request.numberOfBytes < entry.size - offset) ? request.numberOfBytes : entry.size - offset;
+  request.offset = entry.offset + offset;
+  return true;
 }
 
 
@@ -32,6 +32,30 @@
 namespace core {
 
 
+//[-------------------------------------------------------]
+//[ Local classes                                         ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Unmaps the stream when leaving the scope.
+ */
+namespace {
+class StreamUnmapper {
+public:
+  explicit StreamUnmapper(Stream& stream)
+  : mStream(stream) {
+  }
+
+  ~StreamUnmapper() {
+    mStream.unmap();
+  }
+
+private:
+  Stream& mStream;
+};
+}
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -47,14 +71,34 @@ JsonReader::~JsonReader() {
 
 
 JsonValue JsonReader::read() {
-  JsonValue result;
+  // Parse straight from the mapped stream content, saves the copy into a string
+  if (mStream->can_be_mapped() && !mStream->is_mapped()) {
+    const char* data = static_cast<const char*>(mStream->map());
+    if (data) {
+      // Return the temporary so no JsonValue copy is made, the stream gets unmapped afterwards
+      const StreamUnmapper unmapper(*mStream);
+      return JsonParser::parse(data, mStream->get_size());
+    }
+  }
 
-  String content = mStream->get_content_as_string();
+  const String content = mStream->get_content_as_string();
+  return JsonParser::parse(content);
+}
 
-  JsonParser parser(content);
-  parser.parse_object(&result, true);
+bool JsonReader::read(JsonDocument& document) {
+  // Neither the mapping nor the content string outlive this call, so the document has to keep
+  // its own copy
+  if (mStream->can_be_mapped() && !mStream->is_mapped()) {
+    const char* data = static_cast<const char*>(mStream->map());
+    if (data) {
+      const bool result = document.parse(data, mStream->get_size(), true);
+      mStream->unmap();
+      return result;
+    }
+  }
 
-  return result;
+  const String content = mStream->get_content_as_string();
+  return document.parse(content, true);
 }
 
 
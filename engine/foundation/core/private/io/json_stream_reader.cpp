@@ -0,0 +1,428 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/json_stream_reader.h"
+#include "core/io/stream.h"
+#include "core/json/json_sax_handler.h"
+#include "core/string/number_conversion.h"
+#include "core/string/string_utils.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static bool is_terminator(int c) {
+  return c < 0 || c <= ' ' || c == ',' || c == '#' || c == ':' || c == '{' || c == '}' || c == '[' || c == ']' || c == '"';
+}
+
+static void append_to_token(Vector<char>& token, const char* data, sizeT size) {
+  for (sizeT i = 0; i < size; ++i) {
+    token.push_back(data[i]);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonStreamReader::JsonStreamReader(uint32 chunkSize)
+: mChunkSize(0)
+, mChunkPosition(0)
+, mChunkOffset(0)
+, mEndOfStream(false)
+, mTokenOffset(0)
+, mError("")
+, mErrorOffset(0) {
+  mChunk.resize(chunkSize > 0 ? chunkSize : DefaultChunkSize);
+}
+
+JsonStreamReader::~JsonStreamReader() {
+  if (is_open()) {
+    close();
+  }
+}
+
+bool JsonStreamReader::read(JsonSaxHandler& handler) {
+  mChunkSize = 0;
+  mChunkPosition = 0;
+  mChunkOffset = 0;
+  mEndOfStream = false;
+  mToken.clear();
+  mStack.clear();
+  mError = "";
+  mErrorOffset = 0;
+
+  skip_whitespace();
+  const int first = peek();
+  const bool implicitRoot = (first != '{' && first != '[');
+  if (implicitRoot) {
+    // The root object may omit its braces
+    if (!handler.on_begin_object()) {
+      return set_error("Stopped by handler");
+    }
+    mStack.push_back('{');
+  } else if (!read_value(handler)) {
+    return false;
+  }
+
+  while (!mStack.empty()) {
+    skip_whitespace();
+    const int c = peek();
+    const bool isImplicitRoot = implicitRoot && (mStack.size() == 1);
+
+    if (mStack.back() == '{') {
+      if (c == '}' || (c < 0 && isImplicitRoot)) {
+        if (c == '}') {
+          if (isImplicitRoot) {
+            return set_error("Unexpected '}'");
+          }
+          advance();
+        }
+        mStack.pop_back();
+        if (!handler.on_end_object()) {
+          return set_error("Stopped by handler");
+        }
+        continue;
+      }
+      if (c < 0) {
+        return set_error("Unterminated object");
+      }
+
+      if (!read_key(handler)) {
+        return false;
+      }
+      skip_whitespace();
+      if (peek() != ':') {
+        return set_error("Expected ':' after object key");
+      }
+      advance();
+      skip_whitespace();
+      if (!read_value(handler)) {
+        return false;
+      }
+    } else {
+      if (c == ']') {
+        advance();
+        mStack.pop_back();
+        if (!handler.on_end_array()) {
+          return set_error("Stopped by handler");
+        }
+        continue;
+      }
+      if (c < 0) {
+        return set_error("Unterminated array");
+      }
+      if (!read_value(handler)) {
+        return false;
+      }
+    }
+  }
+
+  skip_whitespace();
+  if (peek() >= 0) {
+    return set_error("Unexpected content after the root value");
+  }
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+bool JsonStreamReader::fill() {
+  if (mEndOfStream) {
+    return false;
+  }
+
+  mChunkOffset += mChunkSize;
+  mChunkPosition = 0;
+  mChunkSize = static_cast<uint32>(mStream->read(mChunk.data(), mChunk.size()));
+  if (mChunkSize == 0) {
+    mEndOfStream = true;
+    return false;
+  }
+  return true;
+}
+
+void JsonStreamReader::skip_whitespace() {
+  for (;;) {
+    const int c = peek();
+    if (c < 0) {
+      return;
+    }
+    if (c <= ' ' || c == ',') {
+      advance();
+    } else if (c == '#') {
+      // Comments run until the end of the line
+      while (peek() >= 0 && peek() != '\n') {
+        advance();
+      }
+    } else {
+      return;
+    }
+  }
+}
+
+bool JsonStreamReader::read_value(JsonSaxHandler& handler) {
+  const int c = peek();
+  switch (c) {
+    case '{':
+    case '[':
+      if (mStack.size() >= MaxDepth) {
+        return set_error("Maximum nesting depth exceeded");
+      }
+      advance();
+      mStack.push_back(static_cast<char>(c));
+      if (!((c == '{') ? handler.on_begin_object() : handler.on_begin_array())) {
+        return set_error("Stopped by handler");
+      }
+      return true;
+
+    case '"': {
+      bool rawText = false;
+      if (!read_string(rawText)) {
+        return false;
+      }
+      if (!handler.on_string(StringView(mToken.data(), mToken.size()), rawText)) {
+        return set_error("Stopped by handler");
+      }
+      return true;
+    }
+
+    case -1:
+      return set_error("Unexpected end of stream");
+
+    default:
+      return read_atom() && emit_atom(handler);
+  }
+}
+
+bool JsonStreamReader::read_key(JsonSaxHandler& handler) {
+  if (peek() == '"') {
+    bool rawText = false;
+    if (!read_string(rawText)) {
+      return false;
+    }
+  } else {
+    // Unquoted keys run up to the ':' and may contain whitespace, which is trimmed at the end
+    mToken.clear();
+    for (int c = peek(); c >= 0 && c != ':' && c != '"' && c != '#' && c != '{' && c != '}' && c != '[' && c != ']'; c = peek()) {
+      mToken.push_back(static_cast<char>(c));
+      advance();
+    }
+    while (!mToken.empty() && (static_cast<uint8>(mToken.back()) <= ' ' || mToken.back() == ',')) {
+      mToken.pop_back();
+    }
+    if (mToken.empty()) {
+      return set_error("Expected object key");
+    }
+  }
+
+  if (!handler.on_key(StringView(mToken.data(), mToken.size()))) {
+    return set_error("Stopped by handler");
+  }
+  return true;
+}
+
+bool JsonStreamReader::read_string(bool& rawText) {
+  mToken.clear();
+  rawText = false;
+
+  // Opening quote, an immediately following quote is either an empty string or a raw text block
+  advance();
+  if (peek() == '"') {
+    advance();
+    if (peek() != '"') {
+      return true;
+    }
+    advance();
+    rawText = true;
+    return read_raw_text();
+  }
+
+  for (;;) {
+    if (mChunkPosition >= mChunkSize && !fill()) {
+      return set_error("Unterminated string");
+    }
+
+    // Take the run up to the next delimiter in one go
+    const char* begin = mChunk.data() + mChunkPosition;
+    const char* end = mChunk.data() + mChunkSize;
+    const char* current = begin;
+    while (current < end && *current != '"' && *current != '\\') {
+      ++current;
+    }
+    append_to_token(mToken, begin, static_cast<sizeT>(current - begin));
+    mChunkPosition += static_cast<uint32>(current - begin);
+    if (current == end) {
+      continue;
+    }
+
+    advance();
+    if (*current == '"') {
+      return true;
+    }
+
+    // Escape sequence
+    const int escape = peek();
+    advance();
+    switch (escape) {
+      case '"':  mToken.push_back('"'); break;
+      case '\\': mToken.push_back('\\'); break;
+      case '/':  mToken.push_back('/'); break;
+      case 'b':  mToken.push_back('\b'); break;
+      case 'f':  mToken.push_back('\f'); break;
+      case 'n':  mToken.push_back('\n'); break;
+      case 'r':  mToken.push_back('\r'); break;
+      case 't':  mToken.push_back('\t'); break;
+      case 'u': {
+        uint32 codePoint = 0;
+        for (uint32 i = 0; i < 8; ++i) {
+          // The second half of a surrogate pair is read in the same loop
+          if (i == 4) {
+            if (codePoint < 0xd800 || codePoint > 0xdbff) {
+              break;
+            }
+            if (peek() != '\\') {
+              return set_error("Invalid unicode surrogate pair");
+            }
+            advance();
+            if (peek() != 'u') {
+              return set_error("Invalid unicode surrogate pair");
+            }
+            advance();
+          }
+          const int c = peek();
+          const int digit = (c < 0) ? -1 : hex_digit_value(static_cast<char>(c));
+          if (digit < 0) {
+            return set_error("Invalid unicode escape sequence");
+          }
+          advance();
+          codePoint = (codePoint << 4) | static_cast<uint32>(digit);
+        }
+
+        if (codePoint > 0xffff) {
+          const uint32 high = codePoint >> 16;
+          const uint32 low = codePoint & 0xffff;
+          if (low < 0xdc00 || low > 0xdfff) {
+            return set_error("Invalid unicode surrogate pair");
+          }
+          codePoint = 0x10000 + ((high - 0xd800) << 10) + (low - 0xdc00);
+        } else if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+          return set_error("Invalid unicode surrogate pair");
+        }
+
+        char utf8[4];
+        append_to_token(mToken, utf8, encode_utf8(codePoint, utf8));
+        break;
+      }
+      default:
+        return set_error("Invalid escape sequence");
+    }
+  }
+}
+
+bool JsonStreamReader::read_raw_text() {
+  // Everything up to the closing '"""' is taken as it is
+  uint32 numQuotes = 0;
+  for (int c = peek(); c >= 0; c = peek()) {
+    advance();
+    if (c == '"') {
+      if (++numQuotes == 3) {
+        return true;
+      }
+      continue;
+    }
+    for (; numQuotes > 0; --numQuotes) {
+      mToken.push_back('"');
+    }
+    mToken.push_back(static_cast<char>(c));
+  }
+  return set_error("Unterminated raw text block");
+}
+
+bool JsonStreamReader::read_atom() {
+  mToken.clear();
+  mTokenOffset = get_offset();
+  for (int c = peek(); !is_terminator(c); c = peek()) {
+    mToken.push_back(static_cast<char>(c));
+    advance();
+  }
+  return !mToken.empty() || set_error("Unexpected character");
+}
+
+bool JsonStreamReader::emit_atom(JsonSaxHandler& handler) {
+  const StringView token(mToken.data(), mToken.size());
+  bool result;
+  if (token.compare("true") == 0) {
+    result = handler.on_bool(true);
+  } else if (token.compare("false") == 0) {
+    result = handler.on_bool(false);
+  } else if (token.compare("null") == 0) {
+    result = handler.on_null();
+  } else {
+    const char* begin = token.data();
+    const char* end = begin + token.size();
+    if (*begin != '-' && (*begin < '0' || *begin > '9')) {
+      set_error("Unexpected character");
+      mErrorOffset = mTokenOffset;
+      return false;
+    }
+
+    // Integers which fit into 64 bit, everything else is a number
+    int64 integer = 0;
+    if (core::from_chars(begin, end, integer) == end) {
+      result = handler.on_integer(integer);
+    } else {
+      double number = 0.0;
+      if (core::from_chars(begin, end, number) != end) {
+        set_error("Invalid number");
+        mErrorOffset = mTokenOffset;
+        return false;
+      }
+      result = handler.on_number(number);
+    }
+  }
+
+  return result || set_error("Stopped by handler");
+}
+
+bool JsonStreamReader::set_error(const char* error) {
+  mError = error;
+  mErrorOffset = get_offset();
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
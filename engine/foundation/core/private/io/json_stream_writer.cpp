@@ -0,0 +1,386 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/json_stream_writer.h"
+#include "core/io/stream.h"
+#include "core/json/json_binary.h"
+#include "core/json/json_document.h"
+#include "core/json/json_value.h"
+#include "core/string/number_conversion.h"
+#include <cmath>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonStreamWriter::JsonStreamWriter(uint32 indentationLength, uint32 bufferSize)
+: mBufferUsed(0)
+, mIndentationLength(indentationLength)
+, mAfterKey(false) {
+  mBuffer.resize(bufferSize > 0 ? bufferSize : DefaultBufferSize);
+}
+
+JsonStreamWriter::~JsonStreamWriter() {
+  if (is_open()) {
+    close();
+  }
+}
+
+void JsonStreamWriter::close() {
+  flush();
+  mNumValues.clear();
+  mAfterKey = false;
+
+  StreamWriter::close();
+}
+
+void JsonStreamWriter::flush() {
+  if (mBufferUsed > 0) {
+    mStream->write(mBuffer.data(), mBufferUsed);
+    mBufferUsed = 0;
+  }
+}
+
+void JsonStreamWriter::begin_object() {
+  begin_container('{');
+}
+
+void JsonStreamWriter::end_object() {
+  end_container('}');
+}
+
+void JsonStreamWriter::begin_array() {
+  begin_container('[');
+}
+
+void JsonStreamWriter::end_array() {
+  end_container(']');
+}
+
+void JsonStreamWriter::key(StringView name) {
+  BE_ASSERT(!mNumValues.empty() && !mAfterKey, "A member name is only valid inside of an object")
+
+  begin_value();
+  write_escaped(name);
+  if (mIndentationLength > 0) {
+    put(": ", 2);
+  } else {
+    put(':');
+  }
+  mAfterKey = true;
+}
+
+void JsonStreamWriter::write_null() {
+  begin_value();
+  put("null", 4);
+}
+
+void JsonStreamWriter::write_bool(bool value) {
+  begin_value();
+  if (value) {
+    put("true", 4);
+  } else {
+    put("false", 5);
+  }
+}
+
+void JsonStreamWriter::write_integer(int64 value) {
+  begin_value();
+
+  char text[MaxNumberChars];
+  put(text, static_cast<sizeT>(core::to_chars(text, text + MaxNumberChars, value) - text));
+}
+
+void JsonStreamWriter::write_number(double value) {
+  if (!std::isfinite(value)) {
+    // JSON has no representation for infinity and NaN
+    write_null();
+    return;
+  }
+
+  begin_value();
+
+  // Shortest representation which parses back to the very same value
+  char text[MaxNumberChars];
+  const sizeT length = static_cast<sizeT>(core::to_chars(text, text + MaxNumberChars, value) - text);
+  put(text, length);
+
+  // Keep the value a number when it is read back, otherwise it would become an integer
+  bool integral = true;
+  for (sizeT i = 0; i < length; ++i) {
+    if (text[i] == '.' || text[i] == 'e') {
+      integral = false;
+      break;
+    }
+  }
+  if (integral) {
+    put(".0", 2);
+  }
+}
+
+void JsonStreamWriter::write_string(StringView value, bool rawText) {
+  begin_value();
+
+  if (rawText) {
+    put("\"\"\"", 3);
+    put(value.data(), value.size());
+    put("\"\"\"", 3);
+  } else {
+    write_escaped(value);
+  }
+}
+
+void JsonStreamWriter::write_value(const JsonValue& value) {
+  switch (value.get_type()) {
+    case JsonType_Null:
+      write_null();
+      break;
+    case JsonType_Boolean:
+      write_bool(value.to_bool());
+      break;
+    case JsonType_Integer:
+      write_integer(value.to_integer());
+      break;
+    case JsonType_Number:
+      write_number(value.to_number());
+      break;
+    case JsonType_String:
+      write_string(StringView(value.to_string().c_str(), value.to_string().length()), value.is_raw_text());
+      break;
+    case JsonType_Array: {
+      begin_array();
+      const Vector<JsonValue*>& elements = value.get_array();
+      for (sizeT i = 0; i < elements.size(); ++i) {
+        write_value(*elements[i]);
+      }
+      end_array();
+      break;
+    }
+    case JsonType_Object: {
+      begin_object();
+      const Map<String, JsonValue*>& members = value.get_object();
+      for (auto iter = members.cbegin(); iter != members.cend(); ++iter) {
+        key(StringView(iter.key().c_str(), iter.key().length()));
+        write_value(*iter.value());
+      }
+      end_object();
+      break;
+    }
+  }
+}
+
+void JsonStreamWriter::write_value(const JsonElement& element) {
+  switch (element.get_type()) {
+    case JsonType_Null:
+      write_null();
+      break;
+    case JsonType_Boolean:
+      write_bool(element.to_bool());
+      break;
+    case JsonType_Integer:
+      write_integer(element.to_integer());
+      break;
+    case JsonType_Number:
+      write_number(element.to_number());
+      break;
+    case JsonType_String:
+      write_string(element.to_string(), element.is_raw_text());
+      break;
+    case JsonType_Array: {
+      begin_array();
+      const uint32 size = element.get_size();
+      for (uint32 i = 0; i < size; ++i) {
+        write_value(element(i));
+      }
+      end_array();
+      break;
+    }
+    case JsonType_Object: {
+      begin_object();
+      const uint32 size = element.get_size();
+      for (uint32 i = 0; i < size; ++i) {
+        key(element.get_member_name(i));
+        write_value(element.get_member_value(i));
+      }
+      end_object();
+      break;
+    }
+  }
+}
+
+void JsonStreamWriter::write_value(const JsonBinaryElement& element) {
+  switch (element.get_type()) {
+    case JsonType_Null:
+      write_null();
+      break;
+    case JsonType_Boolean:
+      write_bool(element.to_bool());
+      break;
+    case JsonType_Integer:
+      write_integer(element.to_integer());
+      break;
+    case JsonType_Number:
+      write_number(element.to_number());
+      break;
+    case JsonType_String:
+      write_string(element.to_string(), element.is_raw_text());
+      break;
+    case JsonType_Array: {
+      begin_array();
+      const uint32 size = element.get_size();
+      JsonBinaryElement child = element.get_first();
+      for (uint32 i = 0; i < size; ++i) {
+        write_value(child);
+        if (i + 1 < size) {
+          child = child.get_next();
+        }
+      }
+      end_array();
+      break;
+    }
+    case JsonType_Object: {
+      begin_object();
+      const uint32 size = element.get_size();
+      JsonBinaryElement name = element.get_first();
+      for (uint32 i = 0; i < size; ++i) {
+        const JsonBinaryElement value = name.get_next();
+        key(name.to_string());
+        write_value(value);
+        if (i + 1 < size) {
+          name = value.get_next();
+        }
+      }
+      end_object();
+      break;
+    }
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+void JsonStreamWriter::begin_value() {
+  if (mAfterKey) {
+    // The value belongs to the member name written right before
+    mAfterKey = false;
+    return;
+  }
+
+  if (!mNumValues.empty()) {
+    if (mNumValues.back()++ > 0) {
+      put(',');
+    }
+    write_line_break(static_cast<uint32>(mNumValues.size()));
+  }
+}
+
+void JsonStreamWriter::begin_container(char bracket) {
+  begin_value();
+  put(bracket);
+  mNumValues.push_back(0);
+}
+
+void JsonStreamWriter::end_container(char bracket) {
+  BE_ASSERT(!mNumValues.empty() && !mAfterKey, "Unbalanced JSON container")
+
+  const uint32 numValues = mNumValues.back();
+  mNumValues.pop_back();
+  if (numValues > 0) {
+    write_line_break(static_cast<uint32>(mNumValues.size()));
+  }
+  put(bracket);
+}
+
+void JsonStreamWriter::write_line_break(uint32 level) {
+  if (mIndentationLength > 0) {
+    put('\n');
+    for (uint32 i = 0; i < level * mIndentationLength; ++i) {
+      put(' ');
+    }
+  }
+}
+
+void JsonStreamWriter::write_escaped(StringView value) {
+  static constexpr char HexDigits[] = "0123456789abcdef";
+
+  put('"');
+
+  // Copy runs of characters which need no escaping as a whole
+  const char* data = value.data();
+  sizeT runStart = 0;
+  for (sizeT i = 0; i < value.size(); ++i) {
+    const unsigned char c = static_cast<unsigned char>(data[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    put(data + runStart, i - runStart);
+    runStart = i + 1;
+
+    put('\\');
+    switch (c) {
+      case '"':  put('"');  break;
+      case '\\': put('\\'); break;
+      case '\b': put('b');  break;
+      case '\f': put('f');  break;
+      case '\n': put('n');  break;
+      case '\r': put('r');  break;
+      case '\t': put('t');  break;
+      default: {
+        const char escape[5] = { 'u', '0', '0', HexDigits[c >> 4], HexDigits[c & 0x0f] };
+        put(escape, 5);
+        break;
+      }
+    }
+  }
+  put(data + runStart, value.size() - runStart);
+
+  put('"');
+}
+
+void JsonStreamWriter::put(const char* data, sizeT size) {
+  while (size > 0) {
+    if (mBufferUsed == mBuffer.size()) {
+      flush();
+    }
+    const sizeT chunk = std::min<sizeT>(size, mBuffer.size() - mBufferUsed);
+    Memory::copy(mBuffer.data() + mBufferUsed, data, static_cast<uint32>(chunk));
+    mBufferUsed += static_cast<uint32>(chunk);
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -146,7 +146,7 @@ sizeT MemoryStream::read(void *ptr, sizeT numBytes) {
   BE_ASSERT(mPosition + readBytes <= mSize, "Memory stream read out of bounds")
 
   if (readBytes > 0) {
-    Memory::copy(mBuffer + mPosition, ptr, readBytes);
+    Memory::copy(ptr, mBuffer + mPosition, readBytes);
     mPosition += readBytes;
   }
   return readBytes;
@@ -44,9 +44,17 @@ MountPoint::MountPoint(const String& mount, const String& realPath)
 
 }
 
+MountPoint::MountPoint(const String& mount, const String& realPath, const Ptr<PackArchive>& archive)
+: mMount(mount)
+, mRealPath(realPath)
+, mArchive(archive) {
+
+}
+
 MountPoint::MountPoint(const MountPoint& rhs)
 : mMount(rhs.mMount)
-, mRealPath(rhs.mRealPath) {
+, mRealPath(rhs.mRealPath)
+, mArchive(rhs.mArchive) {
 
 }
 
@@ -58,6 +66,7 @@ MountPoint::~MountPoint() {
 MountPoint& MountPoint::operator=(const core::MountPoint &rhs) {
   mMount = rhs.mMount;
   mRealPath = rhs.mRealPath;
+  mArchive = rhs.mArchive;
 
   return *this;
 }
@@ -79,6 +88,14 @@ const String& MountPoint::get_real_path() const {
   return mRealPath;
 }
 
+const Ptr<PackArchive>& MountPoint::get_archive() const {
+  return mArchive;
+}
+
+bool MountPoint::is_archive() const {
+  return mArchive.is_valid();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -23,6 +23,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/io/mount_point_registry.h"
+#include "core/threading/lock_guard.h"
+#include "core/utility/fnv1a.h"
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -34,8 +37,11 @@ namespace core {
 //[-------------------------------------------------------]
 //[ Public methods                                        ]
 //[-------------------------------------------------------]
-MountPointRegistry::MountPointRegistry() {
-
+MountPointRegistry::MountPointRegistry()
+: mCacheCapacity(DefaultCacheCapacity)
+, mNumCacheHits(0)
+, mNumCacheMisses(0) {
+  rebuild();
 }
 
 MountPointRegistry::~MountPointRegistry() {
@@ -45,27 +51,31 @@ MountPointRegistry::~MountPointRegistry() {
 void MountPointRegistry::add_mount_point(const MountPoint &mountPoint) {
   if (!has_mount_point(mountPoint.get_mount())) {
     mMountPoints.push_back(mountPoint);
-    mMapMountPoints[mountPoint.get_mount()] = mountPoint;
+    mMapMountPoints[Name(mountPoint.get_mount())] = mountPoint;
+    rebuild();
   }
 }
 
 void MountPointRegistry::add_mount_point(const String &mountPoint, const String &realDirectory) {
   if (!has_mount_point(mountPoint)) {
     mMountPoints.emplace_back(mountPoint, realDirectory);
-    mMapMountPoints[mountPoint] = mMountPoints.back();
+    mMapMountPoints[Name(mountPoint)] = mMountPoints.back();
+    rebuild();
   }
 }
 
 void MountPointRegistry::remove_mount_point(const String &mountPoint) {
   BE_ASSERT(has_mount_point(mountPoint), "Trying to unmount not registered mount point")
 
-  auto element = mMapMountPoints.find(mountPoint);
+  const Name mountName = Name::find(mountPoint);
+  auto element = mMapMountPoints.find(mountName);
   mMountPoints.erase(element.value());
-  mMapMountPoints.erase(mountPoint);
+  mMapMountPoints.erase(mountName);
+  rebuild();
 }
 
 bool MountPointRegistry::has_mount_point(const core::String &mountPoint) const {
-  return mMapMountPoints.find(mountPoint) != mMapMountPoints.cend();
+  return mMapMountPoints.find(Name::find(mountPoint)) != mMapMountPoints.cend();
 }
 
 const MountPoint &MountPointRegistry::get_mount_point_by_index(core::uint32 index) const {
@@ -73,7 +83,7 @@ const MountPoint &MountPointRegistry::get_mount_point_by_index(core::uint32 inde
 }
 
 const MountPoint &MountPointRegistry::get_mount_point_by_name(const String &mountPoint) const {
-  return mMapMountPoints.at(mountPoint);
+  return mMapMountPoints.at(Name::find(mountPoint));
 }
 
 const Vector<MountPoint> &MountPointRegistry::get_mount_points() const {
@@ -85,8 +95,9 @@ core::uint32 MountPointRegistry::get_num_of_mount_points() const {
 }
 
 String MountPointRegistry::get_real_path_of_mount(const String& mountPoint) const {
-  if (has_mount_point(mountPoint)) {
-    return mMapMountPoints.at(mountPoint).get_real_path();
+  auto element = mMapMountPoints.find(Name::find(mountPoint));
+  if (element != mMapMountPoints.cend()) {
+    return element->second.get_real_path();
   } else {
     static String SEmpty = "";
     return SEmpty;
@@ -94,27 +105,249 @@ String MountPointRegistry::get_real_path_of_mount(const String& mountPoint) cons
 }
 
 Path MountPointRegistry::resolve_path(const Path &path) const {
-  return Path(resolve_path(path.get_native_path()));
+  return Path(resolve_path(PathView(path.get_native_path())));
 }
 
 String MountPointRegistry::resolve_path(const String &path) const {
-  String resultPath = path;
+  return resolve_path(PathView(path));
+}
+
+String MountPointRegistry::resolve_path(PathView path) const {
+  return resolve_uncached(path);
+}
+
+const MountPoint* MountPointRegistry::find_mount_point_of(PathView realPath, PathView& relativePath) const {
+  core::sizeT prefixLength = 0;
+  const core::uint32 mountIndex = find_mount_index(realPath, false, prefixLength);
+  if (InvalidIndex == mountIndex) {
+    return nullptr;
+  }
+  const core::sizeT offset = (prefixLength < realPath.length()) ? prefixLength + 1 : prefixLength;
+  relativePath = PathView(realPath.data() + offset, realPath.length() - offset);
+  return &mMountPoints[mountIndex];
+}
+
+PackArchive* MountPointRegistry::find_archive(const String& path, String& entryName) const {
+  // Archive mounts resolve to "<archive filename>/<entry name>"
+  core::sizeT prefixLength = 0;
+  const core::uint32 mountIndex = find_mount_index(PathView(path), true, prefixLength);
+  if (InvalidIndex == mountIndex) {
+    return nullptr;
+  }
+  entryName = (prefixLength < path.length()) ? path.substr(prefixLength + 1) : String();
+  return mMountPoints[mountIndex].get_archive().get();
+}
+
+PackArchive* MountPointRegistry::resolve_path(PathView path, String& realPath, String& entryName) const {
+  core::uint32 archiveIndex = InvalidIndex;
+  core::sizeT entryOffset = 0;
+  resolve_cached(path, realPath, archiveIndex, entryOffset);
+  if (InvalidIndex == archiveIndex) {
+    return nullptr;
+  }
+  entryName = (entryOffset < realPath.length()) ? realPath.substr(entryOffset) : String();
+  return mMountPoints[archiveIndex].get_archive().get();
+}
+
+void MountPointRegistry::set_cache_capacity(core::uint32 capacity) {
+  LockGuard<Mutex> lock(mCacheMutex);
+  mCacheCapacity = capacity;
+  mCache.clear();
+  mPreviousCache.clear();
+}
+
+core::uint32 MountPointRegistry::get_cache_capacity() const {
+  LockGuard<Mutex> lock(mCacheMutex);
+  return mCacheCapacity;
+}
+
+core::uint64 MountPointRegistry::get_num_cache_hits() const {
+  LockGuard<Mutex> lock(mCacheMutex);
+  return mNumCacheHits;
+}
+
+core::uint64 MountPointRegistry::get_num_cache_misses() const {
+  LockGuard<Mutex> lock(mCacheMutex);
+  return mNumCacheMisses;
+}
+
+void MountPointRegistry::clear_cache() {
+  LockGuard<Mutex> lock(mCacheMutex);
+  mCache.clear();
+  mPreviousCache.clear();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void MountPointRegistry::rebuild() {
+  mResolvedMountPaths.clear();
+  mTrieMounts.clear();
+  mTrieEdges.clear();
+  mTrieMounts.push_back(InvalidIndex);
+  mTrieMounts.push_back(InvalidIndex);
 
-  String::SizeType  colonPosition = resultPath.find(":");
+  for (core::uint32 i = 0; i < mMountPoints.size(); ++i) {
+    const String realPath = flatten_real_path(mMountPoints[i].get_real_path());
+    mResolvedMountPaths[Name(mMountPoints[i].get_mount())] = realPath;
 
-  while (colonPosition != String::NPOS) {
-    String mountString = resultPath.substr(0, colonPosition);
-    if (has_mount_point(mountString)) {
-      resultPath.replace(colonPosition, 1, "/");
-      resultPath = resultPath.replace(0, colonPosition, get_real_path_of_mount(mountString));
-    } else {
-      break; // No more mount points found, break out of the loop
+    // Insert the segments of the real path, the first mount point ending at a node wins
+    const char* text = realPath.c_str();
+    const core::sizeT length = realPath.length();
+    core::uint32 node = (length > 0 && '/' == text[0]) ? 1 : 0;
+    core::sizeT position = 0;
+    while (position < length) {
+      const core::sizeT start = position;
+      while (position < length && '/' != text[position]) {
+        ++position;
+      }
+      if (position > start) {
+        const Name segment(StringView(text + start, position - start));
+        const core::uint64 key = (static_cast<core::uint64>(node) << 32) | segment.get_id();
+        auto edge = mTrieEdges.find(key);
+        if (edge == mTrieEdges.end()) {
+          const core::uint32 child = mTrieMounts.size();
+          mTrieMounts.push_back(InvalidIndex);
+          mTrieEdges.emplace(key, child);
+          node = child;
+        } else {
+          node = edge->second;
+        }
+      }
+      ++position;
     }
+    if (InvalidIndex == mTrieMounts[node]) {
+      mTrieMounts[node] = i;
+    }
+  }
+
+  clear_cache();
+}
+
+String MountPointRegistry::flatten_real_path(const String& realPath) const {
+  // Mounts may refer to other mounts, a cycle stops once every mount has been used once
+  String result = realPath;
+  for (core::uint32 i = 0; i <= mMountPoints.size(); ++i) {
+    const String::SizeType colonPosition = result.find(":");
+    if (colonPosition == String::NPOS) {
+      break;
+    }
+    auto element = mMapMountPoints.find(Name::find(StringView(result.c_str(), colonPosition)));
+    if (element == mMapMountPoints.cend()) {
+      break;
+    }
+    String resolved = element->second.get_real_path();
+    resolved += '/';
+    resolved.append(result.c_str() + colonPosition + 1, result.length() - colonPosition - 1);
+    result = resolved;
+  }
+  return result;
+}
+
+String MountPointRegistry::resolve_uncached(PathView path) const {
+  // Look the mount up by the prefix in place, unknown prefixes are never interned
+  const char* colon = (path.length() > 0) ? static_cast<const char*>(memchr(path.data(), ':', path.length())) : nullptr;
+  if (nullptr != colon) {
+    const core::sizeT colonPosition = static_cast<core::sizeT>(colon - path.data());
+    auto element = mResolvedMountPaths.find(Name::find(StringView(path.data(), colonPosition)));
+    if (element != mResolvedMountPaths.cend()) {
+      String result = element->second;
+      result += '/';
+      result.append(colon + 1, path.length() - colonPosition - 1);
+      return result;
+    }
+  }
+  return path.to_string();
+}
 
-    colonPosition = resultPath.find(":");
+core::uint32 MountPointRegistry::find_mount_index(PathView realPath, bool archivesOnly, core::sizeT& prefixLength) const {
+  // Walk the segments as long as the trie has them, remember the innermost matching mount point
+  const char* text = realPath.data();
+  const core::sizeT length = realPath.length();
+  core::uint32 node = (length > 0 && '/' == text[0]) ? 1 : 0;
+  core::uint32 mountIndex = InvalidIndex;
+  core::sizeT position = 0;
+  while (position < length) {
+    const core::sizeT start = position;
+    while (position < length && '/' != text[position]) {
+      ++position;
+    }
+    if (position > start) {
+      const Name segment = Name::find(StringView(text + start, position - start));
+      if (segment.is_empty()) {
+        break;
+      }
+      auto edge = mTrieEdges.find((static_cast<core::uint64>(node) << 32) | segment.get_id());
+      if (edge == mTrieEdges.cend()) {
+        break;
+      }
+      node = edge->second;
+      const core::uint32 candidate = mTrieMounts[node];
+      if (InvalidIndex != candidate && (!archivesOnly || mMountPoints[candidate].is_archive())) {
+        mountIndex = candidate;
+        prefixLength = position;
+      }
+    }
+    ++position;
   }
+  return mountIndex;
+}
 
-  return resultPath;
+void MountPointRegistry::resolve_cached(PathView path, String& realPath, core::uint32& archiveIndex, core::sizeT& entryOffset) const {
+  const core::uint64 hash = path.is_empty() ? 0 : FNV1a::calculate_fnv1a_64(reinterpret_cast<const core::uint8*>(path.data()), static_cast<core::uint32>(path.length()));
+  {
+    LockGuard<Mutex> lock(mCacheMutex);
+    auto element = mCache.find(hash);
+    if (element != mCache.end() && PathView(element->second.virtualPath) == path) {
+      ++mNumCacheHits;
+      realPath = element->second.realPath;
+      archiveIndex = element->second.archiveIndex;
+      entryOffset = element->second.entryOffset;
+      return;
+    }
+
+    // Recently used entries of the previous generation move back into the current one
+    element = mPreviousCache.find(hash);
+    if (element != mPreviousCache.end() && PathView(element->second.virtualPath) == path) {
+      ++mNumCacheHits;
+      const ResolvedPath resolvedPath = element->second;
+      mPreviousCache.erase(element);
+      insert_cached(hash, resolvedPath);
+      realPath = resolvedPath.realPath;
+      archiveIndex = resolvedPath.archiveIndex;
+      entryOffset = resolvedPath.entryOffset;
+      return;
+    }
+    ++mNumCacheMisses;
+  }
+
+  ResolvedPath resolvedPath;
+  resolvedPath.virtualPath = path.to_string();
+  resolvedPath.realPath = resolve_uncached(path);
+  core::sizeT prefixLength = 0;
+  resolvedPath.archiveIndex = find_mount_index(PathView(resolvedPath.realPath), true, prefixLength);
+  resolvedPath.entryOffset = (prefixLength < resolvedPath.realPath.length()) ? prefixLength + 1 : prefixLength;
+  realPath = resolvedPath.realPath;
+  archiveIndex = resolvedPath.archiveIndex;
+  entryOffset = resolvedPath.entryOffset;
+
+  LockGuard<Mutex> lock(mCacheMutex);
+  insert_cached(hash, resolvedPath);
+}
+
+void MountPointRegistry::insert_cached(core::uint64 hash, const ResolvedPath& resolvedPath) const {
+  // Two generations approximate least recently used: once the current one is full it replaces the
+  // previous one, entries which haven't been used since are dropped with it
+  if (0 == mCacheCapacity) {
+    return;
+  }
+  const core::uint32 generationCapacity = (mCacheCapacity > 1) ? mCacheCapacity / 2 : 1;
+  if (mCache.size() >= generationCapacity) {
+    mPreviousCache.swap(mCache);
+    mCache.clear();
+  }
+  mCache.insert_or_assign(hash, resolvedPath);
 }
 
 
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/pack_archive.h"
+#include "core/core/default_assert.h"
+#include "core/io/filesystem_helper.h"
+#include "core/io/pack_stream.h"
+#include "core/tools/compression_lz4.h"
+#include "core/utility/fnv1a.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+namespace {
+
+/**
+ * @brief
+ * Strips leading and trailing '/' of a name inside the archive.
+ */
+void trim_name(const String& name, const char*& begin, sizeT& length) {
+  begin = name.c_str();
+  length = name.length();
+  while (length > 0 && '/' == *begin) {
+    ++begin;
+    --length;
+  }
+  while (length > 0 && '/' == begin[length - 1]) {
+    --length;
+  }
+}
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+uint64 PackArchive::hash_name(const char* name, sizeT length) {
+  return (length > 0) ? FNV1a::calculate_fnv1a_64(reinterpret_cast<const uint8*>(name), static_cast<uint32>(length)) : FNV1a::FNV1a_INITIAL_HASH_64;
+}
+
+uint64 PackArchive::hash_content(const uint8* content, uint64 numberOfBytes) {
+  // The FNV-1a implementation takes 32 bit sizes, hash huge files piecewise
+  static constexpr uint64 MaximumChunkSize = 1u << 30;
+  uint64 hash = FNV1a::FNV1a_INITIAL_HASH_64;
+  while (numberOfBytes > 0) {
+    const uint64 chunkSize = (numberOfBytes < MaximumChunkSize) ? numberOfBytes : MaximumChunkSize;
+    hash = FNV1a::calculate_fnv1a_64(content, static_cast<uint32>(chunkSize), hash);
+    content += chunkSize;
+    numberOfBytes -= chunkSize;
+  }
+  return hash;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+PackArchive::PackArchive()
+: mData(nullptr)
+, mSize(0)
+, mHeader(nullptr)
+, mEntries(nullptr)
+, mBuckets(nullptr)
+, mNames(nullptr) {
+
+}
+
+PackArchive::~PackArchive() {
+  close();
+}
+
+bool PackArchive::open(const String& filename) {
+  close();
+
+  if (!mFile.open(filename, EFileMode::Read)) {
+    return false;
+  }
+
+  // Lookups jump around in the table of contents, entries are read as a whole
+  mData = static_cast<const uint8*>(mFile.map(EAccessPattern::Random, mSize));
+  if (nullptr == mData || !validate()) {
+    close();
+    return false;
+  }
+
+  mFilename = filename;
+  return true;
+}
+
+void PackArchive::close() {
+  if (mData) {
+    mFile.unmap();
+  }
+  mFile.close();
+  mFilename.clear();
+  mData = nullptr;
+  mSize = 0;
+  mHeader = nullptr;
+  mEntries = nullptr;
+  mBuckets = nullptr;
+  mNames = nullptr;
+}
+
+uint32 PackArchive::find_entry(const String& name) const {
+  const uint32 numberOfEntries = get_num_entries();
+  if (0 == numberOfEntries) {
+    return InvalidIndex;
+  }
+
+  const char* begin = nullptr;
+  sizeT length = 0;
+  trim_name(name, begin, length);
+
+  // Linear probing, the table is at least twice as large as the number of entries
+  const uint64 hash = hash_name(begin, length);
+  const uint32 mask = mHeader->numberOfBuckets - 1;
+  uint32 bucket = static_cast<uint32>(hash) & mask;
+  for (uint32 i = 0; i < mHeader->numberOfBuckets; ++i) {
+    const uint32 value = mBuckets[bucket];
+    if (0 == value) {
+      break;
+    }
+    const PackEntry& entry = mEntries[value - 1];
+    if (entry.nameHash == hash && entry.nameLength == length && memcmp(mNames + entry.nameOffset, begin, length) == 0) {
+      return value - 1;
+    }
+    bucket = (bucket + 1) & mask;
+  }
+  return InvalidIndex;
+}
+
+bool PackArchive::has_directory(const String& name) const {
+  const char* begin = nullptr;
+  sizeT length = 0;
+  trim_name(name, begin, length);
+  if (0 == length) {
+    return (get_num_entries() > 0);
+  }
+
+  // Names are sorted, the first one not less than "<directory>/" tells whether there's anything inside
+  const String prefix = String(begin, length) + "/";
+  const uint32 index = lower_bound(prefix.c_str(), prefix.length());
+  return (index < get_num_entries() && mEntries[index].nameLength > prefix.length() && memcmp(get_entry_name(index), prefix.c_str(), prefix.length()) == 0);
+}
+
+void PackArchive::enumerate(const String& directoryName, const String& directory, EEnumerationMode enumerationMode, Vector<String>& entries, bool recursive, bool returnAsRelativePaths) const {
+  const char* begin = nullptr;
+  sizeT length = 0;
+  trim_name(directory, begin, length);
+  const String prefix = (length > 0) ? String(begin, length) + "/" : String();
+  const bool files = (EEnumerationMode::All == enumerationMode || EEnumerationMode::Files == enumerationMode);
+  const bool directories = (EEnumerationMode::All == enumerationMode || EEnumerationMode::Directories == enumerationMode);
+
+  // Everything inside the directory is a contiguous range of the sorted names, and so is everything inside
+  // any of its sub directories. A sub directory is new whenever the previous name doesn't share it.
+  const char* previousName = nullptr;
+  sizeT previousLength = 0;
+  for (uint32 index = lower_bound(prefix.c_str(), prefix.length()); index < get_num_entries(); ++index) {
+    const PackEntry& entry = mEntries[index];
+    const char* name = mNames + entry.nameOffset;
+    if (entry.nameLength < prefix.length() || memcmp(name, prefix.c_str(), prefix.length()) != 0) {
+      break;
+    }
+
+    bool isNested = false;
+    for (sizeT position = prefix.length(); position < entry.nameLength; ++position) {
+      if ('/' != name[position]) {
+        continue;
+      }
+      const bool isKnown = (previousName && previousLength > position && memcmp(previousName, name, position + 1) == 0);
+      if (directories && !isKnown) {
+        const String relativeName(name + prefix.length(), position - prefix.length());
+        entries.push_back(returnAsRelativePaths ? relativeName : FilesystemHelper::normalize(directoryName + "/" + relativeName));
+      }
+      isNested = true;
+      if (!recursive) {
+        break;
+      }
+    }
+
+    if (files && (recursive || !isNested)) {
+      const String relativeName(name + prefix.length(), entry.nameLength - prefix.length());
+      entries.push_back(returnAsRelativePaths ? relativeName : FilesystemHelper::normalize(directoryName + "/" + relativeName));
+    }
+
+    previousName = name;
+    previousLength = entry.nameLength;
+  }
+}
+
+bool PackArchive::read_entry(uint32 index, void* destinationBuffer) const {
+  const PackEntry& entry = get_entry(index);
+  const uint8* storedData = get_stored_data(index);
+
+  switch (entry.compression) {
+    case EPackCompression::None:
+      memcpy(destinationBuffer, storedData, static_cast<size_t>(entry.size));
+      return true;
+
+    case EPackCompression::LZ4:
+    {
+      // LZ4 reports failures as negative result
+      const CompressionLZ4 compression;
+      const sizeT numberOfBytes = compression.decompress(static_cast<uint8*>(destinationBuffer), storedData, static_cast<sizeT>(entry.storedSize), static_cast<sizeT>(entry.size));
+      return (numberOfBytes == static_cast<sizeT>(entry.size));
+    }
+  }
+  return false;
+}
+
+bool PackArchive::verify_entry(uint32 index) const {
+  const PackEntry& entry = get_entry(index);
+  if (EPackCompression::None == entry.compression) {
+    return (hash_content(get_stored_data(index), entry.size) == entry.contentHash);
+  }
+
+  Vector<uint8> content;
+  content.resize(static_cast<sizeT>(entry.size));
+  return (read_entry(index, content.data()) && hash_content(content.data(), entry.size) == entry.contentHash);
+}
+
+Ptr<Stream> PackArchive::create_stream(uint32 index) {
+  // The stream takes a reference, on an archive without owner releasing the stream would delete it
+  BE_ASSERT(get_ref_count() > 0, "Streams can only be created for archives owned by a Ptr")
+  if (0 == get_ref_count()) {
+    return Ptr<Stream>();
+  }
+  Ptr<Stream> stream(new PackStream(Ptr<PackArchive>(this), index));
+  stream->set_path(Path(get_entry_name(index)));
+  return stream;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool PackArchive::validate() {
+  // Whether the range lies within the archive, without overflowing
+  const auto isInside = [this](uint64 offset, uint64 numberOfBytes) {
+    return (offset <= mSize && numberOfBytes <= mSize - offset);
+  };
+
+  if (mSize < sizeof(PackHeader)) {
+    return false;
+  }
+  const PackHeader* header = reinterpret_cast<const PackHeader*>(mData);
+  if (Magic != header->magic || Version != header->version) {
+    return false;
+  }
+  const uint32 numberOfBuckets = header->numberOfBuckets;
+  if (0 == numberOfBuckets || (numberOfBuckets & (numberOfBuckets - 1)) != 0 || numberOfBuckets < header->numberOfEntries ||
+      0 == header->alignment || (header->alignment & (header->alignment - 1)) != 0) {
+    return false;
+  }
+  if ((header->entriesOffset % alignof(PackEntry)) != 0 || !isInside(header->entriesOffset, static_cast<uint64>(header->numberOfEntries) * sizeof(PackEntry)) ||
+      (header->bucketsOffset % alignof(uint32)) != 0 || !isInside(header->bucketsOffset, static_cast<uint64>(numberOfBuckets) * sizeof(uint32)) ||
+      !isInside(header->namesOffset, header->namesSize)) {
+    return false;
+  }
+
+  const PackEntry* entries = reinterpret_cast<const PackEntry*>(mData + header->entriesOffset);
+  const uint32* buckets = reinterpret_cast<const uint32*>(mData + header->bucketsOffset);
+  const char* names = reinterpret_cast<const char*>(mData + header->namesOffset);
+  for (uint32 i = 0; i < header->numberOfEntries; ++i) {
+    const PackEntry& entry = entries[i];
+    if (static_cast<uint64>(entry.nameOffset) + entry.nameLength >= header->namesSize || '\0' != names[entry.nameOffset + entry.nameLength] ||
+        !isInside(entry.offset, entry.storedSize)) {
+      return false;
+    }
+    switch (entry.compression) {
+      case EPackCompression::None:
+        if (entry.storedSize != entry.size) {
+          return false;
+        }
+        break;
+
+      case EPackCompression::LZ4:
+        // LZ4 works on "int" sizes
+        if (entry.size > 0x7fffffff || entry.storedSize > 0x7fffffff) {
+          return false;
+        }
+        break;
+
+      default:
+        return false;
+    }
+  }
+  for (uint32 i = 0; i < numberOfBuckets; ++i) {
+    if (buckets[i] > header->numberOfEntries) {
+      return false;
+    }
+  }
+
+  mHeader = header;
+  mEntries = entries;
+  mBuckets = buckets;
+  mNames = names;
+  return true;
+}
+
+uint32 PackArchive::lower_bound(const char* prefix, sizeT length) const {
+  uint32 first = 0;
+  uint32 count = get_num_entries();
+  while (count > 0) {
+    const uint32 step = count / 2;
+    const PackEntry& entry = mEntries[first + step];
+    const sizeT commonLength = (entry.nameLength < length) ? entry.nameLength : length;
+    const int result = memcmp(mNames + entry.nameOffset, prefix, commonLength);
+    if (result < 0 || (0 == result && entry.nameLength < length)) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -0,0 +1,276 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/pack_archive_writer.h"
+#include "core/io/file.h"
+#include "core/io/filesystem.h"
+#include "core/io/filesystem_helper.h"
+#include "core/memory/memory.h"
+#include "core/std/sort.h"
+#include "core/tools/compression_lz4.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+namespace {
+
+/**
+ * @brief
+ * Writes the given number of zero bytes.
+ */
+bool write_zeros(File& file, uint64 numberOfBytes) {
+  static const uint8 Zeros[256] = {};
+  while (numberOfBytes > 0) {
+    const uint64 chunkSize = (numberOfBytes < sizeof(Zeros)) ? numberOfBytes : sizeof(Zeros);
+    if (file.write(Zeros, chunkSize) != chunkSize) {
+      return false;
+    }
+    numberOfBytes -= chunkSize;
+  }
+  return true;
+}
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+PackArchiveWriter::PackArchiveWriter()
+: mAlignment(DefaultAlignment)
+, mCompression(EPackCompression::None) {
+
+}
+
+PackArchiveWriter::~PackArchiveWriter() {
+  clear();
+}
+
+bool PackArchiveWriter::add_file(const String& name, const String& filename) {
+  String normalizedName;
+  if (!add_name(name, normalizedName)) {
+    return false;
+  }
+
+  mEntries.push_back(Entry{normalizedName, filename, nullptr, 0});
+  return true;
+}
+
+bool PackArchiveWriter::add_data(const String& name, const void* data, uint64 numberOfBytes) {
+  String normalizedName;
+  if (!add_name(name, normalizedName)) {
+    return false;
+  }
+
+  uint8* copy = nullptr;
+  if (numberOfBytes > 0) {
+    copy = static_cast<uint8*>(Memory::allocate(static_cast<sizeT>(numberOfBytes)));
+    memcpy(copy, data, static_cast<size_t>(numberOfBytes));
+  }
+  mEntries.push_back(Entry{normalizedName, String(), copy, numberOfBytes});
+  return true;
+}
+
+uint32 PackArchiveWriter::add_directory(const String& directory, const String& prefix) {
+  const String normalizedDirectory = FilesystemHelper::normalize(directory);
+  Vector<String> filenames;
+  Filesystem().enumerate_files(normalizedDirectory, normalizedDirectory, EEnumerationMode::Files, filenames, true, false);
+
+  // The enumerated names start with the directory, the rest is the name inside the archive
+  uint32 numberOfAddedFiles = 0;
+  for (const String& filename : filenames) {
+    const String name = filename.substr(normalizedDirectory.length());
+    if (add_file(prefix.empty() ? name : prefix + "/" + name, filename)) {
+      ++numberOfAddedFiles;
+    }
+  }
+  return numberOfAddedFiles;
+}
+
+bool PackArchiveWriter::write(const String& filename) const {
+  const uint32 numberOfEntries = mEntries.size();
+
+  // Entries are sorted by name, directories become contiguous ranges
+  Vector<uint32> order;
+  order.resize(numberOfEntries);
+  for (uint32 i = 0; i < numberOfEntries; ++i) {
+    order[i] = i;
+  }
+  core::sort(order.begin(), order.end(), [this](uint32 left, uint32 right) {
+    return strcmp(mEntries[left].name.c_str(), mEntries[right].name.c_str()) < 0;
+  });
+
+  // Table of contents, the bucket table is kept at most half full
+  uint32 numberOfBuckets = 1;
+  while (numberOfBuckets < numberOfEntries * 2) {
+    numberOfBuckets <<= 1;
+  }
+  PackHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = PackArchive::Magic;
+  header.version = PackArchive::Version;
+  header.numberOfEntries = numberOfEntries;
+  header.numberOfBuckets = numberOfBuckets;
+  header.alignment = mAlignment;
+  header.entriesOffset = sizeof(PackHeader);
+  header.bucketsOffset = header.entriesOffset + static_cast<uint64>(numberOfEntries) * sizeof(PackEntry);
+  header.namesOffset = header.bucketsOffset + static_cast<uint64>(numberOfBuckets) * sizeof(uint32);
+  for (const Entry& entry : mEntries) {
+    header.namesSize += entry.name.length() + 1;
+  }
+
+  const uint64 tableOfContentsSize = header.namesOffset + header.namesSize;
+  Vector<uint8> tableOfContents;
+  tableOfContents.resize(static_cast<sizeT>(tableOfContentsSize));
+  memset(tableOfContents.data(), 0, static_cast<size_t>(tableOfContentsSize));
+  PackEntry* packEntries = reinterpret_cast<PackEntry*>(tableOfContents.data() + header.entriesOffset);
+  uint32* buckets = reinterpret_cast<uint32*>(tableOfContents.data() + header.bucketsOffset);
+  char* names = reinterpret_cast<char*>(tableOfContents.data() + header.namesOffset);
+
+  uint32 nameOffset = 0;
+  for (uint32 i = 0; i < numberOfEntries; ++i) {
+    const String& name = mEntries[order[i]].name;
+    PackEntry& packEntry = packEntries[i];
+    packEntry.nameHash = PackArchive::hash_name(name.c_str(), name.length());
+    packEntry.nameOffset = nameOffset;
+    packEntry.nameLength = name.length();
+    memcpy(names + nameOffset, name.c_str(), name.length());
+    nameOffset += name.length() + 1;
+
+    uint32 bucket = static_cast<uint32>(packEntry.nameHash) & (numberOfBuckets - 1);
+    while (0 != buckets[bucket]) {
+      bucket = (bucket + 1) & (numberOfBuckets - 1);
+    }
+    buckets[bucket] = i + 1;
+  }
+
+  // The table of contents is written once all data offsets are known, reserve its space for now
+  File file;
+  if (!file.open(filename, EFileMode::Write) || !write_zeros(file, tableOfContentsSize)) {
+    return false;
+  }
+
+  const CompressionLZ4 compression;
+  Vector<uint8> compressed;
+  uint64 position = tableOfContentsSize;
+  bool result = true;
+  for (uint32 i = 0; i < numberOfEntries && result; ++i) {
+    const Entry& entry = mEntries[order[i]];
+    PackEntry& packEntry = packEntries[i];
+
+    // Files are mapped instead of read, and only for the time they are packed
+    File source;
+    const uint8* content = entry.data;
+    uint64 numberOfBytes = entry.numberOfBytes;
+    if (!entry.filename.empty()) {
+      if (!source.open(entry.filename, EFileMode::Read)) {
+        result = false;
+        break;
+      }
+      if (source.get_number_of_bytes() > 0) {
+        content = static_cast<const uint8*>(source.map(EAccessPattern::Sequential, numberOfBytes));
+        if (nullptr == content) {
+          result = false;
+          break;
+        }
+      }
+    }
+
+    const uint64 alignedPosition = (position + mAlignment - 1) & ~static_cast<uint64>(mAlignment - 1);
+    result = write_zeros(file, alignedPosition - position);
+    position = alignedPosition;
+
+    packEntry.offset = position;
+    packEntry.size = numberOfBytes;
+    packEntry.contentHash = PackArchive::hash_content(content, numberOfBytes);
+    packEntry.compression = EPackCompression::None;
+    packEntry.storedSize = numberOfBytes;
+    const uint8* storedData = content;
+
+    // Only keep the compressed data if it's worth the decompression, LZ4 works on "int" sizes
+    if (EPackCompression::LZ4 == mCompression && numberOfBytes > 0 && numberOfBytes <= 0x7fffffff) {
+      compressed.resize(compression.compress_bound(static_cast<uint32>(numberOfBytes)));
+      const sizeT compressedSize = compression.compress(compressed.data(), content, static_cast<sizeT>(numberOfBytes), compressed.size());
+      if (compressedSize > 0 && compressedSize <= numberOfBytes - numberOfBytes / 8) {
+        packEntry.compression = EPackCompression::LZ4;
+        packEntry.storedSize = compressedSize;
+        storedData = compressed.data();
+      }
+    }
+
+    if (result && packEntry.storedSize > 0) {
+      result = (file.write(storedData, packEntry.storedSize) == packEntry.storedSize);
+    }
+    position += packEntry.storedSize;
+  }
+
+  // Data written through "write()" is buffered, it has to be on its way before the positional write
+  file.flush();
+  memcpy(tableOfContents.data(), &header, sizeof(header));
+  result = result && (file.write_at(0, tableOfContents.data(), tableOfContentsSize) == tableOfContentsSize);
+  file.close();
+  return result;
+}
+
+void PackArchiveWriter::clear() {
+  for (Entry& entry : mEntries) {
+    if (entry.data) {
+      Memory::free(entry.data);
+    }
+  }
+  mEntries.clear();
+  mNames.clear();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool PackArchiveWriter::add_name(const String& name, String& normalizedName) {
+  // Names are relative, without leading '/'
+  normalizedName = FilesystemHelper::normalize(name);
+  sizeT first = 0;
+  while (first < normalizedName.length() && '/' == normalizedName[first]) {
+    ++first;
+  }
+  if (first > 0) {
+    normalizedName = normalizedName.substr(first);
+  }
+
+  return (!normalizedName.empty() && mNames.insert(normalizedName).second);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
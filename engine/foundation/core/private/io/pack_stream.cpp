@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/pack_stream.h"
+#include "core/memory/memory.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+PackStream::PackStream(const Ptr<PackArchive>& archive, uint32 entryIndex)
+: mArchive(archive)
+, mEntryIndex(entryIndex)
+, mContent(nullptr)
+, mBuffer(nullptr)
+, mSize(0)
+, mPosition(0) {
+  mFileAccessMode = EFileMode::Read;
+}
+
+PackStream::~PackStream() {
+  if (is_open()) {
+    close();
+  }
+}
+
+bool PackStream::can_read() const {
+  return true;
+}
+
+bool PackStream::can_write() const {
+  return false;
+}
+
+bool PackStream::can_seek() const {
+  return true;
+}
+
+bool PackStream::can_be_mapped() const {
+  return true;
+}
+
+sizeT PackStream::get_size() const {
+  return mSize;
+}
+
+sizeT PackStream::get_position() const {
+  return mPosition;
+}
+
+bool PackStream::open() {
+  BE_ASSERT(!is_open(), "Pack stream already open")
+
+  if (mFileAccessMode != EFileMode::Read || !mArchive->is_open()) {
+    return false;
+  }
+
+  const PackEntry& entry = mArchive->get_entry(mEntryIndex);
+  if (EPackCompression::None == entry.compression) {
+    mContent = mArchive->get_stored_data(mEntryIndex);
+  } else {
+    mBuffer = static_cast<uint8*>(Memory::allocate(static_cast<sizeT>(entry.size) + 1));
+    if (!mArchive->read_entry(mEntryIndex, mBuffer)) {
+      Memory::free(mBuffer);
+      mBuffer = nullptr;
+      return false;
+    }
+    mContent = mBuffer;
+  }
+  mSize = static_cast<sizeT>(entry.size);
+  mPosition = 0;
+
+  return Stream::open();
+}
+
+void PackStream::close() {
+  BE_ASSERT(is_open(), "No need to close, was never opened")
+
+  if (is_mapped()) {
+    unmap();
+  }
+  if (mBuffer) {
+    Memory::free(mBuffer);
+    mBuffer = nullptr;
+  }
+  mContent = nullptr;
+  mSize = 0;
+  mPosition = 0;
+
+  Stream::close();
+}
+
+sizeT PackStream::read(void* ptr, sizeT numBytes) {
+  BE_ASSERT(is_open(), "No need to read, was never opened")
+
+  const sizeT readBytes = numBytes <= mSize - mPosition ? numBytes : mSize - mPosition;
+  if (readBytes > 0) {
+    Memory::copy(ptr, mContent + mPosition, readBytes);
+    mPosition += readBytes;
+  }
+  return readBytes;
+}
+
+void PackStream::seek(sizeT offset, EFileSeek seek) {
+  // Relative seeks may move backwards, the unsigned offset wraps around accordingly
+  switch (seek) {
+    case EFileSeek::Set:
+      mPosition = offset;
+      break;
+
+    case EFileSeek::Current:
+      mPosition += offset;
+      break;
+
+    case EFileSeek::End:
+      mPosition = mSize + offset;
+      break;
+  }
+
+  if (mPosition > mSize) {
+    mPosition = mSize;
+  }
+}
+
+bool PackStream::eof() const {
+  return (mPosition == mSize);
+}
+
+String PackStream::get_content_as_string() {
+  return String(reinterpret_cast<const char*>(mContent + mPosition), mSize - mPosition);
+}
+
+void* PackStream::map() {
+  return memory_map();
+}
+
+void PackStream::unmap() {
+  memory_unmap();
+}
+
+void* PackStream::memory_map() {
+  BE_ASSERT(is_open(), "There is no entry opened")
+
+  // The content is read-only, handing out a non-const pointer is owed to the stream interface
+  mIsMapped = true;
+  return const_cast<uint8*>(mContent);
+}
+
+void PackStream::memory_unmap() {
+  mIsMapped = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
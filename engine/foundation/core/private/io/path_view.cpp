@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/io/path_view.h"
+#include "core/io/path.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+StringView PathView::get_mount_name() const {
+  for (sizeT i = 0; i < mLength; ++i) {
+    if (':' == mData[i]) {
+      return StringView(mData, i);
+    }
+    if (is_separator(mData[i])) {
+      break;
+    }
+  }
+  return StringView(mData, 0);
+}
+
+PathView PathView::get_mount_relative_path() const {
+  const sizeT mountLength = static_cast<sizeT>(get_mount_name().length());
+  return (mountLength > 0) ? PathView(mData + mountLength + 1, mLength - mountLength - 1) : *this;
+}
+
+PathView PathView::get_directory() const {
+  const sizeT separator = find_last_separator();
+  return PathView(mData, (separator < mLength) ? separator + 1 : 0);
+}
+
+StringView PathView::get_filename() const {
+  const sizeT separator = find_last_separator();
+  const sizeT start = (separator < mLength) ? separator + 1 : static_cast<sizeT>(get_mount_name().length() + (has_mount() ? 1 : 0));
+  return StringView(mData + start, mLength - start);
+}
+
+StringView PathView::get_extension() const {
+  const StringView filename = get_filename();
+  for (sizeT i = static_cast<sizeT>(filename.length()); i > 0; --i) {
+    if ('.' == filename.data()[i - 1]) {
+      return StringView(filename.data() + i - 1, filename.length() - i + 1);
+    }
+  }
+  return StringView(filename.data() + filename.length(), 0);
+}
+
+StringView PathView::get_title() const {
+  const StringView filename = get_filename();
+  for (sizeT i = 0; i < static_cast<sizeT>(filename.length()); ++i) {
+    if ('.' == filename.data()[i]) {
+      return StringView(filename.data(), i);
+    }
+  }
+  return filename;
+}
+
+uint32 PathView::get_num_parts() const {
+  const PathView relative = get_mount_relative_path();
+  uint32 numberOfParts = 0;
+  bool inPart = false;
+  for (sizeT i = 0; i < relative.mLength; ++i) {
+    const bool separator = is_separator(relative.mData[i]);
+    if (!separator && !inPart) {
+      ++numberOfParts;
+    }
+    inPart = !separator;
+  }
+  return numberOfParts;
+}
+
+StringView PathView::get_part(uint32 index) const {
+  const PathView relative = get_mount_relative_path();
+  sizeT i = 0;
+  while (i < relative.mLength) {
+    // Skip separators, then measure the part
+    while (i < relative.mLength && is_separator(relative.mData[i])) {
+      ++i;
+    }
+    const sizeT start = i;
+    while (i < relative.mLength && !is_separator(relative.mData[i])) {
+      ++i;
+    }
+    if (i > start) {
+      if (0 == index) {
+        return StringView(relative.mData + start, i - start);
+      }
+      --index;
+    }
+  }
+  return StringView(mData + mLength, 0);
+}
+
+String PathView::to_string() const {
+  return String(mData, mLength);
+}
+
+Path PathView::to_path() const {
+  return Path(to_string());
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+sizeT PathView::find_last_separator() const {
+  for (sizeT i = mLength; i > 0; --i) {
+    if (is_separator(mData[i - 1])) {
+      return i - 1;
+    }
+  }
+  return mLength;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
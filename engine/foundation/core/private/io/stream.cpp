@@ -70,6 +70,14 @@ EFileMode Stream::get_access_mode() const {
   return mFileAccessMode;
 }
 
+void Stream::set_access_pattern(EAccessPattern accessPattern) {
+  mAccessPattern = accessPattern;
+}
+
+EAccessPattern Stream::get_access_pattern() const {
+  return mAccessPattern;
+}
+
 
 bool Stream::is_open() const {
   return mIsOpen;
@@ -120,6 +128,12 @@ void Stream::write(const void *ptr, sizeT numBytes) {
 
 }
 
+void Stream::write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) {
+  for (uint32 i = 0; i < numberOfBuffers; ++i) {
+    write(buffers[i].data, static_cast<sizeT>(buffers[i].numberOfBytes));
+  }
+}
+
 sizeT Stream::read(void *ptr, sizeT numBytes) {
   return 0;
 }
@@ -0,0 +1,827 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/json/json_binary.h"
+#include "core/io/file_stream.h"
+#include "core/io/path.h"
+#include "core/json/json_document.h"
+#include "core/json/json_value.h"
+#include "core/memory/memory.h"
+#include <cmath>
+#include <cstring>
+#if defined(LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** CBOR major types */
+static constexpr uint8 MajorUnsigned = 0;
+static constexpr uint8 MajorNegative = 1;
+static constexpr uint8 MajorByteString = 2;
+static constexpr uint8 MajorTextString = 3;
+static constexpr uint8 MajorArray = 4;
+static constexpr uint8 MajorMap = 5;
+static constexpr uint8 MajorTag = 6;
+static constexpr uint8 MajorSimple = 7;
+
+/** CBOR initial bytes of the simple values and floats */
+static constexpr uint8 False = 0xf4;
+static constexpr uint8 True = 0xf5;
+static constexpr uint8 Null = 0xf6;
+static constexpr uint8 Float16 = 0xf9;
+static constexpr uint8 Float32 = 0xfa;
+static constexpr uint8 Float64 = 0xfb;
+
+/** Tag of an encoded CBOR data item inside of a byte string */
+static constexpr uint64 EncodedItemTag = 24;
+
+/** Self-describe CBOR tag 55799 */
+static constexpr uint8 Magic[JsonBinary::MagicSize] = { 0xd9, 0xd9, 0xf7 };
+
+/** Space reserved in front of nested containers: tag 24 plus a byte string head with 32-bit length */
+static constexpr uint32 WrapHeadSize = 7;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static uint64 read_big_endian(const uint8* data, uint32 numberOfBytes) {
+  uint64 value = 0;
+  for (uint32 i = 0; i < numberOfBytes; ++i) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+/**
+ * @brief
+ * Decodes the head of a well-formed item and returns the position behind it.
+ */
+static const uint8* read_head(const uint8* item, uint64& argument) {
+  const uint8 info = *item & 0x1f;
+  if (info < 24) {
+    argument = info;
+    return item + 1;
+  }
+  const uint32 numberOfBytes = 1u << (info - 24);
+  argument = read_big_endian(item + 1, numberOfBytes);
+  return item + 1 + numberOfBytes;
+}
+
+/**
+ * @brief
+ * Decodes the head of an untrusted item, fails if it is truncated or uses indefinite lengths.
+ */
+static bool read_head_checked(const uint8*& cursor, const uint8* end, uint8& major, uint8& info, uint64& argument) {
+  if (cursor >= end) {
+    return false;
+  }
+  major = *cursor >> 5;
+  info = *cursor & 0x1f;
+  if (info < 24) {
+    argument = info;
+    ++cursor;
+    return true;
+  }
+  if (info > 27) {
+    return false;
+  }
+  const uint32 numberOfBytes = 1u << (info - 24);
+  if (static_cast<sizeT>(end - cursor) <= numberOfBytes) {
+    return false;
+  }
+  argument = read_big_endian(cursor + 1, numberOfBytes);
+  cursor += 1 + numberOfBytes;
+  return true;
+}
+
+/**
+ * @brief
+ * Returns the position behind a well-formed item.
+ */
+static const uint8* skip_item(const uint8* item) {
+  uint64 argument = 0;
+  const uint8* next = read_head(item, argument);
+  switch (*item >> 5) {
+    case MajorByteString:
+    case MajorTextString:
+      return next + argument;
+
+    case MajorArray:
+      for (uint64 i = 0; i < argument; ++i) {
+        next = skip_item(next);
+      }
+      return next;
+
+    case MajorMap:
+      for (uint64 i = 0; i < argument * 2; ++i) {
+        next = skip_item(next);
+      }
+      return next;
+
+    case MajorTag:
+      // Wrapped containers are a byte string, skipped in constant time
+      return skip_item(next);
+
+    default:
+      return next;
+  }
+}
+
+static double decode_half(uint16 half) {
+  const int exponent = (half >> 10) & 0x1f;
+  const int mantissa = half & 0x3ff;
+  double value;
+  if (exponent == 0) {
+    value = std::ldexp(mantissa, -24);
+  } else if (exponent != 31) {
+    value = std::ldexp(mantissa + 1024, exponent - 25);
+  } else {
+    value = (mantissa == 0) ? INFINITY : NAN;
+  }
+  return (half & 0x8000) ? -value : value;
+}
+
+static uint32 encode_head(uint8* destination, uint8 major, uint64 argument) {
+  const uint8 type = static_cast<uint8>(major << 5);
+  uint32 numberOfBytes;
+  if (argument < 24) {
+    destination[0] = static_cast<uint8>(type | argument);
+    return 1;
+  } else if (argument <= 0xff) {
+    destination[0] = type | 24;
+    numberOfBytes = 1;
+  } else if (argument <= 0xffff) {
+    destination[0] = type | 25;
+    numberOfBytes = 2;
+  } else if (argument <= 0xffffffff) {
+    destination[0] = type | 26;
+    numberOfBytes = 4;
+  } else {
+    destination[0] = type | 27;
+    numberOfBytes = 8;
+  }
+  for (uint32 i = 0; i < numberOfBytes; ++i) {
+    destination[1 + i] = static_cast<uint8>(argument >> ((numberOfBytes - 1 - i) * 8));
+  }
+  return 1 + numberOfBytes;
+}
+
+static void write_bytes(Vector<uint8>& output, const void* data, uint32 numberOfBytes) {
+  const uint32 position = output.size();
+  output.grow(numberOfBytes);
+  Memory::copy(output.data() + position, data, numberOfBytes);
+}
+
+static void write_head(Vector<uint8>& output, uint8 major, uint64 argument) {
+  uint8 head[9];
+  write_bytes(output, head, encode_head(head, major, argument));
+}
+
+static void write_integer(Vector<uint8>& output, int64 value) {
+  if (value >= 0) {
+    write_head(output, MajorUnsigned, static_cast<uint64>(value));
+  } else {
+    // -1 - n, which is the bitwise complement
+    write_head(output, MajorNegative, ~static_cast<uint64>(value));
+  }
+}
+
+static void write_number(Vector<uint8>& output, double value) {
+  uint8 data[9];
+  const float single = static_cast<float>(value);
+  if (static_cast<double>(single) == value || std::isnan(value)) {
+    uint32 bits;
+    memcpy(&bits, &single, sizeof(bits));
+    data[0] = Float32;
+    for (uint32 i = 0; i < 4; ++i) {
+      data[1 + i] = static_cast<uint8>(bits >> ((3 - i) * 8));
+    }
+    write_bytes(output, data, 5);
+  } else {
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    data[0] = Float64;
+    for (uint32 i = 0; i < 8; ++i) {
+      data[1 + i] = static_cast<uint8>(bits >> ((7 - i) * 8));
+    }
+    write_bytes(output, data, 9);
+  }
+}
+
+static void write_string(Vector<uint8>& output, const char* data, uint32 length, bool rawText) {
+  if (rawText) {
+    write_head(output, MajorTag, JsonBinary::RawTextTag);
+  }
+  write_head(output, MajorTextString, length);
+  write_bytes(output, data, length);
+}
+
+static uint32 begin_container(Vector<uint8>& output, uint8 major, uint32 size, bool nested) {
+  const uint32 start = output.size();
+  if (nested && size > 0) {
+    // Placeholder for the wrapping, the content size is only known in end_container()
+    output.grow(WrapHeadSize);
+  }
+  write_head(output, major, size);
+  return start;
+}
+
+static void end_container(Vector<uint8>& output, uint32 start, uint32 size, bool nested) {
+  if (!nested || size == 0) {
+    return;
+  }
+
+  const uint32 contentStart = start + WrapHeadSize;
+  const uint32 contentSize = output.size() - contentStart;
+
+  // Small containers are cheap to skip by walking them, leave them unwrapped
+  uint8 head[WrapHeadSize];
+  uint32 headSize = 0;
+  if (contentSize >= JsonBinary::WrapThreshold) {
+    headSize = encode_head(head, MajorTag, EncodedItemTag);
+    headSize += encode_head(head + headSize, MajorByteString, contentSize);
+  }
+
+  if (headSize < WrapHeadSize) {
+    Memory::move(output.data() + start + headSize, output.data() + contentStart, contentSize);
+    output.resize(start + headSize + contentSize);
+  }
+  Memory::copy(output.data() + start, head, headSize);
+}
+
+static void encode_value(const JsonValue& value, Vector<uint8>& output, bool nested) {
+  switch (value.get_type()) {
+    case JsonType_Null:
+      output.push_back(Null);
+      break;
+
+    case JsonType_Boolean:
+      output.push_back(value.to_bool() ? True : False);
+      break;
+
+    case JsonType_Integer:
+      write_integer(output, value.to_integer());
+      break;
+
+    case JsonType_Number:
+      write_number(output, value.to_number());
+      break;
+
+    case JsonType_String:
+      write_string(output, value.to_string().c_str(), value.to_string().length(), value.is_raw_text());
+      break;
+
+    case JsonType_Array: {
+      const Vector<JsonValue*>& elements = value.get_array();
+      const uint32 start = begin_container(output, MajorArray, elements.size(), nested);
+      for (uint32 i = 0; i < elements.size(); ++i) {
+        encode_value(*elements[i], output, true);
+      }
+      end_container(output, start, elements.size(), nested);
+      break;
+    }
+
+    case JsonType_Object: {
+      const Map<String, JsonValue*>& members = value.get_object();
+      const uint32 start = begin_container(output, MajorMap, members.size(), nested);
+      for (auto iter = members.cbegin(); iter != members.cend(); ++iter) {
+        write_string(output, iter.key().c_str(), iter.key().length(), false);
+        encode_value(*iter.value(), output, true);
+      }
+      end_container(output, start, members.size(), nested);
+      break;
+    }
+  }
+}
+
+static void encode_element(const JsonElement& element, Vector<uint8>& output, bool nested) {
+  switch (element.get_type()) {
+    case JsonType_Null:
+      output.push_back(Null);
+      break;
+
+    case JsonType_Boolean:
+      output.push_back(element.to_bool() ? True : False);
+      break;
+
+    case JsonType_Integer:
+      write_integer(output, element.to_integer());
+      break;
+
+    case JsonType_Number:
+      write_number(output, element.to_number());
+      break;
+
+    case JsonType_String: {
+      const StringView string = element.to_string();
+      write_string(output, string.data(), static_cast<uint32>(string.size()), element.is_raw_text());
+      break;
+    }
+
+    case JsonType_Array: {
+      const uint32 size = element.get_size();
+      const uint32 start = begin_container(output, MajorArray, size, nested);
+      for (uint32 i = 0; i < size; ++i) {
+        encode_element(element(i), output, true);
+      }
+      end_container(output, start, size, nested);
+      break;
+    }
+
+    case JsonType_Object: {
+      const uint32 size = element.get_size();
+      const uint32 start = begin_container(output, MajorMap, size, nested);
+      for (uint32 i = 0; i < size; ++i) {
+        const StringView name = element.get_member_name(i);
+        write_string(output, name.data(), static_cast<uint32>(name.size()), false);
+        encode_element(element.get_member_value(i), output, true);
+      }
+      end_container(output, start, size, nested);
+      break;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Checks a single untrusted item, on failure the cursor is left at the offending item.
+ */
+static bool validate_item(const uint8*& cursor, const uint8* end, uint32 depth) {
+  const uint8* position = cursor;
+  uint8 major = 0;
+  uint8 info = 0;
+  uint64 argument = 0;
+  if (!read_head_checked(position, end, major, info, argument)) {
+    return false;
+  }
+
+  switch (major) {
+    case MajorUnsigned:
+    case MajorNegative:
+      // Has to fit into int64
+      if (argument > static_cast<uint64>(INT64_MAX)) {
+        return false;
+      }
+      break;
+
+    case MajorTextString:
+      if (argument > static_cast<uint64>(end - position)) {
+        return false;
+      }
+      position += argument;
+      break;
+
+    case MajorArray:
+    case MajorMap: {
+      // Every child takes at least one byte, this also rejects absurd counts early
+      if (depth >= JsonBinary::MaxDepth || argument > static_cast<uint64>(end - position) || argument > 0xffffffff) {
+        return false;
+      }
+      const uint64 numItems = (major == MajorMap) ? argument * 2 : argument;
+      for (uint64 i = 0; i < numItems; ++i) {
+        const bool isName = (major == MajorMap) && (i % 2 == 0);
+        if ((isName && (position >= end || (*position >> 5) != MajorTextString)) || !validate_item(position, end, depth + 1)) {
+          cursor = position;
+          return false;
+        }
+      }
+      break;
+    }
+
+    case MajorTag:
+      if (argument == EncodedItemTag) {
+        const uint8* bytes = position;
+        uint8 bytesMajor = 0;
+        uint64 length = 0;
+        if (!read_head_checked(position, end, bytesMajor, info, length) || bytesMajor != MajorByteString || length > static_cast<uint64>(end - position)) {
+          cursor = bytes;
+          return false;
+        }
+
+        // Exactly one container has to fill the byte string
+        const uint8* contentEnd = position + length;
+        if (position >= contentEnd || ((*position >> 5) != MajorArray && (*position >> 5) != MajorMap) || !validate_item(position, contentEnd, depth) || position != contentEnd) {
+          cursor = position;
+          return false;
+        }
+      } else if (argument == JsonBinary::RawTextTag) {
+        if (position >= end || (*position >> 5) != MajorTextString || !validate_item(position, end, depth)) {
+          cursor = position;
+          return false;
+        }
+      } else {
+        return false;
+      }
+      break;
+
+    case MajorSimple:
+      if (*cursor != False && *cursor != True && *cursor != Null && *cursor != Float16 && *cursor != Float32 && *cursor != Float64) {
+        return false;
+      }
+      break;
+
+    default:
+      // Byte strings only appear wrapped in tag 24
+      return false;
+  }
+
+  cursor = position;
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonBinaryElement::JsonBinaryElement(const uint8* item)
+: mItem(item)
+, mValue(item)
+, mRawText(false) {
+  if (nullptr != mValue) {
+    // Look through the tags, a wrapped container follows its byte string head
+    while ((*mValue >> 5) == MajorTag) {
+      uint64 tag = 0;
+      const uint8* next = read_head(mValue, tag);
+      if (tag == EncodedItemTag) {
+        uint64 length = 0;
+        next = read_head(next, length);
+      } else if (tag == JsonBinary::RawTextTag) {
+        mRawText = true;
+      }
+      mValue = next;
+    }
+  }
+}
+
+EJsonType JsonBinaryElement::get_type() const {
+  if (nullptr == mValue) {
+    return JsonType_Null;
+  }
+
+  switch (*mValue >> 5) {
+    case MajorUnsigned:
+    case MajorNegative:
+      return JsonType_Integer;
+    case MajorTextString:
+      return JsonType_String;
+    case MajorArray:
+      return JsonType_Array;
+    case MajorMap:
+      return JsonType_Object;
+    default:
+      if (*mValue == True || *mValue == False) {
+        return JsonType_Boolean;
+      }
+      return (*mValue == Null) ? JsonType_Null : JsonType_Number;
+  }
+}
+
+bool JsonBinaryElement::to_bool() const {
+  BE_ASSERT(is_bool(), "Cannot interpret as bool, is of other type")
+  return *mValue == True;
+}
+
+int64 JsonBinaryElement::to_integer() const {
+  BE_ASSERT(is_integer(), "Cannot interpret as integer, is of other type")
+  uint64 argument = 0;
+  read_head(mValue, argument);
+  return ((*mValue >> 5) == MajorUnsigned) ? static_cast<int64>(argument) : static_cast<int64>(~argument);
+}
+
+double JsonBinaryElement::to_number() const {
+  BE_ASSERT(is_number(), "Cannot interpret as number, is of other type")
+  uint64 bits = 0;
+  read_head(mValue, bits);
+  if (*mValue == Float16) {
+    return decode_half(static_cast<uint16>(bits));
+  } else if (*mValue == Float32) {
+    const uint32 singleBits = static_cast<uint32>(bits);
+    float single;
+    memcpy(&single, &singleBits, sizeof(single));
+    return single;
+  }
+  double number;
+  memcpy(&number, &bits, sizeof(number));
+  return number;
+}
+
+StringView JsonBinaryElement::to_string() const {
+  BE_ASSERT(is_string(), "Cannot interpret as string, is of other type")
+  uint64 length = 0;
+  const uint8* data = read_head(mValue, length);
+  return StringView(reinterpret_cast<const char*>(data), static_cast<sizeT>(length));
+}
+
+uint32 JsonBinaryElement::get_size() const {
+  if (!is_array() && !is_object()) {
+    return 0;
+  }
+  uint64 size = 0;
+  read_head(mValue, size);
+  return static_cast<uint32>(size);
+}
+
+JsonBinaryElement JsonBinaryElement::operator()(uint32 index) const {
+  if (!is_array() || index >= get_size()) {
+    return JsonBinaryElement();
+  }
+
+  JsonBinaryElement element = get_first();
+  for (uint32 i = 0; i < index; ++i) {
+    element = element.get_next();
+  }
+  return element;
+}
+
+JsonBinaryElement JsonBinaryElement::operator[](StringView key) const {
+  const uint32 size = is_object() ? get_size() : 0;
+
+  JsonBinaryElement name = get_first();
+  for (uint32 i = 0; i < size; ++i) {
+    const JsonBinaryElement value = name.get_next();
+    if (name.to_string().compare(key) == 0) {
+      return value;
+    }
+    if (i + 1 < size) {
+      name = value.get_next();
+    }
+  }
+  return JsonBinaryElement();
+}
+
+StringView JsonBinaryElement::get_member_name(uint32 index) const {
+  BE_ASSERT(is_object() && index < get_size(), "Member index out of range")
+
+  JsonBinaryElement name = get_first();
+  for (uint32 i = 0; i < index; ++i) {
+    name = name.get_next().get_next();
+  }
+  return name.to_string();
+}
+
+JsonBinaryElement JsonBinaryElement::get_member_value(uint32 index) const {
+  if (!is_object() || index >= get_size()) {
+    return JsonBinaryElement();
+  }
+
+  JsonBinaryElement name = get_first();
+  for (uint32 i = 0; i < index; ++i) {
+    name = name.get_next().get_next();
+  }
+  return name.get_next();
+}
+
+JsonBinaryElement JsonBinaryElement::get_first() const {
+  if (get_size() == 0) {
+    return JsonBinaryElement();
+  }
+  uint64 size = 0;
+  return JsonBinaryElement(read_head(mValue, size));
+}
+
+JsonBinaryElement JsonBinaryElement::get_next() const {
+  BE_ASSERT(is_valid(), "Invalid element has no successor")
+  return JsonBinaryElement(skip_item(mItem));
+}
+
+
+void JsonBinary::encode(const JsonValue& value, Vector<uint8>& output) {
+  output.clear();
+  write_bytes(output, Magic, MagicSize);
+  encode_value(value, output, false);
+}
+
+void JsonBinary::encode(const JsonElement& element, Vector<uint8>& output) {
+  output.clear();
+  write_bytes(output, Magic, MagicSize);
+  encode_element(element, output, false);
+}
+
+bool JsonBinary::encode_text(const char* data, sizeT size, Vector<uint8>& output) {
+  JsonDocument document;
+  if (!document.parse(data, size, false)) {
+    return false;
+  }
+  encode(document.get_root(), output);
+  return true;
+}
+
+JsonValue JsonBinary::decode(const JsonBinaryElement& element) {
+  JsonValue result;
+  decode_value(element, &result);
+  return result;
+}
+
+bool JsonBinary::is_binary(const void* data, sizeT size) {
+  return size >= MagicSize && Memory::compare(data, Magic, MagicSize) == 0;
+}
+
+bool JsonBinary::validate(const void* data, sizeT size, sizeT& errorOffset) {
+  const uint8* begin = static_cast<const uint8*>(data);
+  if (!is_binary(data, size)) {
+    errorOffset = 0;
+    return false;
+  }
+
+  const uint8* end = begin + size;
+  const uint8* cursor = begin + MagicSize;
+  if (!validate_item(cursor, end, 0) || cursor != end) {
+    errorOffset = static_cast<sizeT>(cursor - begin);
+    return false;
+  }
+  return true;
+}
+
+
+JsonBinaryDocument::JsonBinaryDocument()
+: mData(nullptr)
+, mSize(0)
+, mMapped(false)
+, mValid(false) {
+
+}
+
+JsonBinaryDocument::~JsonBinaryDocument() {
+  close();
+}
+
+bool JsonBinaryDocument::open(const String& filename) {
+  close();
+
+  const String nativeFilename = Path(filename).get_native_path();
+#if defined(LINUX)
+  const int fileDescriptor = ::open(nativeFilename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fileDescriptor < 0) {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0) {
+    void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mapping != MAP_FAILED) {
+      mData = static_cast<const uint8*>(mapping);
+      mSize = static_cast<sizeT>(fileStat.st_size);
+      mMapped = true;
+    }
+  }
+  // The mapping stays valid after closing the descriptor
+  ::close(fileDescriptor);
+  if (!mMapped) {
+    return false;
+  }
+#else
+  FileStream file;
+  file.set_path(Path(nativeFilename));
+  file.set_access_mode(EFileMode::Read);
+  if (!file.open()) {
+    return false;
+  }
+  mContent.resize(static_cast<uint32>(file.get_size()));
+  if (!mContent.empty()) {
+    mContent.resize(static_cast<uint32>(file.read(mContent.data(), mContent.size())));
+  }
+  file.close();
+  mData = mContent.data();
+  mSize = mContent.size();
+#endif
+
+  sizeT errorOffset = 0;
+  mValid = JsonBinary::validate(mData, mSize, errorOffset);
+  return mValid;
+}
+
+bool JsonBinaryDocument::load(const void* data, sizeT size) {
+  close();
+
+  mData = static_cast<const uint8*>(data);
+  mSize = size;
+
+  sizeT errorOffset = 0;
+  mValid = JsonBinary::validate(mData, mSize, errorOffset);
+  return mValid;
+}
+
+void JsonBinaryDocument::close() {
+#if defined(LINUX)
+  if (mMapped) {
+    munmap(const_cast<uint8*>(mData), mSize);
+  }
+#endif
+  mContent.clear();
+  mData = nullptr;
+  mSize = 0;
+  mMapped = false;
+  mValid = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+void JsonBinary::decode_value(const JsonBinaryElement& element, JsonValue* value) {
+  switch (element.get_type()) {
+    case JsonType_Null:
+      value->mType = JsonType_Null;
+      break;
+
+    case JsonType_Boolean:
+      value->mType = JsonType_Boolean;
+      value->mBool = element.to_bool();
+      break;
+
+    case JsonType_Integer:
+      value->mType = JsonType_Integer;
+      value->mInteger = element.to_integer();
+      break;
+
+    case JsonType_Number:
+      value->mType = JsonType_Number;
+      value->mNumber = static_cast<float>(element.to_number());
+      break;
+
+    case JsonType_String: {
+      const StringView string = element.to_string();
+      value->mType = JsonType_String;
+      value->mIsRawTextBlock = element.is_raw_text();
+      new (&value->mString) String(string.data(), static_cast<String::SizeType>(string.size()));
+      break;
+    }
+
+    case JsonType_Array: {
+      const uint32 size = element.get_size();
+      value->mType = JsonType_Array;
+      new (&value->mArray) Vector<JsonValue*>();
+      value->mArray.reserve(size);
+
+      JsonBinaryElement child = element.get_first();
+      for (uint32 i = 0; i < size; ++i) {
+        auto* childValue = new JsonValue();
+        decode_value(child, childValue);
+        value->mArray.push_back(childValue);
+        if (i + 1 < size) {
+          child = child.get_next();
+        }
+      }
+      break;
+    }
+
+    case JsonType_Object: {
+      const uint32 size = element.get_size();
+      value->mType = JsonType_Object;
+      new (&value->mObject) Map<String, JsonValue*>();
+
+      JsonBinaryElement name = element.get_first();
+      for (uint32 i = 0; i < size; ++i) {
+        const JsonBinaryElement member = name.get_next();
+        const StringView string = name.to_string();
+
+        auto* childValue = new JsonValue();
+        decode_value(member, childValue);
+        value->mObject.insert(String(string.data(), static_cast<String::SizeType>(string.size())), childValue);
+        if (i + 1 < size) {
+          name = member.get_next();
+        }
+      }
+      break;
+    }
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,340 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/json/json_document.h"
+#include "core/memory/linear_allocator.h"
+#include "core/memory/memory.h"
+#include "core/string/string_hash.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** All arena allocations are rounded up to and aligned at this */
+static constexpr sizeT ArenaAlignment = 8;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static sizeT align_arena_size(sizeT numberOfBytes) {
+  return (numberOfBytes + ArenaAlignment - 1) & ~(ArenaAlignment - 1);
+}
+
+static uint32 hash_key(const char* key, uint32 length) {
+  // 32-bit FNV-1a, same as StringHash but without requiring a null terminator
+  uint32 hash = StringHash::FNV1a_INITIAL_HASH_32;
+  for (uint32 i = 0; i < length; ++i) {
+    hash = (hash ^ static_cast<uint8>(key[i])) * StringHash::FNV1a_MAGIC_PRIME_32;
+  }
+  return hash;
+}
+
+static uint32 get_index_capacity(uint32 numMembers) {
+  // Keep the load factor at or below 50 %
+  uint32 capacity = 16;
+  while (capacity < numMembers * 2) {
+    capacity <<= 1;
+  }
+  return capacity;
+}
+
+static sizeT get_members_size(uint32 numMembers) {
+  sizeT numberOfBytes = numMembers * sizeof(JsonMember);
+  if (numMembers > JsonDocument::IndexThreshold) {
+    numberOfBytes += get_index_capacity(numMembers) * sizeof(uint32);
+  }
+  return align_arena_size(numberOfBytes);
+}
+
+static uint32 count_elements(const JsonTape& tape, uint32 index) {
+  const uint32 numElements = tape.get_num_elements(index);
+  if (numElements < JsonTape::MaxNumElements) {
+    return numElements;
+  }
+
+  // The count saturated, walk the container
+  uint32 count = 0;
+  const uint32 end = tape.get_next(index) - 1;
+  for (uint32 i = index + 1; i < end; i = tape.get_next(i)) {
+    ++count;
+  }
+  return (tape.get_type(index) == EJsonTapeType::ObjectBegin) ? count / 2 : count;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonElement JsonElement::operator[](StringView key) const {
+  if (!is_object()) {
+    return JsonElement();
+  }
+
+  const uint32 keyLength = static_cast<uint32>(key.size());
+  const uint32 keyHash = hash_key(key.data(), keyLength);
+  const uint32 numMembers = mNode->size;
+  const JsonMember* members = mNode->members;
+
+  if (numMembers > JsonDocument::IndexThreshold) {
+    // The hash index directly follows the members, entries are member index + 1
+    const uint32* index = reinterpret_cast<const uint32*>(members + numMembers);
+    const uint32 mask = get_index_capacity(numMembers) - 1;
+    for (uint32 slot = keyHash & mask; index[slot]; slot = (slot + 1) & mask) {
+      const JsonMember& member = members[index[slot] - 1];
+      if (member.keyHash == keyHash && member.keyLength == keyLength && Memory::compare(member.key, key.data(), keyLength) == 0) {
+        return JsonElement(&member.value);
+      }
+    }
+  } else {
+    for (uint32 i = 0; i < numMembers; ++i) {
+      const JsonMember& member = members[i];
+      if (member.keyHash == keyHash && member.keyLength == keyLength && Memory::compare(member.key, key.data(), keyLength) == 0) {
+        return JsonElement(&member.value);
+      }
+    }
+  }
+
+  return JsonElement();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonDocument::JsonDocument()
+: mArena(nullptr)
+, mRoot(nullptr)
+, mInput(nullptr)
+, mInputSize(0)
+, mRetainedInput(nullptr)
+, mStringBuffer(nullptr) {
+
+}
+
+JsonDocument::~JsonDocument() {
+  // All nodes are trivially destructible, releasing the arena releases the document
+  delete mArena;
+}
+
+bool JsonDocument::parse(const char* data, sizeT size, bool retainInput) {
+  clear();
+
+  if (!mTape.parse(data, size)) {
+    return false;
+  }
+  mInput = data;
+  mInputSize = size;
+
+  // The tape tells the exact arena size, so the document is a single allocation
+  const sizeT arenaSize = compute_arena_size(retainInput ? size : 0);
+  if (!mArena || mArena->get_available() < arenaSize) {
+    delete mArena;
+    mArena = new LinearAllocator(arenaSize);
+  }
+
+  if (retainInput && size > 0) {
+    char* retainedInput = static_cast<char*>(allocate(size, ArenaAlignment));
+    Memory::copy(retainedInput, data, static_cast<uint32>(size));
+    mRetainedInput = retainedInput;
+  }
+
+  const sizeT stringBufferSize = mTape.get_string_buffer_size();
+  if (stringBufferSize > 0) {
+    char* stringBuffer = static_cast<char*>(allocate(stringBufferSize, ArenaAlignment));
+    Memory::copy(stringBuffer, mTape.get_string_buffer(), static_cast<uint32>(stringBufferSize));
+    mStringBuffer = stringBuffer;
+  }
+
+  mRoot = static_cast<JsonNode*>(allocate(sizeof(JsonNode), alignof(JsonNode)));
+  build_node(0, *mRoot);
+
+  // The tape is scratch memory only, strings were redirected into the arena or the input
+  mTape.clear();
+  return true;
+}
+
+void JsonDocument::clear() {
+  if (mArena) {
+    mArena->reset();
+  }
+  mRoot = nullptr;
+  mInput = nullptr;
+  mInputSize = 0;
+  mRetainedInput = nullptr;
+  mStringBuffer = nullptr;
+}
+
+sizeT JsonDocument::get_memory_usage() const {
+  return mArena ? mArena->get_used() : 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+sizeT JsonDocument::compute_arena_size(sizeT retainedSize) const {
+  sizeT numberOfBytes = align_arena_size(retainedSize) +
+                        align_arena_size(mTape.get_string_buffer_size()) +
+                        align_arena_size(sizeof(JsonNode));
+
+  for (uint32 i = 0; i < mTape.get_size();) {
+    switch (mTape.get_type(i)) {
+      case EJsonTapeType::ArrayBegin:
+        numberOfBytes += align_arena_size(count_elements(mTape, i) * sizeof(JsonNode));
+        ++i;
+        break;
+
+      case EJsonTapeType::ObjectBegin:
+        numberOfBytes += get_members_size(count_elements(mTape, i));
+        ++i;
+        break;
+
+      default:
+        i = mTape.get_next(i);
+        break;
+    }
+  }
+
+  return numberOfBytes;
+}
+
+void JsonDocument::build_node(uint32 index, JsonNode& node) {
+  node.rawText = 0;
+  node.reserved = 0;
+  node.size = 0;
+  node.integer = 0;
+
+  switch (mTape.get_type(index)) {
+    case EJsonTapeType::Null:
+      node.type = JsonType_Null;
+      break;
+
+    case EJsonTapeType::True:
+    case EJsonTapeType::False:
+      node.type = JsonType_Boolean;
+      node.boolean = (mTape.get_type(index) == EJsonTapeType::True);
+      break;
+
+    case EJsonTapeType::Integer:
+      node.type = JsonType_Integer;
+      node.integer = mTape.get_integer(index);
+      break;
+
+    case EJsonTapeType::Number:
+      node.type = JsonType_Number;
+      node.number = mTape.get_number(index);
+      break;
+
+    case EJsonTapeType::String:
+      node.type = JsonType_String;
+      node.rawText = mTape.is_raw_text(index) ? 1 : 0;
+      node.string = build_string(index, node.size);
+      break;
+
+    case EJsonTapeType::ArrayBegin: {
+      const uint32 numElements = count_elements(mTape, index);
+      auto* elements = static_cast<JsonNode*>(allocate(numElements * sizeof(JsonNode), alignof(JsonNode)));
+      uint32 element = index + 1;
+      for (uint32 i = 0; i < numElements; ++i) {
+        build_node(element, elements[i]);
+        element = mTape.get_next(element);
+      }
+
+      node.type = JsonType_Array;
+      node.size = numElements;
+      node.elements = elements;
+      break;
+    }
+
+    case EJsonTapeType::ObjectBegin: {
+      const uint32 numMembers = count_elements(mTape, index);
+      auto* members = static_cast<JsonMember*>(allocate(get_members_size(numMembers), alignof(JsonMember)));
+      uint32 key = index + 1;
+      for (uint32 i = 0; i < numMembers; ++i) {
+        JsonMember& member = members[i];
+        member.key = build_string(key, member.keyLength);
+        member.keyHash = hash_key(member.key, member.keyLength);
+
+        const uint32 value = mTape.get_next(key);
+        build_node(value, member.value);
+        key = mTape.get_next(value);
+      }
+
+      // Larger objects get an open addressing index behind the members, duplicate keys resolve
+      // to the first occurrence since it is probed first
+      if (numMembers > IndexThreshold) {
+        const uint32 capacity = get_index_capacity(numMembers);
+        const uint32 mask = capacity - 1;
+        auto* hashIndex = reinterpret_cast<uint32*>(members + numMembers);
+        Memory::set(hashIndex, 0, capacity * sizeof(uint32));
+        for (uint32 i = 0; i < numMembers; ++i) {
+          uint32 slot = members[i].keyHash & mask;
+          while (hashIndex[slot]) {
+            slot = (slot + 1) & mask;
+          }
+          hashIndex[slot] = i + 1;
+        }
+      }
+
+      node.type = JsonType_Object;
+      node.size = numMembers;
+      node.members = members;
+      break;
+    }
+
+    default:
+      node.type = JsonType_Null;
+      break;
+  }
+}
+
+const char* JsonDocument::build_string(uint32 index, uint32& length) {
+  const StringView string = mTape.get_string(index);
+  length = static_cast<uint32>(string.size());
+
+  // Strings are either views into the input or into the decoded string buffer of the tape,
+  // redirect them to the retained input or the arena copy of the buffer
+  const char* data = string.data();
+  if (data >= mInput && data < mInput + mInputSize) {
+    return mRetainedInput ? mRetainedInput + (data - mInput) : data;
+  }
+  return mStringBuffer + (data - mTape.get_string_buffer());
+}
+
+void* JsonDocument::allocate(sizeT numberOfBytes, sizeT alignment) {
+  return mArena->allocate(align_arena_size(numberOfBytes), alignment);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -23,7 +23,12 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/json/json_parser.h"
+#include "core/json/json_tape.h"
 #include "core/json/json_value.h"
+#include "core/log/log.h"
+#include "core/string/number_conversion.h"
+#include <cstring>
+#include <new>
 
 
 //[-------------------------------------------------------]
@@ -41,17 +46,31 @@ static String STrue = "true";
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 JsonValue JsonParser::parse(const String& inputString) {
+  return parse(inputString.c_str(), inputString.size());
+}
+
+JsonValue JsonParser::parse(const char* data, sizeT size) {
+  JsonValue result;
 
-  JsonValue result; // = new JsonValue();
-  JsonParser parser(inputString);
-  parser.parse_object(&result, true);
+  JsonTape tape;
+  if (tape.parse(data, size)) {
+    build_value(tape, 0, &result);
+  } else {
+    String message;
+    message.append_format("Failed to parse JSON at offset %lu: %s", static_cast<unsigned long>(tape.get_error_offset()), tape.get_error());
+    BE_LOG(Error, message)
+
+    result.mType = JsonType_Object;
+    new (&result.mObject) Map<String, JsonValue*>();
+  }
 
   return result;
 }
 
 
 JsonParser::JsonParser(const String& inputString)
-: mInputString(inputString)
+: mInput(inputString.c_str())
+, mInputSize(inputString.size())
 , mCurrentPosition(0) {
 
 }
@@ -140,18 +159,22 @@ bool JsonParser::parse_number(JsonValue *value) {
       next();
   }
 
-  // Get string
-  String result = mInputString.substr(start, (mCurrentPosition-start));
-
+  // Convert in place, without a temporary string
+  const char* begin = mInput + start;
+  const char* end = mInput + mCurrentPosition;
   if (isFloat)
   {
+    double number = 0.0;
+    core::from_chars(begin, end, number);
     value->mType = JsonType_Number;
-    value->mNumber = (float)strtod(result.c_str(), nullptr);
+    value->mNumber = static_cast<float>(number);
   }
   else
   {
+    int64 integer = 0;
+    core::from_chars(begin, end, integer);
     value->mType = JsonType_Integer;
-    value->mInteger = (int)strtol(result.c_str(), nullptr, 10);
+    value->mInteger = integer;
   }
 
   return true;
@@ -162,6 +185,7 @@ bool JsonParser::parse_array(JsonValue *value) {
     return false;
 
   value->mType = JsonType_Array;
+  new (&value->mArray) Vector<JsonValue*>();
 
   next();
 
@@ -197,8 +221,7 @@ bool JsonParser::parse_string(JsonValue *value) {
     return false;
 
   value->mType = JsonType_String;
-  //auto tmp = new String(str);;
-  value->mString = str;
+  new (&value->mString) String(str);
   return true;
 }
 
@@ -213,7 +236,7 @@ bool JsonParser::parse_object(JsonValue* value, bool isRootObject) {
   // The current json value is a table
   value->mType = JsonType_Object;
   // Create the corresponding table
-  //value->mObject = new Map<String, JsonValue*>();
+  new (&value->mObject) Map<String, JsonValue*>();
   skip_whitespace();
 
   // Check if just an empty object
@@ -253,16 +276,84 @@ bool JsonParser::parse_object(JsonValue* value, bool isRootObject) {
 }
 
 
+void JsonParser::build_value(const JsonTape& tape, uint32 index, JsonValue* value) {
+  switch (tape.get_type(index)) {
+    case EJsonTapeType::Null:
+      value->mType = JsonType_Null;
+      break;
+
+    case EJsonTapeType::True:
+    case EJsonTapeType::False:
+      value->mType = JsonType_Boolean;
+      value->mBool = (tape.get_type(index) == EJsonTapeType::True);
+      break;
+
+    case EJsonTapeType::Integer:
+      value->mType = JsonType_Integer;
+      value->mInteger = tape.get_integer(index);
+      break;
+
+    case EJsonTapeType::Number:
+      value->mType = JsonType_Number;
+      value->mNumber = static_cast<float>(tape.get_number(index));
+      break;
+
+    case EJsonTapeType::String: {
+      const StringView string = tape.get_string(index);
+      value->mType = JsonType_String;
+      value->mIsRawTextBlock = tape.is_raw_text(index);
+      new (&value->mString) String(string.data(), static_cast<String::SizeType>(string.size()));
+      break;
+    }
+
+    case EJsonTapeType::ArrayBegin: {
+      value->mType = JsonType_Array;
+      new (&value->mArray) Vector<JsonValue*>();
+      value->mArray.reserve(tape.get_num_elements(index));
+
+      const uint32 end = tape.get_next(index) - 1;
+      for (uint32 element = index + 1; element < end; element = tape.get_next(element)) {
+        auto* child = new JsonValue();
+        build_value(tape, element, child);
+        value->mArray.push_back(child);
+      }
+      break;
+    }
+
+    case EJsonTapeType::ObjectBegin: {
+      value->mType = JsonType_Object;
+      new (&value->mObject) Map<String, JsonValue*>();
+
+      // Members are stored as key string followed by the value
+      const uint32 end = tape.get_next(index) - 1;
+      for (uint32 key = index + 1; key < end;) {
+        const uint32 member = tape.get_next(key);
+        const StringView name = tape.get_string(key);
+
+        auto* child = new JsonValue();
+        build_value(tape, member, child);
+        value->mObject.insert(String(name.data(), static_cast<String::SizeType>(name.size())), child);
+
+        key = tape.get_next(member);
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
 char JsonParser::next() {
-  return mInputString[mCurrentPosition++];
+  return (mCurrentPosition < mInputSize) ? mInput[mCurrentPosition++] : '\0';
 }
 
 char JsonParser::current() {
-  return mInputString[mCurrentPosition];
+  return (mCurrentPosition < mInputSize) ? mInput[mCurrentPosition] : '\0';
 }
 
 bool JsonParser::is_string(const String &str) const {
-  return mInputString.compare(mCurrentPosition, str.size(), str) == 0;
+  return (mCurrentPosition + str.size() <= mInputSize) && memcmp(mInput + mCurrentPosition, str.c_str(), str.size()) == 0;
 }
 
 String JsonParser::parse_key() {
@@ -279,7 +370,7 @@ String JsonParser::parse_key() {
       skip_whitespace();
 
     if (current() == ':')
-      return mInputString.substr(start, cur_wo_whitespace - start);
+      return String(mInput + start, cur_wo_whitespace - start);
 
     next();
   }
@@ -307,7 +398,7 @@ void JsonParser::skip_whitespace() {
 }
 
 bool JsonParser::is_multiline_string_quotes() {
-  return mInputString[mCurrentPosition] == '"' && mInputString[mCurrentPosition+1] == '"' && mInputString[mCurrentPosition+2] == '"';
+  return mCurrentPosition + 2 < mInputSize && mInput[mCurrentPosition] == '"' && mInput[mCurrentPosition+1] == '"' && mInput[mCurrentPosition+2] == '"';
 }
 
 String JsonParser::parse_multiline_string() {
@@ -324,8 +415,7 @@ String JsonParser::parse_multiline_string() {
     if (is_multiline_string_quotes())
     {
       uint64 end = mCurrentPosition;
-      String new_result = mInputString.substr(start, end - start);
-      result = new_result;
+      result.assign(mInput + start, end - start);
       mCurrentPosition += 3;
       return result;
     }
@@ -357,7 +447,7 @@ String JsonParser::parse_string_internal(JsonValue* value) {
     {
       uint64 end = mCurrentPosition;
       next();
-      return mInputString.substr(start, (end-start));
+      return String(mInput + start, (end-start));
       break;
     }
 
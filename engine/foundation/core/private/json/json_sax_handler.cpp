@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/json/json_sax_handler.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public virtual JsonSaxHandler functions               ]
+//[-------------------------------------------------------]
+JsonSaxHandler::~JsonSaxHandler() {
+
+}
+
+bool JsonSaxHandler::on_null() {
+  return true;
+}
+
+bool JsonSaxHandler::on_bool(bool) {
+  return true;
+}
+
+bool JsonSaxHandler::on_integer(int64) {
+  return true;
+}
+
+bool JsonSaxHandler::on_number(double) {
+  return true;
+}
+
+bool JsonSaxHandler::on_string(StringView, bool) {
+  return true;
+}
+
+bool JsonSaxHandler::on_key(StringView) {
+  return true;
+}
+
+bool JsonSaxHandler::on_begin_object() {
+  return true;
+}
+
+bool JsonSaxHandler::on_end_object() {
+  return true;
+}
+
+bool JsonSaxHandler::on_begin_array() {
+  return true;
+}
+
+bool JsonSaxHandler::on_end_array() {
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,811 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/json/json_tape.h"
+#include "core/string/number_conversion.h"
+#include "core/string/string_utils.h"
+#include <cstring>
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Classification of one 64 byte block of input, one bit per byte.
+ */
+struct JsonBlock {
+  uint64 quote;       ///< '"'
+  uint64 backslash;   ///< '\'
+  uint64 op;          ///< '{', '}', '[', ']' and ':'
+  uint64 whitespace;  ///< Everything up to and including ' ', and ',' which is optional in our dialect
+  uint64 comment;     ///< '#'
+};
+
+/** Every other bit set, starting with bit 0 */
+static constexpr uint64 EvenBits = 0x5555555555555555ull;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static void classify_block(const uint8* data, JsonBlock& block) {
+  block = JsonBlock();
+
+#if defined(__SSE2__)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i colon = _mm_set1_epi8(':');
+  const __m128i comma = _mm_set1_epi8(',');
+  const __m128i hash = _mm_set1_epi8('#');
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i openBrace = _mm_set1_epi8('{');
+  const __m128i closeBrace = _mm_set1_epi8('}');
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+
+  for (uint32 i = 0; i < 4; ++i) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+    const uint32 shift = i * 16;
+
+    // '[' and ']' only differ from '{' and '}' in bit 5, so a single compare catches both
+    const __m128i folded = _mm_or_si128(chunk, caseBit);
+    const __m128i op = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, openBrace), _mm_cmpeq_epi8(folded, closeBrace)),
+                                    _mm_cmpeq_epi8(chunk, colon));
+    // Unsigned "chunk <= ' '" is "max(chunk, ' ') == ' '"
+    const __m128i whitespace = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(chunk, space), space), _mm_cmpeq_epi8(chunk, comma));
+
+    block.quote      |= static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)))) << shift;
+    block.backslash  |= static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash)))) << shift;
+    block.op         |= static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(op))) << shift;
+    block.whitespace |= static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(whitespace))) << shift;
+    block.comment    |= static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, hash)))) << shift;
+  }
+#else
+  for (uint32 i = 0; i < 64; ++i) {
+    const uint8 c = data[i];
+    const uint64 bit = 1ull << i;
+    switch (c) {
+      case '"':  block.quote |= bit; break;
+      case '\\': block.backslash |= bit; break;
+      case '#':  block.comment |= bit; break;
+      case ',':  block.whitespace |= bit; break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':  block.op |= bit; break;
+      default:
+        if (c <= ' ') {
+          block.whitespace |= bit;
+        }
+        break;
+    }
+  }
+#endif
+}
+
+/**
+ * @brief
+ * Returns the mask of all characters which are escaped by a backslash.
+ *
+ * @param[in] backslash
+ * Backslash mask of the current block
+ * @param[in, out] escapedCarry
+ * 1 if the first character of this block is escaped by the last one of the previous block
+ */
+static uint64 find_escaped(uint64 backslash, uint64& escapedCarry) {
+  if (!backslash && !escapedCarry) {
+    return 0;
+  }
+
+  // An escaped backslash does not escape anything itself
+  uint64 escaped = escapedCarry;
+  backslash &= ~escapedCarry;
+  escapedCarry = 0;
+
+  // Backslashes are rare in practice, walking the set bits beats the branch free variant
+  while (backslash) {
+    const uint32 index = static_cast<uint32>(__builtin_ctzll(backslash));
+    backslash &= backslash - 1;
+    if (index == 63) {
+      escapedCarry = 1;
+    } else {
+      const uint64 next = 1ull << (index + 1);
+      escaped |= next;
+      backslash &= ~next;
+    }
+  }
+
+  return escaped;
+}
+
+/**
+ * @brief
+ * Turns a quote mask into a mask of all bytes between an opening and a closing quote, including
+ * the opening quote itself.
+ */
+static uint64 prefix_xor(uint64 bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+static bool validate_utf8(const uint8* data, sizeT size, sizeT& errorOffset) {
+  sizeT i = 0;
+  while (i < size) {
+#if defined(__SSE2__)
+    // Skip pure ASCII runs a whole chunk at a time
+    if (i + 16 <= size) {
+      const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))));
+      if (!mask) {
+        i += 16;
+        continue;
+      }
+      i += __builtin_ctz(mask);
+    }
+#endif
+
+    const uint8 c = data[i];
+    if (c < 0x80) {
+      ++i;
+      continue;
+    }
+
+    uint32 length;
+    uint32 codePoint;
+    uint32 minimum;
+    if ((c & 0xe0) == 0xc0) {
+      length = 2;
+      codePoint = c & 0x1f;
+      minimum = 0x80;
+    } else if ((c & 0xf0) == 0xe0) {
+      length = 3;
+      codePoint = c & 0x0f;
+      minimum = 0x800;
+    } else if ((c & 0xf8) == 0xf0) {
+      length = 4;
+      codePoint = c & 0x07;
+      minimum = 0x10000;
+    } else {
+      errorOffset = i;
+      return false;
+    }
+
+    if (i + length > size) {
+      errorOffset = i;
+      return false;
+    }
+    for (uint32 k = 1; k < length; ++k) {
+      const uint8 continuation = data[i + k];
+      if ((continuation & 0xc0) != 0x80) {
+        errorOffset = i;
+        return false;
+      }
+      codePoint = (codePoint << 6) | (continuation & 0x3f);
+    }
+
+    // Reject overlong encodings, surrogates and everything beyond the unicode range
+    if (codePoint < minimum || codePoint > 0x10ffff || (codePoint >= 0xd800 && codePoint <= 0xdfff)) {
+      errorOffset = i;
+      return false;
+    }
+    i += length;
+  }
+
+  return true;
+}
+
+/**
+ * @brief
+ * Returns the position of the next '"' or '\' at or after the given position, or size if there is none.
+ */
+static sizeT find_string_delimiter(const char* data, sizeT position, sizeT size) {
+#if defined(__SSE2__)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  while (position + 16 <= size) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+    const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))));
+    if (mask) {
+      return position + __builtin_ctz(mask);
+    }
+    position += 16;
+  }
+#endif
+
+  while (position < size && data[position] != '"' && data[position] != '\\') {
+    ++position;
+  }
+  return position;
+}
+
+/**
+ * @brief
+ * Returns the position of the next '"""' at or after the given position, or size if there is none.
+ */
+static sizeT find_raw_text_end(const char* data, sizeT position, sizeT size) {
+  while (position + 3 <= size) {
+    const char* quote = static_cast<const char*>(memchr(data + position, '"', size - position - 2));
+    if (!quote) {
+      break;
+    }
+    position = static_cast<sizeT>(quote - data);
+    if (data[position + 1] == '"' && data[position + 2] == '"') {
+      return position;
+    }
+    ++position;
+  }
+  return size;
+}
+
+static bool is_raw_text_start(const char* data, sizeT position, sizeT size) {
+  return (position + 2 < size) && data[position + 1] == '"' && data[position + 2] == '"';
+}
+
+static bool is_op(char c) {
+  return c == '{' || c == '}' || c == '[' || c == ']' || c == ':';
+}
+
+static bool parse_hex4(const char* data, uint32& value) {
+  value = 0;
+  for (uint32 i = 0; i < 4; ++i) {
+    const int digit = hex_digit_value(data[i]);
+    if (digit < 0) {
+      return false;
+    }
+    value = (value << 4) | static_cast<uint32>(digit);
+  }
+  return true;
+}
+
+static void append_to_buffer(Vector<char>& buffer, const char* data, sizeT size) {
+  const sizeT offset = buffer.size();
+  const sizeT newSize = offset + size;
+  // Vector::resize() grows to the exact size, grow geometrically instead
+  if (newSize > buffer.capacity()) {
+    buffer.reserve(static_cast<uint32>((newSize > buffer.capacity() * 2) ? newSize : buffer.capacity() * 2));
+  }
+  buffer.resize(newSize);
+  Memory::copy(buffer.data() + offset, data, static_cast<uint32>(size));
+}
+
+static void append_utf8(Vector<char>& buffer, uint32 codePoint) {
+  char utf8[4];
+  append_to_buffer(buffer, utf8, encode_utf8(codePoint, utf8));
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+JsonTape::JsonTape()
+: mInput(nullptr)
+, mInputSize(0)
+, mNumStructurals(0)
+, mNextStructural(0)
+, mError("")
+, mErrorOffset(0)
+, mVectorized(false) {
+
+}
+
+JsonTape::~JsonTape() {
+
+}
+
+bool JsonTape::parse(const char* data, sizeT size) {
+  clear();
+  mInput = data;
+  mInputSize = size;
+
+  // Structural positions are stored as 32-bit offsets
+  if (size >= 0xffffffffull) {
+    return set_error("Document exceeds 4 GiB", 0);
+  }
+
+  sizeT errorOffset = 0;
+  if (!validate_utf8(reinterpret_cast<const uint8*>(data), size, errorOffset)) {
+    return set_error("Invalid UTF-8", errorOffset);
+  }
+
+  // Stage one, the vectorized pass bails out on comments and raw text blocks
+  mVectorized = build_structural_index();
+  if (!mVectorized && !build_structural_index_scalar()) {
+    return false;
+  }
+
+  // Stage two
+  if (!build_tape()) {
+    mTape.clear();
+    return false;
+  }
+
+  return true;
+}
+
+void JsonTape::clear() {
+  mInput = nullptr;
+  mInputSize = 0;
+  mNumStructurals = 0;
+  mNextStructural = 0;
+  mTape.clear();
+  mStringBuffer.clear();
+  mError = "";
+  mErrorOffset = 0;
+  mVectorized = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+bool JsonTape::build_structural_index() {
+  // Worst case every single byte is structural
+  if (mStructurals.size() < mInputSize + 1) {
+    mStructurals.resize(mInputSize + 1);
+  }
+  uint32* structurals = mStructurals.data();
+  uint32 numStructurals = 0;
+
+  const uint8* input = reinterpret_cast<const uint8*>(mInput);
+  uint8 tail[64];
+  uint64 escapedCarry = 0;
+  uint64 inStringCarry = 0;
+  uint64 scalarCarry = 0;
+  uint64 quoteCarry = 0;
+
+  for (sizeT base = 0; base < mInputSize; base += 64) {
+    const uint8* data = input + base;
+    if (mInputSize - base < 64) {
+      // Pad the last block with whitespace
+      memset(tail, ' ', sizeof(tail));
+      memcpy(tail, data, mInputSize - base);
+      data = tail;
+    }
+
+    JsonBlock block;
+    classify_block(data, block);
+
+    const uint64 quote = block.quote & ~find_escaped(block.backslash, escapedCarry);
+
+    // '"""' raw text blocks may contain single quotes which would break the quote parity
+    if (quote & ((quote << 1) | (quoteCarry >> 63)) & ((quote << 2) | (quoteCarry >> 62))) {
+      return false;
+    }
+    quoteCarry = quote;
+
+    // Everything between an opening and a closing quote, carried over from the previous block
+    const uint64 inString = prefix_xor(quote) ^ inStringCarry;
+    inStringCarry = static_cast<uint64>(static_cast<int64>(inString) >> 63);
+
+    // Comments may contain quotes as well
+    if (block.comment & ~inString) {
+      return false;
+    }
+
+    // Atoms (numbers, literals, unquoted keys) are recorded at their first character
+    const uint64 scalar = ~(block.op | block.whitespace);
+    const uint64 scalarStart = scalar & ~((scalar << 1) | scalarCarry);
+    scalarCarry = scalar >> 63;
+
+    uint64 bits = ((block.op | (scalarStart & ~block.quote)) & ~inString) | (quote & inString);
+    while (bits) {
+      structurals[numStructurals++] = static_cast<uint32>(base + __builtin_ctzll(bits));
+      bits &= bits - 1;
+    }
+  }
+
+  // Let the scalar pass report the unterminated string
+  if (inStringCarry) {
+    return false;
+  }
+
+  mNumStructurals = numStructurals;
+  return true;
+}
+
+bool JsonTape::build_structural_index_scalar() {
+  if (mStructurals.size() < mInputSize + 1) {
+    mStructurals.resize(mInputSize + 1);
+  }
+  uint32* structurals = mStructurals.data();
+  uint32 numStructurals = 0;
+  bool followsScalar = false;
+
+  sizeT i = 0;
+  while (i < mInputSize) {
+    const char c = mInput[i];
+    if (static_cast<uint8>(c) <= ' ' || c == ',') {
+      followsScalar = false;
+      ++i;
+    } else if (c == '#') {
+      while (i < mInputSize && mInput[i] != '\n') {
+        ++i;
+      }
+      followsScalar = false;
+    } else if (is_op(c)) {
+      structurals[numStructurals++] = static_cast<uint32>(i);
+      followsScalar = false;
+      ++i;
+    } else if (c == '"') {
+      structurals[numStructurals++] = static_cast<uint32>(i);
+      if (is_raw_text_start(mInput, i, mInputSize)) {
+        const sizeT end = find_raw_text_end(mInput, i + 3, mInputSize);
+        if (end >= mInputSize) {
+          return set_error("Unterminated raw text block", i);
+        }
+        i = end + 3;
+      } else {
+        const sizeT start = i++;
+        while (i < mInputSize && mInput[i] != '"') {
+          i += (mInput[i] == '\\') ? 2 : 1;
+        }
+        if (i >= mInputSize) {
+          return set_error("Unterminated string", start);
+        }
+        ++i;
+      }
+      followsScalar = true;
+    } else {
+      if (!followsScalar) {
+        structurals[numStructurals++] = static_cast<uint32>(i);
+      }
+      followsScalar = true;
+      ++i;
+    }
+  }
+
+  mNumStructurals = numStructurals;
+  return true;
+}
+
+bool JsonTape::build_tape() {
+  // Every structural produces at most two tape words, plus the braces of an implicit root
+  mTape.reserve(mNumStructurals * 2 + 2);
+  mNextStructural = 0;
+
+  if (mNumStructurals > 0) {
+    const char first = mInput[mStructurals[0]];
+    if (first == '{' || first == '[') {
+      if (!parse_value(0)) {
+        return false;
+      }
+      if (mNextStructural < mNumStructurals) {
+        return set_error("Unexpected content after the root value", mStructurals[mNextStructural]);
+      }
+      return true;
+    }
+  }
+
+  // The root object may omit its braces
+  return parse_object(true, 1);
+}
+
+bool JsonTape::parse_value(uint32 depth) {
+  if (mNextStructural >= mNumStructurals) {
+    return set_error("Unexpected end of document", mInputSize);
+  }
+
+  const sizeT position = mStructurals[mNextStructural++];
+  switch (mInput[position]) {
+    case '{': return parse_object(false, depth + 1);
+    case '[': return parse_array(depth + 1);
+    case '"': return parse_string(position);
+    case 't': return parse_literal(position, "true", 4, EJsonTapeType::True);
+    case 'f': return parse_literal(position, "false", 5, EJsonTapeType::False);
+    case 'n': return parse_literal(position, "null", 4, EJsonTapeType::Null);
+    case '-':
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+      return parse_number(position);
+    default:
+      return set_error("Unexpected character", position);
+  }
+}
+
+bool JsonTape::parse_object(bool implicitRoot, uint32 depth) {
+  if (depth > MaxDepth) {
+    return set_error("Maximum nesting depth exceeded", mStructurals[mNextStructural - 1]);
+  }
+
+  const uint32 begin = mTape.size();
+  append_entry(EJsonTapeType::ObjectBegin, 0);
+
+  uint32 numMembers = 0;
+  for (;;) {
+    if (mNextStructural >= mNumStructurals) {
+      if (implicitRoot) {
+        break;
+      }
+      return set_error("Unterminated object", mInputSize);
+    }
+
+    const sizeT position = mStructurals[mNextStructural++];
+    const char c = mInput[position];
+    if (c == '}') {
+      if (implicitRoot) {
+        return set_error("Unexpected '}'", position);
+      }
+      break;
+    }
+
+    // Key, quoted or not
+    if (is_op(c)) {
+      return set_error("Expected object key", position);
+    } else if (c == '"') {
+      if (!parse_string(position)) {
+        return false;
+      }
+    } else if (!parse_unquoted_key(position)) {
+      return false;
+    }
+
+    if (mNextStructural >= mNumStructurals || mInput[mStructurals[mNextStructural]] != ':') {
+      return set_error("Expected ':' after object key", position);
+    }
+    ++mNextStructural;
+
+    if (!parse_value(depth)) {
+      return false;
+    }
+    ++numMembers;
+  }
+
+  const uint32 end = mTape.size();
+  append_entry(EJsonTapeType::ObjectEnd, begin);
+  mTape[begin] = (static_cast<uint64>(EJsonTapeType::ObjectBegin) << 56) |
+                 ((numMembers < NumElementsMask ? numMembers : NumElementsMask) << 32) | end;
+  return true;
+}
+
+bool JsonTape::parse_array(uint32 depth) {
+  if (depth > MaxDepth) {
+    return set_error("Maximum nesting depth exceeded", mStructurals[mNextStructural - 1]);
+  }
+
+  const uint32 begin = mTape.size();
+  append_entry(EJsonTapeType::ArrayBegin, 0);
+
+  uint32 numElements = 0;
+  for (;;) {
+    if (mNextStructural >= mNumStructurals) {
+      return set_error("Unterminated array", mInputSize);
+    }
+    if (mInput[mStructurals[mNextStructural]] == ']') {
+      ++mNextStructural;
+      break;
+    }
+
+    if (!parse_value(depth)) {
+      return false;
+    }
+    ++numElements;
+  }
+
+  const uint32 end = mTape.size();
+  append_entry(EJsonTapeType::ArrayEnd, begin);
+  mTape[begin] = (static_cast<uint64>(EJsonTapeType::ArrayBegin) << 56) |
+                 ((numElements < NumElementsMask ? numElements : NumElementsMask) << 32) | end;
+  return true;
+}
+
+bool JsonTape::parse_string(sizeT position) {
+  // Raw text blocks are taken as they are
+  if (is_raw_text_start(mInput, position, mInputSize)) {
+    const sizeT start = position + 3;
+    const sizeT end = find_raw_text_end(mInput, start, mInputSize);
+    if (end >= mInputSize) {
+      return set_error("Unterminated raw text block", position);
+    }
+    append_entry(EJsonTapeType::String, StringRawFlag | (end - start));
+    mTape.push_back(start);
+    return true;
+  }
+
+  // Fast path, the string has no escape sequences and can be referenced directly
+  const sizeT start = position + 1;
+  sizeT i = find_string_delimiter(mInput, start, mInputSize);
+  if (i >= mInputSize) {
+    return set_error("Unterminated string", position);
+  }
+  if (mInput[i] == '"') {
+    append_entry(EJsonTapeType::String, i - start);
+    mTape.push_back(start);
+    return true;
+  }
+
+  // Decode into the string buffer
+  const sizeT offset = mStringBuffer.size();
+  append_to_buffer(mStringBuffer, mInput + start, i - start);
+  for (;;) {
+    if (i >= mInputSize) {
+      return set_error("Unterminated string", position);
+    }
+    if (mInput[i] == '"') {
+      break;
+    }
+    if (mInput[i] != '\\') {
+      const sizeT next = find_string_delimiter(mInput, i, mInputSize);
+      append_to_buffer(mStringBuffer, mInput + i, next - i);
+      i = next;
+      continue;
+    }
+
+    if (i + 1 >= mInputSize) {
+      return set_error("Unterminated string", position);
+    }
+    char unescaped;
+    switch (mInput[i + 1]) {
+      case '"':  unescaped = '"'; break;
+      case '\\': unescaped = '\\'; break;
+      case '/':  unescaped = '/'; break;
+      case 'b':  unescaped = '\b'; break;
+      case 'f':  unescaped = '\f'; break;
+      case 'n':  unescaped = '\n'; break;
+      case 'r':  unescaped = '\r'; break;
+      case 't':  unescaped = '\t'; break;
+      case 'u': {
+        uint32 codePoint = 0;
+        if (i + 6 > mInputSize || !parse_hex4(mInput + i + 2, codePoint)) {
+          return set_error("Invalid unicode escape sequence", i);
+        }
+        if (codePoint >= 0xd800 && codePoint <= 0xdbff) {
+          // Surrogate pair
+          uint32 low = 0;
+          if (i + 12 > mInputSize || mInput[i + 6] != '\\' || mInput[i + 7] != 'u' ||
+              !parse_hex4(mInput + i + 8, low) || low < 0xdc00 || low > 0xdfff) {
+            return set_error("Invalid unicode surrogate pair", i);
+          }
+          codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+          i += 6;
+        } else if (codePoint >= 0xdc00 && codePoint <= 0xdfff) {
+          return set_error("Invalid unicode surrogate pair", i);
+        }
+        append_utf8(mStringBuffer, codePoint);
+        i += 6;
+        continue;
+      }
+      default:
+        return set_error("Invalid escape sequence", i);
+    }
+    append_to_buffer(mStringBuffer, &unescaped, 1);
+    i += 2;
+  }
+
+  append_entry(EJsonTapeType::String, StringBufferFlag | (mStringBuffer.size() - offset));
+  mTape.push_back(offset);
+  return true;
+}
+
+bool JsonTape::parse_unquoted_key(sizeT position) {
+  // Unquoted keys run up to the ':' and may contain whitespace, which is trimmed at the end
+  sizeT end = position;
+  while (end < mInputSize && !is_op(mInput[end]) && mInput[end] != '"' && mInput[end] != '#') {
+    ++end;
+  }
+  if (end >= mInputSize || mInput[end] != ':') {
+    return set_error("Expected ':' after object key", position);
+  }
+
+  sizeT last = end;
+  while (last > position && (static_cast<uint8>(mInput[last - 1]) <= ' ' || mInput[last - 1] == ',')) {
+    --last;
+  }
+
+  // Atoms of a key containing whitespace were indexed separately
+  while (mNextStructural < mNumStructurals && mStructurals[mNextStructural] < end) {
+    ++mNextStructural;
+  }
+
+  append_entry(EJsonTapeType::String, last - position);
+  mTape.push_back(position);
+  return true;
+}
+
+bool JsonTape::parse_number(sizeT position) {
+  const char* begin = mInput + position;
+  const char* end = mInput + mInputSize;
+  const char* current = begin;
+
+  const bool negative = (*current == '-');
+  if (negative) {
+    ++current;
+  }
+
+  // Accumulate the integer part directly, no temporary string or strtol round trip
+  const char* digits = current;
+  uint64 value = 0;
+  while (current < end && static_cast<uint8>(*current - '0') <= 9) {
+    value = value * 10 + static_cast<uint64>(*current - '0');
+    ++current;
+  }
+  const sizeT numDigits = static_cast<sizeT>(current - digits);
+  if (numDigits == 0) {
+    return set_error("Invalid number", position);
+  }
+
+  const bool isFloat = (current < end) && (*current == '.' || *current == 'e' || *current == 'E');
+  const uint64 limit = negative ? 0x8000000000000000ull : 0x7fffffffffffffffull;
+  if (!isFloat && (numDigits < 19 || (numDigits == 19 && value <= limit))) {
+    if (!is_terminator(static_cast<sizeT>(current - mInput))) {
+      return set_error("Invalid number", position);
+    }
+    append_entry(EJsonTapeType::Integer, 0);
+    mTape.push_back(negative ? (~value + 1) : value);
+    return true;
+  }
+
+  // Fractions, exponents and integers exceeding 64 bit
+  double number = 0.0;
+  const char* numberEnd = core::from_chars(begin, end, number);
+  if (nullptr == numberEnd || !is_terminator(static_cast<sizeT>(numberEnd - mInput))) {
+    return set_error("Invalid number", position);
+  }
+  uint64 bits;
+  Memory::copy(&bits, &number, sizeof(double));
+  append_entry(EJsonTapeType::Number, 0);
+  mTape.push_back(bits);
+  return true;
+}
+
+bool JsonTape::parse_literal(sizeT position, const char* literal, uint32 length, EJsonTapeType type) {
+  if (position + length > mInputSize || memcmp(mInput + position, literal, length) != 0 || !is_terminator(position + length)) {
+    return set_error("Invalid literal", position);
+  }
+  append_entry(type, 0);
+  return true;
+}
+
+bool JsonTape::is_terminator(sizeT position) const {
+  if (position >= mInputSize) {
+    return true;
+  }
+  const char c = mInput[position];
+  return static_cast<uint8>(c) <= ' ' || c == ',' || c == '#' || is_op(c);
+}
+
+bool JsonTape::set_error(const char* error, sizeT offset) {
+  mError = error;
+  mErrorOffset = offset;
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
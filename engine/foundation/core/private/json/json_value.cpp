@@ -23,6 +23,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/json/json_value.h"
+#include <new>
+#include <utility>
 
 
 //[-------------------------------------------------------]
@@ -37,51 +39,33 @@ namespace core {
 JsonValue::JsonValue()
 : mType(EJsonType::JsonType_Null)
 , mBool(false)
-//, mArray(nullptr)
 , mIsRawTextBlock(false) {
-
+  // Array, object and string are only constructed once the value becomes one of them
 }
 
 JsonValue::JsonValue(const JsonValue& rhs)
-: mType(rhs.mType)
+: mType(EJsonType::JsonType_Null)
+, mBool(false)
 , mIsRawTextBlock(rhs.mIsRawTextBlock) {
   copy_from(rhs);
 }
 
 JsonValue::JsonValue(JsonValue&& rhs)
-: mType(rhs.mType)
+: mType(EJsonType::JsonType_Null)
+, mBool(false)
 , mIsRawTextBlock(rhs.mIsRawTextBlock) {
-  copy_from(rhs);
+  copy_from(std::move(rhs));
 }
 
 JsonValue::~JsonValue() {
-  // Based on type, call the correct cleanup
-  if (mType == JsonType_Object) {
-    Vector<JsonValue*> values;
-    mObject.get_values(values);
-    for (auto& value: values) {
-      //delete value;
-    }
-    mObject.clear();
-    //delete mObject;
-  }
-  else if (mType == JsonType_Array) {
-    for (auto& value: mArray) {
-      //delete value;
-    }
-    mArray.clear();
-    //delete mArray;
-  }
-  else if (mType == JsonType_String) {
-    mString.clear();
-    //delete mString;
-  }
+  // Children are referenced, not owned
+  destroy();
 }
 
 
 JsonValue& JsonValue::operator=(const core::JsonValue &rhs) {
   if (this != &rhs) {
-    mType = rhs.mType;
+    destroy();
     mIsRawTextBlock = rhs.mIsRawTextBlock;
     copy_from(rhs);
   }
@@ -91,9 +75,9 @@ JsonValue& JsonValue::operator=(const core::JsonValue &rhs) {
 
 JsonValue& JsonValue::operator=(core::JsonValue &&rhs) {
   if (this != &rhs) {
-    mType = rhs.mType;
+    destroy();
     mIsRawTextBlock = rhs.mIsRawTextBlock;
-    copy_from(rhs);
+    copy_from(std::move(rhs));
   }
 
   return *this;
@@ -184,6 +168,8 @@ Map<String, JsonValue*> &JsonValue::to_object() {
 
 
 void JsonValue::copy_from(const core::JsonValue &rhs) {
+  // The storage of this value holds no constructed member, see "destroy()"
+  mType = rhs.mType;
   switch(rhs.mType) {
 
     case JsonType_Null:
@@ -198,18 +184,20 @@ void JsonValue::copy_from(const core::JsonValue &rhs) {
       mInteger = rhs.mInteger;
       break;
     case JsonType_String:
-      mString = rhs.mString; // new String(*rhs.mString);
+      new (&mString) String(rhs.mString);
       break;
     case JsonType_Array:
-      mArray = rhs.mArray; // new Vector<JsonValue*>(*rhs.mArray);
+      new (&mArray) Vector<JsonValue*>(rhs.mArray);
       break;
     case JsonType_Object:
-      mObject = rhs.mObject; // new Map<String, JsonValue*>(*rhs.mObject);
+      new (&mObject) Map<String, JsonValue*>(rhs.mObject);
       break;
   }
 }
 
 void JsonValue::copy_from(core::JsonValue &&rhs) {
+  // The storage of this value holds no constructed member, see "destroy()"
+  mType = rhs.mType;
   switch(rhs.mType) {
 
     case JsonType_Null:
@@ -224,15 +212,33 @@ void JsonValue::copy_from(core::JsonValue &&rhs) {
       mInteger = rhs.mInteger;
       break;
     case JsonType_String:
-      mString = rhs.mString; // new String(*rhs.mString);
+      new (&mString) String(std::move(rhs.mString));
       break;
     case JsonType_Array:
-      mArray = rhs.mArray; // new Vector<JsonValue*>(*rhs.mArray);
+      new (&mArray) Vector<JsonValue*>(std::move(rhs.mArray));
       break;
     case JsonType_Object:
-      mObject = rhs.mObject; // new Map<String, JsonValue*>(*rhs.mObject);
+      // Map can't be moved
+      new (&mObject) Map<String, JsonValue*>(rhs.mObject);
+      break;
+  }
+}
+
+void JsonValue::destroy() {
+  switch(mType) {
+    case JsonType_String:
+      mString.~String();
+      break;
+    case JsonType_Array:
+      mArray.~Vector<JsonValue*>();
+      break;
+    case JsonType_Object:
+      mObject.~Map<String, JsonValue*>();
+      break;
+    default:
       break;
   }
+  mType = JsonType_Null;
 }
 
 
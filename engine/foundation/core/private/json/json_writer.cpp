@@ -23,6 +23,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/json/json_writer.h"
+#include "core/string/number_conversion.h"
+#include <cmath>
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -50,109 +53,127 @@ String JsonPrinter::convert_to_string(const core::JsonValue &jsonValue) {
   // This is the root object, we typically _always_ have an object on root level
   BE_ASSERT(jsonValue.is_object(), "On Root level we expect an Object")
 
-  uint64 numElements = jsonValue.get_object().size();
-  Vector<String> keys;
-  Vector<JsonValue*> values;
-  jsonValue.get_object().get_keys(keys);
-  jsonValue.get_object().get_values(values);
-  for (uint64 i = 0; i < numElements; ++i) {
-    result += keys[i] + ": " + value_to_string(*values[i], 1);
+  const Map<String, JsonValue*>& object = jsonValue.get_object();
+  const uint64 numElements = object.size();
+  uint64 i = 0;
+  for (auto iter = object.cbegin(); iter != object.cend(); ++iter, ++i) {
+    result += iter.key();
+    result += ": ";
+    value_to_string(result, *iter.value(), 1);
     if (i < (numElements-1)) {
-      result += ",";
+      result += ',';
     }
-    result += "\n";
+    result += '\n';
   }
 
   return result;
 }
 
 
-String JsonPrinter::value_to_string(const JsonValue& jsonValue, uint64 level) {
+void JsonPrinter::value_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
   switch(jsonValue.get_type()) {
     case JsonType_Null:
-      return null_to_string(jsonValue, level);
+      null_to_string(result, jsonValue, level);
+      break;
     case JsonType_Boolean:
-      return boolean_to_string(jsonValue, level);
+      boolean_to_string(result, jsonValue, level);
+      break;
     case JsonType_Number:
-      return number_to_string(jsonValue, level);
+      number_to_string(result, jsonValue, level);
+      break;
     case JsonType_Integer:
-      return integer_to_string(jsonValue, level);
+      integer_to_string(result, jsonValue, level);
+      break;
     case JsonType_String:
-      return string_to_string(jsonValue, level);
+      string_to_string(result, jsonValue, level);
+      break;
     case JsonType_Array:
-      return array_to_string(jsonValue, level);
+      array_to_string(result, jsonValue, level);
+      break;
     case JsonType_Object:
-      return object_to_string(jsonValue, level);
+      object_to_string(result, jsonValue, level);
+      break;
   }
-  return String();
 }
 
-String JsonPrinter::null_to_string(const JsonValue& jsonValue, uint64 level) {
-  return "null";
+void JsonPrinter::null_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  result += "null";
 }
 
-String JsonPrinter::boolean_to_string(const JsonValue& jsonValue, uint64 level) {
-  return jsonValue.to_bool() ? "true" : "false";
+void JsonPrinter::boolean_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  result += jsonValue.to_bool() ? "true" : "false";
 }
 
-String JsonPrinter::number_to_string(const JsonValue& jsonValue, uint64 level) {
-  return core::to_string(jsonValue.to_number());
-}
+void JsonPrinter::number_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  const float value = jsonValue.to_number();
+  if (!std::isfinite(value)) {
+    // JSON has no representation for infinity and NaN, write the same as JsonStreamWriter
+    result += "null";
+    return;
+  }
 
-String JsonPrinter::integer_to_string(const JsonValue& jsonValue, uint64 level) {
-  return core::to_string(jsonValue.to_integer());
-}
+  char text[MaxNumberChars];
+  const char* end = core::to_chars(text, text + MaxNumberChars, value);
+  result.append(text, static_cast<String::SizeType>(end - text));
 
-String JsonPrinter::string_to_string(const JsonValue& jsonValue, uint64 level) {
-  if (jsonValue.is_raw_text()) {
-    return "\"\"\"" + jsonValue.to_string() + "\"\"\"";
-  } else {
-    return "\"" + jsonValue.to_string() + "\"";
+  // Integral values need a fraction, otherwise they are read back as integer
+  if (nullptr == memchr(text, '.', end - text) && nullptr == memchr(text, 'e', end - text)) {
+    result.append(".0", 2);
   }
 }
 
-String JsonPrinter::array_to_string(const JsonValue& jsonValue, uint64 level) {
-  String result = "[\n";
+void JsonPrinter::integer_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  result.append(jsonValue.to_integer());
+}
+
+void JsonPrinter::string_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  const char* quotes = jsonValue.is_raw_text() ? "\"\"\"" : "\"";
+  result += quotes;
+  result += jsonValue.to_string();
+  result += quotes;
+}
 
-  Vector<JsonValue*> array = jsonValue.get_array();
+void JsonPrinter::array_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  result += "[\n";
 
-  if (array.size() > 0) {
-    result += make_indent(level) + value_to_string(*array[0], level+1);
+  const Vector<JsonValue*>& array = jsonValue.get_array();
 
-    for (uint64 i = 1; i < array.size(); ++i) {
-      result += ",\n" + make_indent(level) + value_to_string(*array[i], level+1);
+  for (uint64 i = 0; i < array.size(); ++i) {
+    if (i > 0) {
+      result += ",\n";
     }
+    make_indent(result, level);
+    value_to_string(result, *array[i], level+1);
   }
 
-  result += "\n" + make_indent(level > 0 ? level-1 : level) + "]";
-  return result;
+  result += '\n';
+  make_indent(result, level > 0 ? level-1 : level);
+  result += ']';
 }
 
-String JsonPrinter::object_to_string(const JsonValue& jsonValue, uint64 level) {
-  String result = "{\n";
-
-  uint64 numElements = jsonValue.get_object().size();
-  Vector<String> keys;
-  Vector<JsonValue*> values;
-  jsonValue.get_object().get_keys(keys);
-  jsonValue.get_object().get_values(values);
-  for (uint64 i = 0; i < numElements; ++i) {
-    result += make_indent(level) + keys[i] + ": " + value_to_string(*values[i], level+1);
+void JsonPrinter::object_to_string(String& result, const JsonValue& jsonValue, uint64 level) {
+  result += "{\n";
+
+  const Map<String, JsonValue*>& object = jsonValue.get_object();
+  const uint64 numElements = object.size();
+  uint64 i = 0;
+  for (auto iter = object.cbegin(); iter != object.cend(); ++iter, ++i) {
+    make_indent(result, level);
+    result += iter.key();
+    result += ": ";
+    value_to_string(result, *iter.value(), level+1);
     if (i < (numElements-1)) {
-      result += ",";
+      result += ',';
     }
-    result += "\n";
+    result += '\n';
   }
 
-  result += make_indent(level > 0 ? level-1 : level) + "}";
-
-  return result;
+  make_indent(result, level > 0 ? level-1 : level);
+  result += '}';
 }
 
-String JsonPrinter::make_indent(core::uint64 level) {
-  String result(level * mIndentationLength, ' ');
-
-  return result;
+void JsonPrinter::make_indent(String& result, core::uint64 level) {
+  result.append(level * mIndentationLength, ' ');
 }
 
 
@@ -29,7 +29,11 @@
 //[-------------------------------------------------------]
 #include "core/linux/linux_file.h"
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <cerrno>
+#include <unistd.h>
 
 
 //[-------------------------------------------------------]
@@ -42,7 +46,11 @@ namespace core {
 //[ Public methods                                        ]
 //[-------------------------------------------------------]
 LinuxFile::LinuxFile()
-: mFile(nullptr) {
+: mFile(nullptr)
+, mFileDescriptor(-1)
+, mAccess(EFileMode::Read)
+, mMappedData(nullptr)
+, mMappedSize(0) {
 
 }
 
@@ -52,12 +60,15 @@ LinuxFile::~LinuxFile() {
 
 uint64 LinuxFile::get_number_of_bytes() {
   if (mFile) {
-    const int curr_pos = ftell(mFile);
-    fseek(mFile, 0, SEEK_END);
-    const int32 size = ftell(mFile);
-    fseek(mFile, curr_pos, SEEK_SET);
+    // Data written through stdio may still sit in the buffer
+    if (mAccess != EFileMode::Read) {
+      ::fflush(mFile);
+    }
 
-    return size;
+    struct stat fileStat;
+    if (::fstat(::fileno(mFile), &fileStat) == 0) {
+      return static_cast<uint64>(fileStat.st_size);
+    }
   }
   return 0;
 }
@@ -67,7 +78,7 @@ bool LinuxFile::is_eof() const {
 }
 
 bool LinuxFile::flush() {
-  return mFile && fflush(mFile);
+  return mFile && 0 == fflush(mFile);
 }
 
 bool LinuxFile::open(const String& absoluteFilename, EFileMode fileMode) {
@@ -80,44 +91,178 @@ bool LinuxFile::open(const String& absoluteFilename, EFileMode fileMode) {
 
   // Directly open the file
   mFile = ::fopen(mAbsoluteFilename.c_str(), mAccess == EFileMode::Read ? "r" : "w");
+  mFileDescriptor = mFile ? ::fileno(mFile) : -1;
 
   return (mFile != nullptr);
 }
 
 void LinuxFile::close() {
+  unmap();
+
   if (mFile) {
     ::fclose(mFile);
 
     mFile = nullptr;
+    mFileDescriptor = -1;
   }
 }
 
 uint64 LinuxFile::tell() const {
-  return mFile ? ftell(mFile) : -1;
+  return mFile ? static_cast<uint64>(::ftello(mFile)) : -1;
 }
 
 void LinuxFile::seek(uint64 seek) {
-  ::fseek(mFile, seek, SEEK_SET);
+  if (mFile) {
+    ::fseeko(mFile, static_cast<off_t>(seek), SEEK_SET);
+  }
 }
 
 uint64 LinuxFile::read(void *destinationBuffer, uint64 numberOfBytes) {
   if (mFile) {
-    return ::fread(destinationBuffer, numberOfBytes, 1, mFile);
+    return ::fread(destinationBuffer, 1, numberOfBytes, mFile);
   }
   return 0;
 }
 
 void LinuxFile::skip(uint64 numberOfBytes) {
+  if (mFile) {
+    ::fseeko(mFile, static_cast<off_t>(numberOfBytes), SEEK_CUR);
+  }
+}
 
+uint64 LinuxFile::read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes) {
+  uint64 numberOfReadBytes = 0;
+  if (mFileDescriptor >= 0) {
+    // pread may return less than requested, e.g. when interrupted by a signal
+    uint8* destination = static_cast<uint8*>(destinationBuffer);
+    while (numberOfReadBytes < numberOfBytes) {
+      const ssize_t result = ::pread(mFileDescriptor, destination + numberOfReadBytes, static_cast<size_t>(numberOfBytes - numberOfReadBytes), static_cast<off_t>(offset + numberOfReadBytes));
+      if (result > 0) {
+        numberOfReadBytes += static_cast<uint64>(result);
+      } else if (result == 0 || errno != EINTR) {
+        break;
+      }
+    }
+  }
+  return numberOfReadBytes;
+}
+
+const void* LinuxFile::map(EAccessPattern accessPattern, uint64& numberOfBytes) {
+  BE_ASSERT(nullptr == mMappedData, "The file is already mapped")
+  numberOfBytes = 0;
+
+  // A write only descriptor can't back a read-only mapping, and mmap refuses zero lengths
+  if (nullptr == mFile || mAccess != EFileMode::Read) {
+    return nullptr;
+  }
+  const int fileDescriptor = ::fileno(mFile);
+  struct stat fileStat;
+  if (::fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0) {
+    return nullptr;
+  }
+
+  void* data = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+  if (MAP_FAILED == data) {
+    return nullptr;
+  }
+
+  // The hint is only advisory, a failing madvise leaves a perfectly usable mapping
+  int advice = MADV_NORMAL;
+  switch (accessPattern) {
+    case EAccessPattern::Random:
+      advice = MADV_RANDOM;
+      break;
+
+    case EAccessPattern::Sequential:
+      advice = MADV_SEQUENTIAL;
+      break;
+
+    case EAccessPattern::WillNeed:
+      advice = MADV_WILLNEED;
+      break;
+  }
+  ::madvise(data, static_cast<size_t>(fileStat.st_size), advice);
+
+  mMappedData = data;
+  mMappedSize = static_cast<uint64>(fileStat.st_size);
+  numberOfBytes = mMappedSize;
+  return mMappedData;
+}
+
+void LinuxFile::unmap() {
+  if (mMappedData) {
+    ::munmap(mMappedData, static_cast<size_t>(mMappedSize));
+    mMappedData = nullptr;
+    mMappedSize = 0;
+  }
 }
 
 uint64 LinuxFile::write(const void *sourceBuffer, uint64 numberOfBytes) {
   if (mFile) {
-    return ::fwrite(sourceBuffer, numberOfBytes, 1, mFile);
+    return ::fwrite(sourceBuffer, 1, numberOfBytes, mFile);
   }
   return 0;
 }
 
+uint64 LinuxFile::write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes) {
+  uint64 numberOfWrittenBytes = 0;
+  // Bytes still buffered by "write()" would land after these ones and overwrite them
+  if (nullptr != mFile && ::fflush(mFile) == 0) {
+    const uint8* source = static_cast<const uint8*>(sourceBuffer);
+    while (numberOfWrittenBytes < numberOfBytes) {
+      const ssize_t result = ::pwrite(mFileDescriptor, source + numberOfWrittenBytes, static_cast<size_t>(numberOfBytes - numberOfWrittenBytes), static_cast<off_t>(offset + numberOfWrittenBytes));
+      if (result > 0) {
+        numberOfWrittenBytes += static_cast<uint64>(result);
+      } else if (result == 0 || errno != EINTR) {
+        break;
+      }
+    }
+  }
+  return numberOfWrittenBytes;
+}
+
+uint64 LinuxFile::write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) {
+  uint64 numberOfWrittenBytes = 0;
+  if (nullptr == mFile || ::fflush(mFile) != 0) {
+    return numberOfWrittenBytes;
+  }
+
+  // Batches of vectors, a partially written vector is resumed at its first unwritten byte
+  static constexpr uint32 MaxNumberOfVectors = 64;
+  struct iovec vectors[MaxNumberOfVectors];
+  uint32 bufferIndex = 0;
+  uint64 bufferOffset = 0;
+  while (bufferIndex < numberOfBuffers) {
+    int numberOfVectors = 0;
+    for (uint32 i = bufferIndex; i < numberOfBuffers && numberOfVectors < static_cast<int>(MaxNumberOfVectors); ++i) {
+      const uint64 skip = (i == bufferIndex) ? bufferOffset : 0;
+      vectors[numberOfVectors].iov_base = const_cast<uint8*>(static_cast<const uint8*>(buffers[i].data) + skip);
+      vectors[numberOfVectors].iov_len = static_cast<size_t>(buffers[i].numberOfBytes - skip);
+      ++numberOfVectors;
+    }
+    const ssize_t result = ::writev(mFileDescriptor, vectors, numberOfVectors);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    } else if (result == 0 && vectors[0].iov_len > 0) {
+      break;
+    }
+
+    // Advance past the completely written buffers
+    numberOfWrittenBytes += static_cast<uint64>(result);
+    uint64 numberOfLeftBytes = static_cast<uint64>(result);
+    while (bufferIndex < numberOfBuffers && numberOfLeftBytes >= buffers[bufferIndex].numberOfBytes - bufferOffset) {
+      numberOfLeftBytes -= buffers[bufferIndex].numberOfBytes - bufferOffset;
+      bufferOffset = 0;
+      ++bufferIndex;
+    }
+    bufferOffset += numberOfLeftBytes;
+  }
+  return numberOfWrittenBytes;
+}
+
 int64 LinuxFile::get_last_modification_time() const {
   struct stat fileStat;
 
@@ -24,6 +24,7 @@
 //[-------------------------------------------------------]
 #include "core/linux/linux_file_watcher.h"
 #include "core/memory/memory.h"
+#include <cerrno>
 #include <dirent.h>
 #include <unistd.h>
 #include <sys/inotify.h>
@@ -50,13 +51,9 @@ static core::Vector<core::String> list_directory_entries(const char* dirPath) {
         break;
       }
 
-      core::uint32 numBytes = strlen(dirEntry->d_name);
-      char* stringBuffer = new char[numBytes];
-
-      core::Memory::copy(&stringBuffer[0], dirEntry->d_name, numBytes + 1);
-
-      entries.push_back(stringBuffer);
+      entries.push_back(dirEntry->d_name);
     }
+    closedir(dir);
   }
 
   return entries;
@@ -99,14 +96,14 @@ static void create_watcher_recursively(core::int32 fileHandle, const char* dirPa
 //[-------------------------------------------------------]
 LinuxFileWatcher::LinuxFileWatcher(const Path &path)
   : FileWatcherImpl(path)
-  , mHandle(0) {
+  , mHandle(-1) {
   // Initialize the notification handle
   initialize_notification_handle();
 }
 
 LinuxFileWatcher::LinuxFileWatcher(const String &watcherPath)
   : FileWatcherImpl(watcherPath)
-  , mHandle(0) {
+  , mHandle(-1) {
   // Initialize the notification handle
   initialize_notification_handle();
 }
@@ -127,21 +124,26 @@ bool LinuxFileWatcher::any_changes() const {
 
   bool anyChanges = select(FD_SETSIZE, &fileHandles, nullptr, nullptr, &timeout) > 0;
 
-  // Read flush element
+  // Drain the pending events, the handle is non-blocking
   if (anyChanges) {
-    read(mHandle, nullptr, 1024);
+    alignas(inotify_event) char buffer[4096];
+    while (read(mHandle, buffer, sizeof(buffer)) > 0 || EINTR == errno) {
+    }
   }
 
   return anyChanges;
 }
 
 void LinuxFileWatcher::close() {
-  ::close(mHandle);
+  if (mHandle >= 0) {
+    ::close(mHandle);
+    mHandle = -1;
+  }
 }
 
 
 void LinuxFileWatcher::initialize_notification_handle() {
-  mHandle = inotify_init();
+  mHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
 
   // Add watcher
   if (mPath.is_directory()) {
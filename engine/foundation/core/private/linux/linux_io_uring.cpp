@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/linux/linux_io_uring.h"
+#include "core/core/default_assert.h"
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static int io_uring_setup(uint32 numberOfEntries, io_uring_params* parameters) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, numberOfEntries, parameters));
+}
+
+static int io_uring_enter(int ringFileDescriptor, uint32 numberToSubmit, uint32 minimumCompletions, uint32 flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ringFileDescriptor, numberToSubmit, minimumCompletions, flags, nullptr, 0));
+}
+
+static int io_uring_register(int ringFileDescriptor, uint32 opcode, void* argument, uint32 numberOfArguments) {
+  return static_cast<int>(::syscall(__NR_io_uring_register, ringFileDescriptor, opcode, argument, numberOfArguments));
+}
+
+static uint32* ring_pointer(void* ring, uint32 offset) {
+  return reinterpret_cast<uint32*>(static_cast<uint8*>(ring) + offset);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+LinuxIoUring::LinuxIoUring()
+: mRingFileDescriptor(-1)
+, mNumEntries(0)
+, mNumUnsubmitted(0)
+, mSubmissionRing(nullptr)
+, mSubmissionRingSize(0)
+, mSubmissionHead(nullptr)
+, mSubmissionTail(nullptr)
+, mSubmissionMask(nullptr)
+, mSubmissionArray(nullptr)
+, mSubmissionEntries(nullptr)
+, mSubmissionEntriesSize(0)
+, mCompletionRing(nullptr)
+, mCompletionRingSize(0)
+, mCompletionHead(nullptr)
+, mCompletionTail(nullptr)
+, mCompletionMask(nullptr)
+, mCompletionEntries(nullptr) {
+
+}
+
+LinuxIoUring::~LinuxIoUring() {
+  deinitialize();
+}
+
+bool LinuxIoUring::initialize(uint32 numberOfEntries) {
+  BE_ASSERT(!is_initialized(), "The ring has already been initialized")
+
+  io_uring_params parameters;
+  memset(&parameters, 0, sizeof(parameters));
+  mRingFileDescriptor = io_uring_setup(numberOfEntries, &parameters);
+  if (mRingFileDescriptor < 0) {
+    mRingFileDescriptor = -1;
+    return false;
+  }
+
+  // Plain reads are only known to kernels from 5.6 on, which also brought the probe
+  {
+    alignas(io_uring_probe) uint8 probeMemory[sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op)];
+    memset(probeMemory, 0, sizeof(probeMemory));
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probeMemory);
+    if (io_uring_register(mRingFileDescriptor, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) < 0 ||
+        probe->last_op < IORING_OP_READ || !(probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED)) {
+      deinitialize();
+      return false;
+    }
+  }
+
+  mSubmissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(uint32);
+  mCompletionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+  const bool singleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (singleMapping) {
+    mSubmissionRingSize = (mSubmissionRingSize > mCompletionRingSize) ? mSubmissionRingSize : mCompletionRingSize;
+    mCompletionRingSize = mSubmissionRingSize;
+  }
+
+  mSubmissionRing = ::mmap(nullptr, mSubmissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_SQ_RING);
+  if (MAP_FAILED == mSubmissionRing) {
+    mSubmissionRing = nullptr;
+    deinitialize();
+    return false;
+  }
+  if (singleMapping) {
+    mCompletionRing = mSubmissionRing;
+  } else {
+    mCompletionRing = ::mmap(nullptr, mCompletionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_CQ_RING);
+    if (MAP_FAILED == mCompletionRing) {
+      mCompletionRing = nullptr;
+      deinitialize();
+      return false;
+    }
+  }
+  mSubmissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+  void* submissionEntries = ::mmap(nullptr, mSubmissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_SQES);
+  if (MAP_FAILED == submissionEntries) {
+    deinitialize();
+    return false;
+  }
+  mSubmissionEntries = static_cast<io_uring_sqe*>(submissionEntries);
+
+  mSubmissionHead = ring_pointer(mSubmissionRing, parameters.sq_off.head);
+  mSubmissionTail = ring_pointer(mSubmissionRing, parameters.sq_off.tail);
+  mSubmissionMask = ring_pointer(mSubmissionRing, parameters.sq_off.ring_mask);
+  mSubmissionArray = ring_pointer(mSubmissionRing, parameters.sq_off.array);
+  mCompletionHead = ring_pointer(mCompletionRing, parameters.cq_off.head);
+  mCompletionTail = ring_pointer(mCompletionRing, parameters.cq_off.tail);
+  mCompletionMask = ring_pointer(mCompletionRing, parameters.cq_off.ring_mask);
+  mCompletionEntries = reinterpret_cast<io_uring_cqe*>(static_cast<uint8*>(mCompletionRing) + parameters.cq_off.cqes);
+  mNumEntries = parameters.sq_entries;
+  mNumUnsubmitted = 0;
+
+  // Done
+  return true;
+}
+
+void LinuxIoUring::deinitialize() {
+  if (mSubmissionEntries) {
+    ::munmap(mSubmissionEntries, mSubmissionEntriesSize);
+  }
+  if (mCompletionRing && mCompletionRing != mSubmissionRing) {
+    ::munmap(mCompletionRing, mCompletionRingSize);
+  }
+  if (mSubmissionRing) {
+    ::munmap(mSubmissionRing, mSubmissionRingSize);
+  }
+  if (mRingFileDescriptor >= 0) {
+    ::close(mRingFileDescriptor);
+  }
+
+  mRingFileDescriptor = -1;
+  mNumEntries = 0;
+  mNumUnsubmitted = 0;
+  mSubmissionRing = nullptr;
+  mSubmissionRingSize = 0;
+  mSubmissionHead = mSubmissionTail = mSubmissionMask = mSubmissionArray = nullptr;
+  mSubmissionEntries = nullptr;
+  mSubmissionEntriesSize = 0;
+  mCompletionRing = nullptr;
+  mCompletionRingSize = 0;
+  mCompletionHead = mCompletionTail = mCompletionMask = nullptr;
+  mCompletionEntries = nullptr;
+}
+
+bool LinuxIoUring::is_initialized() const {
+  return (nullptr != mSubmissionEntries);
+}
+
+uint32 LinuxIoUring::get_num_entries() const {
+  return mNumEntries;
+}
+
+bool LinuxIoUring::prepare_read(int fileDescriptor, void* buffer, uint32 numberOfBytes, uint64 offset, uint64 userData) {
+  BE_ASSERT(is_initialized(), "The ring has not been initialized")
+
+  // Only this thread moves the tail, the kernel moves the head while consuming
+  const uint32 tail = *mSubmissionTail;
+  if (tail - __atomic_load_n(mSubmissionHead, __ATOMIC_ACQUIRE) >= mNumEntries) {
+    return false;
+  }
+
+  const uint32 index = tail & *mSubmissionMask;
+  io_uring_sqe& entry = mSubmissionEntries[index];
+  memset(&entry, 0, sizeof(entry));
+  entry.opcode = IORING_OP_READ;
+  entry.fd = fileDescriptor;
+  entry.addr = reinterpret_cast<uint64>(buffer);
+  entry.len = numberOfBytes;
+  entry.off = offset;
+  entry.user_data = userData;
+  mSubmissionArray[index] = index;
+
+  // Publish the entry before the kernel can see the new tail
+  __atomic_store_n(mSubmissionTail, tail + 1, __ATOMIC_RELEASE);
+  ++mNumUnsubmitted;
+  return true;
+}
+
+int32 LinuxIoUring::submit(uint32 minimumNumberOfCompletions) {
+  BE_ASSERT(is_initialized(), "The ring has not been initialized")
+
+  const uint32 flags = (minimumNumberOfCompletions > 0) ? IORING_ENTER_GETEVENTS : 0;
+  int result = 0;
+  do {
+    result = io_uring_enter(mRingFileDescriptor, mNumUnsubmitted, minimumNumberOfCompletions, flags);
+  } while (result < 0 && errno == EINTR);
+  if (result < 0) {
+    return -errno;
+  }
+  mNumUnsubmitted -= (static_cast<uint32>(result) < mNumUnsubmitted) ? static_cast<uint32>(result) : mNumUnsubmitted;
+  return result;
+}
+
+bool LinuxIoUring::pop_completion(uint64& userData, int32& result) {
+  BE_ASSERT(is_initialized(), "The ring has not been initialized")
+
+  const uint32 head = *mCompletionHead;
+  if (head == __atomic_load_n(mCompletionTail, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+
+  const io_uring_cqe& entry = mCompletionEntries[head & *mCompletionMask];
+  userData = entry.user_data;
+  result = entry.res;
+
+  // Hand the slot back to the kernel only after the entry has been read
+  __atomic_store_n(mCompletionHead, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool LinuxIoUring::pop_unsubmitted(uint64& userData) {
+  BE_ASSERT(is_initialized(), "The ring has not been initialized")
+
+  if (0 == mNumUnsubmitted) {
+    return false;
+  }
+
+  // Without a submission polling thread the kernel only consumes entries inside of "submit()",
+  // so the tail can simply be moved back
+  const uint32 tail = *mSubmissionTail - 1;
+  userData = mSubmissionEntries[tail & *mSubmissionMask].user_data;
+  __atomic_store_n(mSubmissionTail, tail, __ATOMIC_RELEASE);
+  --mNumUnsubmitted;
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -25,7 +25,10 @@
 #include "core/linux/linux_platform.h"
 #include "core/io/file.h"
 #include "core/memory/memory.h"
+#include "core/profiling/startup_tracer.h"
 #include "core/std/math.h"
+#include "core/string/format.h"
+#include "core/string/number_conversion.h"
 #include "core/string/regex.h"
 #include <pwd.h>
 #include <time.h>
@@ -62,7 +65,7 @@ bool LinuxPlatform::get_memory_information(MemoryInformation &sMemoryInformation
 
 LinuxPlatform::LinuxPlatform()
 : mSysInfoInit(!uname(&mName)) {
-  initialize_cpu_info();
+  // The CPU information is gathered on first request, reading sysfs is too expensive to be done during startup
 }
 
 LinuxPlatform::~LinuxPlatform() {
@@ -109,13 +112,15 @@ uint32 LinuxPlatform::get_cpu_mhz() const {
 
   // Parse kernel information file
   if (file->open("/proc/cpuinfo", EFileMode::Read)) {
-    static CRegEx cRegEx("^\\s*cpu MHz\\s*:\\s*(\\d+(\\.\\d+)).*$");
+    // Constant matching keeps the shared expression free of per call state
+    static const CRegEx cRegEx("^\\s*cpu MHz\\s*:\\s*(\\d+(\\.\\d+)).*$");
 
+    RegExMatch match;
     while (!file->is_eof()) {
       const String line = file->get_str();
-      if (cRegEx.match(line)) {
-        const String sResult = cRegEx.get_result(0);
-        mhz = sResult.get_int();
+      if (cRegEx.match(StringView(line.data(), line.size()), 0, match)) {
+        const StringView result = match.get_group(1);
+        from_chars(result.data(), result.data() + result.size(), mhz);
       }
     }
   }
@@ -128,6 +133,7 @@ uint32 LinuxPlatform::get_cpu_mhz() const {
 }
 
 CPUInfo LinuxPlatform::get_cpu_info() const {
+  std::call_once(mCpuInfoOnce, &LinuxPlatform::initialize_cpu_info, this);
   return mCpuInfo;
 }
 
@@ -135,7 +141,7 @@ String LinuxPlatform::get_executable_filename() const {
   // get PID of current process
   const pid_t nPID = getpid();
   char szLinkName[512];
-  if (snprintf(szLinkName, 512, "/proc/%d/exe", nPID) >= 0) {
+  if (format_to(szLinkName, sizeof(szLinkName), "/proc/{}/exe", nPID) < sizeof(szLinkName)) {
     // Read symbolic link
     char szProgram[512];
     const int nRet = readlink(szLinkName, szProgram, 512);
@@ -169,7 +175,7 @@ void LinuxPlatform::urgent_message(const String &sMessage) const {
   // There's no such thing as "MessageBox()" from MS Windows and using a GUI system
   // like Qt would be a total overkill in here, so, go the easiest possible way...
   char szCommand[1024];
-  sprintf(szCommand, "xmessage -center \"%s\"", sMessage.c_str());
+  format_to(szCommand, sizeof(szCommand), "xmessage -center \"{}\"", sMessage);
   system(szCommand);
 }
 
@@ -206,7 +212,9 @@ void LinuxPlatform::yield() const {
   sched_yield();
 }
 
-void LinuxPlatform::initialize_cpu_info() {
+void LinuxPlatform::initialize_cpu_info() const {
+  BE_STARTUP_SCOPE("LinuxPlatform::initialize_cpu_info")
+
   cpu_set_t cpus;
   CPU_ZERO(&cpus);
   if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
@@ -229,7 +237,7 @@ void LinuxPlatform::initialize_cpu_info() {
 
         {
           File cFile;
-          if (cFile.open(String().append_format("sys/devices/system/cpu/cpu%d/topology/core_id", cpuIdx), EFileMode::Read)) {
+          if (cFile.open(format("sys/devices/system/cpu/cpu{}/topology/core_id", cpuIdx), EFileMode::Read)) {
             String content = cFile.get_content_as_string();
             cpusInfo[cpuIdx].Core = content.get_int();
             cFile.close();
@@ -238,7 +246,7 @@ void LinuxPlatform::initialize_cpu_info() {
 
         {
           File cFile;
-          if (cFile.open(String().append_format("sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpuIdx), EFileMode::Read)) {
+          if (cFile.open(format("sys/devices/system/cpu/cpu{}/topology/physical_package_id", cpuIdx), EFileMode::Read)) {
             String content = cFile.get_content_as_string();
 
             cpusInfo[cpuIdx].Package = content.get_int();
@@ -292,7 +300,7 @@ void LinuxPlatform::initialize_cpu_info() {
   mCpuInfo.L3CacheSize = 0;
   for (int32 cacheLevel = 1; cacheLevel <= 3; cacheLevel++) {
     File cFile;
-    if (cFile.open(String().append_format("sys/devices/system/cpu/cpu0/cache/index%d/size", cacheLevel), EFileMode::Read)) {
+    if (cFile.open(format("sys/devices/system/cpu/cpu0/cache/index{}/size", cacheLevel), EFileMode::Read)) {
       String content = cFile.get_content_as_string();
 
       char cType = content[content.length()-1];
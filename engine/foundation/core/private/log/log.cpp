@@ -32,6 +32,7 @@
 
 #include "core/log/log_formatter_text.h"
 #include "core/log/log.h"
+#include "core/profiling/telemetry_server.h"
 
 
 //[-------------------------------------------------------]
@@ -127,9 +128,21 @@ Log &Log::operator=(const Log &cSource) {
   return *this;
 }
 
-bool Log::write(uint8 nLogLevel, const String &sText) {
+bool Log::write(uint8 nLogLevel, const String &sText, const LogSite *pLogSite) {
   // Is there any text to write down?
   if (sText.length()) {
+    // Debug log levels get the source location of the call site attached
+    String sLocation;
+    if (pLogSite && nLogLevel >= Debug) {
+      sLocation = " (";
+      sLocation += pLogSite->pszFile;
+      sLocation += ':';
+      sLocation += to_string(pLogSite->nLine);
+      sLocation += ", ";
+      sLocation += pLogSite->pszFunction;
+      sLocation += ')';
+    }
+
     // Write into the standard OS console?
     if (m_bVerbose) {
       // Prepare log message
@@ -140,6 +153,7 @@ bool Log::write(uint8 nLogLevel, const String &sText) {
         sLogMessage += "]: ";
       }
       sLogMessage += sText;
+      sLogMessage += sLocation;
       sLogMessage += '\n';
 
       // Write the text into the OS console - it would be nice if this could be done using 'File::StandardOutput.Print()',
@@ -194,11 +208,17 @@ bool Log::write(uint8 nLogLevel, const String &sText) {
 #endif
     }
 
+    // Stream into attached telemetry viewers
+    TelemetryServer &cTelemetryServer = TelemetryServer::instance();
+    if (cTelemetryServer.has_clients()) {
+      cTelemetryServer.publish_log(nLogLevel, sText);
+    }
+
     // Is there a log formatter?
     bool bResult = true; // By default, all went fine
     if (m_pLogFormatter) {
       // Write the text
-      bResult = m_pLogFormatter->output(nLogLevel, sText);
+      bResult = m_pLogFormatter->output(nLogLevel, sLocation.length() ? sText + sLocation : sText);
       if (bResult) {
         // Remove the latest message from the list if the limit is reached
         if (m_qLastMessages.size() == m_nBufferedMessages) {
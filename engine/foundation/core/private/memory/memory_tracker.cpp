@@ -24,6 +24,7 @@
 //[-------------------------------------------------------]
 #include "core/memory/memory_tracker.h"
 #include "core/log/log.h"
+#include "core/string/format.h"
 #include "core/threading/lock_guard.h"
 
 
@@ -112,7 +113,7 @@ void MemoryTracker::track_dealloc(void* ptr) {
     ++mNumDeallocations;
   } else {
     // This could be a double-free or freeing unallocated memory
-    BE_LOG(Warning, String().append_format("Deallocating untracked memory at %p", ptr))
+    BE_LOG(Warning, format("Deallocating untracked memory at {:p}", ptr))
   }
 }
 
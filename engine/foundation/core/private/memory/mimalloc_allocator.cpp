@@ -24,6 +24,7 @@
 //[-------------------------------------------------------]
 #include "core/memory/mimalloc_allocator.h"
 #include "core/memory/memory_tracker.h"
+#include "core/memory/no_alloc_scope.h"
 #include <mimalloc.h>
 
 
@@ -49,6 +50,7 @@ MimallocAllocator::~MimallocAllocator() {
 
 void *MimallocAllocator::allocate(core::sizeT newNumberOfBytes, core::sizeT alignment) {
   if (0 != newNumberOfBytes) {
+    BE_TRACK_NO_ALLOC(newNumberOfBytes, "MimallocAllocator")
     void* ptr = mi_malloc_aligned(newNumberOfBytes, alignment);
 
     BE_TRACK_ALLOC(ptr, newNumberOfBytes, "MimallocAllocator");
@@ -59,6 +61,7 @@ void *MimallocAllocator::allocate(core::sizeT newNumberOfBytes, core::sizeT alig
 }
 
 void *MimallocAllocator::reallocate(void *oldPointer, core::sizeT oldNumberOfBytes, core::sizeT newNumberOfBytes, core::sizeT alignment) {
+  BE_TRACK_NO_ALLOC(newNumberOfBytes, "MimallocAllocator")
   BE_TRACK_DEALLOC(oldPointer);
   void* newPtr = mi_realloc_aligned(oldPointer, newNumberOfBytes, alignment);
   BE_TRACK_ALLOC(newPtr, newNumberOfBytes, "MimallocAllocator");
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/memory/no_alloc_scope.h"
+#include "core/std/atomic.h"
+#include <cstdio>
+#if defined(LINUX)
+#include <execinfo.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+static atomic<uint32> SNumViolations(0);
+static atomic<NoAllocScope::EViolationMode> SViolationMode(NoAllocScope::EViolationMode::Report);
+
+
+//[-------------------------------------------------------]
+//[ Static data                                           ]
+//[-------------------------------------------------------]
+thread_local const NoAllocScope* NoAllocScope::SCurrentScope = nullptr;
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+void NoAllocScope::on_allocation(sizeT numberOfBytes, const char* allocatorName) {
+  const NoAllocScope* scope = SCurrentScope;
+  if (nullptr == scope) {
+    return;
+  }
+
+  // Suspend the scope while reporting, writing the stack trace might allocate by itself
+  SCurrentScope = nullptr;
+  ++SNumViolations;
+
+  fprintf(stderr, "Allocation of %llu bytes by %s inside no-allocation scope \"%s\" (%s:%u)\n",
+          static_cast<unsigned long long>(numberOfBytes), allocatorName, scope->mName, scope->mFile, scope->mLine);
+#if defined(LINUX)
+  void* frames[32];
+  const int numberOfFrames = backtrace(frames, 32);
+  backtrace_symbols_fd(frames, numberOfFrames, fileno(stderr));
+#endif
+  fflush(stderr);
+
+  if (EViolationMode::Abort == SViolationMode.load(std::memory_order_relaxed)) {
+    DEBUG_BREAK;
+  }
+
+  SCurrentScope = scope;
+}
+
+NoAllocScope::EViolationMode NoAllocScope::get_violation_mode() {
+  return SViolationMode.load(std::memory_order_relaxed);
+}
+
+void NoAllocScope::set_violation_mode(EViolationMode violationMode) {
+  SViolationMode.store(violationMode, std::memory_order_relaxed);
+}
+
+uint32 NoAllocScope::get_num_violations() {
+  return SNumViolations.load(std::memory_order_relaxed);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+NoAllocScope::NoAllocScope(const char* name, const char* file, uint32 line)
+: mName(name)
+, mFile(file)
+, mLine(line)
+, mParentScope(SCurrentScope) {
+  SCurrentScope = this;
+}
+
+NoAllocScope::~NoAllocScope() {
+  SCurrentScope = mParentScope;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
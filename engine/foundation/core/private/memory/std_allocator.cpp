@@ -23,6 +23,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/memory/std_allocator.h"
+#include "core/memory/no_alloc_scope.h"
 
 
 //[-------------------------------------------------------]
@@ -54,6 +55,7 @@ bool StdAllocator::operator!=(const StdAllocator &cSource) {
 }
 
 void *StdAllocator::allocate(core::sizeT newNumberOfBytes, core::sizeT alignment) {
+  BE_TRACK_NO_ALLOC(newNumberOfBytes, "StdAllocator")
   //return (0 != newNumberOfBytes) ? ::aligned_alloc(alignment, newNumberOfBytes) : nullptr;
   return (0 != newNumberOfBytes) ? ::malloc(newNumberOfBytes) : nullptr;
 }
@@ -64,6 +66,7 @@ void *StdAllocator::reallocate(void *oldPointer, core::sizeT oldNumberOfBytes, c
   }
 
   if (oldPointer) {
+    BE_TRACK_NO_ALLOC(newNumberOfBytes, "StdAllocator")
     return ::realloc(oldPointer, newNumberOfBytes);
   }
   return allocate(newNumberOfBytes, alignment);
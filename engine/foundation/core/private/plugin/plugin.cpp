@@ -42,6 +42,14 @@ Plugin::Plugin()
 Plugin::~Plugin() {
 }
 
+const String& Plugin::get_name() const {
+  return mName;
+}
+
+void Plugin::set_name(const String& name) {
+  mName = name;
+}
+
 const String& Plugin::get_filename() const {
   return mFileName;
 }
@@ -0,0 +1,373 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/profiling/metrics.h"
+#include "core/threading/lock_guard.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Cleared when the registry is destroyed, threads exiting afterwards must not touch it anymore */
+static atomic<bool> SRegistryAlive(false);
+
+
+//[-------------------------------------------------------]
+//[ Local structures                                      ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Owns the metric slots of the current thread and returns them to the registry on thread exit.
+ */
+struct ThreadSlotsOwner {
+  Metrics::ThreadSlots* slots = nullptr;
+
+  ~ThreadSlotsOwner() {
+    // After static destruction the slots are simply left behind, see Metrics::~Metrics()
+    if (slots && SRegistryAlive.load(std::memory_order_acquire)) {
+      Metrics::instance().release_thread_slots(slots);
+    }
+  }
+};
+
+static thread_local ThreadSlotsOwner SThreadSlotsOwner;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Appends a quoted JSON string, escaping quotes, backslashes and control characters.
+ */
+static void append_json_string(String& json, const String& text) {
+  static constexpr char HexDigits[] = "0123456789abcdef";
+
+  json += '"';
+  for (sizeT i = 0; i < text.size(); ++i) {
+    const char character = text[i];
+    if ('"' == character || '\\' == character) {
+      json += '\\';
+      json += character;
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      json += "\\u00";
+      json += HexDigits[(character >> 4) & 0xf];
+      json += HexDigits[character & 0xf];
+    } else {
+      json += character;
+    }
+  }
+  json += '"';
+}
+
+static const char* metric_type_to_string(EMetricType type) {
+  switch (type) {
+    case EMetricType::Counter:
+      return "counter";
+    case EMetricType::Gauge:
+      return "gauge";
+    case EMetricType::Histogram:
+      return "histogram";
+  }
+  return "";
+}
+
+
+//[-------------------------------------------------------]
+//[ Static data                                           ]
+//[-------------------------------------------------------]
+thread_local Metrics::ThreadSlots* Metrics::SThreadSlots = nullptr;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Metrics& Metrics::instance() {
+  static Metrics SInstance;
+  return SInstance;
+}
+
+Metrics::Metrics()
+: mNumMetrics(0)
+, mNumSlots(0)
+, mNumFrames(0)
+, mFrameIndex(0) {
+  for (uint32 i = 0; i < MaxMetrics; ++i) {
+    mGauges[i].store(0.0, std::memory_order_relaxed);
+  }
+  for (uint32 i = 0; i < MaxSlots; ++i) {
+    mRetired[i] = 0;
+    mTotals[i] = 0;
+    mPrevious[i] = 0;
+  }
+
+  // Keep roughly two seconds at 60 frames per second
+  set_history_size(120);
+  SRegistryAlive.store(true, std::memory_order_release);
+}
+
+Metrics::~Metrics() {
+  // Threads still running at this point keep pointers to their slots and may still record, so the
+  // slots are deliberately leaked instead of deleted; exiting threads see the flag and leave them alone
+  SRegistryAlive.store(false, std::memory_order_release);
+}
+
+MetricId Metrics::register_counter(const String& name) {
+  return register_metric(name, EMetricType::Counter, 1);
+}
+
+MetricId Metrics::register_gauge(const String& name) {
+  return register_metric(name, EMetricType::Gauge, 0);
+}
+
+MetricId Metrics::register_histogram(const String& name) {
+  // Number of samples, sum of samples and the buckets
+  return register_metric(name, EMetricType::Histogram, 2 + NumHistogramBuckets);
+}
+
+MetricId Metrics::find(const String& name) const {
+  LockGuard<Mutex> lock(mMutex);
+
+  auto it = mMetricsByName.find(name);
+  return (it != mMetricsByName.end()) ? it->second : InvalidMetricId;
+}
+
+void Metrics::snapshot() {
+  LockGuard<Mutex> lock(mMutex);
+
+  if (mFrames.empty()) {
+    return;
+  }
+
+  // Sum up the values of all threads
+  for (uint32 i = 0; i < mNumSlots; ++i) {
+    mTotals[i] = mRetired[i];
+  }
+  for (ThreadSlots* slots : mThreadSlots) {
+    for (uint32 i = 0; i < mNumSlots; ++i) {
+      mTotals[i] += slots->values[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  // Fill the next frame of the ring buffer
+  const uint32 historySize = mFrames.size();
+  const MetricsFrame* previousFrame = mNumFrames ? &mFrames[(mFrameIndex + historySize - 1) % historySize] : nullptr;
+  MetricsFrame& frame = mFrames[mFrameIndex % historySize];
+  MetricSample* samples = const_cast<MetricSample*>(frame.samples);
+  const uint32 numMetrics = mNumMetrics.load(std::memory_order_acquire);
+  for (uint32 id = 0; id < numMetrics; ++id) {
+    const MetricInfo& info = mMetrics[id];
+    MetricSample& sample = samples[id];
+    switch (info.type) {
+      case EMetricType::Counter:
+        sample.value = static_cast<double>(mTotals[info.slot]);
+        sample.delta = static_cast<double>(mTotals[info.slot] - mPrevious[info.slot]);
+        sample.mean = 0.0;
+        break;
+
+      case EMetricType::Gauge:
+        sample.value = mGauges[info.slot].load(std::memory_order_relaxed);
+        sample.delta = (previousFrame && id < previousFrame->numMetrics) ? sample.value - previousFrame->samples[id].value : 0.0;
+        sample.mean = 0.0;
+        break;
+
+      case EMetricType::Histogram:
+      {
+        const int64 count = mTotals[info.slot] - mPrevious[info.slot];
+        const int64 sum = mTotals[info.slot + 1] - mPrevious[info.slot + 1];
+        sample.value = static_cast<double>(mTotals[info.slot]);
+        sample.delta = static_cast<double>(count);
+        sample.mean = count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+        break;
+      }
+    }
+  }
+  frame.frameIndex = mFrameIndex;
+  frame.numMetrics = numMetrics;
+
+  // Remember the totals for the next deltas
+  for (uint32 i = 0; i < mNumSlots; ++i) {
+    mPrevious[i] = mTotals[i];
+  }
+
+  ++mFrameIndex;
+  if (mNumFrames < historySize) {
+    ++mNumFrames;
+  }
+}
+
+void Metrics::set_history_size(uint32 historySize) {
+  LockGuard<Mutex> lock(mMutex);
+
+  mFrames.clear();
+  mSamples.clear();
+  mFrames.resize(historySize);
+  mSamples.resize(historySize * MaxMetrics);
+  for (uint32 i = 0; i < historySize; ++i) {
+    MetricsFrame& frame = mFrames[i];
+    frame.frameIndex = 0;
+    frame.numMetrics = 0;
+    frame.samples = mSamples.data() + i * MaxMetrics;
+  }
+  mNumFrames = 0;
+}
+
+const MetricsFrame* Metrics::get_frame(uint32 age) const {
+  if (age >= mNumFrames) {
+    return nullptr;
+  }
+
+  const uint32 historySize = mFrames.size();
+  return &mFrames[(mFrameIndex + historySize - 1 - age) % historySize];
+}
+
+bool Metrics::get_histogram_buckets(MetricId id, uint64* buckets) const {
+  if (id >= get_num_metrics() || mMetrics[id].type != EMetricType::Histogram || !buckets) {
+    return false;
+  }
+
+  LockGuard<Mutex> lock(mMutex);
+  const int64* totals = &mTotals[mMetrics[id].slot + 2];
+  for (uint32 i = 0; i < NumHistogramBuckets; ++i) {
+    buckets[i] = static_cast<uint64>(totals[i]);
+  }
+  return true;
+}
+
+String Metrics::to_json() const {
+  const MetricsFrame* frame = get_frame(0);
+
+  String json = "{\n  \"frame\": ";
+  json += to_string(frame ? frame->frameIndex : 0ull);
+  json += ",\n  \"metrics\": {";
+  if (frame) {
+    for (uint32 id = 0; id < frame->numMetrics; ++id) {
+      const MetricInfo& info = mMetrics[id];
+      const MetricSample& sample = frame->samples[id];
+
+      json += (id ? ",\n    " : "\n    ");
+      append_json_string(json, info.name);
+      json += ": { \"type\": \"";
+      json += metric_type_to_string(info.type);
+      json += "\", \"value\": ";
+      json += to_string(sample.value);
+      json += ", \"delta\": ";
+      json += to_string(sample.delta);
+      if (info.type == EMetricType::Histogram) {
+        uint64 buckets[NumHistogramBuckets];
+        get_histogram_buckets(id, buckets);
+
+        json += ", \"mean\": ";
+        json += to_string(sample.mean);
+        json += ", \"buckets\": [";
+        for (uint32 i = 0; i < NumHistogramBuckets; ++i) {
+          if (i) {
+            json += ", ";
+          }
+          json += to_string(buckets[i]);
+        }
+        json += ']';
+      }
+      json += " }";
+    }
+  }
+  json += "\n  }\n}\n";
+
+  return json;
+}
+
+MetricId Metrics::register_metric(const String& name, EMetricType type, uint32 numSlots) {
+  LockGuard<Mutex> lock(mMutex);
+
+  // Already registered?
+  auto it = mMetricsByName.find(name);
+  if (it != mMetricsByName.end()) {
+    return (mMetrics[it->second].type == type) ? it->second : InvalidMetricId;
+  }
+
+  const MetricId id = mNumMetrics.load(std::memory_order_relaxed);
+  if (id >= MaxMetrics || mNumSlots + numSlots > MaxSlots) {
+    return InvalidMetricId;
+  }
+
+  MetricInfo& info = mMetrics[id];
+  info.name = name;
+  info.type = type;
+  info.slot = (type == EMetricType::Gauge) ? id : mNumSlots;
+  mNumSlots += numSlots;
+  mMetricsByName[name] = id;
+
+  // Publish the metric
+  mNumMetrics.store(id + 1, std::memory_order_release);
+  return id;
+}
+
+Metrics::ThreadSlots& Metrics::create_thread_slots() {
+  if (!SRegistryAlive.load(std::memory_order_acquire)) {
+    // Recording during static destruction, the values have nowhere to go anymore
+    static ThreadSlots SOrphanedSlots;
+    return SOrphanedSlots;
+  }
+
+  ThreadSlots* slots = new ThreadSlots();
+  for (uint32 i = 0; i < MaxSlots; ++i) {
+    slots->values[i].store(0, std::memory_order_relaxed);
+  }
+
+  {
+    LockGuard<Mutex> lock(mMutex);
+    mThreadSlots.push_back(slots);
+  }
+
+  SThreadSlotsOwner.slots = slots;
+  SThreadSlots = slots;
+  return *slots;
+}
+
+void Metrics::release_thread_slots(ThreadSlots* slots) {
+  {
+    LockGuard<Mutex> lock(mMutex);
+
+    // Keep the values of the finished thread
+    for (uint32 i = 0; i < MaxSlots; ++i) {
+      mRetired[i] += slots->values[i].load(std::memory_order_relaxed);
+    }
+    mThreadSlots.erase(slots);
+  }
+
+  delete slots;
+  SThreadSlots = nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
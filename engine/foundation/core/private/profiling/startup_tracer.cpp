@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/profiling/startup_tracer.h"
+#include "core/log/log.h"
+#include <chrono>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Nesting depth of the traced scopes of the current thread */
+static thread_local uint32 SDepth = 0;
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+StartupTracer& StartupTracer::instance() {
+  static StartupTracer SInstance;
+  return SInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+uint32 StartupTracer::begin_scope(const char* name) {
+  const uint32 index = mNumEntries.fetch_add(1, std::memory_order_relaxed);
+  if (index >= MaxEntries) {
+    return MaxEntries;
+  }
+
+  Entry& entry = mEntries[index];
+  entry.name = name;
+  entry.begin = get_time() - mStartTime;
+  entry.duration = 0;
+  entry.depth = SDepth++;
+  return index;
+}
+
+void StartupTracer::end_scope(uint32 index) {
+  Entry& entry = mEntries[index];
+  entry.duration = get_time() - mStartTime - entry.begin;
+  --SDepth;
+}
+
+void StartupTracer::finish(bool report) {
+  if (!mTracing.exchange(false)) {
+    return;
+  }
+  mTotalTime = get_time() - mStartTime;
+
+  if (report) {
+    BE_LOG(Info, to_string())
+  }
+}
+
+String StartupTracer::to_string() const {
+  String text;
+  text.append_format("Startup took %.3f ms, %u traced scopes", static_cast<double>(mTotalTime) / 1000.0, get_num_entries());
+  const uint32 numEntries = get_num_entries();
+  for (uint32 i = 0; i < numEntries; ++i) {
+    const Entry& entry = mEntries[i];
+    text.append_format("\n%10.3f ms  %*s%s", static_cast<double>(entry.duration) / 1000.0, static_cast<int>(entry.depth * 2), "", entry.name);
+  }
+  return text;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+StartupTracer::StartupTracer()
+: mTracing(true)
+, mNumEntries(0)
+, mStartTime(get_time())
+, mTotalTime(0) {
+
+}
+
+StartupTracer::~StartupTracer() {
+
+}
+
+uint64 StartupTracer::get_time() const {
+  return static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,390 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/profiling/telemetry_server.h"
+#include "core/profiling/metrics.h"
+#include "core/threading/lock_guard.h"
+#include "core/threading/thread.h"
+#include "core/log/log.h"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#if defined(LINUX)
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Number of bytes taken out of the ring buffer at once */
+static constexpr uint32 ChunkSize = 64 * 1024;
+
+/** Milliseconds the sender thread waits for new viewers while there's nothing to send */
+static constexpr int IdleTimeout = 2;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static uint64 get_current_thread_id() {
+#if defined(LINUX)
+  static thread_local const uint64 SThreadId = static_cast<uint64>(syscall(SYS_gettid));
+  return SThreadId;
+#else
+  return 0;
+#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+TelemetryServer& TelemetryServer::instance() {
+  static TelemetryServer SInstance;
+  return SInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+bool TelemetryServer::start(const String& socketPath) {
+  if (is_running()) {
+    return false;
+  }
+
+#if defined(LINUX)
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  if (socketPath.empty() || socketPath.length() >= sizeof(address.sun_path)) {
+    BE_LOG(Error, "Invalid telemetry socket path '" + socketPath + "'")
+    return false;
+  }
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path, socketPath.c_str(), socketPath.length());
+
+  mListenSocket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (mListenSocket < 0) {
+    BE_LOG(Error, "Failed to create the telemetry socket")
+    return false;
+  }
+
+  // Replace a stale socket file of a previous run
+  ::unlink(socketPath.c_str());
+  if (::bind(mListenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 || ::listen(mListenSocket, 4) < 0) {
+    BE_LOG(Error, "Failed to bind the telemetry socket to '" + socketPath + "'")
+    ::close(mListenSocket);
+    mListenSocket = -1;
+    return false;
+  }
+
+  mSocketPath = socketPath;
+  mBuffer.resize(BufferSize);
+  mReadPosition = 0;
+  mWritePosition = 0;
+  mNumAnnouncedMetrics = 0;
+  mRunning.store(true);
+
+  mThread = new Thread(&TelemetryServer::run_thread, this);
+  mThread->set_name("TelemetryServer");
+  mThread->start();
+
+  BE_LOG(Info, "Streaming telemetry to '" + socketPath + "'")
+  return true;
+#else
+  BE_LOG(Error, "Telemetry streaming is not supported on this platform")
+  return false;
+#endif
+}
+
+void TelemetryServer::stop() {
+  if (!is_running()) {
+    return;
+  }
+
+  // Stop the sender thread, it disconnects all viewers on its way out
+  mRunning.store(false);
+  mThread->join();
+  delete mThread;
+  mThread = nullptr;
+
+#if defined(LINUX)
+  ::close(mListenSocket);
+  mListenSocket = -1;
+  ::unlink(mSocketPath.c_str());
+#endif
+  mSocketPath.clear();
+}
+
+uint64 TelemetryServer::get_timestamp() const {
+  return static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TelemetryServer::publish_log(uint8 logLevel, const String& text) {
+  if (has_clients()) {
+    const TelemetryLog log = { get_timestamp(), logLevel, 0 };
+    write_packet(ETelemetryPacket::Log, &log, sizeof(log), text.c_str(), static_cast<uint32>(text.length()));
+  }
+}
+
+void TelemetryServer::publish_metrics(const MetricsFrame& frame) {
+  if (has_clients()) {
+    // Announce metrics registered since the last frame, viewers attaching later get all of them on connect
+    const Metrics& metrics = Metrics::instance();
+    for (; mNumAnnouncedMetrics < frame.numMetrics; ++mNumAnnouncedMetrics) {
+      const TelemetryMetricInfo metricInfo = { mNumAnnouncedMetrics, static_cast<uint32>(metrics.get_type(mNumAnnouncedMetrics)) };
+      const String& name = metrics.get_name(mNumAnnouncedMetrics);
+      write_packet(ETelemetryPacket::MetricInfo, &metricInfo, sizeof(metricInfo), name.c_str(), static_cast<uint32>(name.length()));
+    }
+
+    const TelemetryMetricsFrame metricsFrame = { frame.frameIndex, get_timestamp(), frame.numMetrics, 0 };
+    write_packet(ETelemetryPacket::MetricsFrame, &metricsFrame, sizeof(metricsFrame), frame.samples, frame.numMetrics * static_cast<uint32>(sizeof(MetricSample)));
+  }
+}
+
+void TelemetryServer::publish_zone(const char* name, uint64 begin, uint64 end) {
+  if (has_clients()) {
+    const TelemetryZone zone = { get_current_thread_id(), begin, end };
+    write_packet(ETelemetryPacket::Zone, &zone, sizeof(zone), name, static_cast<uint32>(strlen(name)));
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+TelemetryServer::TelemetryServer()
+: mRunning(false)
+, mNumClients(0)
+, mNumDroppedBytes(0)
+, mListenSocket(-1)
+, mThread(nullptr)
+, mReadPosition(0)
+, mWritePosition(0)
+, mNumAnnouncedMetrics(0) {
+
+}
+
+TelemetryServer::~TelemetryServer() {
+  stop();
+}
+
+bool TelemetryServer::write_packet(ETelemetryPacket type, const void* header, uint32 headerSize, const void* data, uint32 dataSize) {
+  const TelemetryPacketHeader packetHeader = { static_cast<uint16>(type), 0, headerSize + dataSize };
+  const uint32 packetSize = static_cast<uint32>(sizeof(packetHeader)) + headerSize + dataSize;
+
+  // Only copy under the lock, the sender thread never holds it while talking to the sockets
+  LockGuard<Mutex> lock(mBufferMutex);
+  if (!is_running() || BufferSize - (mWritePosition - mReadPosition) < packetSize) {
+    // Drop the packet instead of waiting for the sender thread
+    mNumDroppedBytes.fetch_add(packetSize, std::memory_order_relaxed);
+    return false;
+  }
+  write_to_buffer(&packetHeader, sizeof(packetHeader));
+  write_to_buffer(header, headerSize);
+  if (dataSize > 0) {
+    write_to_buffer(data, dataSize);
+  }
+  return true;
+}
+
+void TelemetryServer::write_to_buffer(const void* data, uint32 size) {
+  // The ring buffer size is a power of two, so wrapping is a simple mask
+  const uint32 offset = static_cast<uint32>(mWritePosition & (BufferSize - 1));
+  const uint32 firstPart = (size < BufferSize - offset) ? size : BufferSize - offset;
+  memcpy(mBuffer.data() + offset, data, firstPart);
+  memcpy(mBuffer.data(), static_cast<const uint8*>(data) + firstPart, size - firstPart);
+  mWritePosition += size;
+}
+
+void TelemetryServer::read_from_buffer(uint64 position, void* data, uint32 size) const {
+  const uint32 offset = static_cast<uint32>(position & (BufferSize - 1));
+  const uint32 firstPart = (size < BufferSize - offset) ? size : BufferSize - offset;
+  memcpy(data, mBuffer.data() + offset, firstPart);
+  memcpy(static_cast<uint8*>(data) + firstPart, mBuffer.data(), size - firstPart);
+}
+
+int TelemetryServer::run_thread(void* data) {
+  static_cast<TelemetryServer*>(data)->run();
+  return 0;
+}
+
+void TelemetryServer::run() {
+  Vector<uint8> chunk;
+  chunk.resize(ChunkSize);
+
+  while (is_running()) {
+    accept_clients();
+
+    // Take the next whole packets out of the ring buffer, viewers attach between two chunks and
+    // must never see the tail of a split packet; a single packet larger than a chunk is taken alone
+    uint32 numBytes = 0;
+    {
+      LockGuard<Mutex> lock(mBufferMutex);
+      const uint64 available = mWritePosition - mReadPosition;
+      while (numBytes < available) {
+        TelemetryPacketHeader packetHeader;
+        read_from_buffer(mReadPosition + numBytes, &packetHeader, sizeof(packetHeader));
+        const uint32 packetSize = static_cast<uint32>(sizeof(packetHeader)) + packetHeader.payloadSize;
+        if (numBytes > 0 && numBytes + packetSize > ChunkSize) {
+          break;
+        }
+        numBytes += packetSize;
+      }
+      if (numBytes > chunk.size()) {
+        chunk.resize(numBytes);
+      }
+      read_from_buffer(mReadPosition, chunk.data(), numBytes);
+      mReadPosition += numBytes;
+    }
+
+    // Forward it to all viewers, this also retries bytes a viewer couldn't take before
+    for (uint32 i = 0; i < mClients.size(); ) {
+      send_to_client(*mClients[i], chunk.data(), numBytes);
+      if (mClients[i]->pending.size() > MaxPendingBytes || mClients[i]->socket < 0) {
+        close_client(i);
+      } else {
+        ++i;
+      }
+    }
+
+#if defined(LINUX)
+    // Nothing to do, wait for new viewers
+    if (0 == numBytes) {
+      pollfd listenPoll = { mListenSocket, POLLIN, 0 };
+      ::poll(&listenPoll, 1, IdleTimeout);
+    }
+#endif
+  }
+
+  // Disconnect all viewers
+  while (!mClients.empty()) {
+    close_client(static_cast<uint32>(mClients.size() - 1));
+  }
+}
+
+void TelemetryServer::accept_clients() {
+#if defined(LINUX)
+  for (;;) {
+    const int socket = ::accept4(mListenSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (socket < 0) {
+      break;
+    }
+
+    Client* client = new Client();
+    client->socket = socket;
+
+    // Identify the stream and announce all metrics registered so far
+    const TelemetryHello hello = { TelemetryMagic, TelemetryVersion, 0, static_cast<uint64>(::getpid()) };
+    queue_packet(*client, ETelemetryPacket::Hello, &hello, sizeof(hello), nullptr, 0);
+    const Metrics& metrics = Metrics::instance();
+    const uint32 numMetrics = metrics.get_num_metrics();
+    for (uint32 id = 0; id < numMetrics; ++id) {
+      const TelemetryMetricInfo metricInfo = { id, static_cast<uint32>(metrics.get_type(id)) };
+      const String& name = metrics.get_name(id);
+      queue_packet(*client, ETelemetryPacket::MetricInfo, &metricInfo, sizeof(metricInfo), name.c_str(), static_cast<uint32>(name.length()));
+    }
+
+    mClients.push_back(client);
+    mNumClients.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+}
+
+void TelemetryServer::send_to_client(Client& client, const uint8* data, uint32 size) {
+#if defined(LINUX)
+  // Bytes left over from before go first to keep the packets intact
+  if (!client.pending.empty()) {
+    const ssize_t sent = ::send(client.socket, client.pending.data(), client.pending.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (sent < 0 && EAGAIN != errno && EWOULDBLOCK != errno) {
+      ::close(client.socket);
+      client.socket = -1;
+      return;
+    }
+    if (sent > 0) {
+      const sizeT remaining = client.pending.size() - static_cast<sizeT>(sent);
+      memmove(client.pending.data(), client.pending.data() + sent, remaining);
+      client.pending.resize(remaining);
+    }
+  }
+
+  // Send new bytes directly, queue what the socket can't take
+  sizeT sent = 0;
+  if (client.pending.empty() && size > 0) {
+    const ssize_t result = ::send(client.socket, data, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (result < 0 && EAGAIN != errno && EWOULDBLOCK != errno) {
+      ::close(client.socket);
+      client.socket = -1;
+      return;
+    }
+    sent = (result > 0) ? static_cast<sizeT>(result) : 0;
+  }
+  if (sent < size) {
+    const sizeT offset = client.pending.size();
+    client.pending.resize(offset + size - sent);
+    memcpy(client.pending.data() + offset, data + sent, size - sent);
+  }
+#endif
+}
+
+void TelemetryServer::queue_packet(Client& client, ETelemetryPacket type, const void* header, uint32 headerSize, const void* data, uint32 dataSize) {
+  const TelemetryPacketHeader packetHeader = { static_cast<uint16>(type), 0, headerSize + dataSize };
+  const sizeT offset = client.pending.size();
+  client.pending.resize(offset + sizeof(packetHeader) + headerSize + dataSize);
+  uint8* destination = client.pending.data() + offset;
+  memcpy(destination, &packetHeader, sizeof(packetHeader));
+  memcpy(destination + sizeof(packetHeader), header, headerSize);
+  if (dataSize > 0) {
+    memcpy(destination + sizeof(packetHeader) + headerSize, data, dataSize);
+  }
+}
+
+void TelemetryServer::close_client(uint32 index) {
+  Client* client = mClients[index];
+#if defined(LINUX)
+  if (client->socket >= 0) {
+    ::close(client->socket);
+  }
+#endif
+  mClients.erase_at(index);
+  delete client;
+  mNumClients.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
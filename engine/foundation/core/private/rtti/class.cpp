@@ -107,6 +107,12 @@ uint32 Class::get_num_properties() const {
 }
 
 const ClassMethod* Class::get_method(const String& name) const {
+  // A name which was never interned can't be a member
+  const Name memberName = Name::find(name);
+  return memberName.is_empty() ? nullptr : get_method(memberName);
+}
+
+const ClassMethod* Class::get_method(Name name) const {
   const auto& meth = mMethodsMap.find(name);
   if (meth != mMethodsMap.end()) {
     return &meth.value();
@@ -123,6 +129,12 @@ const ClassMethod* Class::get_method(const String& name) const {
 }
 
 const ClassField* Class::get_field(const String& name) const {
+  // A name which was never interned can't be a member
+  const Name memberName = Name::find(name);
+  return memberName.is_empty() ? nullptr : get_field(memberName);
+}
+
+const ClassField* Class::get_field(Name name) const {
   const auto& field = mFieldsMap.find(name);
   if (field != mFieldsMap.end()) {
     return &field.value();
@@ -139,6 +151,12 @@ const ClassField* Class::get_field(const String& name) const {
 }
 
 const ClassProperty* Class::get_property(const String& name) const {
+  // A name which was never interned can't be a member
+  const Name memberName = Name::find(name);
+  return memberName.is_empty() ? nullptr : get_property(memberName);
+}
+
+const ClassProperty* Class::get_property(Name name) const {
   const auto& prop = mPropertiesMap.find(name);
   if (prop != mPropertiesMap.end()) {
     return &prop.value();
@@ -23,6 +23,10 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/rtti/rtti_type_server.h"
+#include "core/profiling/startup_tracer.h"
+#include "core/string/string_simd.h"
+#include "core/threading/lock_guard.h"
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -31,16 +35,35 @@
 namespace core {
 
 
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+template<typename TTypeInfo>
+static TTypeInfo* find_type_info(const core::hash_map<Name, TTypeInfo*>& typeMap, Name name) {
+  auto ti = typeMap.find(name);
+  return (ti == typeMap.end()) ? nullptr : ti->second;
+}
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+RttiLazyRegistration::RttiLazyRegistration(EKind kind, const char* name, void (*registerFunction)())
+: mName(name)
+, mRegisterFunction(registerFunction)
+, mNext(nullptr) {
+  RttiTypeServer::instance().add_lazy_registration(*this, kind);
+}
+
+
 RttiTypeServer& RttiTypeServer::instance() {
   static RttiTypeServer SInstance;
   return SInstance;
 }
 
 
-RttiTypeServer::RttiTypeServer() {
+RttiTypeServer::RttiTypeServer()
+: mNumPendingTypes(0) {
 }
 
 RttiTypeServer::~RttiTypeServer() {
@@ -48,13 +71,23 @@ RttiTypeServer::~RttiTypeServer() {
 }
 
 void RttiTypeServer::register_primitive_type(const String& name, PrimitiveTypeInfo* primitiveTypeInfo) {
-  auto ti = mPrimitiveTypesMap.find(name);
+  const Name typeName(name);
+  auto ti = mPrimitiveTypesMap.find(typeName);
   if (ti == mPrimitiveTypesMap.end()) {
-    mPrimitiveTypesMap[name] = primitiveTypeInfo;
+    mPrimitiveTypesMap[typeName] = primitiveTypeInfo;
   }
 }
 
 PrimitiveTypeInfo* RttiTypeServer::get_primitive_type(const String& name) {
+  // A name which was never interned finds nothing
+  auto ti = mPrimitiveTypesMap.find(Name::find(name));
+  if (ti == mPrimitiveTypesMap.end()) {
+    return nullptr;
+  }
+  return ti.value();
+}
+
+PrimitiveTypeInfo* RttiTypeServer::get_primitive_type(Name name) {
   auto ti = mPrimitiveTypesMap.find(name);
   if (ti == mPrimitiveTypesMap.end()) {
     return nullptr;
@@ -63,33 +96,139 @@ PrimitiveTypeInfo* RttiTypeServer::get_primitive_type(const String& name) {
 }
 
 void RttiTypeServer::register_class_type(const String& name, ClassTypeInfo* classTypeInfo) {
-  auto ti = mClassTypeMap.find(name);
+  const Name typeName(name);
+  auto ti = mClassTypeMap.find(typeName);
   if (ti == mClassTypeMap.end()) {
-    mClassTypeMap[name] = classTypeInfo;
+    mClassTypeMap[typeName] = classTypeInfo;
   }
 }
 
 ClassTypeInfo* RttiTypeServer::get_class_type(const String& name) {
-  auto ti = mClassTypeMap.find(name);
-  if (ti == mClassTypeMap.end()) {
-    return nullptr;
+  if (mNumPendingTypes.load(std::memory_order_acquire) > 0) {
+    LockGuard<Mutex> lock(mPendingMutex);
+    register_pending_type(mPendingClasses, name.c_str(), name.length());
+    return find_type_info(mClassTypeMap, Name::find(name));
   }
-  return ti.value();
+
+  // A name which was never interned finds nothing
+  return find_type_info(mClassTypeMap, Name::find(name));
+}
+
+ClassTypeInfo* RttiTypeServer::get_class_type(Name name) {
+  if (mNumPendingTypes.load(std::memory_order_acquire) > 0) {
+    LockGuard<Mutex> lock(mPendingMutex);
+    register_pending_type(mPendingClasses, name.c_str(), strlen(name.c_str()));
+    return find_type_info(mClassTypeMap, name);
+  }
+  return find_type_info(mClassTypeMap, name);
 }
 
 void RttiTypeServer::register_enum_type(const String& name, EnumTypeInfo* enumTypeInfo) {
-  auto ti = mEnumTypeMap.find(name);
+  const Name typeName(name);
+  auto ti = mEnumTypeMap.find(typeName);
   if (ti == mEnumTypeMap.end()) {
-    mEnumTypeMap[name] = enumTypeInfo;
+    mEnumTypeMap[typeName] = enumTypeInfo;
   }
 }
 
 EnumTypeInfo* RttiTypeServer::get_enum_type(const String& name) {
-  auto ti = mEnumTypeMap.find(name);
-  if (ti == mEnumTypeMap.end()) {
-    return nullptr;
+  if (mNumPendingTypes.load(std::memory_order_acquire) > 0) {
+    LockGuard<Mutex> lock(mPendingMutex);
+    register_pending_type(mPendingEnums, name.c_str(), name.length());
+    return find_type_info(mEnumTypeMap, Name::find(name));
   }
-  return ti.value();
+
+  // A name which was never interned finds nothing
+  return find_type_info(mEnumTypeMap, Name::find(name));
+}
+
+EnumTypeInfo* RttiTypeServer::get_enum_type(Name name) {
+  if (mNumPendingTypes.load(std::memory_order_acquire) > 0) {
+    LockGuard<Mutex> lock(mPendingMutex);
+    register_pending_type(mPendingEnums, name.c_str(), strlen(name.c_str()));
+    return find_type_info(mEnumTypeMap, name);
+  }
+  return find_type_info(mEnumTypeMap, name);
+}
+
+void RttiTypeServer::add_lazy_registration(RttiLazyRegistration& registration, RttiLazyRegistration::EKind kind) {
+  LockGuard<Mutex> lock(mPendingMutex);
+  PendingMap& pendingMap = (RttiLazyRegistration::EKind::Class == kind) ? mPendingClasses : mPendingEnums;
+  RttiLazyRegistration*& chain = pendingMap[string_hash(registration.mName, strlen(registration.mName))];
+  registration.mNext = chain;
+  chain = &registration;
+  mNumPendingTypes.fetch_add(1, std::memory_order_release);
+}
+
+void RttiTypeServer::register_pending_types() {
+  LockGuard<Mutex> lock(mPendingMutex);
+  while (!mPendingClasses.empty()) {
+    const char* name = mPendingClasses.begin()->second->mName;
+    register_pending_type(mPendingClasses, name, strlen(name));
+  }
+  while (!mPendingEnums.empty()) {
+    const char* name = mPendingEnums.begin()->second->mName;
+    register_pending_type(mPendingEnums, name, strlen(name));
+  }
+}
+
+void RttiTypeServer::get_class_types(Vector<ClassTypeInfo*>& classTypes) {
+  register_pending_types();
+  classTypes.reserve(classTypes.size() + mClassTypeMap.size());
+  for (const auto& ti : mClassTypeMap) {
+    classTypes.push_back(ti.second);
+  }
+}
+
+void RttiTypeServer::get_enum_types(Vector<EnumTypeInfo*>& enumTypes) {
+  register_pending_types();
+  enumTypes.reserve(enumTypes.size() + mEnumTypeMap.size());
+  for (const auto& ti : mEnumTypeMap) {
+    enumTypes.push_back(ti.second);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void RttiTypeServer::register_pending_type(PendingMap& pendingMap, const char* name, sizeT length) {
+  if (pendingMap.empty()) {
+    return;
+  }
+  auto chain = pendingMap.find(string_hash(name, length));
+  if (chain == pendingMap.end()) {
+    return;
+  }
+
+  // Names sharing the hash are chained
+  RttiLazyRegistration* previous = nullptr;
+  RttiLazyRegistration* registration = chain->second;
+  while (nullptr != registration && 0 != strcmp(registration->mName, name)) {
+    previous = registration;
+    registration = registration->mNext;
+  }
+  if (nullptr == registration) {
+    return;
+  }
+
+  // Unlink first, the registration looks up its own type and base classes
+  if (nullptr != previous) {
+    previous->mNext = registration->mNext;
+  } else if (nullptr != registration->mNext) {
+    chain.value() = registration->mNext;
+  } else {
+    pendingMap.erase(chain);
+  }
+  registration->mNext = nullptr;
+
+  {
+    BE_STARTUP_SCOPE(registration->mName)
+    registration->mRegisterFunction();
+  }
+
+  // Only now lookups may skip the lock, the type maps are complete
+  mNumPendingTypes.fetch_sub(1, std::memory_order_release);
 }
 
 
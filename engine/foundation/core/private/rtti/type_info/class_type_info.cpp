@@ -23,6 +23,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/rtti/type_info/class_type_info.h"
+#include "core/rtti/rtti_type_server.h"
 
 
 //[-------------------------------------------------------]
@@ -45,7 +46,8 @@ namespace core {
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 ClassTypeInfo::ClassTypeInfo(const String& name)
-: TypeInfo(name) {
+: TypeInfo(name)
+, mClass(nullptr) {
 }
 
 TypeInfoType ClassTypeInfo::get_type_info_type() const {
@@ -53,6 +55,10 @@ TypeInfoType ClassTypeInfo::get_type_info_type() const {
 }
 
 const Class* ClassTypeInfo::get_class() const {
+  // The reflection is registered on first use
+  if (nullptr == mClass) {
+    RttiTypeServer::instance().get_class_type(get_name());
+  }
   return mClass;
 }
 
@@ -23,6 +23,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/rtti/type_info/enum_type_info.h"
+#include "core/rtti/rtti_type_server.h"
 
 
 //[-------------------------------------------------------]
@@ -45,7 +46,8 @@ namespace core {
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 EnumTypeInfo::EnumTypeInfo(const String& name)
-: TypeInfo(name) {
+: TypeInfo(name)
+, mEnum(nullptr) {
 }
 
 TypeInfoType EnumTypeInfo::get_type_info_type() const {
@@ -53,6 +55,10 @@ TypeInfoType EnumTypeInfo::get_type_info_type() const {
 }
 
 const Enum* EnumTypeInfo::get_enum() const {
+  // The reflection is registered on first use
+  if (nullptr == mEnum) {
+    RttiTypeServer::instance().get_enum_type(get_name());
+  }
   return mEnum;
 }
 
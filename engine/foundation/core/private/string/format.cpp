@@ -0,0 +1,426 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/format.h"
+#include "core/color/color4.h"
+#include "core/io/stream.h"
+#include "core/string/number_conversion.h"
+#include <charconv>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Size of the stack buffer used when formatting into strings and streams */
+static constexpr sizeT LocalBufferSize = 256;
+
+/** Enough for a fixed notation double with the largest precision */
+static constexpr sizeT FloatBufferSize = 320 + MaxFormatPrecision;
+
+static constexpr char LowerDigits[] = "0123456789abcdef";
+
+static constexpr char UpperDigits[] = "0123456789ABCDEF";
+
+
+//[-------------------------------------------------------]
+//[ Local classes                                         ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Output appending to a string whenever the stack buffer is full.
+ */
+class StringFormatOutput : public FormatOutput {
+public:
+  explicit StringFormatOutput(String& destination)
+  : FormatOutput(mLocalBuffer, LocalBufferSize)
+  , mDestination(destination) {
+  }
+
+  void finish() {
+    flush();
+  }
+
+protected:
+  bool flush() override {
+    mDestination.append(mBuffer, static_cast<String::SizeType>(mUsed));
+    mUsed = 0;
+    return true;
+  }
+
+private:
+  char mLocalBuffer[LocalBufferSize];
+  String& mDestination;
+};
+
+/**
+ * @brief
+ * Output writing to a stream whenever the stack buffer is full.
+ */
+class StreamFormatOutput : public FormatOutput {
+public:
+  explicit StreamFormatOutput(Stream& stream)
+  : FormatOutput(mLocalBuffer, LocalBufferSize)
+  , mStream(stream) {
+  }
+
+  void finish() {
+    flush();
+  }
+
+protected:
+  bool flush() override {
+    if (mUsed > 0) {
+      mStream.write(mBuffer, mUsed);
+    }
+    mUsed = 0;
+    return true;
+  }
+
+private:
+  char mLocalBuffer[LocalBufferSize];
+  Stream& mStream;
+};
+
+/**
+ * @brief
+ * Output which only counts the characters.
+ */
+class CountingFormatOutput : public FormatOutput {
+public:
+  CountingFormatOutput()
+  : FormatOutput(mLocalBuffer, LocalBufferSize) {
+  }
+
+protected:
+  bool flush() override {
+    mUsed = 0;
+    return true;
+  }
+
+private:
+  char mLocalBuffer[LocalBufferSize];
+};
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes a number, zero padding goes between the sign and the digits.
+ */
+static void write_number(FormatOutput& output, const FormatSpec& spec, const char* text, sizeT size) {
+  if (spec.Zero && spec.Align == '\0' && spec.Width > size) {
+    const sizeT signSize = (size > 0 && *text == '-') ? 1 : 0;
+    output.put(text, signSize);
+    output.put_fill('0', spec.Width - size);
+    output.put(text + signSize, size - signSize);
+  } else {
+    output.put_padded(spec, text, size, '>');
+  }
+}
+
+template<typename TType>
+static void format_floating_point(FormatOutput& output, const FormatSpec& spec, TType value) {
+  char buffer[FloatBufferSize];
+  char* end = nullptr;
+  if (spec.Type == '\0' && spec.Precision < 0) {
+    // Shortest representation reading back to the same value
+    end = to_chars(buffer, buffer + FloatBufferSize, value);
+  } else {
+    const std::chars_format chars_format = (spec.Type == 'e') ? std::chars_format::scientific :
+                                           (spec.Type == 'g') ? std::chars_format::general : std::chars_format::fixed;
+    const int precision = (spec.Precision < 0) ? 6 : spec.Precision;
+    const std::to_chars_result result = std::to_chars(buffer, buffer + FloatBufferSize, value, chars_format, precision);
+    end = (result.ec == std::errc()) ? result.ptr : nullptr;
+  }
+  if (end != nullptr) {
+    write_number(output, spec, buffer, static_cast<sizeT>(end - buffer));
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+FormatOutput::FormatOutput(char* buffer, sizeT capacity)
+: mBuffer(buffer)
+, mCapacity(capacity)
+, mUsed(0)
+, mSize(0) {
+}
+
+FormatOutput::~FormatOutput() {
+}
+
+void FormatOutput::put_fill(char c, sizeT count) {
+  mSize += count;
+  while (count > 0) {
+    if (mUsed == mCapacity && !flush()) {
+      return;
+    }
+    const sizeT numChars = (count < mCapacity - mUsed) ? count : mCapacity - mUsed;
+    Memory::set(mBuffer + mUsed, c, static_cast<uint32>(numChars));
+    mUsed += numChars;
+    count -= numChars;
+  }
+}
+
+void FormatOutput::put_padded(const FormatSpec& spec, const char* data, sizeT size, char defaultAlign) {
+  if (spec.Width <= size) {
+    put(data, size);
+    return;
+  }
+
+  const sizeT padding = spec.Width - size;
+  const char align = (spec.Align != '\0') ? spec.Align : defaultAlign;
+  const sizeT before = (align == '>') ? padding : (align == '^') ? padding / 2 : 0;
+  put_fill(spec.Fill, before);
+  put(data, size);
+  put_fill(spec.Fill, padding - before);
+}
+
+void Formatter<bool>::format(FormatOutput& output, const FormatSpec& spec, bool value) {
+  if (spec.Type == '\0' || spec.Type == 's') {
+    output.put_padded(spec, value ? "true" : "false", value ? 4 : 5, '<');
+  } else {
+    internal::format_integer(output, spec, value ? 1 : 0, false);
+  }
+}
+
+void Formatter<char>::format(FormatOutput& output, const FormatSpec& spec, char value) {
+  if (spec.Type == '\0' || spec.Type == 'c') {
+    output.put_padded(spec, &value, 1, '<');
+  } else {
+    Formatter<int32>::format(output, spec, static_cast<int32>(value));
+  }
+}
+
+void Formatter<float>::format(FormatOutput& output, const FormatSpec& spec, float value) {
+  format_floating_point(output, spec, value);
+}
+
+void Formatter<double>::format(FormatOutput& output, const FormatSpec& spec, double value) {
+  format_floating_point(output, spec, value);
+}
+
+void Formatter<const char*>::format(FormatOutput& output, const FormatSpec& spec, const char* value) {
+  if (value == nullptr) {
+    value = "(null)";
+  }
+  sizeT size = strlen(value);
+  if (spec.Precision >= 0 && static_cast<sizeT>(spec.Precision) < size) {
+    size = static_cast<sizeT>(spec.Precision);
+  }
+  output.put_padded(spec, value, size, '<');
+}
+
+void Formatter<StringView>::format(FormatOutput& output, const FormatSpec& spec, StringView value) {
+  sizeT size = value.size();
+  if (spec.Precision >= 0 && static_cast<sizeT>(spec.Precision) < size) {
+    size = static_cast<sizeT>(spec.Precision);
+  }
+  output.put_padded(spec, value.data(), size, '<');
+}
+
+void Formatter<String>::format(FormatOutput& output, const FormatSpec& spec, const String& value) {
+  sizeT size = value.size();
+  if (spec.Precision >= 0 && static_cast<sizeT>(spec.Precision) < size) {
+    size = static_cast<sizeT>(spec.Precision);
+  }
+  output.put_padded(spec, value.c_str(), size, '<');
+}
+
+void Formatter<const void*>::format(FormatOutput& output, const FormatSpec& spec, const void* value) {
+  char buffer[2 + 2 * sizeof(uintptr_t)];
+  char* position = buffer + sizeof(buffer);
+  uintptr_t address = reinterpret_cast<uintptr_t>(value);
+  do {
+    *--position = LowerDigits[address & 0xf];
+    address >>= 4;
+  } while (address != 0);
+  *--position = 'x';
+  *--position = '0';
+  output.put_padded(spec, position, static_cast<sizeT>(buffer + sizeof(buffer) - position), '>');
+}
+
+void Formatter<std::nullptr_t>::format(FormatOutput& output, const FormatSpec& spec, std::nullptr_t) {
+  Formatter<const void*>::format(output, spec, static_cast<const void*>(nullptr));
+}
+
+void Formatter<Color4>::format(FormatOutput& output, const FormatSpec& spec, const Color4& value) {
+  output.put('(');
+  for (uint32 i = 0; i < 4; ++i) {
+    if (i > 0) {
+      output.put(", ", 2);
+    }
+    Formatter<float>::format(output, spec, value.value[i]);
+  }
+  output.put(')');
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual FormatOutput functions              ]
+//[-------------------------------------------------------]
+bool FormatOutput::flush() {
+  // A plain buffer has nowhere to go, the remaining output is only counted
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+void FormatOutput::put_overflow(const char* data, sizeT size) {
+  mSize += size;
+  while (size > 0) {
+    if (mUsed == mCapacity && !flush()) {
+      return;
+    }
+    const sizeT numChars = (size < mCapacity - mUsed) ? size : mCapacity - mUsed;
+    Memory::copy(mBuffer + mUsed, data, static_cast<uint32>(numChars));
+    mUsed += numChars;
+    data += numChars;
+    size -= numChars;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Internal                                              ]
+//[-------------------------------------------------------]
+namespace internal {
+
+void format_string_error(const char*) {
+  // Only ever reached during constant evaluation, where it fails the compilation
+}
+
+void format_integer(FormatOutput& output, const FormatSpec& spec, uint64 magnitude, bool negative) {
+  if (spec.Type == 'c') {
+    const char c = static_cast<char>(magnitude);
+    output.put_padded(spec, &c, 1, '<');
+    return;
+  }
+
+  // One extra character in front for the sign
+  char buffer[1 + 64];
+  char* first = buffer + 1;
+  char* last = buffer + sizeof(buffer);
+  if (spec.Type == '\0' || spec.Type == 'd') {
+    last = to_chars(first, last, magnitude);
+  } else {
+    const char* digits = (spec.Type == 'X') ? UpperDigits : LowerDigits;
+    const uint32 shift = (spec.Type == 'b') ? 1 : (spec.Type == 'o') ? 3 : 4;
+    const uint64 mask = (uint64(1) << shift) - 1;
+    first = last;
+    do {
+      *--first = digits[magnitude & mask];
+      magnitude >>= shift;
+    } while (magnitude != 0);
+  }
+  if (negative) {
+    *--first = '-';
+  }
+  write_number(output, spec, first, static_cast<sizeT>(last - first));
+}
+
+void vformat_to(FormatOutput& output, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments) {
+  const char* position = format;
+  const char* last = format + length;
+  sizeT argumentIndex = 0;
+  while (position != last) {
+    // Literal text up to the next brace in one go
+    const char* literal = position;
+    while (position != last && *position != '{' && *position != '}') {
+      ++position;
+    }
+    output.put(literal, static_cast<sizeT>(position - literal));
+    if (position == last) {
+      break;
+    }
+
+    // Escaped brace, or a lone '}' which the compile-time check already rejected
+    if (*position == '}' || (position + 1 != last && position[1] == '{')) {
+      output.put(*position);
+      position += (position + 1 != last && position[1] == *position) ? 2 : 1;
+      continue;
+    }
+
+    FormatSpec spec;
+    const char* next = parse_format_spec(position + 1, last, spec);
+    if (next == nullptr || argumentIndex == numArguments) {
+      output.put(position, static_cast<sizeT>(last - position));
+      break;
+    }
+    arguments[argumentIndex].Format(output, spec, arguments[argumentIndex].Value);
+    ++argumentIndex;
+    position = next;
+  }
+}
+
+void vformat_to(String& destination, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments) {
+  StringFormatOutput output(destination);
+  vformat_to(output, format, length, arguments, numArguments);
+  output.finish();
+}
+
+sizeT vformat_to(char* buffer, sizeT size, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments) {
+  if (size == 0) {
+    return vformatted_size(format, length, arguments, numArguments);
+  }
+
+  // Keep room for the terminator
+  FormatOutput output(buffer, size - 1);
+  vformat_to(output, format, length, arguments, numArguments);
+  buffer[output.get_buffer_used()] = '\0';
+  return output.get_size();
+}
+
+void vformat_to(Stream& stream, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments) {
+  StreamFormatOutput output(stream);
+  vformat_to(output, format, length, arguments, numArguments);
+  output.finish();
+}
+
+sizeT vformatted_size(const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments) {
+  CountingFormatOutput output;
+  vformat_to(output, format, length, arguments, numArguments);
+  return output.get_size();
+}
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
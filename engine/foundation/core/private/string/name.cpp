@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/name.h"
+#include "core/string/string_simd.h"
+#include "core/threading/lock_guard.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Initial number of hash table slots */
+static constexpr uint32 InitialTableSize = 1024;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static NameTable::Entry* allocate_chunk() {
+  return new NameTable::Entry[NameTable::EntriesPerChunk];
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+NameTable& NameTable::instance() {
+  static NameTable SInstance;
+  return SInstance;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+uint32 NameTable::intern(const char* text, sizeT size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  // Fast path without locking for names which already exist
+  const uint64 hash = string_hash(text, size);
+  uint32 id = probe(text, size, hash);
+  if (0 != id) {
+    return id;
+  }
+
+  LockGuard<Mutex> lock(mMutex);
+
+  // Someone else might have been faster
+  id = probe(text, size, hash);
+  if (0 != id) {
+    return id;
+  }
+
+  id = mNumNames.load(std::memory_order_relaxed);
+  BE_ASSERT(id < EntriesPerChunk * MaxChunks, "Name table is full")
+  Entry* chunk = mChunks[id / EntriesPerChunk].load(std::memory_order_relaxed);
+  if (nullptr == chunk) {
+    chunk = allocate_chunk();
+    mChunks[id / EntriesPerChunk].store(chunk, std::memory_order_release);
+  }
+
+  Entry& entry = chunk[id % EntriesPerChunk];
+  entry.Text = store_text(text, size);
+  entry.Size = static_cast<uint32>(size);
+  entry.Hash = hash;
+  mNumNames.store(id + 1, std::memory_order_release);
+
+  // Keep the load factor at one half at most
+  Table* table = mTable.load(std::memory_order_relaxed);
+  if ((id + 1) * 2 > table->Mask + 1) {
+    grow();
+  } else {
+    insert_slot(table, id, hash);
+  }
+  return id;
+}
+
+uint32 NameTable::find(const char* text, sizeT size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  const uint64 hash = string_hash(text, size);
+  const uint32 id = probe(text, size, hash);
+  if (0 != id) {
+    return id;
+  }
+
+  // The table might just be growing, a miss is only final under the lock
+  LockGuard<Mutex> lock(mMutex);
+  return probe(text, size, hash);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+NameTable::NameTable()
+: mNumNames(1)
+, mTextCursor(nullptr)
+, mTextRemaining(0) {
+  for (uint32 i = 0; i < MaxChunks; ++i) {
+    mChunks[i].store(nullptr, std::memory_order_relaxed);
+  }
+
+  // Id 0 is the empty name
+  Entry* chunk = allocate_chunk();
+  chunk[0].Text = "";
+  chunk[0].Size = 0;
+  chunk[0].Hash = string_hash("", 0);
+  mChunks[0].store(chunk, std::memory_order_relaxed);
+
+  Table* table = new Table;
+  table->Mask = InitialTableSize - 1;
+  table->Slots = new atomic<uint32>[InitialTableSize];
+  for (uint32 i = 0; i < InitialTableSize; ++i) {
+    table->Slots[i].store(0, std::memory_order_relaxed);
+  }
+  mTable.store(table, std::memory_order_release);
+}
+
+NameTable::~NameTable() {
+  mRetiredTables.push_back(mTable.load(std::memory_order_relaxed));
+  for (Table* table : mRetiredTables) {
+    delete [] table->Slots;
+    delete table;
+  }
+  for (uint32 i = 0; i < MaxChunks; ++i) {
+    delete [] mChunks[i].load(std::memory_order_relaxed);
+  }
+  for (char* block : mTextBlocks) {
+    delete [] block;
+  }
+}
+
+uint32 NameTable::probe(const char* text, sizeT size, uint64 hash) const {
+  const Table* table = mTable.load(std::memory_order_acquire);
+  uint32 index = static_cast<uint32>(hash) & table->Mask;
+  for (;;) {
+    const uint32 id = table->Slots[index].load(std::memory_order_acquire);
+    if (0 == id) {
+      return 0;
+    }
+    const Entry& entry = get_entry(id);
+    if (entry.Hash == hash && entry.Size == size && 0 == memcmp(entry.Text, text, size)) {
+      return id;
+    }
+    index = (index + 1) & table->Mask;
+  }
+}
+
+const char* NameTable::store_text(const char* text, sizeT size) {
+  char* destination = nullptr;
+  if (size + 1 > TextBlockSize / 4) {
+    // Long texts get a block of their own instead of wasting the rest of the current one
+    destination = new char[size + 1];
+    mTextBlocks.push_back(destination);
+  } else {
+    if (size + 1 > mTextRemaining) {
+      mTextCursor = new char[TextBlockSize];
+      mTextRemaining = TextBlockSize;
+      mTextBlocks.push_back(mTextCursor);
+    }
+    destination = mTextCursor;
+    mTextCursor += size + 1;
+    mTextRemaining -= size + 1;
+  }
+  memcpy(destination, text, size);
+  destination[size] = '\0';
+  return destination;
+}
+
+void NameTable::insert_slot(Table* table, uint32 id, uint64 hash) {
+  uint32 index = static_cast<uint32>(hash) & table->Mask;
+  while (0 != table->Slots[index].load(std::memory_order_relaxed)) {
+    index = (index + 1) & table->Mask;
+  }
+  table->Slots[index].store(id, std::memory_order_release);
+}
+
+void NameTable::grow() {
+  Table* oldTable = mTable.load(std::memory_order_relaxed);
+  const uint32 capacity = (oldTable->Mask + 1) * 2;
+
+  Table* table = new Table;
+  table->Mask = capacity - 1;
+  table->Slots = new atomic<uint32>[capacity];
+  for (uint32 i = 0; i < capacity; ++i) {
+    table->Slots[i].store(0, std::memory_order_relaxed);
+  }
+  const uint32 numNames = mNumNames.load(std::memory_order_relaxed);
+  for (uint32 id = 1; id < numNames; ++id) {
+    insert_slot(table, id, get_entry(id).Hash);
+  }
+
+  // Readers may still walk the old table, it stays alive until shutdown
+  mTable.store(table, std::memory_order_release);
+  mRetiredTables.push_back(oldTable);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/number_conversion.h"
+#include <charconv>
+#include <limits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Two digit decimal representations of 0 to 99 */
+static constexpr char DigitPairs[201] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+template<typename TType>
+static uint32 count_digits(TType value) {
+  uint32 numDigits = 1;
+  for (;;) {
+    if (value < 10) {
+      return numDigits;
+    }
+    if (value < 100) {
+      return numDigits + 1;
+    }
+    if (value < 1000) {
+      return numDigits + 2;
+    }
+    if (value < 10000) {
+      return numDigits + 3;
+    }
+    value /= 10000;
+    numDigits += 4;
+  }
+}
+
+template<typename TType>
+static char* write_unsigned(char* first, char* last, TType value) {
+  const uint32 numDigits = count_digits(value);
+  if (static_cast<uint64>(last - first) < numDigits) {
+    return nullptr;
+  }
+
+  // Fill from the back, two digits per division
+  char* position = first + numDigits;
+  while (value >= 100) {
+    const uint32 pair = static_cast<uint32>(value % 100) * 2;
+    value /= 100;
+    *--position = DigitPairs[pair + 1];
+    *--position = DigitPairs[pair];
+  }
+  if (value >= 10) {
+    const uint32 pair = static_cast<uint32>(value) * 2;
+    *--position = DigitPairs[pair + 1];
+    *--position = DigitPairs[pair];
+  } else {
+    *--position = static_cast<char>('0' + value);
+  }
+  return first + numDigits;
+}
+
+template<typename TUnsigned, typename TSigned>
+static char* write_signed(char* first, char* last, TSigned value) {
+  if (value >= 0) {
+    return write_unsigned(first, last, static_cast<TUnsigned>(value));
+  }
+  if (first == last) {
+    return nullptr;
+  }
+  *first = '-';
+  // Negate in unsigned arithmetic, which is also defined for the minimum value
+  return write_unsigned(first + 1, last, static_cast<TUnsigned>(0) - static_cast<TUnsigned>(value));
+}
+
+/**
+ * @brief
+ * Reads decimal digits into an unsigned value which must not exceed the given maximum.
+ */
+template<typename TType>
+static const char* read_unsigned(const char* first, const char* last, TType maximum, TType& value) {
+  if (first == last || *first < '0' || *first > '9') {
+    return nullptr;
+  }
+
+  TType result = 0;
+  for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+    const TType digit = static_cast<TType>(*first - '0');
+    if (result > (maximum - digit) / 10) {
+      return nullptr;
+    }
+    result = result * 10 + digit;
+  }
+  value = result;
+  return first;
+}
+
+template<typename TUnsigned, typename TSigned>
+static const char* read_signed(const char* first, const char* last, TSigned& value) {
+  const bool negative = (first != last && *first == '-');
+  const TUnsigned maximum = static_cast<TUnsigned>(std::numeric_limits<TSigned>::max()) + (negative ? 1 : 0);
+
+  TUnsigned magnitude = 0;
+  const char* end = read_unsigned(first + (negative ? 1 : 0), last, maximum, magnitude);
+  if (nullptr != end) {
+    value = negative ? static_cast<TSigned>(static_cast<TUnsigned>(0) - magnitude) : static_cast<TSigned>(magnitude);
+  }
+  return end;
+}
+
+template<typename TType>
+static char* write_float(char* first, char* last, TType value) {
+  const std::to_chars_result result = std::to_chars(first, last, value);
+  return (result.ec == std::errc()) ? result.ptr : nullptr;
+}
+
+template<typename TType>
+static const char* read_float(const char* first, const char* last, TType& value) {
+  TType result = 0;
+  const std::from_chars_result fromCharsResult = std::from_chars(first, last, result);
+  if (fromCharsResult.ec != std::errc()) {
+    return nullptr;
+  }
+  value = result;
+  return fromCharsResult.ptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+char* to_chars(char* first, char* last, uint32 value) {
+  return write_unsigned(first, last, value);
+}
+
+char* to_chars(char* first, char* last, uint64 value) {
+  // Stay in 32 bit arithmetic whenever possible, 64 bit divisions are considerably slower
+  return (value <= 0xffffffff) ? write_unsigned(first, last, static_cast<uint32>(value)) : write_unsigned(first, last, value);
+}
+
+char* to_chars(char* first, char* last, int32 value) {
+  return write_signed<uint32>(first, last, value);
+}
+
+char* to_chars(char* first, char* last, int64 value) {
+  if (value >= 0) {
+    return to_chars(first, last, static_cast<uint64>(value));
+  }
+  return write_signed<uint64>(first, last, value);
+}
+
+char* to_chars(char* first, char* last, float value) {
+  return write_float(first, last, value);
+}
+
+char* to_chars(char* first, char* last, double value) {
+  return write_float(first, last, value);
+}
+
+const char* from_chars(const char* first, const char* last, uint32& value) {
+  return read_unsigned<uint32>(first, last, 0xffffffff, value);
+}
+
+const char* from_chars(const char* first, const char* last, uint64& value) {
+  return read_unsigned<uint64>(first, last, 0xffffffffffffffff, value);
+}
+
+const char* from_chars(const char* first, const char* last, int32& value) {
+  return read_signed<uint32>(first, last, value);
+}
+
+const char* from_chars(const char* first, const char* last, int64& value) {
+  return read_signed<uint64>(first, last, value);
+}
+
+const char* from_chars(const char* first, const char* last, float& value) {
+  return read_float(first, last, value);
+}
+
+const char* from_chars(const char* first, const char* last, double& value) {
+  return read_float(first, last, value);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/regex.h"
+#include "core/threading/lock_guard.h"
+#include <cstring>
+#include <pcre.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Returns whether the PCRE library was built with the JIT compiler.
+ */
+static bool is_jit_available() {
+#if defined(PCRE_CONFIG_JIT)
+  static const bool SAvailable = [] {
+    int available = 0;
+    return (pcre_config(PCRE_CONFIG_JIT, &available) == 0 && available != 0);
+  }();
+  return SAvailable;
+#else
+  return false;
+#endif
+}
+
+static int to_pcre_options(int options) {
+  int pcreOptions = 0;
+  if (options & RegExPattern::OptionCaseless)
+    pcreOptions |= PCRE_CASELESS;
+  if (options & RegExPattern::OptionMultiline)
+    pcreOptions |= PCRE_MULTILINE;
+  if (options & RegExPattern::OptionDotAll)
+    pcreOptions |= PCRE_DOTALL;
+  if (options & RegExPattern::OptionUngreedy)
+    pcreOptions |= PCRE_UNGREEDY;
+  return pcreOptions;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+RegExPattern::RegExPattern(const String &sExpression, int nOptions) :
+m_sExpression(sExpression),
+m_nOptions(nOptions),
+m_pPCRE(nullptr),
+m_pExtra(nullptr),
+m_bJit(false),
+m_pszError(nullptr),
+m_nErrorOffset(0) {
+  // Compile regular expression
+  m_pPCRE = pcre_compile(m_sExpression.c_str(), to_pcre_options(nOptions), &m_pszError, &m_nErrorOffset, nullptr);
+  if (m_pPCRE) {
+    m_pszError = nullptr;
+
+    // Study once for all users of the pattern, with the JIT compiler if there is one
+    const char *pszStudyError = nullptr;
+#if defined(PCRE_STUDY_JIT_COMPILE)
+    if (is_jit_available()) {
+      m_pExtra = pcre_study(m_pPCRE, PCRE_STUDY_JIT_COMPILE, &pszStudyError);
+      int nJit = 0;
+      m_bJit = (m_pExtra && pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_JIT, &nJit) == 0 && nJit != 0);
+    }
+#endif
+    if (!m_pExtra) {
+      m_pExtra = pcre_study(m_pPCRE, 0, &pszStudyError);
+    }
+  }
+}
+
+int RegExPattern::exec(const char *pszSubject, sizeT nSize, sizeT nPosition, int *pnOffsets) const {
+  if (!m_pPCRE) {
+    return -1;
+  }
+  return pcre_exec(
+    m_pPCRE,							// PCRE expression
+    m_pExtra,							// Study data, runs the JIT code if there is some
+    pszSubject,							// Subject string
+    static_cast<int>(nSize),			// Subject length in bytes
+    static_cast<int>(nPosition),		// start at byte position
+    0,									// Default options
+    pnOffsets,							// Output vector with offsets in bytes
+    static_cast<int>(OffsetsSize)		// Size of output vector
+  );
+}
+
+uint32 RegExPattern::get_num_names() const {
+  int nNameCount = 0;
+  if (m_pPCRE) {
+    pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMECOUNT, &nNameCount);
+  }
+  return static_cast<uint32>(nNameCount);
+}
+
+const char *RegExPattern::get_name(uint32 nIndex, int &nGroup) const {
+  const char *pszNameTable = nullptr;
+  pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMETABLE, &pszNameTable);
+  int nNameEntrySize = 0;
+  pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMEENTRYSIZE, &nNameEntrySize);
+
+  // Each entry is the group number in two bytes followed by the null terminated name
+  const char *pszEntry = &pszNameTable[nIndex*nNameEntrySize];
+  nGroup = (static_cast<uint8>(pszEntry[0]) << 8) | static_cast<uint8>(pszEntry[1]);
+  return &pszEntry[2];
+}
+
+int RegExPattern::get_group_index(const char *pszName) const {
+  for (uint32 i=0, nNameCount=get_num_names(); i<nNameCount; i++) {
+    int nGroup = 0;
+    if (strcmp(get_name(i, nGroup), pszName) == 0) {
+      return nGroup;
+    }
+  }
+  return -1;
+}
+
+RegExPattern::~RegExPattern() {
+  if (m_pExtra) {
+    pcre_free_study(m_pExtra);
+  }
+  if (m_pPCRE) {
+    pcre_free(m_pPCRE);
+  }
+}
+
+RegExCache &RegExCache::instance() {
+  static RegExCache SInstance;
+  return SInstance;
+}
+
+Ptr<RegExPattern> RegExCache::get_pattern(const String &sExpression, int nOptions) {
+  Key cKey{sExpression, nOptions};
+  {
+    LockGuard<Mutex> lock(m_cMutex);
+    auto iter = m_mapPatterns.find(cKey);
+    if (iter != m_mapPatterns.end()) {
+      iter.value().LastUse = ++m_nUseCounter;
+      ++m_nHits;
+      return iter->second.Pattern;
+    }
+    ++m_nMisses;
+  }
+
+  // Compile without holding the lock, if two threads race the first one wins
+  Ptr<RegExPattern> pPattern(new RegExPattern(sExpression, nOptions));
+
+  LockGuard<Mutex> lock(m_cMutex);
+  if (m_nCapacity > 0) {
+    auto iter = m_mapPatterns.find(cKey);
+    if (iter != m_mapPatterns.end()) {
+      return iter->second.Pattern;
+    }
+    evict(m_nCapacity - 1);
+    m_mapPatterns.emplace(cKey, Entry{pPattern, ++m_nUseCounter});
+  }
+  return pPattern;
+}
+
+void RegExCache::set_capacity(uint32 nCapacity) {
+  LockGuard<Mutex> lock(m_cMutex);
+  m_nCapacity = nCapacity;
+  evict(nCapacity);
+}
+
+uint32 RegExCache::get_capacity() const {
+  LockGuard<Mutex> lock(m_cMutex);
+  return m_nCapacity;
+}
+
+uint32 RegExCache::get_num_patterns() const {
+  LockGuard<Mutex> lock(m_cMutex);
+  return static_cast<uint32>(m_mapPatterns.size());
+}
+
+uint64 RegExCache::get_num_hits() const {
+  LockGuard<Mutex> lock(m_cMutex);
+  return m_nHits;
+}
+
+uint64 RegExCache::get_num_misses() const {
+  LockGuard<Mutex> lock(m_cMutex);
+  return m_nMisses;
+}
+
+void RegExCache::clear() {
+  LockGuard<Mutex> lock(m_cMutex);
+  m_mapPatterns.clear();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+RegExCache::RegExCache() :
+m_nCapacity(DefaultCapacity),
+m_nUseCounter(0),
+m_nHits(0),
+m_nMisses(0) {
+
+}
+
+RegExCache::~RegExCache() {
+
+}
+
+void RegExCache::evict(uint32 nCapacity) {
+  // The cache is small and only changes on misses, a linear search for the oldest entry is fine
+  while (m_mapPatterns.size() > nCapacity) {
+    auto oldest = m_mapPatterns.begin();
+    for (auto iter = m_mapPatterns.begin(); iter != m_mapPatterns.end(); ++iter) {
+      if (iter->second.LastUse < oldest->second.LastUse) {
+        oldest = iter;
+      }
+    }
+    m_mapPatterns.erase(oldest);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,475 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/string_simd.h"
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define BE_STRING_SIMD
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define BE_STRING_SIMD
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+#if defined(__SSE2__) || defined(_M_X64)
+/**
+ * @brief
+ * 16 byte block operations on SSE2.
+ */
+struct SimdBlock {
+  typedef __m128i Type;
+
+  /** Bytes per block */
+  static constexpr sizeT Size = 16;
+  /** Bits per byte in the result of to_bits() */
+  static constexpr uint32 BitsPerByte = 1;
+
+  static inline Type load(const char* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+
+  static inline void store(char* p, Type v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+
+  static inline Type splat(char c) {
+    return _mm_set1_epi8(c);
+  }
+
+  static inline Type equal(Type a, Type b) {
+    return _mm_cmpeq_epi8(a, b);
+  }
+
+  static inline Type bit_and(Type a, Type b) {
+    return _mm_and_si128(a, b);
+  }
+
+  static inline Type bit_or(Type a, Type b) {
+    return _mm_or_si128(a, b);
+  }
+
+  static inline Type bit_xor(Type a, Type b) {
+    return _mm_xor_si128(a, b);
+  }
+
+  /** All bits set in bytes within [low, low + count) */
+  static inline Type in_range(Type v, char low, uint8 count) {
+    // Unsigned compare of 'v - low' through the signed one by flipping the top bit
+    return _mm_cmplt_epi8(_mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(low + 128))), _mm_set1_epi8(static_cast<char>(count - 128)));
+  }
+
+  static inline uint64 to_bits(Type v) {
+    return static_cast<uint32>(_mm_movemask_epi8(v));
+  }
+};
+#elif defined(__ARM_NEON)
+/**
+ * @brief
+ * 16 byte block operations on NEON.
+ */
+struct SimdBlock {
+  typedef uint8x16_t Type;
+
+  /** Bytes per block */
+  static constexpr sizeT Size = 16;
+  /** Bits per byte in the result of to_bits() */
+  static constexpr uint32 BitsPerByte = 4;
+
+  static inline Type load(const char* p) {
+    return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+  }
+
+  static inline void store(char* p, Type v) {
+    vst1q_u8(reinterpret_cast<uint8_t*>(p), v);
+  }
+
+  static inline Type splat(char c) {
+    return vdupq_n_u8(static_cast<uint8_t>(c));
+  }
+
+  static inline Type equal(Type a, Type b) {
+    return vceqq_u8(a, b);
+  }
+
+  static inline Type bit_and(Type a, Type b) {
+    return vandq_u8(a, b);
+  }
+
+  static inline Type bit_or(Type a, Type b) {
+    return vorrq_u8(a, b);
+  }
+
+  static inline Type bit_xor(Type a, Type b) {
+    return veorq_u8(a, b);
+  }
+
+  /** All bits set in bytes within [low, low + count) */
+  static inline Type in_range(Type v, char low, uint8 count) {
+    return vcltq_u8(vsubq_u8(v, vdupq_n_u8(static_cast<uint8_t>(low))), vdupq_n_u8(count));
+  }
+
+  static inline uint64 to_bits(Type v) {
+    // There is no movemask, narrowing gives four bits per byte instead
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+  }
+};
+#endif
+
+/** Multipliers of the hash function */
+static constexpr uint64 HashSecret0 = 0xa0761d6478bd642full;
+static constexpr uint64 HashSecret1 = 0xe7037ed1a0b428dbull;
+static constexpr uint64 HashSecret2 = 0x8ebc6af09c88c6e3ull;
+static constexpr uint64 HashSecret3 = 0x589965cc75374cc3ull;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static inline char ascii_to_lower(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+static inline int compare_result(char c1, char c2) {
+  return (static_cast<uint8>(c1) < static_cast<uint8>(c2)) ? -1 : 1;
+}
+
+#if defined(BE_STRING_SIMD)
+/** Bits in the result of to_bits() for a single byte */
+static constexpr uint64 ByteBits = (uint64(1) << SimdBlock::BitsPerByte) - 1;
+
+/** to_bits() result with every byte set */
+static constexpr uint64 FullBits = (SimdBlock::Size * SimdBlock::BitsPerByte == 64) ? ~uint64(0) : (uint64(1) << (SimdBlock::Size * SimdBlock::BitsPerByte)) - 1;
+
+/**
+ * @brief
+ * Flips bit 5 of all characters in [low, low + 26), which switches the case of ASCII letters.
+ */
+static inline SimdBlock::Type switch_case(SimdBlock::Type v, char low) {
+  return SimdBlock::bit_xor(v, SimdBlock::bit_and(SimdBlock::in_range(v, low, 26), SimdBlock::splat(0x20)));
+}
+
+static inline uint32 first_byte(uint64 bits) {
+  return static_cast<uint32>(__builtin_ctzll(bits)) / SimdBlock::BitsPerByte;
+}
+#endif
+
+static void switch_case(char* p, sizeT n, char low) {
+  sizeT i = 0;
+#if defined(BE_STRING_SIMD)
+  for (; i + SimdBlock::Size <= n; i += SimdBlock::Size) {
+    SimdBlock::store(p + i, switch_case(SimdBlock::load(p + i), low));
+  }
+#endif
+  for (; i < n; ++i) {
+    if (p[i] >= low && p[i] < low + 26) {
+      p[i] = static_cast<char>(p[i] ^ 0x20);
+    }
+  }
+}
+
+/**
+ * @brief
+ * Finds the first character whose membership in the set equals 'member'.
+ */
+static const char* find_in_set(const char* first, const char* last, const CharacterSet& set, bool member) {
+  const char* position = first;
+#if defined(BE_STRING_SIMD)
+  if (set.is_vectorizable() && !set.is_empty()) {
+    const uint32 numChars = set.get_num_chars();
+    SimdBlock::Type chars[CharacterSet::MaxVectorChars];
+    for (uint32 i = 0; i < numChars; ++i) {
+      chars[i] = SimdBlock::splat(set.get_chars()[i]);
+    }
+    const uint64 invert = member ? 0 : FullBits;
+    while (position + SimdBlock::Size <= last) {
+      const SimdBlock::Type block = SimdBlock::load(position);
+      SimdBlock::Type matches = SimdBlock::equal(block, chars[0]);
+      for (uint32 i = 1; i < numChars; ++i) {
+        matches = SimdBlock::bit_or(matches, SimdBlock::equal(block, chars[i]));
+      }
+      const uint64 bits = SimdBlock::to_bits(matches) ^ invert;
+      if (bits) {
+        return position + first_byte(bits);
+      }
+      position += SimdBlock::Size;
+    }
+  }
+#endif
+  while (position != last && set.contains(*position) != member) {
+    ++position;
+  }
+  return position;
+}
+
+static inline uint64 read64(const uint8* p) {
+  uint64 value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint64 read32(const uint8* p) {
+  uint32 value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief
+ * 64x64->128 bit multiplication, the low half goes to 'a' and the high half to 'b'.
+ */
+static inline void multiply(uint64& a, uint64& b) {
+#if defined(__SIZEOF_INT128__)
+  const __uint128_t product = static_cast<__uint128_t>(a) * b;
+  a = static_cast<uint64>(product);
+  b = static_cast<uint64>(product >> 64);
+#else
+  const uint64 aHigh = a >> 32;
+  const uint64 aLow = a & 0xffffffffull;
+  const uint64 bHigh = b >> 32;
+  const uint64 bLow = b & 0xffffffffull;
+  const uint64 highLow = aHigh * bLow;
+  const uint64 lowHigh = aLow * bHigh;
+  const uint64 lowLow = aLow * bLow;
+  const uint64 middle = (lowLow >> 32) + (highLow & 0xffffffffull) + (lowHigh & 0xffffffffull);
+  a = (middle << 32) | (lowLow & 0xffffffffull);
+  b = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+/**
+ * @brief
+ * Multiplies and folds both halves of the product together.
+ */
+static inline uint64 multiply_mix(uint64 a, uint64 b) {
+  multiply(a, b);
+  return a ^ b;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+CharacterSet::CharacterSet() {
+  clear();
+}
+
+CharacterSet::CharacterSet(const char* chars, sizeT count) {
+  clear();
+  add(chars, count);
+}
+
+void CharacterSet::clear() {
+  memset(mBits, 0, sizeof(mBits));
+  mNumChars = 0;
+}
+
+void CharacterSet::add(char c) {
+  if (!contains(c)) {
+    const uint8 index = static_cast<uint8>(c);
+    mBits[index >> 6] |= uint64(1) << (index & 63);
+    if (mNumChars < MaxVectorChars) {
+      mChars[mNumChars] = c;
+    }
+    ++mNumChars;
+  }
+}
+
+void CharacterSet::add(const char* chars, sizeT count) {
+  for (sizeT i = 0; i < count; ++i) {
+    add(chars[i]);
+  }
+}
+
+const char* string_find_first_of(const char* first, const char* last, const CharacterSet& set) {
+  return find_in_set(first, last, set, true);
+}
+
+const char* string_find_first_not_of(const char* first, const char* last, const CharacterSet& set) {
+  return find_in_set(first, last, set, false);
+}
+
+sizeT string_count_char(const char* first, const char* last, char c) {
+  sizeT count = 0;
+#if defined(BE_STRING_SIMD)
+  const SimdBlock::Type character = SimdBlock::splat(c);
+  while (first + SimdBlock::Size <= last) {
+    count += static_cast<sizeT>(__builtin_popcountll(SimdBlock::to_bits(SimdBlock::equal(SimdBlock::load(first), character)))) / SimdBlock::BitsPerByte;
+    first += SimdBlock::Size;
+  }
+#endif
+  for (; first != last; ++first) {
+    count += (*first == c);
+  }
+  return count;
+}
+
+const char* string_rfind_char(const char* first, const char* last, char c) {
+#if defined(LINUX)
+  return static_cast<const char*>(memrchr(first, c, static_cast<size_t>(last - first)));
+#else
+  while (last != first) {
+    if (*--last == c) {
+      return last;
+    }
+  }
+  return nullptr;
+#endif
+}
+
+const char* string_search(const char* first, const char* last, const char* patternFirst, const char* patternLast) {
+  const sizeT patternSize = static_cast<sizeT>(patternLast - patternFirst);
+  if (patternSize == 0) {
+    return first;
+  }
+  if (patternSize > static_cast<sizeT>(last - first)) {
+    return last;
+  }
+  if (patternSize == 1) {
+    const char* result = static_cast<const char*>(memchr(first, *patternFirst, static_cast<size_t>(last - first)));
+    return (result != nullptr) ? result : last;
+  }
+
+  const char* position = first;
+#if defined(BE_STRING_SIMD)
+  // Candidates have to match the first and the last character of the pattern, which rules out
+  // almost every position with two compares per block
+  const SimdBlock::Type firstChar = SimdBlock::splat(patternFirst[0]);
+  const SimdBlock::Type lastChar = SimdBlock::splat(patternLast[-1]);
+  while (position + patternSize - 1 + SimdBlock::Size <= last) {
+    uint64 bits = SimdBlock::to_bits(SimdBlock::bit_and(SimdBlock::equal(SimdBlock::load(position), firstChar),
+                                                        SimdBlock::equal(SimdBlock::load(position + patternSize - 1), lastChar)));
+    while (bits != 0) {
+      const uint32 index = first_byte(bits);
+      if (memcmp(position + index + 1, patternFirst + 1, patternSize - 2) == 0) {
+        return position + index;
+      }
+      bits &= ~(ByteBits << (index * SimdBlock::BitsPerByte));
+    }
+    position += SimdBlock::Size;
+  }
+#endif
+
+  for (; position + patternSize <= last; ++position) {
+    if (*position == *patternFirst && memcmp(position + 1, patternFirst + 1, patternSize - 1) == 0) {
+      return position;
+    }
+  }
+  return last;
+}
+
+int string_compare(const char* p1, const char* p2, sizeT n) {
+  const int result = memcmp(p1, p2, n);
+  return (result < 0) ? -1 : (result > 0) ? 1 : 0;
+}
+
+int string_compare_i(const char* p1, const char* p2, sizeT n) {
+  sizeT i = 0;
+#if defined(BE_STRING_SIMD)
+  for (; i + SimdBlock::Size <= n; i += SimdBlock::Size) {
+    const SimdBlock::Type a = switch_case(SimdBlock::load(p1 + i), 'A');
+    const SimdBlock::Type b = switch_case(SimdBlock::load(p2 + i), 'A');
+    if (SimdBlock::to_bits(SimdBlock::equal(a, b)) != FullBits) {
+      // The scalar loop below finds the difference within this block
+      break;
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    const char c1 = ascii_to_lower(p1[i]);
+    const char c2 = ascii_to_lower(p2[i]);
+    if (c1 != c2) {
+      return compare_result(c1, c2);
+    }
+  }
+  return 0;
+}
+
+void string_to_lower(char* p, sizeT n) {
+  switch_case(p, n, 'A');
+}
+
+void string_to_upper(char* p, sizeT n) {
+  switch_case(p, n, 'a');
+}
+
+uint64 string_hash(const void* data, sizeT size, uint64 seed) {
+  const uint8* p = static_cast<const uint8*>(data);
+  seed ^= multiply_mix(seed ^ HashSecret0, HashSecret1);
+
+  uint64 a = 0;
+  uint64 b = 0;
+  if (size <= 16) {
+    if (size >= 4) {
+      // Two overlapping pairs of 32 bit reads cover 4 to 16 bytes
+      const sizeT offset = (size >> 3) << 2;
+      a = (read32(p) << 32) | read32(p + offset);
+      b = (read32(p + size - 4) << 32) | read32(p + size - 4 - offset);
+    } else if (size > 0) {
+      a = (uint64(p[0]) << 16) | (uint64(p[size >> 1]) << 8) | p[size - 1];
+    }
+  } else {
+    sizeT remaining = size;
+    if (remaining > 48) {
+      // Three independent lanes keep the multipliers busy
+      uint64 seed1 = seed;
+      uint64 seed2 = seed;
+      do {
+        seed = multiply_mix(read64(p) ^ HashSecret1, read64(p + 8) ^ seed);
+        seed1 = multiply_mix(read64(p + 16) ^ HashSecret2, read64(p + 24) ^ seed1);
+        seed2 = multiply_mix(read64(p + 32) ^ HashSecret3, read64(p + 40) ^ seed2);
+        p += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (remaining > 16) {
+      seed = multiply_mix(read64(p) ^ HashSecret1, read64(p + 8) ^ seed);
+      p += 16;
+      remaining -= 16;
+    }
+    a = read64(p + remaining - 16);
+    b = read64(p + remaining - 8);
+  }
+
+  a ^= HashSecret1;
+  b ^= seed;
+  multiply(a, b);
+  return multiply_mix(a ^ HashSecret0 ^ size, b ^ HashSecret1);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/string/view_tokenizer.h"
+#include "core/io/stream.h"
+#include "core/string/number_conversion.h"
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Reads the whole token as number.
+ */
+template<typename TValue>
+static bool parse_token_number(StringView token, TValue& value) {
+  const char* last = token.data() + token.size();
+  return !token.empty() && from_chars(token.data(), last, value) == last;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+ViewTokenizer::ViewTokenizer()
+: mDelimiters(" \t\r\n")
+, mSingleChars("{}()[]<*>/=,;\"")
+, mQuotes("\"\'")
+, mCommentStartTag("/*")
+, mCommentEndTag("*/")
+, mSingleLineComment("//")
+, mCaseSensitive(false)
+, mText("")
+, mSize(0) {
+  update_character_sets();
+  stop();
+}
+
+ViewTokenizer::~ViewTokenizer() {
+  stop();
+}
+
+void ViewTokenizer::set_delimiters(const String& delimiters) {
+  mDelimiters = delimiters;
+  update_character_sets();
+}
+
+void ViewTokenizer::set_single_chars(const String& singleChars) {
+  mSingleChars = singleChars;
+  update_character_sets();
+}
+
+void ViewTokenizer::set_quotes(const String& quotes) {
+  mQuotes = quotes;
+  update_character_sets();
+}
+
+void ViewTokenizer::set_comment_start_tag(const String& commentStartTag) {
+  mCommentStartTag = commentStartTag;
+  update_character_sets();
+}
+
+void ViewTokenizer::set_comment_end_tag(const String& commentEndTag) {
+  mCommentEndTag = commentEndTag;
+}
+
+void ViewTokenizer::set_single_line_comment(const String& singleLineComment) {
+  mSingleLineComment = singleLineComment;
+  update_character_sets();
+}
+
+void ViewTokenizer::start(StringView text) {
+  stop();
+  mText = text.data();
+  mSize = text.size();
+}
+
+bool ViewTokenizer::start_mapped(const Ptr<Stream>& stream) {
+  stop();
+  if (!stream) {
+    return false;
+  }
+
+  const void* data = stream->map();
+  if (data == nullptr) {
+    stream->unmap();
+    return false;
+  }
+  mStream = stream;
+  mText = static_cast<const char*>(data);
+  mSize = stream->get_size();
+  return true;
+}
+
+void ViewTokenizer::stop() {
+  if (mStream) {
+    mStream->unmap();
+    mStream = nullptr;
+  }
+  mText = "";
+  mSize = 0;
+  mState = State{0, 0, 1, EParseMode::EatGarbage, '\0', StringView(), 1, 1};
+  mStateStack.clear();
+}
+
+Vector<StringView> ViewTokenizer::get_tokens() {
+  Vector<StringView> tokens;
+  StringView token = get_next_token();
+  while (!token.empty()) {
+    tokens.push_back(token);
+    token = get_next_token();
+  }
+  return tokens;
+}
+
+StringView ViewTokenizer::get_next_token() {
+  mState.Token = StringView();
+
+  // Quoted strings come as opening quote, content and closing quote
+  if (mState.Mode == EParseMode::ReadQuoteInside) {
+    const sizeT position = mState.Position;
+    const char* end = static_cast<const char*>(memchr(mText + position, mState.Quote, mSize - position));
+    const sizeT endPosition = end ? static_cast<sizeT>(end - mText) : mSize;
+    mState.Mode = end ? EParseMode::ReadQuoteEnd : EParseMode::EatGarbage;
+    if (endPosition > position) {
+      set_token(position, endPosition - position);
+      advance(endPosition);
+      return mState.Token;
+    }
+  }
+  if (mState.Mode == EParseMode::ReadQuoteEnd) {
+    mState.Mode = EParseMode::EatGarbage;
+    set_token(mState.Position, 1);
+    advance(mState.Position + 1);
+    return mState.Token;
+  }
+
+  const char* last = mText + mSize;
+  while (mState.Position < mSize) {
+    // Runs of delimiters, including line breaks, are skipped a block at a time
+    const sizeT position = static_cast<sizeT>(string_find_first_not_of(mText + mState.Position, last, mSkipSet) - mText);
+    advance(position);
+    if (position == mSize) {
+      break;
+    }
+
+    const char c = mText[position];
+    if (skip_comment()) {
+      continue;
+    } else if (mQuoteSet.contains(c)) {
+      mState.Quote = c;
+      mState.Mode = EParseMode::ReadQuoteInside;
+      set_token(position, 1);
+      advance(position + 1);
+      return mState.Token;
+    } else if (mDelimiterSet.contains(c)) {
+      advance(position + 1);
+    } else if (mSingleCharSet.contains(c)) {
+      set_token(position, 1);
+      advance(position + 1);
+      return mState.Token;
+    } else {
+      // Read the word up to the next character which may end it
+      sizeT end = position + 1;
+      for (;;) {
+        end = static_cast<sizeT>(string_find_first_of(mText + end, last, mWordEndSet) - mText);
+        if (end == mSize || is_word_end(end)) {
+          break;
+        }
+        ++end;
+      }
+      set_token(position, end - position);
+      advance(end);
+      return mState.Token;
+    }
+  }
+
+  return mState.Token;
+}
+
+bool ViewTokenizer::expect_token(StringView expected) {
+  push_state();
+  if (get_next_token().empty() || !compare_token(expected)) {
+    pop_state();
+    return false;
+  }
+  drop_state();
+  return true;
+}
+
+bool ViewTokenizer::find_token(StringView expected) {
+  if (!expected.empty()) {
+    push_state();
+    while (!get_next_token().empty()) {
+      if (compare_token(expected)) {
+        pop_state();
+        return true;
+      }
+      drop_state();
+      push_state();
+    }
+    drop_state();
+  }
+  return false;
+}
+
+bool ViewTokenizer::compare_token(StringView expected) const {
+  if (mState.Token.size() != expected.size()) {
+    return false;
+  }
+  return mCaseSensitive ? (string_compare(mState.Token.data(), expected.data(), expected.size()) == 0)
+                        : (string_compare_i(mState.Token.data(), expected.data(), expected.size()) == 0);
+}
+
+bool ViewTokenizer::parse_number(int32& number) {
+  push_state();
+  if (parse_token_number(get_next_token(), number)) {
+    drop_state();
+    return true;
+  }
+  pop_state();
+  return false;
+}
+
+bool ViewTokenizer::parse_number(float& number) {
+  push_state();
+  if (parse_token_number(get_next_token(), number)) {
+    drop_state();
+    return true;
+  }
+  pop_state();
+  return false;
+}
+
+bool ViewTokenizer::parse_number(double& number) {
+  push_state();
+  if (parse_token_number(get_next_token(), number)) {
+    drop_state();
+    return true;
+  }
+  pop_state();
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+void ViewTokenizer::update_character_sets() {
+  mDelimiterSet = CharacterSet(mDelimiters.data(), mDelimiters.size());
+  mSingleCharSet = CharacterSet(mSingleChars.data(), mSingleChars.size());
+  mQuoteSet = CharacterSet(mQuotes.data(), mQuotes.size());
+
+  // Comments and quotes are checked before delimiters, their first characters can't be skipped blindly
+  CharacterSet commentSet;
+  if (!mCommentStartTag.empty()) {
+    commentSet.add(mCommentStartTag[0]);
+  }
+  if (!mSingleLineComment.empty()) {
+    commentSet.add(mSingleLineComment[0]);
+  }
+  mSkipSet.clear();
+  for (sizeT i = 0; i < mDelimiters.size(); ++i) {
+    if (!mQuoteSet.contains(mDelimiters[i]) && !commentSet.contains(mDelimiters[i])) {
+      mSkipSet.add(mDelimiters[i]);
+    }
+  }
+
+  mWordEndSet = mDelimiterSet;
+  mWordEndSet.add(mSingleChars.data(), mSingleChars.size());
+  mWordEndSet.add(mQuotes.data(), mQuotes.size());
+  if (!mCommentStartTag.empty()) {
+    mWordEndSet.add(mCommentStartTag[0]);
+  }
+  if (!mSingleLineComment.empty()) {
+    mWordEndSet.add(mSingleLineComment[0]);
+  }
+}
+
+void ViewTokenizer::advance(sizeT position) {
+  const char* first = mText + mState.Position;
+  const char* last = mText + position;
+  const sizeT numLines = string_count_char(first, last, '\n');
+  if (numLines > 0) {
+    mState.Line += static_cast<uint32>(numLines);
+    mState.LineStart = static_cast<sizeT>(string_rfind_char(first, last, '\n') - mText) + 1;
+  }
+  mState.Position = position;
+}
+
+StringView ViewTokenizer::set_token(sizeT position, sizeT size) {
+  mState.Token = StringView(mText + position, size);
+  mState.TokenLine = mState.Line;
+  mState.TokenColumn = static_cast<uint32>(position - mState.LineStart) + 1;
+  return mState.Token;
+}
+
+bool ViewTokenizer::is_word_end(sizeT position) const {
+  const char c = mText[position];
+  return mDelimiterSet.contains(c) || mSingleCharSet.contains(c) || mQuoteSet.contains(c) ||
+         is_tag_at(position, mCommentStartTag) || is_tag_at(position, mSingleLineComment);
+}
+
+bool ViewTokenizer::skip_comment() {
+  const sizeT position = mState.Position;
+  const char* last = mText + mSize;
+  if (is_tag_at(position, mCommentStartTag)) {
+    const char* end = string_search(mText + position + mCommentStartTag.size(), last, mCommentEndTag.data(), mCommentEndTag.data() + mCommentEndTag.size());
+    advance((end == last) ? mSize : static_cast<sizeT>(end - mText) + mCommentEndTag.size());
+    return true;
+  } else if (is_tag_at(position, mSingleLineComment)) {
+    const sizeT start = position + mSingleLineComment.size();
+    const char* end = static_cast<const char*>(memchr(mText + start, '\n', mSize - start));
+    advance(end ? static_cast<sizeT>(end - mText) + 1 : mSize);
+    return true;
+  }
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -23,6 +23,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/tools/compression_lz4.h"
+#include <lz4.h>
 #include <lz4hc.h>
 
 
@@ -32,21 +33,40 @@
 namespace core {
 
 
+CompressionLZ4::CompressionLZ4(bool highCompression, int32 level)
+: mHighCompression(highCompression)
+, mLevel(level) {
+  // Zero selects the default of the mode
+  if (mLevel <= 0) {
+    mLevel = mHighCompression ? DefaultHighCompressionLevel : DefaultAcceleration;
+  }
+}
+
 core::sizeT CompressionLZ4::compress(core::uint8 *dst, const core::uint8 *src, core::sizeT srcSize, core::sizeT dstCapacity) const {
-  return LZ4_compress_HC(
-    reinterpret_cast<const char*>(src),
-    reinterpret_cast<char *>(dst),
-    static_cast<int>(srcSize),
-    dstCapacity,
-    LZ4HC_CLEVEL_MAX);
+  const int result = mHighCompression ?
+    LZ4_compress_HC(
+      reinterpret_cast<const char*>(src),
+      reinterpret_cast<char *>(dst),
+      static_cast<int>(srcSize),
+      static_cast<int>(dstCapacity),
+      mLevel) :
+    LZ4_compress_fast(
+      reinterpret_cast<const char*>(src),
+      reinterpret_cast<char *>(dst),
+      static_cast<int>(srcSize),
+      static_cast<int>(dstCapacity),
+      mLevel);
+  return (result > 0) ? static_cast<core::sizeT>(result) : 0;
 }
 
 core::sizeT CompressionLZ4::decompress(core::uint8 *dst, const core::uint8 *src, core::sizeT srcSize, core::sizeT dstSize) const {
-  return LZ4_decompress_safe(
+  // Negative results are errors, don't let them wrap around into huge sizes
+  const int result = LZ4_decompress_safe(
     reinterpret_cast<const char*>(src),
     reinterpret_cast<char*>(dst),
     static_cast<int>(srcSize),
-    static_cast<int>(dstSize));;
+    static_cast<int>(dstSize));
+  return (result > 0) ? static_cast<core::sizeT>(result) : 0;
 }
 
 core::sizeT CompressionLZ4::compress_bound(core::uint32 srcSize) const {
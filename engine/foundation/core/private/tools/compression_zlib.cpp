@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/tools/compression_zlib.h"
+#include <zlib.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+CompressionZlib::CompressionZlib(int32 level)
+: mLevel(level) {
+  if (mLevel <= 0) {
+    mLevel = DefaultLevel;
+  } else if (mLevel > Z_BEST_COMPRESSION) {
+    mLevel = Z_BEST_COMPRESSION;
+  }
+}
+
+core::sizeT CompressionZlib::compress(core::uint8 *dst, const core::uint8 *src, core::sizeT srcSize, core::sizeT dstCapacity) const {
+  uLongf numberOfCompressedBytes = static_cast<uLongf>(dstCapacity);
+  if (compress2(dst, &numberOfCompressedBytes, src, static_cast<uLong>(srcSize), mLevel) != Z_OK) {
+    return 0;
+  }
+  return static_cast<core::sizeT>(numberOfCompressedBytes);
+}
+
+core::sizeT CompressionZlib::decompress(core::uint8 *dst, const core::uint8 *src, core::sizeT srcSize, core::sizeT dstSize) const {
+  uLongf numberOfDecompressedBytes = static_cast<uLongf>(dstSize);
+  if (uncompress(dst, &numberOfDecompressedBytes, src, static_cast<uLong>(srcSize)) != Z_OK) {
+    return 0;
+  }
+  return static_cast<core::sizeT>(numberOfDecompressedBytes);
+}
+
+core::sizeT CompressionZlib::compress_bound(core::uint32 srcSize) const {
+  return static_cast<core::sizeT>(compressBound(srcSize));
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/utility/byte_swap.h"
+#include <cstring>
+#if defined(__SSSE3__)
+  #include <tmmintrin.h>
+  #define BE_BYTE_SWAP_SIMD
+#elif defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define BE_BYTE_SWAP_SIMD
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define BE_BYTE_SWAP_SIMD
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Swaps whole 16 byte blocks of elements, returns the number of processed bytes.
+ */
+template<uint32 ElementSize>
+static uint64 swap_blocks(uint8* destination, const uint8* source, uint64 numberOfBytes) {
+#if defined(BE_BYTE_SWAP_SIMD)
+  const uint64 numberOfBlockBytes = numberOfBytes & ~static_cast<uint64>(15);
+#else
+  const uint64 numberOfBlockBytes = 0;
+#endif
+#if defined(__SSSE3__)
+  const __m128i mask = (2 == ElementSize) ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14) :
+                       (4 == ElementSize) ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12) :
+                                            _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  for (uint64 i = 0; i < numberOfBlockBytes; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_shuffle_epi8(block, mask));
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  for (uint64 i = 0; i < numberOfBlockBytes; i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    // Reverse the 16 bit words inside each element first, then the bytes inside each word
+    if (4 == ElementSize) {
+      block = _mm_shufflehi_epi16(_mm_shufflelo_epi16(block, 0xB1), 0xB1);
+    } else if (8 == ElementSize) {
+      block = _mm_shufflehi_epi16(_mm_shufflelo_epi16(block, 0x1B), 0x1B);
+    }
+    block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), block);
+  }
+#elif defined(__ARM_NEON)
+  for (uint64 i = 0; i < numberOfBlockBytes; i += 16) {
+    const uint8x16_t block = vld1q_u8(source + i);
+    vst1q_u8(destination + i, (2 == ElementSize) ? vrev16q_u8(block) : (4 == ElementSize) ? vrev32q_u8(block) : vrev64q_u8(block));
+  }
+#endif
+  return numberOfBlockBytes;
+}
+
+/**
+ * @brief
+ * Swaps all elements of the given size, blocks first and the remaining elements one by one.
+ */
+template<uint32 ElementSize>
+static void swap_elements(uint8* destination, const uint8* source, uint64 numberOfElements) {
+  const uint64 numberOfBytes = numberOfElements * ElementSize;
+  for (uint64 i = swap_blocks<ElementSize>(destination, source, numberOfBytes); i < numberOfBytes; i += ElementSize) {
+    if (2 == ElementSize) {
+      uint16 value;
+      memcpy(&value, source + i, sizeof(value));
+      value = ByteSwap::swap16(value);
+      memcpy(destination + i, &value, sizeof(value));
+    } else if (4 == ElementSize) {
+      uint32 value;
+      memcpy(&value, source + i, sizeof(value));
+      value = ByteSwap::swap32(value);
+      memcpy(destination + i, &value, sizeof(value));
+    } else {
+      uint64 value;
+      memcpy(&value, source + i, sizeof(value));
+      value = ByteSwap::swap64(value);
+      memcpy(destination + i, &value, sizeof(value));
+    }
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+void ByteSwap::swap_array(void* data, uint64 numberOfElements, uint32 elementSize) {
+  copy_swapped(data, data, numberOfElements, elementSize);
+}
+
+void ByteSwap::copy_swapped(void* destination, const void* source, uint64 numberOfElements, uint32 elementSize) {
+  uint8* destinationBytes = static_cast<uint8*>(destination);
+  const uint8* sourceBytes = static_cast<const uint8*>(source);
+  switch (elementSize) {
+    case 2:
+      swap_elements<2>(destinationBytes, sourceBytes, numberOfElements);
+      break;
+
+    case 4:
+      swap_elements<4>(destinationBytes, sourceBytes, numberOfElements);
+      break;
+
+    case 8:
+      swap_elements<8>(destinationBytes, sourceBytes, numberOfElements);
+      break;
+
+    default:
+      if (destination != source) {
+        memcpy(destination, source, numberOfElements * elementSize);
+      }
+      break;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
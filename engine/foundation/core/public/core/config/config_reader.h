@@ -62,7 +62,33 @@ public:
   ~ConfigReader();
 
 
-  [[nodiscard]] bool read(const String& configFilename, Config& config);
+  /**
+   * @brief
+   * Reads the config from the given file.
+   *
+   * @param[in] configFilename
+   * The config file name
+   * @param[out] config
+   * Receives the config
+   * @param[in] useBinaryCache
+   * If 'true', a binary copy next to the file is used when it is newer than the file, and
+   * rewritten otherwise, see get_binary_cache_filename()
+   *
+   * @return
+   * 'true' if everything went fine, 'false' otherwise
+   */
+  [[nodiscard]] bool read(const String& configFilename, Config& config, bool useBinaryCache = false);
+
+  /**
+   * @brief
+   * Returns the name of the binary cache belonging to a config file.
+   */
+  [[nodiscard]] static String get_binary_cache_filename(const String& configFilename);
+
+private:
+  bool read_binary_cache(const String& configFilename, Config& config) const;
+
+  void write_binary_cache(const String& configFilename, const Config& config) const;
 
 
 private:
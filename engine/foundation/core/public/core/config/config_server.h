@@ -81,6 +81,18 @@ public:
    */
   [[nodiscard]] bool read(const String& configFilename);
 
+  /**
+   * @brief
+   * Sets whether read() uses a binary copy of the config file.
+   *
+   * @param[in] useBinaryCache
+   * If 'true', the config is loaded from a binary copy next to the text file as long as it is up
+   * to date, which avoids tokenizing the text; outdated or missing copies are rewritten
+   */
+  void set_use_binary_cache(bool useBinaryCache);
+
+  [[nodiscard]] bool get_use_binary_cache() const;
+
   /**
    * @brief
    * Writes the config back to the given file path.
@@ -115,6 +127,8 @@ public:
 private:
   /** Pointer to single config implementation */
  Config* mConfig;
+  /** Whether read() uses the binary cache */
+  bool mUseBinaryCache;
 };
 
 
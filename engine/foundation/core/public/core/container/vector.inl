@@ -58,10 +58,12 @@ Vector<TType, TAllocator>::Vector(const Vector<TType, TAllocator>& rhs)
 
 template<typename TType, typename TAllocator>
 Vector<TType, TAllocator>::Vector(Vector<TType, TAllocator>&& rhs)
-: mBuffer(nullptr)
-, mSize(0)
-, mCapacity(0)  {
-
+: mBuffer(rhs.mBuffer)
+, mSize(rhs.mSize)
+, mCapacity(rhs.mCapacity)  {
+  rhs.mBuffer = nullptr;
+  rhs.mSize = 0;
+  rhs.mCapacity = 0;
 }
 
 template<typename TType, typename TAllocator>
@@ -591,7 +593,7 @@ void Vector<TType, TAllocator>::ensure_buffer_size(core::uint32 newSize) {
     // Also take current capacity in consideration for calculating new capacity
     core::uint32 newCapacity = capacity() != 0 ? capacity() : 1;
     while (newSize > newCapacity) {
-      newCapacity += std::ceil(mCapacity * 0.5f);
+      newCapacity += static_cast<core::uint32>(std::ceil(newCapacity * 0.5f));
     }
     resize_buffer_internal(newCapacity);
   }
@@ -241,6 +241,8 @@ private:
   Map<String, Device*> mMapDevices;
   /** List of all controls that needs an update */
   Vector<Control*> mUpdatedControls;
+  /** List of controls which are informed during the current update, kept to not allocate each update */
+  Vector<Control*> mInformedControls;
   /** Pointer to mutex */
   Mutex* mMutex;
 };
@@ -0,0 +1,394 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/core/ptr.h"
+#include "core/core/refcounted.h"
+#include "core/container/vector.h"
+#include "core/platform/condition_variable.h"
+#include "core/platform/mutex.h"
+#include "core/std/atomic.h"
+#include "core/string/string.h"
+#include <functional>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class AsyncFileRead;
+class LinuxIoUring;
+class Thread;
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+/** Called once a read is done, on the thread which finished it */
+typedef std::function<void(AsyncFileRead&)> AsyncReadCallback;
+
+
+//[-------------------------------------------------------]
+//[ Enumerations                                          ]
+//[-------------------------------------------------------]
+enum class EAsyncIoBackend {
+  /** Not started */
+  None,
+  /** Linux io_uring, a single thread keeps many reads in flight */
+  IoUring,
+  /** Worker threads doing blocking pread */
+  ThreadPool
+};
+
+enum class EAsyncIoPriority : uint8 {
+  Low,
+  Normal,
+  High,
+  /** Number of priorities, not a priority */
+  Count
+};
+
+enum class EAsyncIoStatus : uint8 {
+  /** Queued, can still be cancelled */
+  Pending,
+  /** Handed to the backend */
+  InFlight,
+  /** Done, see AsyncFileRead::get_number_of_read_bytes() */
+  Completed,
+  /** Done, see AsyncFileRead::get_error() */
+  Failed,
+  /** Cancelled before it was started */
+  Cancelled
+};
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * AsyncReadRequest
+ *
+ * @brief
+ * Describes a single read into a caller-provided buffer.
+ */
+struct AsyncReadRequest {
+  String filename;                                     ///< Native filename, see IoServer::read_async() for mount point resolution
+  void* buffer = nullptr;                              ///< Destination, must stay valid until the read is done
+  uint64 offset = 0;                                   ///< File offset to start reading at
+  uint64 numberOfBytes = 0;                            ///< Number of bytes to read, reads stop early at the end of the file
+  EAsyncIoPriority priority = EAsyncIoPriority::Normal; ///< Higher priorities are started first, reads of the same priority in order
+  AsyncReadCallback callback;                          ///< Optional completion callback
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * AsyncFileRead
+ *
+ * @brief
+ * Handle of a queued read, acts as future for its result.
+ */
+class AsyncFileRead : public RefCounted {
+
+  friend class AsyncFileIo;
+
+public:
+
+  [[nodiscard]] inline const AsyncReadRequest& get_request() const;
+
+  [[nodiscard]] inline EAsyncIoStatus get_status() const;
+
+  /**
+   * @brief
+   * Returns whether the read has completed, failed or has been cancelled.
+   */
+  [[nodiscard]] inline bool is_done() const;
+
+  /**
+   * @brief
+   * Returns the number of bytes written into the buffer, only valid once the read is done.
+   */
+  [[nodiscard]] inline uint64 get_number_of_read_bytes() const;
+
+  /**
+   * @brief
+   * Returns the errno value of a failed read, 0 otherwise.
+   */
+  [[nodiscard]] inline int32 get_error() const;
+
+  /**
+   * @brief
+   * Blocks until the read is done.
+   *
+   * @return
+   * The final status
+   */
+  EAsyncIoStatus wait();
+
+  /**
+   * @brief
+   * Cancels the read if it hasn't been started yet, see AsyncFileIo::cancel().
+   */
+  bool cancel();
+
+private:
+
+  explicit AsyncFileRead(const AsyncReadRequest& request);
+
+  ~AsyncFileRead() override = default;
+
+private:
+
+  AsyncReadRequest mRequest;
+  atomic<EAsyncIoStatus> mStatus;
+  uint64 mNumberOfReadBytes;
+  int32 mError;
+  int mFileDescriptor;
+  /** Set under the AsyncFileIo lock once the callback returned */
+  bool mIsFinished;
+};
+
+/**
+ * @class
+ * AsyncFileIo
+ *
+ * @brief
+ * Asynchronous batched file reads.
+ *
+ * Requests are queued per priority and started by the backend. By default a pool of worker threads
+ * does blocking pread, which does best for the typical load of many small, cached files. On Linux an
+ * io_uring backend keeping up to QueueDepth reads in flight from a single thread can be requested
+ * explicitly; if io_uring isn't available (old kernel, seccomp filtered container, other platform)
+ * the thread pool takes over transparently.
+ *
+ * AsyncFileIo is a singleton class, so you can use the instance() method to access it.
+ *
+ * @note
+ * - Queueing, cancelling and waiting are thread-safe
+ * - Completion callbacks are called on the I/O threads and should be short
+ */
+class AsyncFileIo : public NonCopyable {
+public:
+
+  /** Maximum number of reads kept in flight by the io_uring backend */
+  static constexpr uint32 QueueDepth = 256;
+  /** Number of worker threads of the thread pool backend */
+  static constexpr uint32 DefaultNumberOfThreads = 4;
+
+public:
+
+  /**
+   * @brief
+   * Retrieves the instance of the AsyncFileIo.
+   *
+   * @return
+   * The AsyncFileIo instance.
+   */
+  static AsyncFileIo& instance();
+
+public:
+
+  /**
+   * @brief
+   * Starts the I/O threads.
+   *
+   * @param[in] backend
+   * Backend to use, io_uring is only used when asked for and falls back to the thread pool if it's unavailable
+   * @param[in] numberOfThreads
+   * Number of worker threads of the thread pool backend
+   *
+   * @return
+   * 'true' if all went fine, else 'false'
+   */
+  bool start(EAsyncIoBackend backend = EAsyncIoBackend::ThreadPool, uint32 numberOfThreads = DefaultNumberOfThreads);
+
+  /**
+   * @brief
+   * Cancels all pending reads, waits for the reads in flight and stops the I/O threads.
+   */
+  void stop();
+
+  /**
+   * @brief
+   * Returns whether or not the I/O threads are running.
+   */
+  [[nodiscard]] inline bool is_running() const;
+
+  /**
+   * @brief
+   * Returns the backend in use.
+   */
+  [[nodiscard]] inline EAsyncIoBackend get_backend() const;
+
+  /**
+   * @brief
+   * Queues a single read.
+   *
+   * @param[in] request
+   * Read to queue
+   *
+   * @return
+   * Handle of the read
+   */
+  Ptr<AsyncFileRead> read(const AsyncReadRequest& request);
+
+  /**
+   * @brief
+   * Queues many reads at once, taking the queue lock and waking the I/O threads only once.
+   *
+   * @param[in] requests
+   * Reads to queue
+   * @param[in] numberOfRequests
+   * Number of reads
+   * @param[out] reads
+   * Receives the handles of the reads, appended in request order
+   */
+  void read(const AsyncReadRequest* requests, uint32 numberOfRequests, Vector<Ptr<AsyncFileRead>>& reads);
+
+  /**
+   * @brief
+   * Fails a read without starting it, its callback is called on this thread.
+   *
+   * @param[in] request
+   * Read that can't be done
+   * @param[in] error
+   * The errno value reported by AsyncFileRead::get_error()
+   *
+   * @return
+   * Handle of the read, already failed
+   */
+  Ptr<AsyncFileRead> fail(const AsyncReadRequest& request, int32 error);
+
+  /**
+   * @brief
+   * Cancels a read which hasn't been started yet, its callback is called on this thread.
+   *
+   * @param[in] read
+   * Read to cancel
+   *
+   * @return
+   * 'true' if the read has been cancelled, 'false' if it's already in flight or done
+   */
+  bool cancel(AsyncFileRead& read);
+
+  /**
+   * @brief
+   * Blocks until the given read is done.
+   */
+  void wait(AsyncFileRead& read);
+
+  /**
+   * @brief
+   * Blocks until all queued reads are done.
+   */
+  void wait_all();
+
+  /**
+   * @brief
+   * Returns the number of queued and in flight reads.
+   */
+  [[nodiscard]] uint32 get_num_outstanding() const;
+
+private:
+
+  /**
+   * @struct
+   * PendingQueue
+   *
+   * @brief
+   * First in, first out queue of reads of one priority.
+   */
+  struct PendingQueue {
+    Vector<AsyncFileRead*> reads; ///< Queued reads, a reference is held for each
+    uint32 head = 0;              ///< Index of the oldest read
+  };
+
+private:
+
+  AsyncFileIo();
+
+  ~AsyncFileIo();
+
+  void enqueue(AsyncFileRead& read);
+
+  [[nodiscard]] bool has_pending() const;
+
+  AsyncFileRead* pop_pending();
+
+  void finish(AsyncFileRead& read, EAsyncIoStatus status);
+
+  static void execute_read(AsyncFileRead& read);
+
+  static int run_worker_thread(void* data);
+
+  void run_worker();
+
+  static int run_ring_thread(void* data);
+
+  void run_ring();
+
+  bool start_ring_read(AsyncFileRead& read);
+
+  static void close_file(AsyncFileRead& read);
+
+private:
+
+  atomic<bool> mRunning;
+  EAsyncIoBackend mBackend;
+  mutable Mutex mMutex;
+  ConditionVariable mWorkCondition;
+  ConditionVariable mDoneCondition;
+  PendingQueue mPending[static_cast<uint32>(EAsyncIoPriority::Count)];
+  uint32 mNumOutstanding;
+  Vector<Thread*> mThreads;
+  LinuxIoUring* mRing;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/async_file_io.inl"
@@ -30,6 +30,7 @@
 //[-------------------------------------------------------]
 #include "core/core.h"
 #include "core/io/stream_reader.h"
+#include "core/io/types.h"
 
 
 //[-------------------------------------------------------]
@@ -51,6 +52,12 @@ namespace core {
  * The `BinaryReader` class provides methods to read basic data types (like `char`, `short`,
  * and `int`) from a stream in a binary format. It supports efficient reading through
  * memory mapping and allows for stream management by opening and closing streams.
+ *
+ * Typed values and whole arrays of trivially copyable types are read with a single copy,
+ * straight out of the mapping when the stream is mapped. Arithmetic and enumeration types
+ * are converted from the configured byte order, other types (e.g. structs) are copied as
+ * they are. Reading past the end never touches memory outside of the data, it sets the
+ * error flag instead and leaves the remaining values zeroed.
  */
 class BinaryReader : public StreamReader {
 public:
@@ -71,13 +78,175 @@ public:
    */
   ~BinaryReader() override;
 
+public:
+  /**
+   * @brief
+   * Enables or disables reading through a memory mapping of the stream.
+   *
+   * @param[in] enable
+   * `true` to map the stream on "open()" when it supports it, must be set before opening.
+   */
+  void set_memory_mapping_enabled(bool enable);
+
+  /**
+   * @brief
+   * Returns whether reading through a memory mapping is enabled.
+   *
+   * @return
+   * `true` if memory mapping is enabled, `false` otherwise.
+   */
+  [[nodiscard]] bool is_memory_mapping_enabled() const;
+
+  /**
+   * @brief
+   * Returns whether the reader currently reads straight from the mapped stream content.
+   *
+   * @return
+   * `true` if the stream is mapped, `false` otherwise.
+   */
+  [[nodiscard]] bool is_mapped() const;
+
+  /**
+   * @brief
+   * Sets the byte order of the data, arithmetic values are converted to the native one while reading.
+   *
+   * @param[in] byteOrder
+   * Byte order of the data, "EByteOrder::Native" by default
+   */
+  void set_byte_order(EByteOrder byteOrder);
+
+  /**
+   * @brief
+   * Returns the byte order of the data.
+   */
+  [[nodiscard]] EByteOrder get_byte_order() const;
+
+  /**
+   * @brief
+   * Returns whether a read ran past the end of the data or the data was malformed.
+   *
+   * @return
+   * `true` if an error occurred since opening, `false` otherwise.
+   */
+  [[nodiscard]] bool has_error() const;
+
+  /**
+   * @brief
+   * Reads raw bytes.
+   *
+   * @param[out] buffer
+   * Receives the bytes
+   * @param[in] numberOfBytes
+   * Number of bytes to read
+   *
+   * @return
+   * Number of read bytes, less than requested sets the error flag
+   */
+  uint64 read_bytes(void* buffer, uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Returns a view of the next bytes of a mapped stream and advances past them, without any copy.
+   *
+   * @param[in] numberOfBytes
+   * Number of bytes to view
+   *
+   * @return
+   * Pointer to the bytes inside of the mapping, valid until the reader is closed; `nullptr` if the
+   * stream isn't mapped or there are not enough bytes left (the latter sets the error flag)
+   */
+  [[nodiscard]] const void* map_bytes(uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Skips bytes.
+   *
+   * @param[in] numberOfBytes
+   * Number of bytes to skip
+   *
+   * @return
+   * `true` if all bytes were skipped, `false` otherwise (sets the error flag)
+   */
+  bool skip(uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Reads a single value of a trivially copyable type.
+   *
+   * @return
+   * The value, zero initialized if it couldn't be read
+   */
+  template<typename T>
+  [[nodiscard]] T read();
+
+  /**
+   * @brief
+   * Reads an array of a trivially copyable type with a single copy.
+   *
+   * @param[out] values
+   * Receives the values
+   * @param[in] numberOfValues
+   * Number of values to read
+   *
+   * @return
+   * Number of completely read values, less than requested sets the error flag
+   */
+  template<typename T>
+  uint64 read_array(T* values, uint64 numberOfValues);
+
+  /**
+   * @brief
+   * Reads an unsigned LEB128 variable length integer.
+   *
+   * @return
+   * The value, 0 if it was truncated or longer than 10 bytes (sets the error flag)
+   */
+  uint64 read_varuint();
+
+  /**
+   * @brief
+   * Reads a zigzag encoded signed LEB128 variable length integer, see "BinaryWriter::write_varint()".
+   *
+   * @return
+   * The value, 0 if it was truncated or malformed (sets the error flag)
+   */
+  int64 read_varint();
+
+  /**
+   * @brief
+   * Reads a single character from the stream.
+   *
+   * @return
+   * The character read from the stream.
+   */
+  char read_char();
+
+  /**
+   * @brief
+   * Reads a short integer (16 bits) from the stream.
+   *
+   * @return
+   * The short integer read from the stream.
+   */
+  short read_short();
+
+  /**
+   * @brief
+   * Reads an integer (32 bits) from the stream.
+   *
+   * @return
+   * The integer read from the stream.
+   */
+  int read_int();
+
 public:
   /**
    * @brief
    * Opens the stream for reading.
    *
-   * This method prepares the stream for reading binary data. It may handle memory mapping
-   * or any other initialization required for the stream.
+   * This method prepares the stream for reading binary data. If memory mapping is enabled and
+   * the stream can be mapped, reads are served from the mapping starting at the current stream
+   * position.
    *
    * @return
    * `true` if the stream was successfully opened, `false` otherwise.
@@ -93,20 +262,50 @@ public:
    */
   void close() override;
 
+private:
+  /**
+   * @brief
+   * Reads an array of values from the mapping or the stream.
+   *
+   * @param[out] values
+   * Receives the values, values which couldn't be read completely are zeroed
+   * @param[in] numberOfValues
+   * Number of values to read
+   * @param[in] valueSize
+   * Size of one value in bytes
+   * @param[in] swap
+   * `true` to reverse the byte order of every value
+   *
+   * @return
+   * Number of completely read values
+   */
+  uint64 read_values(void* values, uint64 numberOfValues, uint32 valueSize, bool swap);
+
 private:
   /** Pointer to the current position in the memory-mapped stream */
   unsigned char* mMapCursor;
   /** Pointer to the end of the memory-mapped stream */
   unsigned char* mMapEnd;
 
+  /** Byte order of the data */
+  EByteOrder mByteOrder;
+
   /** Flag indicating if memory mapping is enabled */
   bool mEnableMapping;
   /** Flag indicating if the stream is currently memory-mapped */
   bool mIsMapped;
+  /** Flag indicating if a read failed since opening */
+  bool mHasError;
 };
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
-}
\ No newline at end of file
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/binary_reader.inl"
\ No newline at end of file
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/utility/byte_swap.h"
+#include <cstring>
+#include <type_traits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+template<typename T>
+T BinaryReader::read() {
+  static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::read: the type must be trivially copyable");
+  T value{};
+  // Fast path for single values which don't need a conversion
+  if (mIsMapped && static_cast<uint64>(mMapEnd - mMapCursor) >= sizeof(T) && (EByteOrder::Native == mByteOrder || !ByteSwap::is_swappable<T>())) {
+    memcpy(&value, mMapCursor, sizeof(T));
+    mMapCursor += sizeof(T);
+  } else {
+    read_values(&value, 1, sizeof(T), EByteOrder::Native != mByteOrder && ByteSwap::is_swappable<T>());
+  }
+  return value;
+}
+
+template<typename T>
+uint64 BinaryReader::read_array(T* values, uint64 numberOfValues) {
+  static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::read_array: the type must be trivially copyable");
+  return read_values(values, numberOfValues, sizeof(T), EByteOrder::Native != mByteOrder && ByteSwap::is_swappable<T>());
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -30,6 +30,7 @@
 //[-------------------------------------------------------]
 #include "core/core.h"
 #include "core/io/stream_writer.h"
+#include "core/io/types.h"
 
 
 //[-------------------------------------------------------]
@@ -51,6 +52,10 @@ namespace core {
  * The `BinaryWriter` class provides methods to write basic data types (like `char`, `short`,
  * and `int`) to a stream in a binary format. It allows you to open and close streams for
  * writing binary data and manage internal memory mapping for efficiency.
+ *
+ * Typed values and whole arrays of trivially copyable types are written with a single call
+ * to the stream. Arithmetic and enumeration types are converted into the configured byte
+ * order through a small stack buffer, other types (e.g. structs) are written as they are.
  */
 class BinaryWriter : public StreamWriter {
 public:
@@ -72,6 +77,72 @@ public:
   ~BinaryWriter() override;
 
 public:
+  /**
+   * @brief
+   * Sets the byte order to write, arithmetic values are converted from the native one while writing.
+   *
+   * @param[in] byteOrder
+   * Byte order of the written data, "EByteOrder::Native" by default
+   */
+  void set_byte_order(EByteOrder byteOrder);
+
+  /**
+   * @brief
+   * Returns the byte order of the written data.
+   */
+  [[nodiscard]] EByteOrder get_byte_order() const;
+
+  /**
+   * @brief
+   * Writes raw bytes.
+   *
+   * @param[in] buffer
+   * Bytes to write
+   * @param[in] numberOfBytes
+   * Number of bytes to write
+   */
+  void write_bytes(const void* buffer, uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Writes a single value of a trivially copyable type.
+   *
+   * @param[in] value
+   * Value to write
+   */
+  template<typename T>
+  void write(const T& value);
+
+  /**
+   * @brief
+   * Writes an array of a trivially copyable type.
+   *
+   * @param[in] values
+   * Values to write
+   * @param[in] numberOfValues
+   * Number of values to write
+   */
+  template<typename T>
+  void write_array(const T* values, uint64 numberOfValues);
+
+  /**
+   * @brief
+   * Writes an unsigned LEB128 variable length integer, 1 byte for values below 128 up to 10 bytes.
+   *
+   * @param[in] value
+   * Value to write
+   */
+  void write_varuint(uint64 value);
+
+  /**
+   * @brief
+   * Writes a signed LEB128 variable length integer, zigzag encoded so small negative values stay short.
+   *
+   * @param[in] value
+   * Value to write
+   */
+  void write_varint(int64 value);
+
   /**
    * @brief
    * Writes a single character to the stream.
@@ -121,12 +192,31 @@ public:
    */
   void close() override;
 
+private:
+  /**
+   * @brief
+   * Writes an array of values to the mapping or the stream.
+   *
+   * @param[in] values
+   * Values to write
+   * @param[in] numberOfValues
+   * Number of values to write
+   * @param[in] valueSize
+   * Size of one value in bytes
+   * @param[in] swap
+   * `true` to reverse the byte order of every value
+   */
+  void write_values(const void* values, uint64 numberOfValues, uint32 valueSize, bool swap);
+
 private:
   /** Pointer to the current position in the memory-mapped stream */
   unsigned char* mMapCursor;
   /** Pointer to the end of the memory-mapped stream */
   unsigned char* mMapEnd;
 
+  /** Byte order of the written data */
+  EByteOrder mByteOrder;
+
   /** Flag indicating if memory mapping is enabled */
   bool mEnableMapping;
   /** Flag indicating if the stream is currently memory-mapped */
@@ -137,4 +227,10 @@ private:
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
-}
\ No newline at end of file
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/binary_writer.inl"
\ No newline at end of file
@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/io/stream.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * ChainedMemoryStream
+ *
+ * @brief
+ * In-memory stream storing its content in a chain of fixed-size segments.
+ *
+ * Unlike `MemoryStream`, growing never reallocates or copies already written data: writes
+ * append into segments of `SegmentSize` bytes which are taken from (and returned to) a
+ * process wide pool, so producing large outputs costs exactly one copy per byte. The
+ * content can be handed on without flattening through "write_to()", which passes all
+ * segments as one gather write to the target stream (`writev` for file streams).
+ *
+ * A contiguous view is only built on demand by "map()" and released again by "unmap()".
+ * Reading and seeking work as with `MemoryStream`, positions map to segments in O(1).
+ */
+class ChainedMemoryStream : public Stream {
+public:
+  /** Number of bytes per segment */
+  static constexpr sizeT SegmentSize = 64 * 1024;
+  /** Number of free segments kept by the pool for later streams */
+  static constexpr uint32 MaxNumberOfPooledSegments = 64;
+
+public:
+  /**
+   * @brief
+   * Default constructor.
+   */
+  ChainedMemoryStream();
+
+  /**
+   * @brief
+   * Destructor.
+   *
+   * Returns the segments to the pool.
+   */
+  ~ChainedMemoryStream() override;
+
+  /**
+   * @brief
+   * Returns the number of segments holding the content.
+   */
+  [[nodiscard]] inline uint32 get_num_segments() const;
+
+  /**
+   * @brief
+   * Returns the content of one segment.
+   *
+   * @param[in] index
+   * Index of the segment, less than "get_num_segments()"
+   * @param[out] numberOfBytes
+   * Receives the number of used bytes of the segment, `SegmentSize` except for the last one
+   *
+   * @return
+   * Pointer to the first byte of the segment, valid until the next write or "clear()"
+   */
+  [[nodiscard]] inline const void* get_segment(uint32 index, sizeT& numberOfBytes) const;
+
+  /**
+   * @brief
+   * Writes the whole content into another stream as one gather write, without flattening it.
+   *
+   * @param[in] stream
+   * Open target stream, written at its current position
+   */
+  void write_to(Stream& stream) const;
+
+  /**
+   * @brief
+   * Removes the content and returns all segments to the pool.
+   */
+  void clear();
+
+public:
+  /**
+   * @brief
+   * Checks if the stream supports reading.
+   *
+   * @return
+   * `true` if the stream is readable, otherwise `false`.
+   */
+  [[nodiscard]] bool can_read() const override;
+
+  /**
+   * @brief
+   * Checks if the stream supports writing.
+   *
+   * @return
+   * `true` if the stream is writable, otherwise `false`.
+   */
+  [[nodiscard]] bool can_write() const override;
+
+  /**
+   * @brief
+   * Checks if the stream supports seeking.
+   *
+   * @return
+   * `true` if the stream supports seeking, otherwise `false`.
+   */
+  [[nodiscard]] bool can_seek() const override;
+
+  /**
+   * @brief
+   * Checks if the stream can be memory-mapped.
+   *
+   * @return
+   * `true`, the content is flattened on demand.
+   */
+  [[nodiscard]] bool can_be_mapped() const override;
+
+  /**
+   * @brief
+   * Retrieves the total size of the stream.
+   *
+   * @return
+   * The size of the stream in bytes.
+   */
+  [[nodiscard]] sizeT get_size() const override;
+
+  /**
+   * @brief
+   * Retrieves the current position in the stream.
+   *
+   * @return
+   * The current position in bytes from the beginning of the stream.
+   */
+  [[nodiscard]] sizeT get_position() const override;
+
+  /**
+   * @brief
+   * Opens the stream, writing starts at the beginning and appending at the end of the content.
+   *
+   * @return
+   * `true` if the stream was successfully opened, otherwise `false`.
+   */
+  bool open() override;
+
+  /**
+   * @brief
+   * Closes the stream, the content stays available for the next "open()".
+   */
+  void close() override;
+
+  /**
+   * @brief
+   * Writes data at the current position, overwriting existing content and appending new segments as needed.
+   *
+   * @param[in] ptr
+   * A pointer to the data to write.
+   *
+   * @param[in] numBytes
+   * The number of bytes to write.
+   */
+  void write(const void* ptr, sizeT numBytes) override;
+
+  /**
+   * @brief
+   * Reads data from the stream.
+   *
+   * @param[out] ptr
+   * A pointer to the buffer to receive the data.
+   *
+   * @param[in] numBytes
+   * The number of bytes to read.
+   *
+   * @return
+   * The actual number of bytes read.
+   */
+  sizeT read(void* ptr, sizeT numBytes) override;
+
+  /**
+   * @brief
+   * Moves the stream position.
+   *
+   * @param[in] offset
+   * The byte offset relative to the position specified by `seek`.
+   *
+   * @param[in] seek
+   * The seek origin.
+   */
+  void seek(sizeT offset, EFileSeek seek) override;
+
+  /**
+   * @brief
+   * Checks if the end of the stream has been reached.
+   *
+   * @return
+   * `true` if the end of the stream is reached, otherwise `false`.
+   */
+  [[nodiscard]] bool eof() const override;
+
+  /**
+   * @brief
+   * Retrieves the content of the stream as a string.
+   *
+   * @return
+   * A string containing the content of the stream.
+   */
+  [[nodiscard]] String get_content_as_string() override;
+
+  /**
+   * @brief
+   * Returns the content as one contiguous block.
+   *
+   * A stream of at most one segment is handed out directly, otherwise the segments are copied
+   * into a contiguous block once which lives until "unmap()".
+   *
+   * @return
+   * A pointer to the content, `nullptr` for an empty stream.
+   */
+  void* map() override;
+
+  /**
+   * @brief
+   * Releases the contiguous block of "map()".
+   */
+  void unmap() override;
+
+  /**
+   * @brief
+   * Same as "map()".
+   *
+   * @return
+   * A pointer to the content.
+   */
+  void* memory_map() override;
+
+  /**
+   * @brief
+   * Same as "unmap()".
+   */
+  void memory_unmap() override;
+
+private:
+  /** The segments holding the content, all of `SegmentSize` bytes */
+  Vector<uint8*> mSegments;
+  /** The number of bytes of content */
+  sizeT mSize;
+  /** The current read/write position */
+  sizeT mPosition;
+  /** Contiguous copy of the content while mapped, `nullptr` if the content is handed out directly */
+  uint8* mFlattened;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/chained_memory_stream.inl"
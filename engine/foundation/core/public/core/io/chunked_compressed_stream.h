@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/io/file.h"
+#include "core/io/stream.h"
+#include "core/platform/condition_variable.h"
+#include "core/platform/mutex.h"
+#include "core/std/atomic.h"
+#include "core/tools/compression.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Thread;
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * ChunkedCompressedHeader
+ *
+ * @brief
+ * Header at the start of a chunked compressed file, written last when the file is closed.
+ */
+struct ChunkedCompressedHeader {
+  uint32 magic;          ///< ChunkedCompressedStream::Magic
+  uint16 version;        ///< ChunkedCompressedStream::Version
+  uint8 codec;           ///< ECompressionCodec of the compressed blocks
+  uint8 reserved;        ///< Always 0
+  uint32 blockSize;      ///< Uncompressed size of every block but the last one
+  uint32 numberOfBlocks; ///< Number of entries of the block index
+  uint64 size;           ///< Uncompressed size of the content
+  uint64 indexOffset;    ///< File offset of the block index
+};
+
+/**
+ * @struct
+ * ChunkedCompressedBlock
+ *
+ * @brief
+ * Entry of the block index at the end of a chunked compressed file.
+ */
+struct ChunkedCompressedBlock {
+  uint64 offset;         ///< File offset of the stored block
+  uint32 storedSize;     ///< Number of stored bytes
+  uint32 flags;          ///< ChunkedCompressedStream::BlockCompressed if the block is compressed, else stored as is
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * ChunkedCompressedStream
+ *
+ * @brief
+ * Seekable compressed file stream.
+ *
+ * The content is split into blocks of a fixed uncompressed size which are compressed on their own,
+ * an index at the end of the file maps each block to its stored position. Reading only decompresses
+ * the blocks which are actually touched, so seeking is cheap and a file doesn't have to fit into
+ * memory. Blocks which don't get smaller are stored as is.
+ *
+ * Writing collects one block per thread and compresses them in parallel, reads spanning several whole
+ * blocks decompress them in parallel straight into the destination buffer. The worker threads are
+ * started with the first parallel job and kept until the stream is closed.
+ *
+ * @note
+ * - Only EFileMode::Read and EFileMode::Write are supported, written files can't be seeked
+ * - Codec, level, block size and number of threads have to be set before opening
+ */
+class ChunkedCompressedStream : public Stream {
+public:
+
+  /** "CHKB" */
+  static constexpr uint32 Magic = 0x424b4843;
+  static constexpr uint32 Version = 1;
+  /** Flag of ChunkedCompressedBlock::flags */
+  static constexpr uint32 BlockCompressed = 1;
+  static constexpr uint32 DefaultBlockSize = 128 * 1024;
+  static constexpr uint32 MinBlockSize = 4 * 1024;
+  static constexpr uint32 MaxBlockSize = 16 * 1024 * 1024;
+
+public:
+
+  ChunkedCompressedStream();
+
+  ~ChunkedCompressedStream() override;
+
+public:
+
+  /**
+   * @brief
+   * Sets the codec used for writing, reading always uses the codec of the file.
+   *
+   * @param[in] codec
+   * The codec, default is ECompressionCodec::LZ4
+   * @param[in] level
+   * Codec specific level, see ECompressionCodec, 0 for the default of the codec
+   */
+  void set_codec(ECompressionCodec codec, int32 level = 0);
+
+  [[nodiscard]] inline ECompressionCodec get_codec() const;
+
+  /**
+   * @brief
+   * Sets the uncompressed block size used for writing, clamped to [MinBlockSize, MaxBlockSize].
+   *
+   * @note
+   * - Larger blocks compress better, smaller blocks make random access cheaper
+   */
+  void set_block_size(uint32 blockSize);
+
+  [[nodiscard]] inline uint32 get_block_size() const;
+
+  /**
+   * @brief
+   * Sets the number of threads (de)compressing blocks, 0 uses one per logical processor.
+   */
+  void set_number_of_threads(uint32 numberOfThreads);
+
+  [[nodiscard]] inline uint32 get_number_of_blocks() const;
+
+  /**
+   * @brief
+   * Returns whether or not writing the file failed, stays set after closing until the stream is opened again.
+   *
+   * @note
+   * - Once failed, further writes are dropped and closing leaves the header out, so the file
+   *   is rejected when opened
+   */
+  [[nodiscard]] inline bool has_write_failed() const;
+
+public:
+
+  [[nodiscard]] bool can_read() const override;
+
+  [[nodiscard]] bool can_write() const override;
+
+  [[nodiscard]] bool can_seek() const override;
+
+  [[nodiscard]] bool can_be_mapped() const override;
+
+  [[nodiscard]] sizeT get_size() const override;
+
+  [[nodiscard]] sizeT get_position() const override;
+
+  /**
+   * @brief
+   * Opens the stream.
+   *
+   * @return
+   * 'true' if everything went fine, 'false' if the access mode isn't supported, the file can't be opened
+   * or isn't a valid chunked compressed file
+   */
+  bool open() override;
+
+  /**
+   * @brief
+   * Closes the stream, when writing the last block, the block index and the header are written.
+   */
+  void close() override;
+
+  void write(const void* ptr, sizeT numBytes) override;
+
+  sizeT read(void* ptr, sizeT numBytes) override;
+
+  void seek(sizeT offset, EFileSeek seek) override;
+
+  void flush() override;
+
+  [[nodiscard]] bool eof() const override;
+
+  [[nodiscard]] String get_content_as_string() override;
+
+private:
+
+  /**
+   * @struct
+   * BlockJob
+   *
+   * @brief
+   * Range of blocks (de)compressed by several threads at once.
+   */
+  struct BlockJob {
+    ChunkedCompressedStream* stream;
+    uint32 firstBlock;
+    uint32 numberOfBlocks;
+    /** Destination of the decompressed blocks, nullptr when compressing the write batch */
+    uint8* destination;
+    atomic<uint32> nextBlock;
+    atomic<bool> failed;
+  };
+
+private:
+
+  bool open_for_reading();
+
+  bool open_for_writing();
+
+  [[nodiscard]] uint32 get_block_raw_size(uint32 block) const;
+
+  bool load_block(uint32 block);
+
+  bool decompress_block(uint32 block, uint8* destination, uint8* scratch);
+
+  void compress_batch_block(uint32 batchBlock);
+
+  void write_batch();
+
+  void run_job(BlockJob& job);
+
+  void start_workers();
+
+  void stop_workers();
+
+  static int run_worker_thread(void* data);
+
+  void run_worker();
+
+  void process_job(BlockJob& job);
+
+private:
+
+  File mFile;
+  Compression* mCompression;
+  ECompressionCodec mCodec;
+  int32 mLevel;
+  uint32 mBlockSize;
+  uint32 mNumberOfThreads;
+  Vector<ChunkedCompressedBlock> mBlocks;
+  sizeT mSize;
+  sizeT mPosition;
+  /** Bound of a compressed block */
+  uint32 mCompressedCapacity;
+
+  // Reading
+  /** Decompressed content of "mCachedBlock" */
+  uint8* mCache;
+  uint32 mCachedBlock;
+  /** Stored data of the block being loaded */
+  uint8* mScratch;
+
+  // Writing
+  /** Uncompressed blocks waiting to be compressed, "mNumberOfThreads" blocks */
+  uint8* mBatch;
+  sizeT mBatchFill;
+  /** Compressed batch blocks, "mCompressedCapacity" bytes each */
+  uint8* mBatchCompressed;
+  Vector<uint32> mBatchCompressedSizes;
+  uint64 mFileOffset;
+  bool mWriteFailed;
+
+  // Workers, the calling thread always takes part in a job
+  Vector<Thread*> mWorkers;
+  Mutex mWorkerMutex;
+  ConditionVariable mWorkCondition;
+  ConditionVariable mDoneCondition;
+  /** Job being processed, nullptr once the calling thread is done with it */
+  BlockJob* mJob;
+  /** Incremented with each job, so a worker takes part in a job at most once */
+  uint32 mJobGeneration;
+  /** Number of workers processing "mJob" */
+  uint32 mNumBusyWorkers;
+  bool mStopWorkers;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/chunked_compressed_stream.inl"
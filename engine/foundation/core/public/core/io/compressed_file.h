@@ -163,6 +163,35 @@ public:
     uint32 formatVersion,
     FileImpl &file);
 
+  /**
+   * @brief
+   * Loads and decompresses data straight from memory, e.g. a memory-mapped file.
+   *
+   * @param[in] formatType
+   * The format type of the compressed data.
+   *
+   * @param[in] formatVersion
+   * The version of the compressed data format.
+   *
+   * @param[in] data
+   * Pointer to the file format header followed by the compressed data.
+   *
+   * @param[in] numberOfBytes
+   * Number of readable bytes at "data".
+   *
+   * @return
+   * "true" if data was successfully loaded, "false" otherwise.
+   *
+   * @note
+   * - The data is decompressed right away without taking a copy of the compressed bytes, so the
+   *   memory only has to stay valid during this call and "decompress()" must not be called
+   */
+  bool load_compressed_data_from_memory(
+    uint32 formatType,
+    uint32 formatVersion,
+    const void* data,
+    sizeT numberOfBytes);
+
   /**
    * @brief
    * Sets the compressed data from the file.
@@ -112,6 +112,42 @@ bool CompressedFile<TCompression>::load_compressed_data_from_file(
 
 }
 
+template<typename TCompression>
+bool CompressedFile<TCompression>::load_compressed_data_from_memory(
+  uint32 formatType,
+  uint32 formatVersion,
+  const void* data,
+  sizeT numberOfBytes
+) {
+  CompressedFileFormatHeader fileFormatHeader;
+  if (nullptr != data && numberOfBytes >= sizeof(CompressedFileFormatHeader)) {
+    core::Memory::copy(&fileFormatHeader, data, sizeof(CompressedFileFormatHeader));
+    if (formatType == fileFormatHeader.formatType && formatVersion == fileFormatHeader.formatVersion &&
+        0 != fileFormatHeader.numberOfCompressedBytes && 0 != fileFormatHeader.numberOfDecompressedBytes &&
+        sizeof(CompressedFileFormatHeader) + fileFormatHeader.numberOfCompressedBytes <= numberOfBytes)
+    {
+      // Decompress directly out of the given memory, there's no need for a compressed copy
+      mCompressedData.clear();
+      mNumberOfDecompressedBytes = fileFormatHeader.numberOfDecompressedBytes;
+      mDecompressedData.resize(mNumberOfDecompressedBytes);
+      const sizeT numberOfDecompressedBytes = mCompression.decompress(
+        mDecompressedData.data(),
+        static_cast<const core::uint8*>(data) + sizeof(CompressedFileFormatHeader),
+        fileFormatHeader.numberOfCompressedBytes,
+        mNumberOfDecompressedBytes
+      );
+      mCurrentDataPointer = mDecompressedData.data();
+
+      // Done
+      return (numberOfDecompressedBytes == mNumberOfDecompressedBytes);
+    }
+  }
+
+  // Error!
+  BE_ASSERT(false, "Invalid file format header")
+  return false;
+}
+
 template<typename TCompression>
 void CompressedFile<TCompression>::set_compressed_data(
   FileImpl &file,
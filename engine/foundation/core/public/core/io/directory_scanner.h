@@ -0,0 +1,341 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/container/vector.h"
+#include "core/platform/condition_variable.h"
+#include "core/platform/mutex.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Enumerations                                          ]
+//[-------------------------------------------------------]
+enum class EDirectoryEntryType : uint8 {
+  File,
+  Directory,
+  /** Symbolic links aren't followed */
+  SymbolicLink,
+  /** Devices, pipes, sockets */
+  Other
+};
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * DirectoryEntry
+ *
+ * @brief
+ * Single entry of a DirectoryScanResult.
+ */
+struct DirectoryEntry {
+  /** The entry is new or differs from the previous scan */
+  static constexpr uint8 Changed = 1 << 0;
+
+  const char* path;                 ///< Native path, zero-terminated, owned by the result
+  uint32 pathLength;                ///< Length of the path in bytes
+  uint32 nameOffset;                ///< Offset of the name within the path
+  uint32 parent;                    ///< Index of the parent directory, DirectoryScanResult::InvalidIndex for the root
+  uint32 firstChild;                ///< Index of the first child of a directory, the children are contiguous
+  uint32 numberOfChildren;          ///< Number of children of a directory
+  EDirectoryEntryType type;         ///< Type of the entry
+  uint8 flags;                      ///< Combination of the flags above
+  uint64 size;                      ///< Size of files in bytes, only if metadata is read
+  int64 modificationTime;           ///< Modification time in nanoseconds since the epoch, for files only if metadata is read
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * DirectoryScanResult
+ *
+ * @brief
+ * Entries of a scanned directory tree, with all paths allocated in one arena.
+ *
+ * The root is the first entry. Apart from that entries are in no particular order, but the
+ * children of each directory are contiguous. A result can be saved and passed to the next scan
+ * of the same directory, which then skips reading directories that didn't change.
+ */
+class DirectoryScanResult : public NonCopyable {
+
+  friend class DirectoryScanner;
+
+public:
+
+  /** Index of no entry */
+  static constexpr uint32 InvalidIndex = 0xffffffff;
+  /** Magic of saved results */
+  static constexpr uint32 Magic = 0x43534442; // "BDSC"
+  /** Version of saved results */
+  static constexpr uint32 Version = 1;
+
+public:
+
+  DirectoryScanResult();
+
+  ~DirectoryScanResult();
+
+  [[nodiscard]] inline uint32 get_num_entries() const;
+
+  [[nodiscard]] inline const DirectoryEntry& get_entry(uint32 index) const;
+
+  [[nodiscard]] inline const DirectoryEntry* get_entries() const;
+
+  /**
+   * @brief
+   * Returns the native path of an entry.
+   */
+  [[nodiscard]] inline StringView get_path(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the filename of an entry, without its directory.
+   */
+  [[nodiscard]] inline StringView get_name(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the time the scan started at, in nanoseconds since the epoch.
+   */
+  [[nodiscard]] inline int64 get_scan_time() const;
+
+  /**
+   * @brief
+   * Returns the number of entries flagged with DirectoryEntry::Changed.
+   */
+  [[nodiscard]] uint32 get_num_changed() const;
+
+  /**
+   * @brief
+   * Removes all entries and frees the arena.
+   */
+  void clear();
+
+  /**
+   * @brief
+   * Writes the result into a file, to be used as cache of a later scan.
+   *
+   * @param[in] filename
+   * Native filename
+   *
+   * @return
+   * 'true' if all went fine, else 'false'
+   */
+  bool save(const String& filename) const;
+
+  /**
+   * @brief
+   * Reads a result previously written by save().
+   *
+   * @param[in] filename
+   * Native filename
+   *
+   * @return
+   * 'true' if all went fine, else 'false' and the result is empty
+   */
+  bool load(const String& filename);
+
+private:
+
+  /** Entries and their arena blocks, merged from the scan threads */
+  Vector<DirectoryEntry> mEntries;
+  Vector<uint8*> mBlocks;
+  int64 mScanTime;
+};
+
+/**
+ * @class
+ * DirectoryScanner
+ *
+ * @brief
+ * Parallel recursive directory scanner.
+ *
+ * Subdirectories are handed out to a pool of threads, each reading whole directories with large
+ * getdents64 calls. The entry type comes from the directory listing itself, so files are only
+ * stat'ed if their size and modification time are requested. Each directory is stat'ed once by
+ * the thread listing its parent.
+ *
+ * Given the result of a previous scan, directories whose modification time is unchanged (so no
+ * entry was added, removed or renamed) aren't read again, their entries are taken over from the
+ * previous result. Content changes of files don't touch the modification time of their directory,
+ * so file metadata is still read for every file if requested. Directories modified shortly before
+ * the previous scan are always read again, a later change could have left the coarse timestamp
+ * as it was.
+ *
+ * @note
+ * - Only one scan at a time per scanner
+ * - Pass a previous result only if it was scanned with the same settings
+ */
+class DirectoryScanner : public NonCopyable {
+public:
+
+  /** Number of bytes of a single getdents64 call */
+  static constexpr uint32 BufferSize = 64 * 1024;
+  /** Number of bytes of each arena block of a thread */
+  static constexpr uint32 BlockSize = 64 * 1024;
+  /** Default number of milliseconds timestamps may lag behind, two seconds cover even FAT */
+  static constexpr uint32 DefaultTimestampGranularity = 2000;
+
+public:
+
+  DirectoryScanner();
+
+  ~DirectoryScanner();
+
+  /**
+   * @brief
+   * Sets the number of threads, including the scanning one, 0 uses one per logical processor.
+   */
+  inline void set_number_of_threads(uint32 numberOfThreads);
+
+  /**
+   * @brief
+   * Sets whether the size and modification time of files are read, off by default.
+   */
+  inline void set_read_metadata(bool readMetadata);
+
+  /**
+   * @brief
+   * Sets whether entries starting with '.' are skipped, off by default.
+   */
+  inline void set_skip_hidden(bool skipHidden);
+
+  /**
+   * @brief
+   * Sets the number of milliseconds a directory has to be older than the previous scan to be taken over.
+   */
+  inline void set_timestamp_granularity(uint32 timestampGranularity);
+
+  /**
+   * @brief
+   * Scans a directory tree.
+   *
+   * @param[in] directory
+   * Native directory to scan, see IoServer::resolve_path() for mount points
+   * @param[out] result
+   * Receives the entries, cleared first
+   * @param[in] previous
+   * Optional result of an earlier scan of the same directory, may be the loaded cache
+   *
+   * @return
+   * 'true' if the directory could be read, else 'false'
+   */
+  bool scan(const String& directory, DirectoryScanResult& result, const DirectoryScanResult* previous = nullptr);
+
+  /**
+   * @brief
+   * Returns the number of directories read by the last scan.
+   */
+  [[nodiscard]] inline uint32 get_num_read_directories() const;
+
+  /**
+   * @brief
+   * Returns the number of directories taken over from the previous result by the last scan.
+   */
+  [[nodiscard]] inline uint32 get_num_reused_directories() const;
+
+private:
+
+  /**
+   * @struct
+   * Job
+   *
+   * @brief
+   * Directory waiting to be listed.
+   */
+  struct Job {
+    const char* path;    ///< Path in the arena of the thread owning the entry
+    uint32 pathLength;   ///< Length of the path
+    uint32 worker;       ///< Index of the thread owning the entry
+    uint32 index;        ///< Index of the entry within its thread
+    uint32 cachedIndex;  ///< Index within the previous result, DirectoryScanResult::InvalidIndex if unknown
+    bool isUnchanged;    ///< The directory can be taken over from the previous result
+  };
+
+  struct Worker;
+
+private:
+
+  static int run_worker_thread(void* data);
+
+  void run_worker(Worker& worker);
+
+  void process_job(Worker& worker, const Job& job);
+
+  void read_directory(Worker& worker, const Job& job);
+
+  void reuse_directory(Worker& worker, const Job& job);
+
+  uint32 add_entry(Worker& worker, const Job& job, const char* name, uint32 nameLength, EDirectoryEntryType type);
+
+  void add_subdirectory(Worker& worker, uint32 index, uint32 cachedIndex);
+
+private:
+
+  uint32 mNumberOfThreads;
+  bool mReadMetadata;
+  bool mSkipHidden;
+  uint32 mTimestampGranularity;
+  uint32 mNumReadDirectories;
+  uint32 mNumReusedDirectories;
+  /** State of the running scan */
+  const DirectoryScanResult* mPrevious;
+  Vector<Worker*> mWorkers;
+  Mutex mMutex;
+  ConditionVariable mCondition;
+  Vector<Job> mJobs;
+  uint32 mNumBusyWorkers;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/directory_scanner.inl"
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline uint32 DirectoryScanResult::get_num_entries() const {
+  return mEntries.size();
+}
+
+inline const DirectoryEntry& DirectoryScanResult::get_entry(uint32 index) const {
+  return mEntries[index];
+}
+
+inline const DirectoryEntry* DirectoryScanResult::get_entries() const {
+  return mEntries.data();
+}
+
+inline int64 DirectoryScanResult::get_scan_time() const {
+  return mScanTime;
+}
+
+inline StringView DirectoryScanResult::get_path(uint32 index) const {
+  return StringView(mEntries[index].path, mEntries[index].pathLength);
+}
+
+inline StringView DirectoryScanResult::get_name(uint32 index) const {
+  const DirectoryEntry& entry = mEntries[index];
+  return StringView(entry.path + entry.nameOffset, entry.pathLength - entry.nameOffset);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline void DirectoryScanner::set_number_of_threads(uint32 numberOfThreads) {
+  mNumberOfThreads = numberOfThreads;
+}
+
+inline void DirectoryScanner::set_read_metadata(bool readMetadata) {
+  mReadMetadata = readMetadata;
+}
+
+inline void DirectoryScanner::set_skip_hidden(bool skipHidden) {
+  mSkipHidden = skipHidden;
+}
+
+inline void DirectoryScanner::set_timestamp_granularity(uint32 timestampGranularity) {
+  mTimestampGranularity = timestampGranularity;
+}
+
+inline uint32 DirectoryScanner::get_num_read_directories() const {
+  return mNumReadDirectories;
+}
+
+inline uint32 DirectoryScanner::get_num_reused_directories() const {
+  return mNumReusedDirectories;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
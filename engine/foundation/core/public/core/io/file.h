@@ -77,8 +77,18 @@ public:
 
   virtual void skip(uint64 numberOfBytes);
 
+  uint64 read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes) override;
+
+  const void* map(EAccessPattern accessPattern, uint64& numberOfBytes) override;
+
+  void unmap() override;
+
   uint64 write(const void* sourceBuffer, uint64 numberOfBytes);
 
+  uint64 write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes) override;
+
+  uint64 write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) override;
+
   [[nodiscard]] core::int64 get_last_modification_time() const;
 
   [[nodiscard]] core::int64 get_file_size() const;
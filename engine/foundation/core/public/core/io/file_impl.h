@@ -142,6 +142,52 @@ public:
    */
   virtual void skip(uint64 numberOfBytes) = 0;
 
+  /**
+   * @brief
+   * Read a requested number of bytes from the given absolute file offset
+   *
+   * @param[in] offset
+   * Absolute byte offset inside the file to start reading at
+   * @param[out] destinationBuffer
+   * Destination buffer were to write to, must be at least "numberOfBytes" long, never ever a
+   * null pointer
+   * @param[in] numberOfBytes
+   * Number of bytes to read into the destination buffer
+   *
+   * @return
+   * The number of read bytes, less than "numberOfBytes" at the end of the file or on error
+   *
+   * @note
+   * - Neither uses nor moves the file position, several threads may read different ranges of
+   *   the same file concurrently
+   * - The default implementation doesn't support positional reads and returns 0
+   */
+  virtual inline uint64 read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Maps the whole file read-only into memory.
+   *
+   * @param[in] accessPattern
+   * Expected access pattern, passed to the operating system as paging hint
+   * @param[out] numberOfBytes
+   * Receives the number of mapped bytes, 0 on failure
+   *
+   * @return
+   * Pointer to the first mapped byte, null pointer if the file can't be mapped (the default)
+   *
+   * @note
+   * - The mapping stays valid until "unmap()" or "close()" is called
+   * - Only files opened for reading can be mapped, empty files can't be mapped
+   */
+  virtual inline const void* map(EAccessPattern accessPattern, uint64& numberOfBytes);
+
+  /**
+   * @brief
+   * Releases a mapping established by "map()", does nothing if the file isn't mapped.
+   */
+  virtual inline void unmap();
+
   //[-------------------------------------------------------]
   //[ Write                                                 ]
   //[-------------------------------------------------------]
@@ -158,6 +204,46 @@ public:
    */
   virtual uint64 write(const void *sourceBuffer, uint64 numberOfBytes) = 0;
 
+  /**
+   * @brief
+   * Write a requested number of bytes at the given absolute file offset
+   *
+   * @param[in] offset
+   * Absolute byte offset inside the file to start writing at
+   * @param[in] sourceBuffer
+   * Source buffer were to read from, must be at least "numberOfBytes" long, never ever a null
+   * pointer
+   * @param[in] numberOfBytes
+   * Number of bytes to read from the source buffer and write into the file
+   *
+   * @return
+   * The number of written bytes
+   *
+   * @note
+   * - Neither uses nor moves the file position, several threads may write disjoint ranges of
+   *   the same file concurrently
+   * - Bypasses the buffering of "write()", don't mix both on overlapping ranges without "flush()"
+   * - The default implementation doesn't support positional writes and returns 0
+   */
+  virtual inline uint64 write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Write several buffers one after another at the current file position (gather write)
+   *
+   * @param[in] buffers
+   * Buffers to write in order, never ever a null pointer
+   * @param[in] numberOfBuffers
+   * Number of buffers
+   *
+   * @return
+   * The number of written bytes
+   *
+   * @note
+   * - The default implementation writes the buffers one by one through "write()"
+   */
+  virtual inline uint64 write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers);
+
   /**
    * @brief
    * Gets the last modification time of the file.
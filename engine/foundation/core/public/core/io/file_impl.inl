@@ -52,6 +52,35 @@ void FileImpl::seek(uint64 seek) {
 
 }
 
+uint64 FileImpl::read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes) {
+  return 0;
+}
+
+uint64 FileImpl::write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes) {
+  return 0;
+}
+
+uint64 FileImpl::write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) {
+  uint64 numberOfWrittenBytes = 0;
+  for (uint32 i = 0; i < numberOfBuffers; ++i) {
+    const uint64 numberOfBufferBytes = write(buffers[i].data, buffers[i].numberOfBytes);
+    numberOfWrittenBytes += numberOfBufferBytes;
+    if (numberOfBufferBytes < buffers[i].numberOfBytes) {
+      break;
+    }
+  }
+  return numberOfWrittenBytes;
+}
+
+const void* FileImpl::map(EAccessPattern accessPattern, uint64& numberOfBytes) {
+  numberOfBytes = 0;
+  return nullptr;
+}
+
+void FileImpl::unmap() {
+
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -148,6 +148,18 @@ public:
    */
   void write(const void* ptr, sizeT numBytes) override;
 
+  /**
+   * @brief
+   * Writes several buffers with a single gather write of the file.
+   *
+   * @param[in] buffers
+   * Buffers to write in order.
+   *
+   * @param[in] numberOfBuffers
+   * The number of buffers.
+   */
+  void write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) override;
+
   /**
    * @brief
    * Reads data from the file stream.
@@ -199,15 +211,50 @@ public:
    */
   [[nodiscard]] String get_content_as_string() override;
 
+  /**
+   * @brief
+   * Maps the whole file into memory, same as "memory_map()".
+   *
+   * @return
+   * A pointer to the mapped file content, null pointer if the file can't be mapped.
+   */
+  void* map() override;
+
+  /**
+   * @brief
+   * Releases the mapping established by "map()".
+   */
+  void unmap() override;
+
+  /**
+   * @brief
+   * Maps the whole file read-only and shared into memory, the access pattern of the stream is
+   * passed to the operating system as paging hint.
+   *
+   * @return
+   * A pointer to the mapped file content, null pointer if the file can't be mapped.
+   *
+   * @note
+   * - Only files opened for reading and holding at least one byte can be mapped
+   * - The mapped memory must not be written to
+   */
+  void* memory_map() override;
+
+  /**
+   * @brief
+   * Releases the mapping established by "memory_map()".
+   */
+  void memory_unmap() override;
+
 protected:
   /** Handle to the file being accessed by this stream. */
   File mFileHandle;
 
-  /** Handle to the mapped file, used for memory-mapping the file content. */
-  File mMapFileHandle;
-
   /** Pointer to the mapped file content in memory. */
   void* mMappedContent;
+
+  /** Number of mapped bytes. */
+  uint64 mMappedSize;
 };
 
 
@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/container/hash_map.h"
+#include "core/container/hash_set.h"
+#include "core/container/vector.h"
+#include "core/platform/mutex.h"
+#include "core/std/atomic.h"
+#include "core/string/string.h"
+#include <functional>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Thread;
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * FileChange
+ *
+ * @brief
+ * All changes of a single path within one delivered batch.
+ */
+struct FileChange {
+  enum EFlags {
+    Added     = 1 << 0, ///< Created or moved into a watched directory
+    Modified  = 1 << 1, ///< Content or attributes written, replaced by renaming another file onto it, or removed and created again within one batch
+    Removed   = 1 << 2, ///< Deleted or moved out of a watched directory
+    Directory = 1 << 3, ///< The path is a directory
+    Overflow  = 1 << 4  ///< Events have been lost, the path is a watched root which has to be rescanned
+  };
+
+  String path;      ///< Path in the spelling of the subscription
+  uint32 flags = 0; ///< Combination of EFlags
+};
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+/** Called with a batch of coalesced changes, on the watcher thread */
+typedef std::function<void(const Vector<FileChange>&)> FileChangeCallback;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * FileWatchService
+ *
+ * @brief
+ * Recursive filesystem watcher delivering debounced change batches to subscribers.
+ *
+ * A single background thread waits on an inotify handle (epoll, so it sleeps until something
+ * happens). Events are coalesced per path, e.g. an editor writing a file in several steps or a
+ * save by rename becomes one modification, and are held back until no new event arrived for
+ * the debounce time or the oldest one waited for the maximum latency. Bursts like version
+ * control checkouts therefore end up in a few large batches instead of thousands of callbacks.
+ *
+ * Watches are per directory, so the number of watched files is only bounded by the directory
+ * count. Once the inotify watch limit of the user is exhausted the remaining directories are
+ * polled by comparing modification times every poll interval instead.
+ *
+ * Paths may use mount points, they are resolved through the IoServer and changes are reported
+ * in the spelling of the subscription.
+ *
+ * FileWatchService is a singleton class, so you can use the instance() method to access it.
+ *
+ * @note
+ * - Watching, subscribing and the statistics are thread-safe
+ * - Callbacks are called on the watcher thread and must not subscribe or unsubscribe
+ */
+class FileWatchService : public NonCopyable {
+public:
+
+  /** Default number of milliseconds without new events before a batch is delivered */
+  static constexpr uint32 DefaultDebounceTime = 100;
+  /** Default maximum number of milliseconds an event is held back during a continuous burst */
+  static constexpr uint32 DefaultMaxLatency = 1000;
+  /** Default number of milliseconds between two scans of polled directories */
+  static constexpr uint32 DefaultPollInterval = 2000;
+  /** Identifier never returned by subscribe() */
+  static constexpr uint32 InvalidSubscription = 0;
+
+public:
+
+  /**
+   * @brief
+   * Retrieves the instance of the FileWatchService.
+   *
+   * @return
+   * The FileWatchService instance.
+   */
+  static FileWatchService& instance();
+
+public:
+
+  /**
+   * @brief
+   * Starts the watcher thread.
+   *
+   * @return
+   * 'true' if all went fine, else 'false'
+   */
+  bool start();
+
+  /**
+   * @brief
+   * Stops the watcher thread and removes all watches, changes not yet delivered are dropped.
+   */
+  void stop();
+
+  /**
+   * @brief
+   * Returns whether or not the watcher thread is running.
+   */
+  [[nodiscard]] inline bool is_running() const;
+
+  /**
+   * @brief
+   * Sets the debounce time and maximum latency in milliseconds.
+   */
+  void set_debounce_time(uint32 debounceTime, uint32 maxLatency = DefaultMaxLatency);
+
+  /**
+   * @brief
+   * Sets the number of milliseconds between two scans of polled directories.
+   */
+  void set_poll_interval(uint32 pollInterval);
+
+  /**
+   * @brief
+   * Watches a directory and all of its subdirectories, including ones created later on.
+   *
+   * @param[in] path
+   * Directory to watch, may use a mount point
+   *
+   * @return
+   * 'true' if the directory is watched, 'false' if it doesn't exist or the service isn't running
+   */
+  bool watch(const String& path);
+
+  /**
+   * @brief
+   * Stops watching a directory previously passed to watch().
+   *
+   * @note
+   * - Directories which are also below another watched directory keep being watched
+   */
+  void unwatch(const String& path);
+
+  /**
+   * @brief
+   * Registers a callback for the changes below a path.
+   *
+   * @param[in] path
+   * Directory or file whose changes are reported, may use a mount point
+   * @param[in] callback
+   * Called with each batch containing changes below the path
+   *
+   * @return
+   * Identifier for unsubscribe()
+   */
+  uint32 subscribe(const String& path, const FileChangeCallback& callback);
+
+  /**
+   * @brief
+   * Removes a subscription, once this returns its callback isn't called anymore.
+   */
+  void unsubscribe(uint32 subscription);
+
+  /**
+   * @brief
+   * Returns the number of directories watched through inotify.
+   */
+  [[nodiscard]] uint32 get_num_watched_directories() const;
+
+  /**
+   * @brief
+   * Returns the number of directories polled because the watch limit has been reached.
+   */
+  [[nodiscard]] uint32 get_num_polled_directories() const;
+
+  /**
+   * @brief
+   * Returns the number of received events.
+   */
+  [[nodiscard]] inline uint64 get_num_events() const;
+
+  /**
+   * @brief
+   * Returns the number of delivered batches.
+   */
+  [[nodiscard]] inline uint64 get_num_batches() const;
+
+private:
+
+  /**
+   * @struct
+   * PolledDirectory
+   *
+   * @brief
+   * Directory without inotify watch and the state of its entries at the last scan.
+   */
+  struct PolledDirectory {
+    String path;                      ///< Native path without trailing separator
+    hash_map<String, uint64> entries; ///< Entry name to stamp of modification time and size, see poll_directories()
+  };
+
+  /**
+   * @struct
+   * Subscription
+   *
+   * @brief
+   * Registered callback and the prefix translating native paths back into its spelling.
+   */
+  struct Subscription {
+    uint32 id;                   ///< Identifier returned by subscribe()
+    String path;                 ///< Path as passed to subscribe()
+    String realPath;             ///< Resolved native path
+    FileChangeCallback callback; ///< Callback to call
+  };
+
+private:
+
+  FileWatchService();
+
+  ~FileWatchService();
+
+  static int run_thread(void* data);
+
+  void run();
+
+  void read_events();
+
+  void poll_directories();
+
+  void deliver();
+
+  void add_directory(const String& path, bool reportEntries);
+
+  [[nodiscard]] bool is_polled(const String& path) const;
+
+  void remove_directory(const String& path);
+
+  void add_change(String&& path, uint32 flags);
+
+  void wake_up();
+
+private:
+
+  atomic<bool> mRunning;
+  atomic<uint64> mNumEvents;
+  atomic<uint64> mNumBatches;
+  Thread* mThread;
+  int mInotifyHandle;
+  int mEpollHandle;
+  int mWakeUpHandle;
+  uint32 mDebounceTime;
+  uint32 mMaxLatency;
+  uint32 mPollInterval;
+  /** Guards everything below except the subscriptions */
+  mutable Mutex mMutex;
+  Vector<String> mRoots;
+  hash_map<int32, String> mWatchPaths;
+  hash_map<String, int32> mWatchHandles;
+  /** Name hashes of the files inside of each watched directory, tells replacing a file apart from adding one */
+  hash_map<int32, hash_set<uint64>> mWatchedFiles;
+  Vector<PolledDirectory*> mPolledDirectories;
+  bool mWatchLimitReached;
+  /** Native path to combined FileChange::EFlags of the batch being collected */
+  hash_map<String, uint32> mPendingChanges;
+  uint64 mFirstPendingTime;
+  uint64 mLastPendingTime;
+  uint64 mNextPollTime;
+  /** Held while delivering, so unsubscribe() waits for a running callback */
+  Mutex mSubscriptionMutex;
+  Vector<Subscription*> mSubscriptions;
+  uint32 mNextSubscription;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/file_watch_service.inl"
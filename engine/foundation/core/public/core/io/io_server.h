@@ -31,7 +31,9 @@
 #include "core/core.h"
 #include "core/core/server_impl.h"
 #include "core/core/ptr.h"
+#include "core/io/async_file_io.h"
 #include "core/io/path.h"
+#include "core/io/path_view.h"
 #include "core/io/types.h"
 #include "core/string/string.h"
 
@@ -47,6 +49,8 @@ namespace core {
 //[-------------------------------------------------------]
 class Filesystem;
 class MountPointRegistry;
+class PackArchive;
+class Stream;
 
 
 //[-------------------------------------------------------]
@@ -109,10 +113,11 @@ public:
 
   /**
    * @brief
-   * Mounts a real directory to a virtual mount point.
+   * Mounts a real directory or a pack archive to a virtual mount point.
    *
    * @param[in] realDirectory
-   * The real directory path.
+   * The real directory path, or the filename of a pack archive (see PackArchive) whose entries then
+   * appear below the mount point.
    *
    * @param[in] mountPoint
    * The virtual mount point.
@@ -185,7 +190,65 @@ public:
    */
   [[nodiscard]] String resolve_path(const String& path) const;
 
+  /**
+   * @brief
+   * Resolves a virtual path view to its real path representation.
+   *
+   * @param[in] path
+   * The virtual path view.
+   *
+   * @return
+   * The resolved real path string.
+   */
+  [[nodiscard]] String resolve_path(PathView path) const;
+
   // Streams
+  /**
+   * @brief
+   * Creates a stream for the given file, resolving mount points and pack archives.
+   *
+   * @param[in] path
+   * The virtual path of the file.
+   *
+   * @param[in] fileMode
+   * The access mode of the stream.
+   *
+   * @return
+   * The stream, not opened yet. Invalid if the file is inside a pack archive and not opened for reading,
+   * or if there's no such entry inside the archive.
+   */
+  [[nodiscard]] Ptr<Stream> create_stream(const Path& path, EFileMode fileMode = EFileMode::Read) const;
+
+
+  /**
+   * @brief
+   * Queues an asynchronous read, the filename is resolved through the mount points first.
+   *
+   * @param[in] request
+   * The read to queue, see AsyncReadRequest
+   *
+   * @return
+   * Handle of the read.
+   *
+   * @note
+   * - Starts AsyncFileIo with its default backend if it's not running yet
+   * - Uncompressed entries of pack archives are read from the archive file. Reads of compressed entries
+   *   fail right away with ENOTSUP, their callback is called on this thread; use "create_stream()" for them
+   */
+  Ptr<AsyncFileRead> read_async(const AsyncReadRequest& request) const;
+
+  /**
+   * @brief
+   * Queues many asynchronous reads at once, see "read_async()".
+   *
+   * @param[in] requests
+   * The reads to queue
+   * @param[in] numberOfRequests
+   * Number of reads
+   * @param[out] reads
+   * Receives the handles of the reads, appended in request order
+   */
+  void read_async(const AsyncReadRequest* requests, uint32 numberOfRequests, Vector<Ptr<AsyncFileRead>>& reads) const;
 
   // Directory
 
@@ -358,6 +421,34 @@ public:
    */
   [[nodiscard]] core::int64 get_file_size(const String& filename) const;
 
+private:
+  /**
+   * @brief
+   * Resolves a virtual path and finds the pack archive it points into.
+   *
+   * @param[in] path
+   * The virtual path.
+   *
+   * @param[out] realPath
+   * Receives the resolved real path.
+   *
+   * @param[out] entryName
+   * Receives the name of the entry inside the archive.
+   *
+   * @return
+   * The archive, null pointer if the path doesn't point into a mounted archive.
+   */
+  [[nodiscard]] PackArchive* resolve(PathView path, String& realPath, String& entryName) const;
+
+  /**
+   * @brief
+   * Resolves the filename of an asynchronous read, reads of archive entries become reads of the archive.
+   *
+   * @return
+   * 'false' if the read targets a compressed archive entry, which can't be read as a plain file range
+   */
+  bool resolve_request(AsyncReadRequest& request) const;
+
 private:
   /** Pointer to the mount point registry. */
   Ptr<MountPointRegistry> mMountPointRegistry;
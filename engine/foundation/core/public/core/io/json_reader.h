@@ -76,6 +76,18 @@ public:
    * The parsed JSON value.
    */
   JsonValue read();
+
+  /**
+   * @brief
+   * Reads and parses the underlying stream into an arena-backed document.
+   *
+   * @param[out] document
+   * The document to parse into, its previous content is discarded.
+   *
+   * @return
+   * `true` if the stream was parsed successfully, `false` otherwise.
+   */
+  bool read(JsonDocument& document);
 };
 
 
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/io/stream_reader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class JsonSaxHandler;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonStreamReader
+ *
+ * @brief
+ * Event based JSON reader pulling from a stream in fixed-size chunks.
+ *
+ * Instead of loading the whole document and building a DOM, the reader tokenizes one chunk at a
+ * time and reports every value to a JsonSaxHandler. Memory usage is the chunk, the longest
+ * single string or number and one byte per nesting level, independent of the document size.
+ *
+ * The relaxed dialect of the JsonParser is supported: commas are optional, keys may be unquoted,
+ * the root object may omit its braces, '#' starts a comment and '"""' delimits raw text blocks.
+ */
+class JsonStreamReader : public StreamReader {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Default number of bytes read from the stream at once */
+  static constexpr uint32 DefaultChunkSize = 64 * 1024;
+  /** Maximum nesting depth of arrays and objects */
+  static constexpr uint32 MaxDepth = 1024;
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Constructor.
+   *
+   * @param[in] chunkSize
+   * Number of bytes read from the stream at once
+   */
+  explicit JsonStreamReader(uint32 chunkSize = DefaultChunkSize);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~JsonStreamReader() override;
+
+  /**
+   * @brief
+   * Reads the stream from its current position and reports all values to the handler.
+   *
+   * @param[in] handler
+   * Receives the events
+   *
+   * @return
+   * 'true' if the whole document was read, 'false' on a syntax error or if the handler stopped
+   */
+  bool read(JsonSaxHandler& handler);
+
+  /**
+   * @brief
+   * Returns the error message of the last read() call, empty string on success.
+   */
+  [[nodiscard]] inline const char* get_error() const;
+
+  /**
+   * @brief
+   * Returns the stream offset at which the last read() call failed.
+   */
+  [[nodiscard]] inline sizeT get_error_offset() const;
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  bool fill();
+
+  inline int peek();
+
+  inline void advance();
+
+  inline sizeT get_offset() const;
+
+  void skip_whitespace();
+
+  bool read_value(JsonSaxHandler& handler);
+
+  bool read_key(JsonSaxHandler& handler);
+
+  bool read_string(bool& rawText);
+
+  bool read_raw_text();
+
+  bool read_atom();
+
+  bool emit_atom(JsonSaxHandler& handler);
+
+  bool set_error(const char* error);
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Current chunk */
+  Vector<char> mChunk;
+  /** Number of valid bytes inside the current chunk */
+  uint32 mChunkSize;
+  /** Read position inside the current chunk */
+  uint32 mChunkPosition;
+  /** Number of bytes read from the stream before the current chunk */
+  sizeT mChunkOffset;
+  /** Whether the stream is exhausted */
+  bool mEndOfStream;
+  /** Current string, number or literal, may span several chunks */
+  Vector<char> mToken;
+  /** Stream offset of the first character of mToken */
+  sizeT mTokenOffset;
+  /** Open containers, '{' or '[' */
+  Vector<char> mStack;
+  /** Error message of the last read, empty on success */
+  const char* mError;
+  /** Stream offset of the error */
+  sizeT mErrorOffset;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/json_stream_reader.inl"
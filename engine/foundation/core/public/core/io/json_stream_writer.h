@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/io/stream_writer.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class JsonBinaryElement;
+class JsonElement;
+class JsonValue;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonStreamWriter
+ *
+ * @brief
+ * Event based JSON writer emitting directly into a stream.
+ *
+ * Values are formatted into a fixed-size buffer which is handed to the stream whenever it is
+ * full, so no intermediate strings are built and memory usage does not depend on the size of the
+ * document. The output is standard JSON: keys are quoted and strings are escaped, only raw text
+ * blocks are written as '"""' blocks.
+ *
+ * Usage:
+ * @code
+ * JsonStreamWriter writer;
+ * writer.set_stream(stream);
+ * writer.open();
+ * writer.begin_object();
+ * writer.key("name");
+ * writer.write_string("bitray");
+ * writer.end_object();
+ * writer.close();
+ * @endcode
+ */
+class JsonStreamWriter : public StreamWriter {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Default size of the output buffer */
+  static constexpr uint32 DefaultBufferSize = 64 * 1024;
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Constructor.
+   *
+   * @param[in] indentationLength
+   * Number of spaces per nesting level, 0 writes compact output without line breaks
+   * @param[in] bufferSize
+   * Size of the output buffer
+   */
+  explicit JsonStreamWriter(uint32 indentationLength = 2, uint32 bufferSize = DefaultBufferSize);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~JsonStreamWriter() override;
+
+  /**
+   * @brief
+   * Flushes the buffered output and closes the writer.
+   */
+  void close() override;
+
+  /**
+   * @brief
+   * Hands the buffered output to the stream.
+   */
+  void flush();
+
+  void begin_object();
+
+  void end_object();
+
+  void begin_array();
+
+  void end_array();
+
+  /**
+   * @brief
+   * Writes an object member name, must be followed by exactly one value.
+   */
+  void key(StringView name);
+
+  void write_null();
+
+  void write_bool(bool value);
+
+  void write_integer(int64 value);
+
+  /**
+   * @brief
+   * Writes a number, non-finite values are written as 'null'.
+   */
+  void write_number(double value);
+
+  /**
+   * @brief
+   * Writes a string.
+   *
+   * @param[in] value
+   * The string to write
+   * @param[in] rawText
+   * If 'true', the string is written unescaped as '"""' raw text block
+   */
+  void write_string(StringView value, bool rawText = false);
+
+  /**
+   * @brief
+   * Writes a whole DOM value including all its children.
+   */
+  void write_value(const JsonValue& value);
+
+  /**
+   * @brief
+   * Writes a whole document element including all its children.
+   */
+  void write_value(const JsonElement& element);
+
+  /**
+   * @brief
+   * Writes a whole binary encoded element including all its children.
+   */
+  void write_value(const JsonBinaryElement& element);
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  void begin_value();
+
+  void begin_container(char bracket);
+
+  void end_container(char bracket);
+
+  void write_line_break(uint32 level);
+
+  void write_escaped(StringView value);
+
+  inline void put(char c);
+
+  void put(const char* data, sizeT size);
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Output buffer */
+  Vector<char> mBuffer;
+  /** Number of used bytes inside mBuffer */
+  uint32 mBufferUsed;
+  /** Number of spaces per nesting level */
+  uint32 mIndentationLength;
+  /** Number of values written to each open container */
+  Vector<uint32> mNumValues;
+  /** Whether the last call wrote a member name */
+  bool mAfterKey;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/json_stream_writer.inl"
@@ -29,6 +29,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/core.h"
+#include "core/core/ptr.h"
+#include "core/io/pack_archive.h"
 #include "core/string/string.h"
 
 
@@ -72,6 +74,21 @@ public:
    */
   MountPoint(const String& mount, const String& realPath);
 
+  /**
+   * @brief
+   * Constructor for a mount point backed by a pack archive.
+   *
+   * @param[in] mount
+   * The virtual mount point name.
+   *
+   * @param[in] realPath
+   * The native filename of the archive.
+   *
+   * @param[in] archive
+   * The opened archive.
+   */
+  MountPoint(const String& mount, const String& realPath, const Ptr<PackArchive>& archive);
+
   /**
    * @brief
    * Copy constructor.
@@ -141,11 +158,31 @@ public:
    */
   [[nodiscard]] const String& get_real_path() const;
 
+  /**
+   * @brief
+   * Retrieves the pack archive the mount point refers to.
+   *
+   * @return
+   * The archive, invalid if the mount point refers to a directory.
+   */
+  [[nodiscard]] const Ptr<PackArchive>& get_archive() const;
+
+  /**
+   * @brief
+   * Checks whether the mount point refers to a pack archive instead of a directory.
+   *
+   * @return
+   * `true` if the mount point refers to a pack archive, otherwise `false`.
+   */
+  [[nodiscard]] bool is_archive() const;
+
 private:
   /** The mounting, as it is internally know */
   String mMount;
   /** The real filesystem path to that directory */
   String mRealPath;
+  /** The archive if the real path is a pack archive */
+  Ptr<PackArchive> mArchive;
 };
 
 
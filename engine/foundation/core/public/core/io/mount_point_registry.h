@@ -34,6 +34,9 @@
 #include "core/container/vector.h"
 #include "core/io/mount_point.h"
 #include "core/io/path.h"
+#include "core/io/path_view.h"
+#include "core/platform/mutex.h"
+#include "core/string/name.h"
 
 
 //[-------------------------------------------------------]
@@ -52,9 +55,21 @@ namespace core {
  * @brief
  * Manages a collection of mount points, allowing for the registration,
  * removal, and querying of virtual-to-physical path mappings.
+ *
+ * Mounts referring to other mounts are flattened whenever the mount points change, so resolving
+ * a path is a single lookup of the interned mount name. The real paths of all mounts form a trie
+ * keyed by interned path segments, which finds the mount containing a real path without comparing
+ * against every mount. Resolving together with the archive lookup, as the IoServer does for every
+ * request, goes through a bounded cache of resolved paths.
+ *
+ * @note
+ * - Resolving is thread-safe, changing the mount points isn't
  */
 class MountPointRegistry : public RefCounted {
 public:
+  /** Number of resolved paths kept by default */
+  static constexpr uint32 DefaultCacheCapacity = 1024;
+
   /**
    * @brief
    * Constructor.
@@ -200,12 +215,169 @@ public:
    */
   [[nodiscard]] String resolve_path(const String& path) const;
 
+  /**
+   * @brief
+   * Resolves a virtual path view to its corresponding real filesystem path.
+   *
+   * @param[in] path
+   * The virtual path to resolve.
+   *
+   * @return
+   * The resolved real filesystem path string.
+   */
+  [[nodiscard]] String resolve_path(PathView path) const;
+
+  /**
+   * @brief
+   * Finds the mount point whose resolved real path contains the given real path.
+   *
+   * @param[in] realPath
+   * The real path, see "resolve_path()".
+   *
+   * @param[out] relativePath
+   * Receives the part of the path behind the real path of the mount point.
+   *
+   * @return
+   * The innermost mount point, null pointer if the path isn't inside of any mount point.
+   */
+  [[nodiscard]] const MountPoint* find_mount_point_of(PathView realPath, PathView& relativePath) const;
+
+  /**
+   * @brief
+   * Finds the pack archive a resolved path points into.
+   *
+   * @param[in] path
+   * The resolved path, see "resolve_path()".
+   *
+   * @param[out] entryName
+   * Receives the name of the entry inside the archive, empty for the root of the archive.
+   *
+   * @return
+   * The archive, null pointer if the path doesn't point into any mounted archive.
+   */
+  [[nodiscard]] PackArchive* find_archive(const String& path, String& entryName) const;
+
+  /**
+   * @brief
+   * Resolves a virtual path and finds the pack archive it points into, through the cache.
+   *
+   * @param[in] path
+   * The virtual path.
+   *
+   * @param[out] realPath
+   * Receives the resolved real filesystem path.
+   *
+   * @param[out] entryName
+   * Receives the name of the entry inside the archive, empty for the root of the archive.
+   *
+   * @return
+   * The archive, null pointer if the path doesn't point into any mounted archive.
+   */
+  [[nodiscard]] PackArchive* resolve_path(PathView path, String& realPath, String& entryName) const;
+
+  /**
+   * @brief
+   * Sets the maximum number of cached resolved paths, 0 disables the cache.
+   */
+  void set_cache_capacity(core::uint32 capacity);
+
+  [[nodiscard]] core::uint32 get_cache_capacity() const;
+
+  /**
+   * @brief
+   * Returns the number of resolves answered from the cache.
+   */
+  [[nodiscard]] core::uint64 get_num_cache_hits() const;
+
+  /**
+   * @brief
+   * Returns the number of resolves which had to look up the mount points.
+   */
+  [[nodiscard]] core::uint64 get_num_cache_misses() const;
+
+  /**
+   * @brief
+   * Drops all resolved paths from the cache.
+   */
+  void clear_cache();
+
+private:
+  /** No mount point, see "mTrieMounts" */
+  static constexpr core::uint32 InvalidIndex = ~0u;
+
+  /**
+   * @struct
+   * TrieEdgeHash
+   *
+   * @brief
+   * Mixes the parent node into the low bits, the same segment below many parents would collide otherwise.
+   */
+  struct TrieEdgeHash {
+    core::sizeT operator()(core::uint64 key) const {
+      key ^= key >> 33;
+      key *= 0xff51afd7ed558ccdull;
+      key ^= key >> 33;
+      return static_cast<core::sizeT>(key);
+    }
+  };
+
+  /**
+   * @struct
+   * ResolvedPath
+   *
+   * @brief
+   * Cached result of resolving a virtual path.
+   */
+  struct ResolvedPath {
+    String virtualPath;        ///< Key, compared on lookup since the cache is keyed by hash
+    String realPath;           ///< Resolved path
+    core::uint32 archiveIndex; ///< Archive mount point containing "realPath", InvalidIndex if none
+    core::sizeT entryOffset;   ///< Offset of the archive entry name inside of "realPath"
+  };
+
+private:
+  /**
+   * @brief
+   * Recomputes the flattened mount paths and the trie, clears the cache.
+   */
+  void rebuild();
+
+  [[nodiscard]] String flatten_real_path(const String& realPath) const;
+
+  [[nodiscard]] String resolve_uncached(PathView path) const;
+
+  [[nodiscard]] core::uint32 find_mount_index(PathView realPath, bool archivesOnly, core::sizeT& prefixLength) const;
+
+  void resolve_cached(PathView path, String& realPath, core::uint32& archiveIndex, core::sizeT& entryOffset) const;
+
+  void insert_cached(core::uint64 hash, const ResolvedPath& resolvedPath) const;
+
 private:
   /** Vector storing all registered mount points. */
   Vector<MountPoint> mMountPoints;
 
   /** Hash map for quick lookup of mount points by name. */
-  hash_map<String, MountPoint> mMapMountPoints;
+  hash_map<Name, MountPoint> mMapMountPoints;
+
+  /** Real path of each mount point with all mounts resolved. */
+  hash_map<Name, String> mResolvedMountPaths;
+
+  /**
+   * Trie of the resolved real paths, one node per path segment. Node 0 is the root of relative paths,
+   * node 1 the root of absolute ones. Holds the index of the mount point ending at each node.
+   */
+  Vector<core::uint32> mTrieMounts;
+
+  /** Edges of the trie, child node by parent node (upper 32 bits) and interned segment (lower 32 bits). */
+  hash_map<core::uint64, core::uint32, TrieEdgeHash> mTrieEdges;
+
+  /** Cache of resolved paths by hash of the virtual path, in two generations, see "resolve_cached()" */
+  mutable Mutex mCacheMutex;
+  mutable hash_map<core::uint64, ResolvedPath> mCache;
+  mutable hash_map<core::uint64, ResolvedPath> mPreviousCache;
+  core::uint32 mCacheCapacity;
+  mutable core::uint64 mNumCacheHits;
+  mutable core::uint64 mNumCacheMisses;
 };
 
 
@@ -0,0 +1,330 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/default_assert.h"
+#include "core/core/ptr.h"
+#include "core/core/refcounted.h"
+#include "core/container/vector.h"
+#include "core/io/file.h"
+#include "core/io/types.h"
+#include "core/string/string.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Stream;
+
+
+//[-------------------------------------------------------]
+//[ Enumerations                                          ]
+//[-------------------------------------------------------]
+enum class EPackCompression : uint32 {
+  /** Stored as is, reads come straight from the mapping */
+  None,
+  /** LZ4 compressed, see CompressionLZ4 */
+  LZ4
+};
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * PackHeader
+ *
+ * @brief
+ * Header at the very beginning of a pack archive.
+ *
+ * @note
+ * - The header is followed by the entries, the bucket table, the names and the data of the entries
+ * - All values are little endian
+ */
+struct PackHeader {
+  uint32 magic;           ///< Always PackArchive::Magic
+  uint32 version;         ///< Always PackArchive::Version
+  uint32 numberOfEntries; ///< Number of PackEntry elements, sorted by name
+  uint32 numberOfBuckets; ///< Number of buckets of the hashed table of contents, power of two
+  uint32 alignment;       ///< Alignment of the data of every entry inside the archive
+  uint32 reserved;        ///< Always 0
+  uint64 entriesOffset;   ///< Archive offset of the first PackEntry
+  uint64 bucketsOffset;   ///< Archive offset of the uint32 bucket table, each bucket holds entry index + 1, 0 for empty
+  uint64 namesOffset;     ///< Archive offset of the names, each one zero terminated
+  uint64 namesSize;       ///< Number of bytes of all names
+};
+
+/**
+ * @struct
+ * PackEntry
+ *
+ * @brief
+ * Table of contents entry of a single file inside a pack archive.
+ */
+struct PackEntry {
+  uint64 nameHash;              ///< 64 bit FNV-1a hash of the name, see PackArchive::hash_name()
+  uint64 offset;                ///< Archive offset of the stored data, multiple of PackHeader::alignment
+  uint64 storedSize;            ///< Number of stored bytes inside the archive
+  uint64 size;                  ///< Number of bytes of the original file
+  uint64 contentHash;           ///< 64 bit FNV-1a hash of the original file content
+  uint32 nameOffset;            ///< Offset of the name relative to PackHeader::namesOffset
+  uint32 nameLength;            ///< Number of characters of the name, without terminating zero
+  EPackCompression compression; ///< How the data is stored
+  uint32 reserved;              ///< Always 0
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * PackArchive
+ *
+ * @brief
+ * Read-only archive packing many files into a single one.
+ *
+ * The archive is mapped into memory as a whole, looking up an entry is a hash table probe without
+ * any syscall and uncompressed entries are read straight from the mapping. Names are relative paths
+ * using '/' as separator, e.g. "textures/stone.png".
+ *
+ * Archives are created by PackArchiveWriter, or by the pack_tool command line tool, and are usually
+ * mounted through IoServer::mount().
+ */
+class PackArchive : public RefCounted {
+public:
+
+  /** "BPAK" */
+  static constexpr uint32 Magic = 0x4b415042;
+  static constexpr uint32 Version = 1;
+  static constexpr uint32 InvalidIndex = ~0u;
+
+public:
+
+  /**
+   * @brief
+   * Calculates the hash of an entry name as stored inside PackEntry::nameHash.
+   *
+   * @param[in] name
+   * The name, must not be a null pointer
+   * @param[in] length
+   * Number of characters of the name
+   *
+   * @return
+   * The 64 bit FNV-1a hash of the name
+   */
+  [[nodiscard]] static uint64 hash_name(const char* name, sizeT length);
+
+  /**
+   * @brief
+   * Calculates the hash of a file content as stored inside PackEntry::contentHash.
+   *
+   * @param[in] content
+   * The content, may be a null pointer if "numberOfBytes" is 0
+   * @param[in] numberOfBytes
+   * Number of bytes of the content
+   *
+   * @return
+   * The 64 bit FNV-1a hash of the content
+   */
+  [[nodiscard]] static uint64 hash_content(const uint8* content, uint64 numberOfBytes);
+
+public:
+
+  PackArchive();
+
+  ~PackArchive() override;
+
+  /**
+   * @brief
+   * Opens and maps the archive, validates the header and the table of contents.
+   *
+   * @param[in] filename
+   * Native filename of the archive
+   *
+   * @return
+   * 'true' if the archive could be opened, 'false' if it can't be mapped or is malformed
+   */
+  bool open(const String& filename);
+
+  /**
+   * @brief
+   * Unmaps and closes the archive.
+   *
+   * @note
+   * - Streams created by "create_stream()" keep a reference to the archive, only close it explicitly
+   *   if none of them are in use anymore
+   */
+  void close();
+
+  [[nodiscard]] inline bool is_open() const;
+
+  [[nodiscard]] inline const String& get_filename() const;
+
+  [[nodiscard]] inline uint32 get_num_entries() const;
+
+  [[nodiscard]] inline const PackEntry& get_entry(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the zero terminated name of the entry at the given index.
+   */
+  [[nodiscard]] inline const char* get_entry_name(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the stored data of the entry at the given index, compressed if the entry is compressed.
+   */
+  [[nodiscard]] inline const uint8* get_stored_data(uint32 index) const;
+
+  /**
+   * @brief
+   * Looks up an entry by name.
+   *
+   * @param[in] name
+   * Name of the entry, a leading '/' is ignored
+   *
+   * @return
+   * Index of the entry, InvalidIndex if there's no such entry
+   */
+  [[nodiscard]] uint32 find_entry(const String& name) const;
+
+  [[nodiscard]] inline bool has_entry(const String& name) const;
+
+  /**
+   * @brief
+   * Returns whether there's at least one entry inside the given directory, or any of its sub directories.
+   *
+   * @param[in] name
+   * Name of the directory, a leading or trailing '/' is ignored, empty for the root
+   */
+  [[nodiscard]] bool has_directory(const String& name) const;
+
+  /**
+   * @brief
+   * Enumerates the entries of a directory, see Filesystem::enumerate_files().
+   *
+   * @param[in] directoryName
+   * Prefix of the returned names if they are not relative
+   * @param[in] directory
+   * Name of the directory inside the archive, empty for the root
+   * @param[in] enumerationMode
+   * Whether to return files, directories or both
+   * @param[out] entries
+   * Receives the names, entries are appended
+   * @param[in] recursive
+   * Whether to descend into sub directories
+   * @param[in] returnAsRelativePaths
+   * Return the names relative to "directory" instead of prefixed by "directoryName"
+   */
+  void enumerate(const String& directoryName, const String& directory, EEnumerationMode enumerationMode, Vector<String>& entries, bool recursive, bool returnAsRelativePaths) const;
+
+  /**
+   * @brief
+   * Reads the original content of an entry, decompressing it if required.
+   *
+   * @param[in] index
+   * Index of the entry
+   * @param[out] destinationBuffer
+   * Receives the content, must be at least PackEntry::size bytes long
+   *
+   * @return
+   * 'true' if everything went fine, 'false' if the entry couldn't be decompressed
+   */
+  bool read_entry(uint32 index, void* destinationBuffer) const;
+
+  /**
+   * @brief
+   * Reads the entry and compares its content against the stored content hash.
+   *
+   * @return
+   * 'true' if the content is intact, 'false' otherwise
+   */
+  [[nodiscard]] bool verify_entry(uint32 index) const;
+
+  /**
+   * @brief
+   * Creates a read-only stream for the entry at the given index.
+   *
+   * @return
+   * The stream, not opened yet, or an empty pointer if the archive isn't owned by a Ptr.
+   * Uncompressed entries are read straight from the mapping.
+   *
+   * @note
+   * - The stream keeps a reference to the archive, so the archive must be heap allocated and owned by a Ptr;
+   *   archives on the stack or held by a raw pointer only support the other accessors
+   */
+  [[nodiscard]] Ptr<Stream> create_stream(uint32 index);
+
+private:
+
+  /**
+   * @brief
+   * Validates the mapped header and the table of contents, sets up the pointers into the mapping.
+   */
+  [[nodiscard]] bool validate();
+
+  /**
+   * @brief
+   * Returns the index of the first entry whose name isn't less than the given prefix.
+   */
+  [[nodiscard]] uint32 lower_bound(const char* prefix, sizeT length) const;
+
+private:
+
+  File mFile;
+  String mFilename;
+  /** The whole archive as mapped by "mFile", null pointer if not open */
+  const uint8* mData;
+  uint64 mSize;
+  const PackHeader* mHeader;
+  const PackEntry* mEntries;
+  const uint32* mBuckets;
+  const char* mNames;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/pack_archive.inl"
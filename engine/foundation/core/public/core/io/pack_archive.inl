@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline bool PackArchive::is_open() const {
+  return (nullptr != mData);
+}
+
+inline const String& PackArchive::get_filename() const {
+  return mFilename;
+}
+
+inline uint32 PackArchive::get_num_entries() const {
+  return mHeader ? mHeader->numberOfEntries : 0;
+}
+
+inline const PackEntry& PackArchive::get_entry(uint32 index) const {
+  BE_ASSERT(index < get_num_entries(), "Invalid pack archive entry index")
+  return mEntries[index];
+}
+
+inline const char* PackArchive::get_entry_name(uint32 index) const {
+  return mNames + get_entry(index).nameOffset;
+}
+
+inline const uint8* PackArchive::get_stored_data(uint32 index) const {
+  return mData + get_entry(index).offset;
+}
+
+inline bool PackArchive::has_entry(const String& name) const {
+  return (InvalidIndex != find_entry(name));
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/container/hash_set.h"
+#include "core/container/vector.h"
+#include "core/io/pack_archive.h"
+#include "core/string/string.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * PackArchiveWriter
+ *
+ * @brief
+ * Collects files and writes them into a pack archive, see PackArchive for reading.
+ *
+ * Files are only read while writing the archive, one at a time, so packing many large files doesn't
+ * require them to fit into memory at once.
+ */
+class PackArchiveWriter : public NonCopyable {
+public:
+
+  /** Alignment of the data of every entry, keeps entries cache line aligned inside the mapping */
+  static constexpr uint32 DefaultAlignment = 64;
+
+public:
+
+  PackArchiveWriter();
+
+  ~PackArchiveWriter();
+
+  [[nodiscard]] inline uint32 get_alignment() const;
+
+  /**
+   * @brief
+   * Sets the alignment of the data of the entries.
+   *
+   * @param[in] alignment
+   * The alignment, must be a power of two
+   */
+  inline void set_alignment(uint32 alignment);
+
+  [[nodiscard]] inline EPackCompression get_compression() const;
+
+  /**
+   * @brief
+   * Sets how added entries are stored.
+   *
+   * @note
+   * - Entries are only stored compressed if that saves at least an eighth of their size
+   */
+  inline void set_compression(EPackCompression compression);
+
+  [[nodiscard]] inline uint32 get_num_entries() const;
+
+  /**
+   * @brief
+   * Adds a file of the native filesystem.
+   *
+   * @param[in] name
+   * Name of the entry inside the archive, e.g. "textures/stone.png"
+   * @param[in] filename
+   * Native filename of the file, read once "write()" is called
+   *
+   * @return
+   * 'true' if the entry was added, 'false' if the name is empty or already taken
+   */
+  bool add_file(const String& name, const String& filename);
+
+  /**
+   * @brief
+   * Adds an entry with the given content.
+   *
+   * @param[in] name
+   * Name of the entry inside the archive
+   * @param[in] data
+   * The content, copied, may be a null pointer if "numberOfBytes" is 0
+   * @param[in] numberOfBytes
+   * Number of bytes of the content
+   *
+   * @return
+   * 'true' if the entry was added, 'false' if the name is empty or already taken
+   */
+  bool add_data(const String& name, const void* data, uint64 numberOfBytes);
+
+  /**
+   * @brief
+   * Adds all files of a native directory and its sub directories.
+   *
+   * @param[in] directory
+   * Native name of the directory
+   * @param[in] prefix
+   * Prepended to the names of the entries, e.g. "textures" to add the files as "textures/<name>"
+   *
+   * @return
+   * Number of added files
+   */
+  uint32 add_directory(const String& directory, const String& prefix = "");
+
+  /**
+   * @brief
+   * Writes all added entries into a new archive.
+   *
+   * @param[in] filename
+   * Native filename of the archive, overwritten if it exists
+   *
+   * @return
+   * 'true' if everything went fine, 'false' if the archive or any of the files couldn't be written or read
+   */
+  bool write(const String& filename) const;
+
+  /**
+   * @brief
+   * Removes all added entries.
+   */
+  void clear();
+
+private:
+
+  /**
+   * @struct
+   * Entry
+   *
+   * @brief
+   * An entry added but not written yet.
+   */
+  struct Entry {
+    String name;             ///< Name inside the archive
+    String filename;         ///< Native filename, empty if the content is given by "data"
+    uint8* data;             ///< Copy of the content given to "add_data()", owned by the writer
+    uint64 numberOfBytes;    ///< Number of bytes of "data"
+  };
+
+private:
+
+  /**
+   * @brief
+   * Normalizes the name and reserves it, fails if it's empty or already taken.
+   */
+  bool add_name(const String& name, String& normalizedName);
+
+private:
+
+  uint32 mAlignment;
+  EPackCompression mCompression;
+  Vector<Entry> mEntries;
+  hash_set<String> mNames;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/pack_archive_writer.inl"
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/ptr.h"
+#include "core/io/pack_archive.h"
+#include "core/io/stream.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * PackStream
+ *
+ * @brief
+ * Read-only stream over a single entry of a PackArchive.
+ *
+ * Uncompressed entries are served straight from the mapping of the archive, compressed entries are
+ * decompressed into a buffer owned by the stream when it's opened. Created by PackArchive::create_stream().
+ */
+class PackStream : public Stream {
+public:
+
+  PackStream(const Ptr<PackArchive>& archive, uint32 entryIndex);
+
+  ~PackStream() override;
+
+public:
+
+  [[nodiscard]] bool can_read() const override;
+
+  [[nodiscard]] bool can_write() const override;
+
+  [[nodiscard]] bool can_seek() const override;
+
+  [[nodiscard]] bool can_be_mapped() const override;
+
+  [[nodiscard]] sizeT get_size() const override;
+
+  [[nodiscard]] sizeT get_position() const override;
+
+  /**
+   * @brief
+   * Opens the stream, only EFileMode::Read is supported.
+   *
+   * @return
+   * 'true' if everything went fine, 'false' if the access mode isn't supported or the entry can't be
+   * decompressed
+   */
+  bool open() override;
+
+  void close() override;
+
+  sizeT read(void* ptr, sizeT numBytes) override;
+
+  void seek(sizeT offset, EFileSeek seek) override;
+
+  [[nodiscard]] bool eof() const override;
+
+  [[nodiscard]] String get_content_as_string() override;
+
+  void* map() override;
+
+  void unmap() override;
+
+  void* memory_map() override;
+
+  void memory_unmap() override;
+
+private:
+
+  Ptr<PackArchive> mArchive;
+  uint32 mEntryIndex;
+  /** Content of the entry while opened, either inside the mapping of the archive or "mBuffer" */
+  const uint8* mContent;
+  /** Decompressed content of a compressed entry */
+  uint8* mBuffer;
+  sizeT mSize;
+  sizeT mPosition;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
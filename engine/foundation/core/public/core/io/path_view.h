@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Path;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * PathView
+ *
+ * @brief
+ * Non-owning view of a path in the "<mount>:<directory>/<filename>" notation of the IoServer.
+ *
+ * Unlike Path nothing is split or copied on construction, every query scans the viewed characters
+ * and returns views into them. Both '/' and '\' are treated as separators.
+ *
+ * @note
+ * - The viewed text has to outlive the view
+ */
+class PathView {
+public:
+
+  inline PathView();
+
+  inline PathView(const char* path);
+
+  inline PathView(const char* path, sizeT length);
+
+  inline PathView(StringView path);
+
+  inline PathView(const String& path);
+
+public:
+
+  [[nodiscard]] inline bool operator==(const PathView& rhs) const;
+
+  [[nodiscard]] inline bool operator!=(const PathView& rhs) const;
+
+public:
+
+  [[nodiscard]] inline const char* data() const;
+
+  [[nodiscard]] inline sizeT length() const;
+
+  [[nodiscard]] inline bool is_empty() const;
+
+  [[nodiscard]] inline StringView get_view() const;
+
+  /**
+   * @brief
+   * Returns whether the path is absolute, that is starts with a separator.
+   */
+  [[nodiscard]] inline bool is_absolute() const;
+
+  /**
+   * @brief
+   * Returns whether the path ends with a separator.
+   */
+  [[nodiscard]] inline bool is_directory() const;
+
+  /**
+   * @brief
+   * Returns whether the path starts with a mount name, see get_mount_name().
+   */
+  [[nodiscard]] inline bool has_mount() const;
+
+  /**
+   * @brief
+   * Returns the name in front of the first ':', empty if there's a separator before it or no ':' at all.
+   *
+   * @note
+   * - Purely syntactic, "http://host" has the mount name "http" as well
+   */
+  [[nodiscard]] StringView get_mount_name() const;
+
+  /**
+   * @brief
+   * Returns the path behind the mount name and its ':', the whole path if there's no mount name.
+   */
+  [[nodiscard]] PathView get_mount_relative_path() const;
+
+  /**
+   * @brief
+   * Returns everything up to and including the last separator.
+   */
+  [[nodiscard]] PathView get_directory() const;
+
+  /**
+   * @brief
+   * Returns everything behind the last separator, empty for directories.
+   */
+  [[nodiscard]] StringView get_filename() const;
+
+  /**
+   * @brief
+   * Returns the extension of the filename including the '.', empty if there is none.
+   */
+  [[nodiscard]] StringView get_extension() const;
+
+  /**
+   * @brief
+   * Returns the filename up to its first '.'.
+   */
+  [[nodiscard]] StringView get_title() const;
+
+  /**
+   * @brief
+   * Returns the number of non-empty parts of the mount relative path, filename included.
+   *
+   * @note
+   * - Scans the whole path on every call
+   */
+  [[nodiscard]] uint32 get_num_parts() const;
+
+  /**
+   * @brief
+   * Returns the non-empty part with the given index, empty if there aren't that many parts.
+   */
+  [[nodiscard]] StringView get_part(uint32 index) const;
+
+  [[nodiscard]] String to_string() const;
+
+  [[nodiscard]] Path to_path() const;
+
+private:
+
+  [[nodiscard]] static inline bool is_separator(char character);
+
+  [[nodiscard]] sizeT find_last_separator() const;
+
+private:
+
+  const char* mData;
+  sizeT mLength;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/io/path_view.inl"
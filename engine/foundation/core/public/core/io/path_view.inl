@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline PathView::PathView()
+: mData("")
+, mLength(0) {
+}
+
+inline PathView::PathView(const char* path)
+: mData(path ? path : "")
+, mLength(path ? static_cast<sizeT>(strlen(path)) : 0) {
+}
+
+inline PathView::PathView(const char* path, sizeT length)
+: mData(path)
+, mLength(length) {
+}
+
+inline PathView::PathView(StringView path)
+: mData(path.data())
+, mLength(static_cast<sizeT>(path.length())) {
+}
+
+inline PathView::PathView(const String& path)
+: mData(path.c_str())
+, mLength(static_cast<sizeT>(path.length())) {
+}
+
+inline bool PathView::operator==(const PathView& rhs) const {
+  return (mLength == rhs.mLength && (0 == mLength || memcmp(mData, rhs.mData, mLength) == 0));
+}
+
+inline bool PathView::operator!=(const PathView& rhs) const {
+  return !operator==(rhs);
+}
+
+inline const char* PathView::data() const {
+  return mData;
+}
+
+inline sizeT PathView::length() const {
+  return mLength;
+}
+
+inline bool PathView::is_empty() const {
+  return (0 == mLength);
+}
+
+inline StringView PathView::get_view() const {
+  return StringView(mData, mLength);
+}
+
+inline bool PathView::is_absolute() const {
+  return (mLength > 0 && is_separator(mData[0]));
+}
+
+inline bool PathView::is_directory() const {
+  return (mLength > 0 && is_separator(mData[mLength - 1]));
+}
+
+inline bool PathView::has_mount() const {
+  return !get_mount_name().empty();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+inline bool PathView::is_separator(char character) {
+  return ('/' == character || '\\' == character);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
@@ -112,6 +112,24 @@ public:
    */
   [[nodiscard]] EFileMode get_access_mode() const;
 
+  /**
+   * @brief
+   * Sets the expected access pattern, used as hint when the stream gets memory-mapped.
+   *
+   * @param[in] accessPattern
+   * The access pattern, specified as an EAccessPattern enumeration value.
+   */
+  void set_access_pattern(EAccessPattern accessPattern);
+
+  /**
+   * @brief
+   * Retrieves the expected access pattern of the stream.
+   *
+   * @return
+   * The access pattern, specified as an EAccessPattern enumeration value.
+   */
+  [[nodiscard]] EAccessPattern get_access_pattern() const;
+
 
   /**
    * @brief
@@ -213,6 +231,20 @@ public:
    */
   virtual void write(const void* ptr, sizeT numBytes);
 
+  /**
+   * @brief
+   * Writes several buffers one after another (gather write).
+   *
+   * The default implementation calls "write()" for each buffer, streams backed by a file
+   * hand all buffers to the operating system at once.
+   *
+   * @param[in] buffers
+   * Buffers to write in order.
+   * @param[in] numberOfBuffers
+   * The number of buffers.
+   */
+  virtual void write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers);
+
   /**
    * @brief
    * Reads data from the stream.
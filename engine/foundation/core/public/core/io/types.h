@@ -53,8 +53,12 @@ enum class EFileMode {
 };
 
 enum class EAccessPattern {
+  /** Accesses jump around, read-ahead is of no use */
   Random,
-  Sequential
+  /** Accesses walk the data front to back, aggressive read-ahead */
+  Sequential,
+  /** The whole data is going to be accessed soon, start paging it in right away */
+  WillNeed
 };
 
 enum class EFileSeek {
@@ -72,9 +76,38 @@ enum class EEnumerationMode {
   Directories
 };
 
+enum class EByteOrder {
+  /** Least significant byte first */
+  Little,
+  /** Most significant byte first */
+  Big,
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  /** Byte order of the running platform */
+  Native = Big
+#else
+  /** Byte order of the running platform */
+  Native = Little
+#endif
+};
+
 static const constexpr char INVALID_CHARACTER = '?';
 
 
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * One buffer of a vectored (gather) write.
+ */
+struct IoBuffer {
+  /** First byte of the buffer */
+  const void* data;
+  /** Number of bytes inside of the buffer */
+  uint64 numberOfBytes;
+};
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -30,5 +30,9 @@
 //[-------------------------------------------------------]
 #include "core/core.h"
 #include "core/json/json_value.h"
+#include "core/json/json_binary.h"
+#include "core/json/json_document.h"
 #include "core/json/json_parser.h"
+#include "core/json/json_sax_handler.h"
+#include "core/json/json_tape.h"
 #include "core/json/json_writer.h"
\ No newline at end of file
@@ -0,0 +1,392 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/core/non_copyable.h"
+#include "core/json/types.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class JsonElement;
+class JsonValue;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonBinaryElement
+ *
+ * @brief
+ * Lightweight read-only handle to a value inside binary encoded JSON.
+ *
+ * The element decodes the value in place on every access, nothing is copied or allocated.
+ * Elements are only valid as long as the underlying bytes are, and only bytes which passed
+ * JsonBinary::validate() may be accessed. Like JsonElement, a missing member or an out of range
+ * element yields an invalid element, so lookups can be chained.
+ *
+ * Children are visited sequentially with get_first() and get_next(). Inside of objects names
+ * and values alternate, so the name of the first member is get_first(), its value is
+ * get_first().get_next() and the name of the second member follows the value.
+ */
+class JsonBinaryElement {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor, creates an invalid element.
+   */
+  inline JsonBinaryElement();
+
+  /**
+   * @brief
+   * Constructor.
+   *
+   * @param[in] item
+   * Pointer to the first byte of an encoded value, can be a null pointer
+   */
+  explicit JsonBinaryElement(const uint8* item);
+
+  /**
+   * @brief
+   * Returns whether the element references a value.
+   */
+  [[nodiscard]] inline bool is_valid() const;
+
+  [[nodiscard]] EJsonType get_type() const;
+
+  [[nodiscard]] inline bool is_null() const;
+
+  [[nodiscard]] inline bool is_bool() const;
+
+  [[nodiscard]] inline bool is_integer() const;
+
+  [[nodiscard]] inline bool is_number() const;
+
+  [[nodiscard]] inline bool is_string() const;
+
+  [[nodiscard]] inline bool is_array() const;
+
+  [[nodiscard]] inline bool is_object() const;
+
+  [[nodiscard]] inline bool is_raw_text() const;
+
+  [[nodiscard]] bool to_bool() const;
+
+  [[nodiscard]] int64 to_integer() const;
+
+  [[nodiscard]] double to_number() const;
+
+  /**
+   * @brief
+   * Returns the string value.
+   *
+   * @return
+   * View into the encoded bytes, not null terminated
+   */
+  [[nodiscard]] StringView to_string() const;
+
+  /**
+   * @brief
+   * Returns the number of array elements or object members, 0 for all other types.
+   */
+  [[nodiscard]] uint32 get_size() const;
+
+  /**
+   * @brief
+   * Returns the array element at the given index, an invalid element if out of range.
+   *
+   * @note
+   * - Walks the preceding elements, use get_first() and get_next() to visit all of them
+   */
+  [[nodiscard]] JsonBinaryElement operator()(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the object member with the given name, an invalid element if there is none.
+   *
+   * @note
+   * - Compares the names in order, nested containers in between are skipped without being
+   *   visited
+   */
+  [[nodiscard]] JsonBinaryElement operator[](StringView key) const;
+
+  [[nodiscard]] inline bool has_member(StringView key) const;
+
+  [[nodiscard]] StringView get_member_name(uint32 index) const;
+
+  [[nodiscard]] JsonBinaryElement get_member_value(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the first array element or the first member name, an invalid element if empty.
+   */
+  [[nodiscard]] JsonBinaryElement get_first() const;
+
+  /**
+   * @brief
+   * Returns the value encoded right after this one inside of the same container.
+   *
+   * @note
+   * - Only valid if this is not the last child, see get_size()
+   */
+  [[nodiscard]] JsonBinaryElement get_next() const;
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** First byte of the item including tags, used to skip it */
+  const uint8* mItem;
+  /** Head of the value itself behind all tags */
+  const uint8* mValue;
+  /** Whether the value was tagged as raw text block */
+  bool mRawText;
+};
+
+
+/**
+ * @class
+ * JsonBinary
+ *
+ * @brief
+ * Compact binary encoding of the JSON data model.
+ *
+ * The encoding is CBOR (RFC 8949) restricted to the types of JsonValue, so the data can be
+ * inspected with any CBOR tool:
+ * - Integers are major types 0 and 1, numbers are single or double precision floats
+ * - Strings and member names are definite length text strings, raw text blocks carry the tag
+ *   RawTextTag
+ * - Arrays and objects are definite length; nested ones with at least WrapThreshold bytes of
+ *   content are wrapped as encoded CBOR data item (tag 24), whose byte string length lets
+ *   readers skip them in constant time
+ * - Documents start with the self-describe CBOR tag 55799
+ */
+class JsonBinary {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Size of the self-describe tag every document starts with */
+  static constexpr uint32 MagicSize = 3;
+  /** Application specific tag marking '"""' raw text blocks */
+  static constexpr uint16 RawTextTag = 0x6272;
+  /** Nested containers with at least this many bytes of content are made skippable */
+  static constexpr uint32 WrapThreshold = 32;
+  /** Maximum nesting depth of arrays and objects */
+  static constexpr uint32 MaxDepth = 1024;
+
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Encodes a value as document.
+   *
+   * @param[in] value
+   * The value to encode
+   * @param[out] output
+   * Receives the document, previous content is discarded
+   */
+  static void encode(const JsonValue& value, Vector<uint8>& output);
+
+  /**
+   * @brief
+   * Encodes a JsonDocument element as document.
+   */
+  static void encode(const JsonElement& element, Vector<uint8>& output);
+
+  /**
+   * @brief
+   * Converts JSON text into a document.
+   *
+   * @return
+   * 'true' on success, 'false' if the text is no valid JSON
+   */
+  static bool encode_text(const char* data, sizeT size, Vector<uint8>& output);
+
+  /**
+   * @brief
+   * Builds a DOM value from an encoded value.
+   */
+  [[nodiscard]] static JsonValue decode(const JsonBinaryElement& element);
+
+  /**
+   * @brief
+   * Returns whether the data starts like a document.
+   */
+  [[nodiscard]] static bool is_binary(const void* data, sizeT size);
+
+  /**
+   * @brief
+   * Checks that the data is a complete, well-formed document.
+   *
+   * @param[in] data
+   * Pointer to the document
+   * @param[in] size
+   * Size of the document in bytes
+   * @param[out] errorOffset
+   * Receives the offset of the first invalid byte on failure
+   *
+   * @return
+   * 'true' if the document can be accessed through JsonBinaryElement
+   */
+  [[nodiscard]] static bool validate(const void* data, sizeT size, sizeT& errorOffset);
+
+  //[-------------------------------------------------------]
+  //[ Private static functions                              ]
+  //[-------------------------------------------------------]
+private:
+  static void decode_value(const JsonBinaryElement& element, JsonValue* value);
+};
+
+
+/**
+ * @class
+ * JsonBinaryDocument
+ *
+ * @brief
+ * Read-only binary document, either memory mapped from a file or referencing a caller buffer.
+ *
+ * Opening a document validates it once, afterwards values are read directly from the mapped
+ * bytes without building a DOM.
+ */
+class JsonBinaryDocument : public NonCopyable {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor.
+   */
+  JsonBinaryDocument();
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~JsonBinaryDocument() override;
+
+  /**
+   * @brief
+   * Maps a file, the previous content is released.
+   *
+   * @param[in] filename
+   * The file name
+   *
+   * @return
+   * 'true' if the file could be mapped and is a valid document
+   */
+  bool open(const String& filename);
+
+  /**
+   * @brief
+   * References a document in memory, the previous content is released.
+   *
+   * @param[in] data
+   * Pointer to the document, has to outlive this instance
+   * @param[in] size
+   * Size of the document in bytes
+   *
+   * @return
+   * 'true' if the data is a valid document
+   */
+  bool load(const void* data, sizeT size);
+
+  /**
+   * @brief
+   * Releases the content.
+   */
+  void close();
+
+  [[nodiscard]] inline bool is_valid() const;
+
+  /**
+   * @brief
+   * Returns whether the content is a memory mapped file.
+   */
+  [[nodiscard]] inline bool is_mapped() const;
+
+  /**
+   * @brief
+   * Returns the root value, an invalid element if there is no valid content.
+   */
+  [[nodiscard]] inline JsonBinaryElement get_root() const;
+
+  [[nodiscard]] inline const uint8* get_data() const;
+
+  [[nodiscard]] inline sizeT get_size() const;
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Document bytes */
+  const uint8* mData;
+  /** Size of the document in bytes */
+  sizeT mSize;
+  /** Whether mData is a file mapping which has to be unmapped */
+  bool mMapped;
+  /** File content on platforms without memory mapping */
+  Vector<uint8> mContent;
+  /** Whether the content passed validation */
+  bool mValid;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/json/json_binary.inl"
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline JsonBinaryElement::JsonBinaryElement()
+: mItem(nullptr)
+, mValue(nullptr)
+, mRawText(false) {
+
+}
+
+inline bool JsonBinaryElement::is_valid() const {
+  return mValue != nullptr;
+}
+
+inline bool JsonBinaryElement::is_null() const {
+  return get_type() == JsonType_Null;
+}
+
+inline bool JsonBinaryElement::is_bool() const {
+  return get_type() == JsonType_Boolean;
+}
+
+inline bool JsonBinaryElement::is_integer() const {
+  return get_type() == JsonType_Integer;
+}
+
+inline bool JsonBinaryElement::is_number() const {
+  return get_type() == JsonType_Number;
+}
+
+inline bool JsonBinaryElement::is_string() const {
+  return get_type() == JsonType_String;
+}
+
+inline bool JsonBinaryElement::is_array() const {
+  return get_type() == JsonType_Array;
+}
+
+inline bool JsonBinaryElement::is_object() const {
+  return get_type() == JsonType_Object;
+}
+
+inline bool JsonBinaryElement::is_raw_text() const {
+  return mRawText;
+}
+
+inline bool JsonBinaryElement::has_member(StringView key) const {
+  return operator[](key).is_valid();
+}
+
+
+inline bool JsonBinaryDocument::is_valid() const {
+  return mValid;
+}
+
+inline bool JsonBinaryDocument::is_mapped() const {
+  return mMapped;
+}
+
+inline JsonBinaryElement JsonBinaryDocument::get_root() const {
+  return mValid ? JsonBinaryElement(mData + JsonBinary::MagicSize) : JsonBinaryElement();
+}
+
+inline const uint8* JsonBinaryDocument::get_data() const {
+  return mData;
+}
+
+inline sizeT JsonBinaryDocument::get_size() const {
+  return mSize;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
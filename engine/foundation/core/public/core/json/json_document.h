@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/json/json_tape.h"
+#include "core/json/types.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class LinearAllocator;
+struct JsonMember;
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * A single value of a JsonDocument, lives inside the document arena.
+ *
+ * @note
+ * - Arrays point to 'size' contiguous nodes, objects to 'size' contiguous members, optionally
+ *   followed by a hash index
+ */
+struct JsonNode {
+  uint8 type;       ///< EJsonType
+  uint8 rawText;    ///< 1 if the string was a '"""' raw text block
+  uint16 reserved;
+  uint32 size;      ///< String length, number of array elements or number of object members
+  union {
+    bool boolean;
+    int64 integer;
+    double number;
+    const char* string;
+    const JsonNode* elements;
+    const JsonMember* members;
+  };
+};
+
+/**
+ * @brief
+ * A single member of a JSON object, lives inside the document arena.
+ */
+struct JsonMember {
+  const char* key;    ///< Member name, not null terminated
+  uint32 keyLength;   ///< Length of the member name in bytes
+  uint32 keyHash;     ///< FNV-1a hash of the member name
+  JsonNode value;     ///< Member value
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonElement
+ *
+ * @brief
+ * Lightweight read-only handle to a value inside a JsonDocument.
+ *
+ * Elements are only valid as long as the document they were taken from is neither destroyed
+ * nor reparsed. Accessing a missing member or an out of range element yields an invalid element
+ * instead of asserting, so lookups can be chained.
+ */
+class JsonElement {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor, creates an invalid element.
+   */
+  inline JsonElement();
+
+  /**
+   * @brief
+   * Constructor.
+   *
+   * @param[in] node
+   * The node to reference, can be a null pointer
+   */
+  inline explicit JsonElement(const JsonNode* node);
+
+  /**
+   * @brief
+   * Returns whether the element references a value.
+   */
+  [[nodiscard]] inline bool is_valid() const;
+
+  [[nodiscard]] inline EJsonType get_type() const;
+
+  [[nodiscard]] inline bool is_null() const;
+
+  [[nodiscard]] inline bool is_bool() const;
+
+  [[nodiscard]] inline bool is_integer() const;
+
+  [[nodiscard]] inline bool is_number() const;
+
+  [[nodiscard]] inline bool is_string() const;
+
+  [[nodiscard]] inline bool is_array() const;
+
+  [[nodiscard]] inline bool is_object() const;
+
+  [[nodiscard]] inline bool is_raw_text() const;
+
+  [[nodiscard]] inline bool to_bool() const;
+
+  [[nodiscard]] inline int64 to_integer() const;
+
+  [[nodiscard]] inline double to_number() const;
+
+  /**
+   * @brief
+   * Returns the string value.
+   *
+   * @return
+   * View into the document arena or into the unretained input, not null terminated
+   */
+  [[nodiscard]] inline StringView to_string() const;
+
+  /**
+   * @brief
+   * Returns the number of array elements or object members, 0 for all other types.
+   */
+  [[nodiscard]] inline uint32 get_size() const;
+
+  /**
+   * @brief
+   * Returns the array element at the given index, an invalid element if out of range.
+   */
+  [[nodiscard]] inline JsonElement operator()(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the object member with the given name, an invalid element if there is none.
+   *
+   * @note
+   * - Objects with more than JsonDocument::IndexThreshold members are looked up through a hash
+   *   index, smaller ones are scanned comparing hashes first
+   */
+  [[nodiscard]] JsonElement operator[](StringView key) const;
+
+  [[nodiscard]] inline bool has_member(StringView key) const;
+
+  /**
+   * @brief
+   * Returns the name of the object member at the given index.
+   */
+  [[nodiscard]] inline StringView get_member_name(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the value of the object member at the given index.
+   */
+  [[nodiscard]] inline JsonElement get_member_value(uint32 index) const;
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  const JsonNode* mNode;
+};
+
+
+/**
+ * @class
+ * JsonDocument
+ *
+ * @brief
+ * Parsed JSON document whose nodes, strings and child arrays all live in a single arena.
+ *
+ * The document is built from a JsonTape in one pass. The exact arena size is known from the
+ * tape up front, so the whole document is a single allocation which is reused by subsequent
+ * parses as long as it is large enough. Destroying or clearing the document is O(1), there are
+ * no per-node destructors.
+ *
+ * String values and member names without escape sequences are views into the input. By default
+ * the input is copied into the arena so the document is self-contained; pass 'retainInput = false'
+ * to reference the caller's buffer instead, which then has to outlive the document.
+ */
+class JsonDocument : public NonCopyable {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Objects with more members than this get a hash index */
+  static constexpr uint32 IndexThreshold = 8;
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor.
+   */
+  JsonDocument();
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~JsonDocument() override;
+
+  /**
+   * @brief
+   * Parses a JSON document, the previous content is discarded.
+   *
+   * @param[in] data
+   * Pointer to the document
+   * @param[in] size
+   * Size of the document in bytes
+   * @param[in] retainInput
+   * If 'true', the input is copied into the arena, else strings reference 'data' directly
+   *
+   * @return
+   * 'true' on success, 'false' on error, see get_error() and get_error_offset()
+   */
+  bool parse(const char* data, sizeT size, bool retainInput = true);
+
+  /**
+   * @brief
+   * Parses a JSON document, the previous content is discarded.
+   */
+  inline bool parse(const String& input, bool retainInput = true);
+
+  /**
+   * @brief
+   * Discards the content, the arena is kept for the next parse.
+   */
+  void clear();
+
+  [[nodiscard]] inline bool is_valid() const;
+
+  [[nodiscard]] inline const char* get_error() const;
+
+  [[nodiscard]] inline sizeT get_error_offset() const;
+
+  /**
+   * @brief
+   * Returns the root value, an invalid element if nothing has been parsed successfully.
+   */
+  [[nodiscard]] inline JsonElement get_root() const;
+
+  /**
+   * @brief
+   * Returns the number of arena bytes used by the current document.
+   */
+  [[nodiscard]] sizeT get_memory_usage() const;
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  sizeT compute_arena_size(sizeT retainedSize) const;
+
+  void build_node(uint32 index, JsonNode& node);
+
+  const char* build_string(uint32 index, uint32& length);
+
+  void* allocate(sizeT numberOfBytes, sizeT alignment);
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Scratch tape, kept so its buffers are reused */
+  JsonTape mTape;
+  /** Arena holding all nodes, escaped strings and the retained input */
+  LinearAllocator* mArena;
+  /** Root value */
+  JsonNode* mRoot;
+  /** Input the tape references */
+  const char* mInput;
+  /** Size of the input in bytes */
+  sizeT mInputSize;
+  /** Retained copy of the input inside the arena, null pointer if not retained */
+  const char* mRetainedInput;
+  /** Copy of the decoded tape strings inside the arena */
+  const char* mStringBuffer;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/json/json_document.inl"
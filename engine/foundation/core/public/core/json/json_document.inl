@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline JsonElement::JsonElement()
+: mNode(nullptr) {
+
+}
+
+inline JsonElement::JsonElement(const JsonNode* node)
+: mNode(node) {
+
+}
+
+inline bool JsonElement::is_valid() const {
+  return mNode != nullptr;
+}
+
+inline EJsonType JsonElement::get_type() const {
+  return mNode ? static_cast<EJsonType>(mNode->type) : JsonType_Null;
+}
+
+inline bool JsonElement::is_null() const {
+  return get_type() == JsonType_Null;
+}
+
+inline bool JsonElement::is_bool() const {
+  return get_type() == JsonType_Boolean;
+}
+
+inline bool JsonElement::is_integer() const {
+  return get_type() == JsonType_Integer;
+}
+
+inline bool JsonElement::is_number() const {
+  return get_type() == JsonType_Number;
+}
+
+inline bool JsonElement::is_string() const {
+  return get_type() == JsonType_String;
+}
+
+inline bool JsonElement::is_array() const {
+  return get_type() == JsonType_Array;
+}
+
+inline bool JsonElement::is_object() const {
+  return get_type() == JsonType_Object;
+}
+
+inline bool JsonElement::is_raw_text() const {
+  return is_string() && mNode->rawText;
+}
+
+inline bool JsonElement::to_bool() const {
+  BE_ASSERT(is_bool(), "Cannot interpret as bool, is of other type")
+  return mNode->boolean;
+}
+
+inline int64 JsonElement::to_integer() const {
+  BE_ASSERT(is_integer(), "Cannot interpret as integer, is of other type")
+  return mNode->integer;
+}
+
+inline double JsonElement::to_number() const {
+  BE_ASSERT(is_number(), "Cannot interpret as number, is of other type")
+  return mNode->number;
+}
+
+inline StringView JsonElement::to_string() const {
+  BE_ASSERT(is_string(), "Cannot interpret as string, is of other type")
+  return StringView(mNode->string, mNode->size);
+}
+
+inline uint32 JsonElement::get_size() const {
+  return (is_array() || is_object()) ? mNode->size : 0;
+}
+
+inline JsonElement JsonElement::operator()(uint32 index) const {
+  return (is_array() && index < mNode->size) ? JsonElement(&mNode->elements[index]) : JsonElement();
+}
+
+inline bool JsonElement::has_member(StringView key) const {
+  return operator[](key).is_valid();
+}
+
+inline StringView JsonElement::get_member_name(uint32 index) const {
+  BE_ASSERT(is_object() && index < mNode->size, "Invalid object member index")
+  return StringView(mNode->members[index].key, mNode->members[index].keyLength);
+}
+
+inline JsonElement JsonElement::get_member_value(uint32 index) const {
+  return (is_object() && index < mNode->size) ? JsonElement(&mNode->members[index].value) : JsonElement();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline bool JsonDocument::parse(const String& input, bool retainInput) {
+  return parse(input.c_str(), input.size(), retainInput);
+}
+
+inline bool JsonDocument::is_valid() const {
+  return mRoot != nullptr;
+}
+
+inline const char* JsonDocument::get_error() const {
+  return mTape.get_error();
+}
+
+inline sizeT JsonDocument::get_error_offset() const {
+  return mTape.get_error_offset();
+}
+
+inline JsonElement JsonDocument::get_root() const {
+  return JsonElement(mRoot);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
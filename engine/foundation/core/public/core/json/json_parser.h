@@ -41,6 +41,7 @@ namespace core {
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class JsonTape;
 class JsonValue;
 
 
@@ -57,6 +58,10 @@ class JsonValue;
  * The `JsonParser` class provides methods to parse a JSON string into a structured
  * `JsonValue` representation. It supports parsing various JSON data types, such as
  * objects, arrays, strings, numbers, and boolean values.
+ *
+ * The static `parse()` methods use the two-stage `JsonTape` parser and convert the resulting
+ * tape into `JsonValue` objects. The incremental `parse_*()` methods are kept for callers that
+ * drive the parser by hand.
  */
 class JsonParser {
 public:
@@ -75,6 +80,22 @@ public:
    */
   static JsonValue parse(const String& inputString);
 
+  /**
+   * @brief
+   * Static method to parse JSON data held in memory into a `JsonValue`.
+   *
+   * The data is neither copied nor required to be null-terminated.
+   *
+   * @param[in] data
+   * Pointer to the JSON data.
+   * @param[in] size
+   * Size of the JSON data in bytes.
+   *
+   * @return
+   * The parsed `JsonValue`, an empty object if the data is malformed.
+   */
+  static JsonValue parse(const char* data, sizeT size);
+
 public:
   /**
    * @brief
@@ -83,7 +104,8 @@ public:
    * This constructor initializes the parser with the provided JSON string.
    *
    * @param[in] inputString
-   * The input string containing the JSON data to be parsed.
+   * The input string containing the JSON data to be parsed. The string is referenced, not
+   * copied, and must outlive the parser.
    */
   explicit JsonParser(const String& inputString);
 
@@ -217,6 +239,19 @@ public:
   bool parse_string(JsonValue* value);
 
 private:
+  /**
+   * @brief
+   * Converts the value at the given tape index into a `JsonValue`.
+   *
+   * @param[in] tape
+   * The parsed tape.
+   * @param[in] index
+   * Tape index of the value.
+   * @param[out] value
+   * The `JsonValue` to store the converted data.
+   */
+  static void build_value(const JsonTape& tape, uint32 index, JsonValue* value);
+
   /**
    * @brief
    * Retrieves the next character in the input string.
@@ -305,8 +340,10 @@ private:
   String parse_string_internal(JsonValue* value = nullptr);
 
 private:
-  /** The input JSON string to be parsed. */
-  String mInputString;
+  /** The input JSON data to be parsed, not owned. */
+  const char* mInput;
+  /** Size of the input JSON data in bytes. */
+  uint64 mInputSize;
   /** The current position while parsing the string. */
   uint64 mCurrentPosition;
 };
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonSaxHandler
+ *
+ * @brief
+ * Receives the events of an event based JSON reader, see JsonStreamReader.
+ *
+ * All callbacks return 'true' to continue and 'false' to stop reading. The default
+ * implementations ignore the event, so handlers only override what they are interested in.
+ * String views passed to the callbacks are only valid for the duration of the call.
+ */
+class JsonSaxHandler {
+public:
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~JsonSaxHandler();
+
+  virtual bool on_null();
+
+  virtual bool on_bool(bool value);
+
+  virtual bool on_integer(int64 value);
+
+  virtual bool on_number(double value);
+
+  /**
+   * @brief
+   * Called for every string value.
+   *
+   * @param[in] value
+   * The unescaped string
+   * @param[in] rawText
+   * 'true' if the string was a '"""' raw text block
+   */
+  virtual bool on_string(StringView value, bool rawText);
+
+  /**
+   * @brief
+   * Called for every object member name, followed by the events of the member value.
+   */
+  virtual bool on_key(StringView key);
+
+  virtual bool on_begin_object();
+
+  virtual bool on_end_object();
+
+  virtual bool on_begin_array();
+
+  virtual bool on_end_array();
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
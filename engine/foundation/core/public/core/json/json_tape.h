@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/memory/memory.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Type of a single entry on a JSON tape, stored in the upper eight bits of the entry word.
+ */
+enum class EJsonTapeType : uint8 {
+  Null        = 'n',  ///< The literal 'null'
+  True        = 't',  ///< The literal 'true'
+  False       = 'f',  ///< The literal 'false'
+  Integer     = 'l',  ///< A signed 64-bit integer, the value is stored in the following tape word
+  Number      = 'd',  ///< A double precision number, the value is stored in the following tape word
+  String      = '"',  ///< A string or object key, the offset is stored in the following tape word
+  ArrayBegin  = '[',  ///< Start of an array, the payload is the index of the matching 'ArrayEnd'
+  ArrayEnd    = ']',  ///< End of an array, the payload is the index of the matching 'ArrayBegin'
+  ObjectBegin = '{',  ///< Start of an object, the payload is the index of the matching 'ObjectEnd'
+  ObjectEnd   = '}'   ///< End of an object, the payload is the index of the matching 'ObjectBegin'
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * JsonTape
+ *
+ * @brief
+ * Flat, two-stage parsed representation of a JSON document.
+ *
+ * Parsing is split in the same way as simdjson does it:
+ * - Stage one walks the input in 64 byte blocks and classifies all bytes at once (SSE2 when
+ *   available, scalar otherwise). Escaped characters and the inside of strings are resolved with
+ *   bit masks, and the positions of all structural characters, string starts and atom starts are
+ *   written to a structural index. The input is validated as UTF-8 beforehand, pure ASCII runs
+ *   are skipped 16 bytes at a time.
+ * - Stage two walks the structural index and writes the document to a tape, a single array of
+ *   64-bit words: one word per value, plus one payload word for strings and numbers. Containers
+ *   store the index of their matching end entry, so whole subtrees can be skipped in O(1).
+ *
+ * The relaxed dialect of the JsonParser is supported as well: commas are optional, keys may be
+ * unquoted, the root object may omit its braces, '#' starts a comment until the end of the line
+ * and '"""' delimits raw text blocks. Documents using comments or raw text blocks are indexed by
+ * the scalar stage one, since both break the quote parity the vectorized pass relies on.
+ *
+ * Strings without escape sequences are not copied; they reference the input, which therefore has
+ * to outlive the tape. Escaped strings are decoded into a string buffer owned by the tape. All
+ * buffers are kept between calls to parse(), so a tape reused for several documents does not
+ * allocate once it has grown to the largest one.
+ */
+class JsonTape {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Maximum nesting depth of arrays and objects */
+  static constexpr uint32 MaxDepth = 1024;
+  /** Element counts stored on the tape saturate at this value */
+  static constexpr uint32 MaxNumElements = 0xffffff;
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor.
+   */
+  JsonTape();
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~JsonTape();
+
+  /**
+   * @brief
+   * Parses a JSON document.
+   *
+   * @param[in] data
+   * Pointer to the document, must stay valid as long as strings are read from the tape
+   * @param[in] size
+   * Size of the document in bytes, documents are limited to 4 GiB
+   *
+   * @return
+   * 'true' on success, 'false' on error, see get_error() and get_error_offset()
+   */
+  bool parse(const char* data, sizeT size);
+
+  /**
+   * @brief
+   * Parses a JSON document.
+   *
+   * @param[in] input
+   * The document, must stay valid as long as strings are read from the tape
+   *
+   * @return
+   * 'true' on success, 'false' on error
+   */
+  inline bool parse(const String& input);
+
+  /**
+   * @brief
+   * Resets the tape, the allocated buffers are kept.
+   */
+  void clear();
+
+  /**
+   * @brief
+   * Returns whether the last parse() call succeeded.
+   */
+  [[nodiscard]] inline bool is_valid() const;
+
+  /**
+   * @brief
+   * Returns the error message of the last parse() call, empty string on success.
+   */
+  [[nodiscard]] inline const char* get_error() const;
+
+  /**
+   * @brief
+   * Returns the byte offset inside the input at which the last parse() call failed.
+   */
+  [[nodiscard]] inline sizeT get_error_offset() const;
+
+  /**
+   * @brief
+   * Returns whether the vectorized stage one was used for the last document.
+   */
+  [[nodiscard]] inline bool is_vectorized() const;
+
+  /**
+   * @brief
+   * Returns the number of entries on the tape, the root value is always at index 0.
+   */
+  [[nodiscard]] inline uint32 get_size() const;
+
+  /**
+   * @brief
+   * Returns the number of structural positions found by stage one.
+   */
+  [[nodiscard]] inline uint32 get_num_structurals() const;
+
+  /**
+   * @brief
+   * Returns the type of the entry at the given tape index.
+   */
+  [[nodiscard]] inline EJsonTapeType get_type(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the tape index of the value following the value at the given index.
+   *
+   * @note
+   * - For arrays and objects, the whole container is skipped
+   */
+  [[nodiscard]] inline uint32 get_next(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the number of elements of an array or the number of members of an object.
+   *
+   * @note
+   * - Saturates at MaxNumElements, iterate the container for larger counts
+   */
+  [[nodiscard]] inline uint32 get_num_elements(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the integer stored at the given tape index.
+   */
+  [[nodiscard]] inline int64 get_integer(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the number stored at the given tape index.
+   */
+  [[nodiscard]] inline double get_number(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the string stored at the given tape index.
+   *
+   * @return
+   * View into either the input or the string buffer of the tape
+   */
+  [[nodiscard]] inline StringView get_string(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns whether the string at the given tape index was a '"""' raw text block.
+   */
+  [[nodiscard]] inline bool is_raw_text(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the buffer holding all decoded escaped strings.
+   */
+  [[nodiscard]] inline const char* get_string_buffer() const;
+
+  /**
+   * @brief
+   * Returns the size of the decoded string buffer in bytes.
+   */
+  [[nodiscard]] inline sizeT get_string_buffer_size() const;
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  static constexpr uint64 PayloadMask = 0x00ffffffffffffffull;
+  static constexpr uint64 StringRawFlag = 1ull << 55;
+  static constexpr uint64 StringBufferFlag = 1ull << 54;
+  static constexpr uint64 StringLengthMask = 0xffffffffull;
+  static constexpr uint64 NumElementsMask = MaxNumElements;
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  bool build_structural_index();
+
+  bool build_structural_index_scalar();
+
+  bool build_tape();
+
+  bool parse_value(uint32 depth);
+
+  bool parse_object(bool implicitRoot, uint32 depth);
+
+  bool parse_array(uint32 depth);
+
+  bool parse_string(sizeT position);
+
+  bool parse_unquoted_key(sizeT position);
+
+  bool parse_number(sizeT position);
+
+  bool parse_literal(sizeT position, const char* literal, uint32 length, EJsonTapeType type);
+
+  bool is_terminator(sizeT position) const;
+
+  inline void append_entry(EJsonTapeType type, uint64 payload);
+
+  bool set_error(const char* error, sizeT offset);
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** The document, not owned */
+  const char* mInput;
+  /** Size of the document in bytes */
+  sizeT mInputSize;
+  /** Stage one output: offsets of all structural characters, string and atom starts */
+  Vector<uint32> mStructurals;
+  /** Number of valid entries inside mStructurals */
+  uint32 mNumStructurals;
+  /** Stage two cursor inside mStructurals */
+  uint32 mNextStructural;
+  /** Stage two output */
+  Vector<uint64> mTape;
+  /** Decoded escaped strings */
+  Vector<char> mStringBuffer;
+  /** Error message of the last parse, empty on success */
+  const char* mError;
+  /** Byte offset of the error */
+  sizeT mErrorOffset;
+  /** Whether the vectorized stage one was used */
+  bool mVectorized;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/json/json_tape.inl"
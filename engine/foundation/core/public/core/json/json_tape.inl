@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline bool JsonTape::parse(const String& input) {
+  return parse(input.c_str(), input.size());
+}
+
+inline bool JsonTape::is_valid() const {
+  return (mError[0] == '\0') && !mTape.empty();
+}
+
+inline const char* JsonTape::get_error() const {
+  return mError;
+}
+
+inline sizeT JsonTape::get_error_offset() const {
+  return mErrorOffset;
+}
+
+inline bool JsonTape::is_vectorized() const {
+  return mVectorized;
+}
+
+inline uint32 JsonTape::get_size() const {
+  return mTape.size();
+}
+
+inline uint32 JsonTape::get_num_structurals() const {
+  return mNumStructurals;
+}
+
+inline EJsonTapeType JsonTape::get_type(uint32 index) const {
+  return static_cast<EJsonTapeType>(mTape[index] >> 56);
+}
+
+inline uint32 JsonTape::get_next(uint32 index) const {
+  switch (get_type(index)) {
+    case EJsonTapeType::ArrayBegin:
+    case EJsonTapeType::ObjectBegin:
+      return static_cast<uint32>(mTape[index] & StringLengthMask) + 1;
+
+    case EJsonTapeType::Integer:
+    case EJsonTapeType::Number:
+    case EJsonTapeType::String:
+      return index + 2;
+
+    default:
+      return index + 1;
+  }
+}
+
+inline uint32 JsonTape::get_num_elements(uint32 index) const {
+  return static_cast<uint32>((mTape[index] >> 32) & NumElementsMask);
+}
+
+inline int64 JsonTape::get_integer(uint32 index) const {
+  return static_cast<int64>(mTape[index + 1]);
+}
+
+inline double JsonTape::get_number(uint32 index) const {
+  double value;
+  Memory::copy(&value, &mTape[index + 1], sizeof(double));
+  return value;
+}
+
+inline StringView JsonTape::get_string(uint32 index) const {
+  const uint64 entry = mTape[index];
+  const char* base = (entry & StringBufferFlag) ? mStringBuffer.data() : mInput;
+  return StringView(base + mTape[index + 1], static_cast<StringView::size_type>(entry & StringLengthMask));
+}
+
+inline bool JsonTape::is_raw_text(uint32 index) const {
+  return (mTape[index] & StringRawFlag) != 0;
+}
+
+inline const char* JsonTape::get_string_buffer() const {
+  return mStringBuffer.data();
+}
+
+inline sizeT JsonTape::get_string_buffer_size() const {
+  return mStringBuffer.size();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+inline void JsonTape::append_entry(EJsonTapeType type, uint64 payload) {
+  mTape.push_back((static_cast<uint64>(type) << 56) | (payload & PayloadMask));
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -63,6 +63,7 @@ namespace core {
 class JsonValue {
 
   friend class JsonParser; ///< The JsonParser class is a friend class, giving it access to private members.
+  friend class JsonBinary; ///< Builds values from the binary encoding.
 
 public:
   /**
@@ -425,7 +426,7 @@ private:
    * @brief
    * Copy data from another `JsonValue`.
    *
-   * This method handles both copying data and ensuring proper resource management.
+   * Constructs the array, object or string in place, the storage must not hold one already.
    *
    * @param[in] rhs
    * The `JsonValue` to copy from.
@@ -436,13 +437,21 @@ private:
    * @brief
    * Move data from another `JsonValue`.
    *
-   * This method handles moving data from the source `JsonValue`.
+   * Constructs the array, object or string in place, the storage must not hold one already.
    *
    * @param[in] rhs
    * The `JsonValue` to move from.
    */
   void copy_from(JsonValue&& rhs);
 
+  /**
+   * @brief
+   * Destroys the array, object or string held by this value and turns it into null.
+   *
+   * copy_from() constructs into the storage, so it has to be called on a destroyed or new value.
+   */
+  void destroy();
+
 private:
   /** The type of the JSON value (boolean, integer, etc.). */
   EJsonType mType;
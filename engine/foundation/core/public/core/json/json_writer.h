@@ -95,129 +95,119 @@ private:
    * Converts a `JsonValue` to its string representation (recursive).
    *
    * This is a helper method that converts any `JsonValue` to its string form depending on its type.
-   * It is called recursively for nested arrays and objects.
+   * It is called recursively for nested arrays and objects, all levels append to the same string
+   * so the cost stays linear in the size of the output.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` object to convert to a string.
    * @param[in] level
    * The current level of indentation for nested structures.
-   *
-   * @return
-   * A string representation of the `JsonValue`.
    */
-  String value_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void value_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts a `null` value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing a null value.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * The string `"null"`.
    */
-  String null_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void null_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts a boolean value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing a boolean value.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * The string `"true"` or `"false"`.
    */
-  String boolean_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void boolean_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts a numeric value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing a numeric value (either integer or float).
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * A string representation of the number.
    */
-  String number_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void number_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts an integer value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing an integer.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * A string representation of the integer.
    */
-  String integer_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void integer_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts a string value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing a string.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * A string representation of the string (with appropriate escaping).
    */
-  String string_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void string_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts an array value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing an array.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * A string representation of the array, with elements serialized in JSON format.
    */
-  String array_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void array_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
    * Converts an object value to its string representation.
    *
+   * @param[in, out] result
+   * The string the representation is appended to.
    * @param[in] jsonValue
    * The `JsonValue` representing an object.
    * @param[in] level
    * The current level of indentation.
-   *
-   * @return
-   * A string representation of the object, with key-value pairs serialized in JSON format.
    */
-  String object_to_string(const JsonValue& jsonValue, uint64 level = 0);
+  void object_to_string(String& result, const JsonValue& jsonValue, uint64 level = 0);
 
   /**
    * @brief
-   * Creates indentation for nested structures.
-   *
-   * Generates a string consisting of spaces for indentation at the specified level.
+   * Appends indentation for nested structures.
    *
+   * @param[in, out] result
+   * The string the indentation is appended to.
    * @param[in] level
    * The level of indentation.
-   *
-   * @return
-   * A string with spaces for indentation.
    */
-  String make_indent(uint64 level);
+  void make_indent(String& result, uint64 level);
 
 private:
 
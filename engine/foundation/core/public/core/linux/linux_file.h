@@ -143,6 +143,45 @@ public:
    */
   void skip(uint64 numberOfBytes) override;
 
+  /**
+   * @brief
+   * Read a requested number of bytes from the given file offset using pread.
+   *
+   * @param[in] offset
+   * Absolute byte offset inside the file to start reading at
+   * @param[out] destinationBuffer
+   * Destination buffer were to write to, must be at least "numberOfBytes" long
+   * @param[in] numberOfBytes
+   * Number of bytes to read into the destination buffer
+   *
+   * @return
+   * The number of read bytes
+   *
+   * @note
+   * - Lock free and without shared cursor, safe to call from several threads at once
+   */
+  uint64 read_at(uint64 offset, void* destinationBuffer, uint64 numberOfBytes) override;
+
+  /**
+   * @brief
+   * Maps the whole file read-only and shared into memory using mmap.
+   *
+   * @param[in] accessPattern
+   * Expected access pattern, forwarded to madvise
+   * @param[out] numberOfBytes
+   * Receives the number of mapped bytes, 0 on failure
+   *
+   * @return
+   * Pointer to the first mapped byte, null pointer on failure
+   */
+  const void* map(EAccessPattern accessPattern, uint64& numberOfBytes) override;
+
+  /**
+   * @brief
+   * Releases the mapping established by "map()".
+   */
+  void unmap() override;
+
   //[-------------------------------------------------------]
   //[ Write                                                 ]
   //[-------------------------------------------------------]
@@ -159,6 +198,43 @@ public:
    */
   uint64 write(const void *sourceBuffer, uint64 numberOfBytes) override;
 
+  /**
+   * @brief
+   * Write a requested number of bytes at the given file offset using pwrite.
+   *
+   * @param[in] offset
+   * Absolute byte offset inside the file to start writing at
+   * @param[in] sourceBuffer
+   * Source buffer were to read from, must be at least "numberOfBytes" long
+   * @param[in] numberOfBytes
+   * Number of bytes to write into the file
+   *
+   * @return
+   * The number of written bytes
+   *
+   * @note
+   * - Without shared cursor, safe to call from several threads at once
+   * - Flushes the bytes buffered by "write()" first, so both can be mixed
+   */
+  uint64 write_at(uint64 offset, const void* sourceBuffer, uint64 numberOfBytes) override;
+
+  /**
+   * @brief
+   * Write several buffers at the current file position using writev.
+   *
+   * @param[in] buffers
+   * Buffers to write in order
+   * @param[in] numberOfBuffers
+   * Number of buffers
+   *
+   * @return
+   * The number of written bytes
+   *
+   * @note
+   * - Flushes pending stdio data first, the buffers themselves bypass the stdio buffer
+   */
+  uint64 write_vectored(const IoBuffer* buffers, uint32 numberOfBuffers) override;
+
   /**
    * @brief
    * Gets the last modification time of the file.
@@ -182,8 +258,14 @@ public:
 private:
 
   FILE* mFile;
+  /** Descriptor behind "mFile", cached for the positional functions, -1 if not opened */
+  int mFileDescriptor;
   EFileMode mAccess;
   core::String mAbsoluteFilename;
+  /** Start of the mmap'ed file content, null pointer if not mapped */
+  void* mMappedData;
+  /** Number of mmap'ed bytes */
+  uint64 mMappedSize;
 };
 
 
@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * LinuxIoUring
+ *
+ * @brief
+ * Minimal io_uring submission/completion ring, talks to the kernel through the raw system calls
+ * so there's no dependency on liburing.
+ *
+ * @note
+ * - Not thread-safe, a ring is meant to be driven by a single thread
+ * - Requires a kernel supporting IORING_OP_READ (5.6+), "initialize()" fails otherwise
+ */
+class LinuxIoUring : public NonCopyable {
+public:
+
+  /**
+   * @brief
+   * Constructor, the ring is not initialized.
+   */
+  LinuxIoUring();
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~LinuxIoUring();
+
+  /**
+   * @brief
+   * Creates the ring.
+   *
+   * @param[in] numberOfEntries
+   * Requested number of submission queue entries, rounded up to a power of two by the kernel
+   *
+   * @return
+   * 'true' if all went fine, 'false' if io_uring is unavailable (old kernel, seccomp, ...)
+   */
+  bool initialize(uint32 numberOfEntries);
+
+  /**
+   * @brief
+   * Destroys the ring, requests still in flight are abandoned.
+   */
+  void deinitialize();
+
+  /**
+   * @brief
+   * Returns whether or not the ring has been created.
+   */
+  [[nodiscard]] bool is_initialized() const;
+
+  /**
+   * @brief
+   * Returns the number of submission queue entries.
+   */
+  [[nodiscard]] uint32 get_num_entries() const;
+
+  /**
+   * @brief
+   * Queues a read, it's handed to the kernel by the next "submit()".
+   *
+   * @param[in] fileDescriptor
+   * File to read from
+   * @param[out] buffer
+   * Destination buffer, must stay valid until the completion has been reaped
+   * @param[in] numberOfBytes
+   * Number of bytes to read
+   * @param[in] offset
+   * File offset to read from
+   * @param[in] userData
+   * Value handed back with the completion
+   *
+   * @return
+   * 'true' if the read has been queued, 'false' if the submission queue is full
+   */
+  bool prepare_read(int fileDescriptor, void* buffer, uint32 numberOfBytes, uint64 offset, uint64 userData);
+
+  /**
+   * @brief
+   * Hands all queued requests to the kernel and optionally waits for completions.
+   *
+   * @param[in] minimumNumberOfCompletions
+   * Number of completions to wait for, 0 to return immediately
+   *
+   * @return
+   * Number of submitted requests, < 0 on error (negative errno)
+   */
+  int32 submit(uint32 minimumNumberOfCompletions);
+
+  /**
+   * @brief
+   * Takes the next completion, never blocks.
+   *
+   * @param[out] userData
+   * Receives the value passed to "prepare_read()"
+   * @param[out] result
+   * Receives the number of read bytes, negative errno on failure
+   *
+   * @return
+   * 'true' if there was a completion, else 'false'
+   */
+  bool pop_completion(uint64& userData, int32& result);
+
+  /**
+   * @brief
+   * Takes back the most recently queued request which hasn't been handed to the kernel yet.
+   *
+   * @param[out] userData
+   * Receives the value passed to "prepare_read()"
+   *
+   * @return
+   * 'true' if there was an unsubmitted request, else 'false'
+   */
+  bool pop_unsubmitted(uint64& userData);
+
+private:
+
+  int mRingFileDescriptor;
+  uint32 mNumEntries;
+  uint32 mNumUnsubmitted;
+  // Submission queue ring, shared with the kernel
+  void* mSubmissionRing;
+  sizeT mSubmissionRingSize;
+  uint32* mSubmissionHead;
+  uint32* mSubmissionTail;
+  uint32* mSubmissionMask;
+  uint32* mSubmissionArray;
+  io_uring_sqe* mSubmissionEntries;
+  sizeT mSubmissionEntriesSize;
+  // Completion queue ring, shared with the kernel, may be the same mapping as the submission ring
+  void* mCompletionRing;
+  sizeT mCompletionRingSize;
+  uint32* mCompletionHead;
+  uint32* mCompletionTail;
+  uint32* mCompletionMask;
+  io_uring_cqe* mCompletionEntries;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -30,6 +30,7 @@
 //[-------------------------------------------------------]
 #include "core/core.h"
 #include "core/platform/platform_impl.h"
+#include <mutex>
 #include <sys/utsname.h>
 
 
@@ -235,10 +236,12 @@ public:
 
 private:
 
-  void initialize_cpu_info();
+  void initialize_cpu_info() const;
 
 private:
-  CPUInfo mCpuInfo;
+  /** CPU information, gathered on first request */
+  mutable CPUInfo mCpuInfo;
+  mutable std::once_flag mCpuInfoOnce;
   /** Has 'm_sName' a valid value? */
   bool		   mSysInfoInit;
   /** Basic system information */
@@ -34,6 +34,24 @@
 #include <queue>
 
 
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Highest log level which is compiled into the binary
+*
+*  @remarks
+*    Log statements with a level above this value are removed entirely at compile time,
+*    neither the log level check nor the text expression is emitted. Define it on the
+*    command line (e.g. "-DBE_LOG_COMPILE_LEVEL=6" keeps "Info" and strips all debug levels)
+*    to override the default, which keeps all log levels.
+*/
+#ifndef BE_LOG_COMPILE_LEVEL
+  #define BE_LOG_COMPILE_LEVEL core::Log::Debug
+#endif
+
+
 //[-------------------------------------------------------]
 //[ Macro definitions                                     ]
 //[-------------------------------------------------------]
@@ -45,24 +63,26 @@
 *    Log level
 *  @param[in] Text
 *    Text which should be written into the log
+*
+*  @remarks
+*    The text expression is only evaluated if the log level is enabled at runtime, the
+*    source location is stored once per call site inside a static log site descriptor.
 */
 #define BE_LOG(Level, Text) { \
-  if (core::Log::instance().get_log_level() >= core::Log::Level) { \
-    core::Log::LogLevel nLogLevel = core::Log::Level; /* Avoid 'expression is constant' warning */ \
-    if (nLogLevel >= core::Log::Debug) { \
-      core::String sLogString = Text; \
-      core::Log::instance().output(core::Log::Level, sLogString + __FILE__ + core::to_string(__LINE__) + __FUNCTION__); \
-    } else core::Log::instance().output(core::Log::Level, Text); \
+  if constexpr (core::Log::Level <= BE_LOG_COMPILE_LEVEL) { \
+    if (core::Log::instance().is_enabled(core::Log::Level)) { \
+      static const core::LogSite SLogSite = { core::Log::Level, __FILE__, __FUNCTION__, __LINE__ }; \
+      core::Log::instance().output(SLogSite, Text); \
+    } \
   } \
 }
 
 #define BE_LOG_CONDITION(COND, Level, Text) { \
-  if (!(COND) && core::Log::instance().get_log_level() >= core::Log::Level) { \
-    core::Log::LogLevel nLogLevel = core::Log::Level; /* Avoid 'expression is constant' warning */ \
-    if (nLogLevel >= core::Log::Debug) { \
-      core::String sLogString = Text; \
-      core::Log::instance().output(core::Log::Level, sLogString + __FILE__ + core::to_string(__LINE__) + __FUNCTION__); \
-    } else core::Log::instance().output(core::Log::Level, Text); \
+  if constexpr (core::Log::Level <= BE_LOG_COMPILE_LEVEL) { \
+    if (!(COND) && core::Log::instance().is_enabled(core::Log::Level)) { \
+      static const core::LogSite SLogSite = { core::Log::Level, __FILE__, __FUNCTION__, __LINE__ }; \
+      core::Log::instance().output(SLogSite, Text); \
+    } \
   } \
 }
 
@@ -78,6 +98,25 @@ namespace core {
 class LogFormatter;
 
 
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static description of a log call site
+*
+*  @remarks
+*    Instances are created once per "BE_LOG" call site, so the source location
+*    doesn't have to be concatenated into the log text on every call.
+*/
+struct LogSite {
+  uint8 nLogLevel;        /**< Log level of the call site */
+  const char *pszFile;    /**< Source file name, never a null pointer */
+  const char *pszFunction;  /**< Function name, never a null pointer */
+  uint32 nLine;          /**< Source line */
+};
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -191,6 +230,35 @@ public:
   */
   inline bool output(uint8 nLogLevel, const String &sText);
 
+  /**
+  *  @brief
+  *    Write a string of a log call site into the log
+  *
+  *  @param[in] cLogSite
+  *    Static log call site description
+  *  @param[in] sText
+  *    Text which should be written into the log
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  *
+  *  @remarks
+  *    For debug log levels the source location of the call site is added to the output.
+  */
+  inline bool output(const LogSite &cLogSite, const String &sText);
+
+  /**
+  *  @brief
+  *    Check whether or not messages of the given log level are written
+  *
+  *  @param[in] nLogLevel
+  *    Log level to check
+  *
+  *  @return
+  *    'true' if the log level is enabled, else 'false'
+  */
+  inline bool is_enabled(uint8 nLogLevel) const;
+
   /**
   *  @brief
   *    get current log level
@@ -338,11 +406,13 @@ private:
   *    Log Level
   *  @param[in] sText
   *    Text which should be written into the log
+  *  @param[in] pLogSite
+  *    Optional log call site description, can be a null pointer
   *
   *  @return
   *    'true' if all went fine, else 'false'
   */
-  CORE_API bool write(uint8 nLogLevel, const String &sText);
+  CORE_API bool write(uint8 nLogLevel, const String &sText, const LogSite *pLogSite = nullptr);
 
 
   //[-------------------------------------------------------]
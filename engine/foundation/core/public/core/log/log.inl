@@ -61,6 +61,23 @@ inline bool Log::output(uint8 nLogLevel, const String &sText) {
   return (nLogLevel > Quiet && nLogLevel <= m_nLogLevel && write(nLogLevel, sText));
 }
 
+/**
+*  @brief
+*    Write a string of a log call site into the log
+*/
+inline bool Log::output(const LogSite &cLogSite, const String &sText) {
+  // Check log level
+  return (is_enabled(cLogSite.nLogLevel) && write(cLogSite.nLogLevel, sText, &cLogSite));
+}
+
+/**
+*  @brief
+*    Check whether or not messages of the given log level are written
+*/
+inline bool Log::is_enabled(uint8 nLogLevel) const {
+  return (nLogLevel > Quiet && nLogLevel <= m_nLogLevel);
+}
+
 /**
 *  @brief
 *    get current log level
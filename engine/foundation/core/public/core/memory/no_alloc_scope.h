@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * NoAllocScope
+ *
+ * @brief
+ * Marks a scope of the current thread in which no heap allocation must happen.
+ *
+ * The heap allocators (StdAllocator, MimallocAllocator and with them everything going through
+ * Memory) report every allocation to this class while a scope is active on the allocating
+ * thread, the RHI command buffers report their growth as well. A violation is written to
+ * stderr together with the name of the innermost scope and a stack trace, and aborts the
+ * process if the violation mode is EViolationMode::Abort.
+ *
+ * @note
+ * - Use the BE_ASSERT_NO_ALLOC macro, the checks are only compiled in if BE_NO_ALLOC_CHECKS is
+ *   defined (CMake option "RE_NO_ALLOC_CHECKS"), so hot paths can carry the scope permanently
+ * - Scopes can be nested, reporting doesn't allocate
+ * - LinearAllocator, StackAllocator and PoolAllocator hand out memory reserved up front and aren't
+ *   reported, only the blocks they get through Memory are; a pool growing by a chunk is a violation,
+ *   taking a block from its free list isn't
+ */
+class NoAllocScope : public NonCopyable {
+public:
+
+  /**
+   * @brief
+   * What to do when an allocation happens inside a scope
+   */
+  enum class EViolationMode {
+    Report,  ///< Print the violation and continue
+    Abort    ///< Print the violation and break into the debugger/abort
+  };
+
+public:
+
+  /**
+   * @brief
+   * Returns whether or not a scope is active on the current thread.
+   */
+  [[nodiscard]] static inline bool is_active();
+
+  /**
+   * @brief
+   * Called by the allocators for each allocation while a scope is active.
+   *
+   * @param[in] numberOfBytes
+   * Number of requested bytes
+   * @param[in] allocatorName
+   * Name of the allocator, used for the report
+   */
+  static void on_allocation(sizeT numberOfBytes, const char* allocatorName);
+
+  /**
+   * @brief
+   * Returns the current violation mode, EViolationMode::Report by default.
+   */
+  [[nodiscard]] static EViolationMode get_violation_mode();
+
+  /**
+   * @brief
+   * Sets the violation mode for all threads.
+   */
+  static void set_violation_mode(EViolationMode violationMode);
+
+  /**
+   * @brief
+   * Returns the number of violations over all threads since the program start.
+   */
+  [[nodiscard]] static uint32 get_num_violations();
+
+public:
+
+  /**
+   * @brief
+   * Enters the scope.
+   *
+   * @param[in] name
+   * Name of the scope, must stay valid during the lifetime of the scope
+   * @param[in] file
+   * Source file of the scope
+   * @param[in] line
+   * Source line of the scope
+   */
+  NoAllocScope(const char* name, const char* file, uint32 line);
+
+  /**
+   * @brief
+   * Leaves the scope.
+   */
+  ~NoAllocScope();
+
+private:
+
+  /** Innermost scope of the current thread, null pointer if there's none */
+  static thread_local const NoAllocScope* SCurrentScope;
+
+  const char* mName;
+  const char* mFile;
+  uint32 mLine;
+  const NoAllocScope* mParentScope;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/memory/no_alloc_scope.inl"
+
+
+//[-------------------------------------------------------]
+//[ Macro definitions                                     ]
+//[-------------------------------------------------------]
+#define BE_NO_ALLOC_SCOPE_NAME_INTERNAL(Line) noAllocScope##Line
+#define BE_NO_ALLOC_SCOPE_NAME(Line) BE_NO_ALLOC_SCOPE_NAME_INTERNAL(Line)
+
+#if defined(BE_NO_ALLOC_CHECKS)
+/**
+ * @brief
+ * Asserts that no heap allocation happens until the end of the enclosing scope
+ *
+ * @param[in] Name
+ * Name of the scope as string literal, e.g. "InputServer::update"
+ */
+#define BE_ASSERT_NO_ALLOC(Name) \
+const core::NoAllocScope BE_NO_ALLOC_SCOPE_NAME(__LINE__)(Name, __FILE__, static_cast<core::uint32>(__LINE__));
+
+/**
+ * @brief
+ * Reports an allocation of an allocator to the active no-allocation scope, if any
+ */
+#define BE_TRACK_NO_ALLOC(size, allocator_name) \
+if (core::NoAllocScope::is_active()) core::NoAllocScope::on_allocation(size, allocator_name);
+#else
+#define BE_ASSERT_NO_ALLOC(Name)
+#define BE_TRACK_NO_ALLOC(size, allocator_name)
+#endif
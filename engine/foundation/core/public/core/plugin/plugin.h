@@ -82,6 +82,18 @@ public:
   ~Plugin() override;
 
 
+  /**
+   * @brief Get the name of the plugin.
+   * @return The name as a constant reference to a String.
+   */
+  const String& get_name() const;
+
+  /**
+   * @brief Set the name for the plugin.
+   * @param name The name to set as a constant reference to a String.
+   */
+  void set_name(const String& name);
+
   /**
    * @brief Get the filename of the plugin.
    *
@@ -146,6 +158,8 @@ public:
   virtual void on_uninstall() = 0;
 
 protected:
+  /** The name of the plugin */
+  String mName;
   /** The filename of the plugin */
   String mFileName;
   Library* mLibrary;
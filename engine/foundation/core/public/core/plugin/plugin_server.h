@@ -115,6 +115,30 @@ public:
    */
   bool load_plugin(const String& pluginName, const String& filename);
 
+  /**
+   * @brief
+   * Registers a plugin without loading it.
+   * The shared library is only loaded on the first get_plugin() call with the plugin name, so
+   * registering all known plugins at startup is cheap.
+   * @param pluginName The name of the plugin.
+   * @param filename The filename of the shared library containing the plugin.
+   */
+  void register_plugin(const String& pluginName, const String& filename);
+
+  /**
+   * @brief
+   * Get a plugin by its name, a registered plugin is loaded on the first call.
+   * @param pluginName The name of the plugin.
+   * @return The plugin, or a null pointer if there's no such plugin or it failed to load.
+   */
+  TPlugin* get_plugin(const String& pluginName);
+
+  /**
+   * @brief
+   * Load all registered plugins which haven't been loaded yet.
+   */
+  void load_registered_plugins();
+
   /**
    * @brief
    * Unload all plugins loaded by this server.
@@ -140,11 +164,25 @@ protected:
    */
   TPlugin* create_plugin(const String& pluginName, const String& filename);
 
+protected:
+  /**
+   * @struct
+   * RegisteredPlugin
+   * @brief
+   * Plugin registered with register_plugin() but not loaded yet.
+   */
+  struct RegisteredPlugin {
+    String name;
+    String filename;
+  };
+
 protected:
   String mLoaderMethod;
   TCore* mCore;
   /** List of all loaded plugins */
   Vector<TPlugin*> mPlugins;
+  /** List of all registered plugins which haven't been loaded yet */
+  Vector<RegisteredPlugin> mRegisteredPlugins;
 };
 
 //[-------------------------------------------------------]
@@ -24,6 +24,7 @@
 //[-------------------------------------------------------]
 #include "core/platform/library.h"
 #include "core/plugin/plugin.h"
+#include "core/profiling/startup_tracer.h"
 
 
 //[-------------------------------------------------------]
@@ -65,6 +66,14 @@ bool PluginServer<TPlugin, TCore>::load_plugin(const String& pluginName, const S
     if (plugin->get_filename() == filename) return false;
   }
 
+  // Loading explicitly supersedes a registration of the same plugin
+  for (sizeT i = 0; i < mRegisteredPlugins.size(); ++i) {
+    if (mRegisteredPlugins[i].name == pluginName) {
+      mRegisteredPlugins.erase_at(i);
+      break;
+    }
+  }
+
   TPlugin* plugin = create_plugin(pluginName, filename);
   if (plugin != nullptr) {
     return true;
@@ -74,6 +83,40 @@ bool PluginServer<TPlugin, TCore>::load_plugin(const String& pluginName, const S
   return false;
 }
 
+template<typename TPlugin, typename TCore>
+void PluginServer<TPlugin, TCore>::register_plugin(const String& pluginName, const String& filename) {
+  for (const RegisteredPlugin& registeredPlugin : mRegisteredPlugins) {
+    if (registeredPlugin.name == pluginName) return;
+  }
+  mRegisteredPlugins.push_back(RegisteredPlugin{pluginName, filename});
+}
+
+template<typename TPlugin, typename TCore>
+TPlugin* PluginServer<TPlugin, TCore>::get_plugin(const String& pluginName) {
+  for (auto* plugin : mPlugins) {
+    if (plugin->get_name() == pluginName) return plugin;
+  }
+
+  // Load a registered plugin on first use
+  for (sizeT i = 0; i < mRegisteredPlugins.size(); ++i) {
+    if (mRegisteredPlugins[i].name == pluginName) {
+      const String filename = mRegisteredPlugins[i].filename;
+      mRegisteredPlugins.erase_at(i);
+      return create_plugin(pluginName, filename);
+    }
+  }
+
+  // Error
+  return nullptr;
+}
+
+template<typename TPlugin, typename TCore>
+void PluginServer<TPlugin, TCore>::load_registered_plugins() {
+  while (!mRegisteredPlugins.empty()) {
+    get_plugin(mRegisteredPlugins[0].name);
+  }
+}
+
 template<typename TPlugin, typename TCore>
 void PluginServer<TPlugin, TCore>::unload_all_plugins() {
   for (auto* plugin : mPlugins) {
@@ -97,6 +140,8 @@ void PluginServer<TPlugin, TCore>::unload_all_plugins() {
 
 template<typename TPlugin, typename TCore>
 TPlugin* PluginServer<TPlugin, TCore>::create_plugin(const core::String& pluginName, const core::String& filename) {
+  BE_STARTUP_SCOPE("PluginServer::create_plugin")
+
   // Load the plugin
   Library* library = re_new<Library>();
   library->set_path(Path(filename));
@@ -107,6 +152,7 @@ TPlugin* PluginServer<TPlugin, TCore>::create_plugin(const core::String& pluginN
     auto pluginLoader = reinterpret_cast<LOAD_ENGINE_PLUGIN>(library->get_symbol(mLoaderMethod));
     if (pluginLoader) {
       TPlugin* plugin = pluginLoader(mCore);
+      plugin->set_name(pluginName);
       plugin->set_filename(filename);
       plugin->set_library(library);
       plugin->on_install();
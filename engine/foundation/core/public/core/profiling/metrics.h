@@ -0,0 +1,389 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/std/atomic.h"
+#include "core/platform/mutex.h"
+#include "core/container/hash_map.h"
+#include "core/container/vector.h"
+#include "core/string/string.h"
+
+
+//[-------------------------------------------------------]
+//[ Macro definitions                                     ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Increments a named counter, the metric is registered once per call site.
+ *
+ * @param[in] Name
+ * Name of the counter, e.g. "io.bytes_read"
+ * @param[in] Value
+ * Value to add to the counter
+ */
+#define BE_METRICS_INCREMENT(Name, Value) { \
+  static const core::MetricId SMetricId = core::Metrics::instance().register_counter(Name); \
+  core::Metrics::instance().increment(SMetricId, Value); \
+}
+
+/**
+ * @brief
+ * Sets a named gauge, the metric is registered once per call site.
+ */
+#define BE_METRICS_GAUGE(Name, Value) { \
+  static const core::MetricId SMetricId = core::Metrics::instance().register_gauge(Name); \
+  core::Metrics::instance().set_gauge(SMetricId, Value); \
+}
+
+/**
+ * @brief
+ * Records a sample in a named histogram, the metric is registered once per call site.
+ */
+#define BE_METRICS_RECORD(Name, Value) { \
+  static const core::MetricId SMetricId = core::Metrics::instance().register_histogram(Name); \
+  core::Metrics::instance().record(SMetricId, Value); \
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+/** Handle of a registered metric */
+typedef uint32 MetricId;
+
+/** Invalid metric handle */
+static constexpr MetricId InvalidMetricId = ~0u;
+
+/**
+ * @brief
+ * Type of a metric
+ */
+enum class EMetricType {
+  Counter,    ///< Monotonic sum, e.g. number of allocations or bytes read
+  Gauge,      ///< Last set value, e.g. number of live objects
+  Histogram   ///< Distribution of samples, e.g. request sizes or durations
+};
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * MetricSample
+ *
+ * @brief
+ * Value of a single metric within a snapshot.
+ */
+struct MetricSample {
+  double value;   ///< Counter total, gauge value or total number of histogram samples
+  double delta;   ///< Change since the previous snapshot (number of new samples for histograms)
+  double mean;    ///< Histograms only: mean of the samples recorded since the previous snapshot
+};
+
+/**
+ * @struct
+ * MetricsFrame
+ *
+ * @brief
+ * Snapshot of all metrics taken at the end of a frame.
+ */
+struct MetricsFrame {
+  uint64 frameIndex;              ///< Index of the snapshot, starts with 0
+  uint32 numMetrics;              ///< Number of valid entries inside 'samples'
+  const MetricSample* samples;    ///< Samples indexed by metric id, owned by the registry
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * Metrics
+ *
+ * @brief
+ * Registry of named counters, gauges and histograms.
+ *
+ * Recording a value doesn't lock: each thread writes into its own slots, which are only
+ * summed up when a snapshot is taken. The slots of a thread are allocated by the first value it
+ * records, every later record neither locks nor allocates. Snapshots are usually taken
+ * once per frame and are kept in a ring buffer for live inspection.
+ *
+ * Metrics is a singleton class, so you can use the instance() method to access it.
+ *
+ * @note
+ * - Registering a metric is thread-safe, registering the same name twice returns the same id
+ * - snapshot(), get_frame() and to_json() are meant to be called from a single (main) thread
+ */
+class Metrics {
+public:
+
+  /** Maximum number of metrics */
+  static constexpr uint32 MaxMetrics = 256;
+  /** Number of per-thread value slots, histograms use several slots */
+  static constexpr uint32 MaxSlots = 1024;
+  /** Number of power-of-two buckets of a histogram */
+  static constexpr uint32 NumHistogramBuckets = 32;
+
+public:
+
+  /**
+   * @brief
+   * Retrieves the instance of the Metrics registry.
+   *
+   * @return
+   * The Metrics instance.
+   */
+  static Metrics& instance();
+
+public:
+
+  /**
+   * @brief
+   * Registers a counter.
+   *
+   * @param[in] name
+   * Unique name of the metric
+   *
+   * @return
+   * Id of the metric, InvalidMetricId if the registry is full or the name is used by a different type
+   */
+  MetricId register_counter(const String& name);
+
+  /**
+   * @brief
+   * Registers a gauge.
+   *
+   * @see
+   * - register_counter()
+   */
+  MetricId register_gauge(const String& name);
+
+  /**
+   * @brief
+   * Registers a histogram with power-of-two buckets.
+   *
+   * @see
+   * - register_counter()
+   */
+  MetricId register_histogram(const String& name);
+
+  /**
+   * @brief
+   * Returns the id of a metric by its name.
+   *
+   * @return
+   * The metric id, InvalidMetricId if there's no metric with the given name
+   */
+  [[nodiscard]] MetricId find(const String& name) const;
+
+  /**
+   * @brief
+   * Adds a value to a counter.
+   */
+  inline void increment(MetricId id, int64 value = 1);
+
+  /**
+   * @brief
+   * Sets the value of a gauge.
+   */
+  inline void set_gauge(MetricId id, double value);
+
+  /**
+   * @brief
+   * Records a sample inside a histogram.
+   */
+  inline void record(MetricId id, uint64 sample);
+
+  /**
+   * @brief
+   * Returns the number of registered metrics.
+   */
+  [[nodiscard]] inline uint32 get_num_metrics() const;
+
+  /**
+   * @brief
+   * Returns the name of a metric.
+   */
+  [[nodiscard]] inline const String& get_name(MetricId id) const;
+
+  /**
+   * @brief
+   * Returns the type of a metric.
+   */
+  [[nodiscard]] inline EMetricType get_type(MetricId id) const;
+
+  /**
+   * @brief
+   * Sums up all per-thread values and stores them as the newest frame inside the ring buffer.
+   */
+  void snapshot();
+
+  /**
+   * @brief
+   * Returns the number of frames kept inside the ring buffer.
+   */
+  [[nodiscard]] inline uint32 get_history_size() const;
+
+  /**
+   * @brief
+   * Sets the number of frames kept inside the ring buffer, discards all recorded frames.
+   */
+  void set_history_size(uint32 historySize);
+
+  /**
+   * @brief
+   * Returns the number of valid frames inside the ring buffer.
+   */
+  [[nodiscard]] inline uint32 get_num_frames() const;
+
+  /**
+   * @brief
+   * Returns a recorded frame.
+   *
+   * @param[in] age
+   * Age of the frame, 0 is the most recent snapshot
+   *
+   * @return
+   * The frame, null pointer if there's no such frame
+   */
+  [[nodiscard]] const MetricsFrame* get_frame(uint32 age = 0) const;
+
+  /**
+   * @brief
+   * Returns the buckets of a histogram as of the most recent snapshot.
+   *
+   * @param[in] id
+   * Id of the histogram
+   * @param[out] buckets
+   * Receives NumHistogramBuckets sample counts, bucket i holds samples in [2^(i-1), 2^i)
+   *
+   * @return
+   * 'true' if all went fine, else 'false'
+   */
+  bool get_histogram_buckets(MetricId id, uint64* buckets) const;
+
+  /**
+   * @brief
+   * Dumps the most recent snapshot as JSON text.
+   */
+  [[nodiscard]] String to_json() const;
+
+private:
+
+  /**
+   * @struct
+   * MetricInfo
+   *
+   * @brief
+   * Registration information of a metric.
+   */
+  struct MetricInfo {
+    String name;       ///< Unique name
+    EMetricType type;  ///< Type of the metric
+    uint32 slot;       ///< First per-thread slot (counters/histograms) or gauge index
+  };
+
+  /**
+   * @struct
+   * ThreadSlots
+   *
+   * @brief
+   * Values recorded by a single thread, only written by the owning thread.
+   */
+  struct ThreadSlots {
+    atomic<int64> values[MaxSlots];
+  };
+
+  /** Thread exit helper, hands the slots of a finished thread back to the registry */
+  friend struct ThreadSlotsOwner;
+
+private:
+
+  /**
+   * @brief
+   * Creates the Metrics registry.
+   */
+  Metrics();
+
+  /**
+   * @brief
+   * Destroys the Metrics registry.
+   */
+  ~Metrics();
+
+  MetricId register_metric(const String& name, EMetricType type, uint32 numSlots);
+
+  inline ThreadSlots& get_thread_slots();
+
+  ThreadSlots& create_thread_slots();
+
+  void release_thread_slots(ThreadSlots* slots);
+
+  static inline void add(atomic<int64>& value, int64 amount);
+
+private:
+
+  static thread_local ThreadSlots* SThreadSlots;
+
+  mutable Mutex mMutex;
+  MetricInfo mMetrics[MaxMetrics];
+  atomic<uint32> mNumMetrics;
+  uint32 mNumSlots;
+  hash_map<String, MetricId> mMetricsByName;
+  atomic<double> mGauges[MaxMetrics];
+  Vector<ThreadSlots*> mThreadSlots;
+  int64 mRetired[MaxSlots];
+  int64 mTotals[MaxSlots];
+  int64 mPrevious[MaxSlots];
+  Vector<MetricsFrame> mFrames;
+  Vector<MetricSample> mSamples;
+  uint32 mNumFrames;
+  uint64 mFrameIndex;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/profiling/metrics.inl"
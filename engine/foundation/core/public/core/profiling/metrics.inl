@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <bit>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline void Metrics::increment(MetricId id, int64 value) {
+  if (id < MaxMetrics) {
+    add(get_thread_slots().values[mMetrics[id].slot], value);
+  }
+}
+
+inline void Metrics::set_gauge(MetricId id, double value) {
+  if (id < MaxMetrics) {
+    mGauges[mMetrics[id].slot].store(value, std::memory_order_relaxed);
+  }
+}
+
+inline void Metrics::record(MetricId id, uint64 sample) {
+  if (id < MaxMetrics) {
+    // Histogram layout: number of samples, sum of samples, power-of-two buckets
+    atomic<int64>* values = &get_thread_slots().values[mMetrics[id].slot];
+    const uint32 bucket = static_cast<uint32>(std::bit_width(sample));
+    add(values[0], 1);
+    add(values[1], static_cast<int64>(sample));
+    add(values[2 + (bucket < NumHistogramBuckets ? bucket : NumHistogramBuckets - 1)], 1);
+  }
+}
+
+inline uint32 Metrics::get_num_metrics() const {
+  return mNumMetrics.load(std::memory_order_acquire);
+}
+
+inline const String& Metrics::get_name(MetricId id) const {
+  return mMetrics[id].name;
+}
+
+inline EMetricType Metrics::get_type(MetricId id) const {
+  return mMetrics[id].type;
+}
+
+inline uint32 Metrics::get_history_size() const {
+  return mFrames.size();
+}
+
+inline uint32 Metrics::get_num_frames() const {
+  return mNumFrames;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+inline Metrics::ThreadSlots& Metrics::get_thread_slots() {
+  return SThreadSlots ? *SThreadSlots : create_thread_slots();
+}
+
+inline void Metrics::add(atomic<int64>& value, int64 amount) {
+  // Only the owning thread writes into its slots, so there's no need for a locked read-modify-write
+  value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/std/atomic.h"
+#include "core/string/string.h"
+
+
+//[-------------------------------------------------------]
+//[ Macro definitions                                     ]
+//[-------------------------------------------------------]
+#define BE_STARTUP_SCOPE_NAME_INTERNAL(Line) startupScope##Line
+#define BE_STARTUP_SCOPE_NAME(Line) BE_STARTUP_SCOPE_NAME_INTERNAL(Line)
+
+/**
+ * @brief
+ * Records the duration of the enclosing scope if it's executed before the main loop is reached
+ *
+ * @param[in] Name
+ * Name of the scope, must stay valid until the program ends, e.g. a string literal
+ */
+#define BE_STARTUP_SCOPE(Name) \
+const core::StartupScope BE_STARTUP_SCOPE_NAME(__LINE__)(Name);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * StartupTracer
+ *
+ * @brief
+ * Records the cost of static initializers, server initialization and other work done before the main loop.
+ *
+ * Recording starts with the first traced scope and ends with finish(), which CoreApplication calls right
+ * before entering main(). Afterwards traced scopes only cost a single relaxed load. Recording never
+ * allocates, so it can be used inside of static initializers.
+ *
+ * StartupTracer is a singleton class, so you can use the instance() method to access it.
+ */
+class StartupTracer : public NonCopyable {
+public:
+
+  /** Maximum number of recorded scopes, further scopes are ignored */
+  static constexpr uint32 MaxEntries = 1024;
+
+  /**
+   * @struct
+   * Entry
+   *
+   * @brief
+   * Recorded scope.
+   */
+  struct Entry {
+    const char* name;  ///< Name of the scope
+    uint64 begin;      ///< Begin in microseconds, relative to the start of the recording
+    uint64 duration;   ///< Duration in microseconds
+    uint32 depth;      ///< Nesting depth on the recording thread, 0 for top-level scopes
+  };
+
+public:
+
+  /**
+   * @brief
+   * Retrieves the instance of the StartupTracer.
+   *
+   * @return
+   * The StartupTracer instance.
+   */
+  static StartupTracer& instance();
+
+public:
+
+  /**
+   * @brief
+   * Returns whether or not scopes are still recorded.
+   */
+  [[nodiscard]] inline bool is_tracing() const;
+
+  /**
+   * @brief
+   * Starts a scope.
+   *
+   * @param[in] name
+   * Name of the scope
+   *
+   * @return
+   * Index of the entry, MaxEntries if the scope isn't recorded
+   */
+  uint32 begin_scope(const char* name);
+
+  /**
+   * @brief
+   * Ends a scope started with begin_scope().
+   *
+   * @param[in] index
+   * Index returned by begin_scope()
+   */
+  void end_scope(uint32 index);
+
+  /**
+   * @brief
+   * Stops recording, usually called once the main loop is reached.
+   *
+   * @param[in] report
+   * If 'true', the report of the recorded scopes is written into the log
+   */
+  void finish(bool report);
+
+  /**
+   * @brief
+   * Returns the number of recorded scopes.
+   */
+  [[nodiscard]] inline uint32 get_num_entries() const;
+
+  /**
+   * @brief
+   * Returns a recorded scope.
+   */
+  [[nodiscard]] inline const Entry& get_entry(uint32 index) const;
+
+  /**
+   * @brief
+   * Returns the microseconds from the start of the recording until finish() was called.
+   */
+  [[nodiscard]] inline uint64 get_total_time() const;
+
+  /**
+   * @brief
+   * Returns the report of all recorded scopes as text, one scope per line in order of execution, nested scopes are indented.
+   */
+  [[nodiscard]] String to_string() const;
+
+private:
+
+  /**
+   * @brief
+   * Creates the StartupTracer.
+   */
+  StartupTracer();
+
+  /**
+   * @brief
+   * Destroys the StartupTracer.
+   */
+  ~StartupTracer() override;
+
+  [[nodiscard]] uint64 get_time() const;
+
+private:
+
+  atomic<bool> mTracing;
+  atomic<uint32> mNumEntries;
+  uint64 mStartTime;
+  uint64 mTotalTime;
+  Entry mEntries[MaxEntries];
+};
+
+/**
+ * @class
+ * StartupScope
+ *
+ * @brief
+ * Records its lifetime with the StartupTracer, see BE_STARTUP_SCOPE.
+ */
+class StartupScope : public NonCopyable {
+public:
+
+  /**
+   * @brief
+   * Starts the scope.
+   *
+   * @param[in] name
+   * Name of the scope, must stay valid until the program ends
+   */
+  inline explicit StartupScope(const char* name);
+
+  /**
+   * @brief
+   * Ends the scope.
+   */
+  inline ~StartupScope();
+
+private:
+
+  uint32 mIndex;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/profiling/startup_tracer.inl"
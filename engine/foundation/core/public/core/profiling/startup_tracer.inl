@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline bool StartupTracer::is_tracing() const {
+  return mTracing.load(std::memory_order_relaxed);
+}
+
+inline uint32 StartupTracer::get_num_entries() const {
+  const uint32 numEntries = mNumEntries.load(std::memory_order_acquire);
+  return (numEntries < MaxEntries) ? numEntries : MaxEntries;
+}
+
+inline const StartupTracer::Entry& StartupTracer::get_entry(uint32 index) const {
+  return mEntries[index];
+}
+
+inline uint64 StartupTracer::get_total_time() const {
+  return mTotalTime;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline StartupScope::StartupScope(const char* name)
+: mIndex(StartupTracer::MaxEntries) {
+  StartupTracer& startupTracer = StartupTracer::instance();
+  if (startupTracer.is_tracing()) {
+    mIndex = startupTracer.begin_scope(name);
+  }
+}
+
+inline StartupScope::~StartupScope() {
+  if (mIndex < StartupTracer::MaxEntries) {
+    StartupTracer::instance().end_scope(mIndex);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+/** Magic number at the start of the hello packet, "BETS" */
+static constexpr uint32 TelemetryMagic = 0x53544542;
+
+/** Version of the telemetry stream format */
+static constexpr uint16 TelemetryVersion = 1;
+
+/**
+ * @brief
+ * Type of a telemetry packet
+ */
+enum class ETelemetryPacket : uint16 {
+  Hello,         ///< TelemetryHello, always the first packet of a stream
+  MetricInfo,    ///< TelemetryMetricInfo followed by the metric name
+  MetricsFrame,  ///< TelemetryMetricsFrame followed by 'numMetrics' MetricSample entries
+  Zone,          ///< TelemetryZone followed by the zone name
+  Log            ///< TelemetryLog followed by the log text
+};
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * TelemetryPacketHeader
+ *
+ * @brief
+ * Header in front of each packet of a telemetry stream.
+ *
+ * @note
+ * - The stream uses the native byte order, it's only meant for local inspection
+ * - Names and texts are not null-terminated, they fill the rest of the payload
+ */
+struct TelemetryPacketHeader {
+  uint16 type;         ///< ETelemetryPacket
+  uint16 reserved;     ///< Always 0
+  uint32 payloadSize;  ///< Number of bytes following the header
+};
+
+/**
+ * @struct
+ * TelemetryHello
+ *
+ * @brief
+ * Identifies the stream and the process it's coming from.
+ */
+struct TelemetryHello {
+  uint32 magic;      ///< TelemetryMagic
+  uint16 version;    ///< TelemetryVersion
+  uint16 reserved;   ///< Always 0
+  uint64 processId;  ///< Id of the streaming process
+};
+
+/**
+ * @struct
+ * TelemetryMetricInfo
+ *
+ * @brief
+ * Announces a registered metric.
+ */
+struct TelemetryMetricInfo {
+  uint32 id;    ///< Metric id, index into the samples of a metrics frame
+  uint32 type;  ///< EMetricType
+};
+
+/**
+ * @struct
+ * TelemetryMetricsFrame
+ *
+ * @brief
+ * Per-frame snapshot of all metrics.
+ */
+struct TelemetryMetricsFrame {
+  uint64 frameIndex;   ///< Index of the snapshot
+  uint64 timestamp;    ///< Time of the snapshot in microseconds
+  uint32 numMetrics;   ///< Number of following samples
+  uint32 reserved;     ///< Always 0
+};
+
+/**
+ * @struct
+ * TelemetryZone
+ *
+ * @brief
+ * Timed profiler zone.
+ */
+struct TelemetryZone {
+  uint64 threadId;  ///< Id of the thread the zone was executed on
+  uint64 begin;     ///< Begin of the zone in microseconds
+  uint64 end;       ///< End of the zone in microseconds
+};
+
+/**
+ * @struct
+ * TelemetryLog
+ *
+ * @brief
+ * Log line.
+ */
+struct TelemetryLog {
+  uint64 timestamp;  ///< Time of the log line in microseconds
+  uint32 logLevel;   ///< Log level, see Log::LogLevel
+  uint32 reserved;   ///< Always 0
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
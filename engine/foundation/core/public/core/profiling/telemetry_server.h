@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/core/non_copyable.h"
+#include "core/profiling/telemetry.h"
+#include "core/std/atomic.h"
+#include "core/platform/mutex.h"
+#include "core/container/vector.h"
+#include "core/string/string.h"
+
+
+//[-------------------------------------------------------]
+//[ Macro definitions                                     ]
+//[-------------------------------------------------------]
+#define BE_TELEMETRY_ZONE_NAME_INTERNAL(Line) telemetryZone##Line
+#define BE_TELEMETRY_ZONE_NAME(Line) BE_TELEMETRY_ZONE_NAME_INTERNAL(Line)
+
+/**
+ * @brief
+ * Streams the duration of the enclosing scope as profiler zone, costs a single check while no viewer is attached
+ *
+ * @param[in] Name
+ * Name of the zone as string literal, e.g. "Renderer::render"
+ */
+#define BE_TELEMETRY_ZONE(Name) \
+const core::TelemetryZoneScope BE_TELEMETRY_ZONE_NAME(__LINE__)(Name);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Thread;
+struct MetricsFrame;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * TelemetryServer
+ *
+ * @brief
+ * Streams profiler zones, metrics and log lines to viewers attached to a local Unix domain socket.
+ *
+ * Publishing only copies the packet into a fixed-size ring buffer, a background thread accepts
+ * viewers and forwards the buffer to them using non-blocking sends. If the ring buffer is full
+ * the packet is dropped, a viewer that can't keep up is disconnected, so a slow consumer never
+ * stalls the frame. See "core/profiling/telemetry.h" for the stream format.
+ *
+ * TelemetryServer is a singleton class, so you can use the instance() method to access it.
+ *
+ * @note
+ * - Publishing is thread-safe and returns immediately while no viewer is attached
+ * - Applications start the server with the "--telemetry <socket path>" command line parameter
+ */
+class TelemetryServer : public NonCopyable {
+public:
+
+  /** Size of the ring buffer in bytes, must be a power of two */
+  static constexpr uint32 BufferSize = 2 * 1024 * 1024;
+  /** Maximum number of bytes queued for a single viewer before it's disconnected */
+  static constexpr uint32 MaxPendingBytes = 8 * 1024 * 1024;
+
+public:
+
+  /**
+   * @brief
+   * Retrieves the instance of the TelemetryServer.
+   *
+   * @return
+   * The TelemetryServer instance.
+   */
+  static TelemetryServer& instance();
+
+public:
+
+  /**
+   * @brief
+   * Creates the socket and starts streaming.
+   *
+   * @param[in] socketPath
+   * File system path of the Unix domain socket, an existing stale socket file is replaced
+   *
+   * @return
+   * 'true' if all went fine, else 'false'
+   */
+  bool start(const String& socketPath);
+
+  /**
+   * @brief
+   * Disconnects all viewers, stops streaming and removes the socket.
+   */
+  void stop();
+
+  /**
+   * @brief
+   * Returns whether or not the server is running.
+   */
+  [[nodiscard]] inline bool is_running() const;
+
+  /**
+   * @brief
+   * Returns whether or not at least one viewer is attached.
+   */
+  [[nodiscard]] inline bool has_clients() const;
+
+  /**
+   * @brief
+   * Returns the number of bytes dropped because the ring buffer was full.
+   */
+  [[nodiscard]] inline uint64 get_num_dropped_bytes() const;
+
+  /**
+   * @brief
+   * Returns the current time of the stream in microseconds.
+   */
+  [[nodiscard]] uint64 get_timestamp() const;
+
+  /**
+   * @brief
+   * Publishes a log line.
+   *
+   * @param[in] logLevel
+   * Log level, see Log::LogLevel
+   * @param[in] text
+   * Log text
+   */
+  void publish_log(uint8 logLevel, const String& text);
+
+  /**
+   * @brief
+   * Publishes a metrics snapshot, metrics which haven't been announced yet are announced first.
+   *
+   * @param[in] frame
+   * Snapshot to publish, usually Metrics::get_frame()
+   */
+  void publish_metrics(const MetricsFrame& frame);
+
+  /**
+   * @brief
+   * Publishes a timed profiler zone of the current thread.
+   *
+   * @param[in] name
+   * Name of the zone
+   * @param[in] begin
+   * Begin of the zone, see get_timestamp()
+   * @param[in] end
+   * End of the zone, see get_timestamp()
+   */
+  void publish_zone(const char* name, uint64 begin, uint64 end);
+
+private:
+
+  /**
+   * @struct
+   * Client
+   *
+   * @brief
+   * Attached viewer.
+   */
+  struct Client {
+    int socket;            ///< Socket handle
+    Vector<uint8> pending; ///< Bytes the socket couldn't take yet
+  };
+
+private:
+
+  /**
+   * @brief
+   * Creates the TelemetryServer.
+   */
+  TelemetryServer();
+
+  /**
+   * @brief
+   * Destroys the TelemetryServer.
+   */
+  ~TelemetryServer();
+
+  bool write_packet(ETelemetryPacket type, const void* header, uint32 headerSize, const void* data, uint32 dataSize);
+
+  void write_to_buffer(const void* data, uint32 size);
+
+  void read_from_buffer(uint64 position, void* data, uint32 size) const;
+
+  static int run_thread(void* data);
+
+  void run();
+
+  void accept_clients();
+
+  void send_to_client(Client& client, const uint8* data, uint32 size);
+
+  void queue_packet(Client& client, ETelemetryPacket type, const void* header, uint32 headerSize, const void* data, uint32 dataSize);
+
+  void close_client(uint32 index);
+
+private:
+
+  atomic<bool> mRunning;
+  atomic<uint32> mNumClients;
+  atomic<uint64> mNumDroppedBytes;
+  String mSocketPath;
+  int mListenSocket;
+  Thread* mThread;
+  Mutex mBufferMutex;
+  Vector<uint8> mBuffer;
+  uint64 mReadPosition;
+  uint64 mWritePosition;
+  uint32 mNumAnnouncedMetrics;
+  Vector<Client*> mClients;
+};
+
+/**
+ * @class
+ * TelemetryZoneScope
+ *
+ * @brief
+ * Publishes the duration of its lifetime as profiler zone, see BE_TELEMETRY_ZONE.
+ */
+class TelemetryZoneScope : public NonCopyable {
+public:
+
+  /**
+   * @brief
+   * Enters the zone.
+   *
+   * @param[in] name
+   * Name of the zone, must stay valid during the lifetime of the scope
+   */
+  inline explicit TelemetryZoneScope(const char* name);
+
+  /**
+   * @brief
+   * Leaves the zone and publishes it, if a viewer is attached.
+   */
+  inline ~TelemetryZoneScope();
+
+private:
+
+  const char* mName;
+  uint64 mBegin;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/profiling/telemetry_server.inl"
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline bool TelemetryServer::is_running() const {
+  return mRunning.load(std::memory_order_relaxed);
+}
+
+inline bool TelemetryServer::has_clients() const {
+  return mNumClients.load(std::memory_order_relaxed) > 0;
+}
+
+inline uint64 TelemetryServer::get_num_dropped_bytes() const {
+  return mNumDroppedBytes.load(std::memory_order_relaxed);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline TelemetryZoneScope::TelemetryZoneScope(const char* name)
+: mName(name)
+, mBegin(0) {
+  TelemetryServer& telemetryServer = TelemetryServer::instance();
+  if (telemetryServer.has_clients()) {
+    mBegin = telemetryServer.get_timestamp();
+  }
+}
+
+inline TelemetryZoneScope::~TelemetryZoneScope() {
+  // Zones entered before the first viewer attached are skipped
+  TelemetryServer& telemetryServer = TelemetryServer::instance();
+  if (0 != mBegin && telemetryServer.has_clients()) {
+    telemetryServer.publish_zone(mName, mBegin, telemetryServer.get_timestamp());
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -77,24 +77,27 @@ ClassBuilder<TClass>& ClassBuilder<TClass>::constructor(FuncBase* func) {
 
 template<typename TClass>
 ClassBuilder<TClass>& ClassBuilder<TClass>::method(const String& name, FuncBase* func) {
-  mClass->mMethodsMap[name] = ClassMethod(name, func);
-  mLastRttiMember = &mClass->mMethodsMap[name];
+  ClassMethod& member = mClass->mMethodsMap[Name(name)];
+  member = ClassMethod(name, func);
+  mLastRttiMember = &member;
 
   return *this;
 }
 
 template<typename TClass>
 ClassBuilder<TClass>& ClassBuilder<TClass>::field(const String& name, core::uint32 offset) {
-  mClass->mFieldsMap[name] = ClassField(name, offset);
-  mLastRttiMember = &mClass->mFieldsMap[name];
+  ClassField& member = mClass->mFieldsMap[Name(name)];
+  member = ClassField(name, offset);
+  mLastRttiMember = &member;
 
   return *this;
 }
 
 template<typename TClass>
 ClassBuilder<TClass>& ClassBuilder<TClass>::property(const String& name, FuncBase* setter, FuncBase* getter) {
-  mClass->mPropertiesMap[name] = ClassProperty(name, setter, getter);
-  mLastRttiMember = &mClass->mPropertiesMap[name];
+  ClassProperty& member = mClass->mPropertiesMap[Name(name)];
+  member = ClassProperty(name, setter, getter);
+  mLastRttiMember = &member;
 
   return *this;
 }
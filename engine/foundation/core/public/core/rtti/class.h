@@ -36,6 +36,7 @@
 #include "core/rtti/func/class_method.h"
 #include "core/rtti/func/class_field.h"
 #include "core/rtti/func/class_property.h"
+#include "core/string/name.h"
 
 
 //[-------------------------------------------------------]
@@ -195,6 +196,15 @@ public:
    */
   [[nodiscard]] const ClassMethod* get_method(const String& name) const;
 
+  /**
+   * @brief Get a method by its interned name, without hashing a string.
+   *
+   * @param name The name of the method to retrieve.
+   *
+   * @return A pointer to the method, or nullptr if the method does not exist.
+   */
+  [[nodiscard]] const ClassMethod* get_method(Name name) const;
+
   /**
    * @brief Get a field by name.
    *
@@ -204,6 +214,15 @@ public:
    */
   [[nodiscard]] const ClassField* get_field(const String& name) const;
 
+  /**
+   * @brief Get a field by its interned name, without hashing a string.
+   *
+   * @param name The name of the field to retrieve.
+   *
+   * @return A pointer to the field, or nullptr if the field does not exist.
+   */
+  [[nodiscard]] const ClassField* get_field(Name name) const;
+
   /**
    * @brief Get a property by name.
    *
@@ -213,6 +232,15 @@ public:
    */
   [[nodiscard]] const ClassProperty* get_property(const String& name) const;
 
+  /**
+   * @brief Get a property by its interned name, without hashing a string.
+   *
+   * @param name The name of the property to retrieve.
+   *
+   * @return A pointer to the property, or nullptr if the property does not exist.
+   */
+  [[nodiscard]] const ClassProperty* get_property(Name name) const;
+
 private:
   /** The name of the class */
   String mName;
@@ -227,13 +255,13 @@ private:
   Vector<ClassConstructor> mConstructors;
 
   /** The list of methods for the class */
-  core::hash_map<String, ClassMethod> mMethodsMap;
+  core::hash_map<Name, ClassMethod> mMethodsMap;
 
   /** The list of fields for the class */
-  core::hash_map<String, ClassField> mFieldsMap;
+  core::hash_map<Name, ClassField> mFieldsMap;
 
   /** The list of properties for the class */
-  core::hash_map<String, ClassProperty> mPropertiesMap;
+  core::hash_map<Name, ClassProperty> mPropertiesMap;
 };
 
 
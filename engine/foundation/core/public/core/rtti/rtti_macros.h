@@ -95,12 +95,7 @@ private:
 
 
 #define be_begin_class(CLASS, NAMESPACE) \
-struct Register_##NAMESPACE_##CLASS { \
-  Register_##NAMESPACE_##CLASS() { \
-    NAMESPACE::CLASS::register_reflection(); \
-  } \
-}; \
-static Register_##NAMESPACE_##CLASS NAMESPACE_##CLASS_declare_class_register; \
+static core::RttiLazyRegistration NAMESPACE##_##CLASS##_lazy_registration(core::RttiLazyRegistration::EKind::Class, #NAMESPACE"::"#CLASS, &NAMESPACE::CLASS::register_reflection); \
 void NAMESPACE::CLASS::register_reflection() { \
   typedef NAMESPACE::CLASS _CLASS; \
   core::Class::declare<NAMESPACE::CLASS>(#NAMESPACE"::"#CLASS) \
@@ -182,12 +177,9 @@ void NAMESPACE::CLASS::register_reflection() { \
 
 #define be_begin_enum(ENUM, NAMESPACE) \
   struct AutoEnumRegister_##NAMESPACE##_##ENUM { \
-    AutoEnumRegister_##NAMESPACE##_##ENUM() { \
-      register_enum(); \
-    } \
     static void register_enum(); \
   }; \
-  static AutoEnumRegister_##NAMESPACE##_##ENUM NAMESPACE##_##ENUM_declare_enum_register; \
+  static core::RttiLazyRegistration NAMESPACE##_##ENUM##_lazy_registration(core::RttiLazyRegistration::EKind::Enum, #NAMESPACE"::"#ENUM, &AutoEnumRegister_##NAMESPACE##_##ENUM::register_enum); \
   void AutoEnumRegister_##NAMESPACE##_##ENUM::register_enum() { \
     core::Enum::declare<NAMESPACE::ENUM>(#NAMESPACE"::"#ENUM) \
 
@@ -32,6 +32,9 @@
 #include "core/core/server_impl.h"
 #include "core/container/hash_map.h"
 #include "core/container/vector.h"
+#include "core/platform/mutex.h"
+#include "core/std/atomic.h"
+#include "core/string/name.h"
 #include "core/string/string.h"
 
 
@@ -57,6 +60,57 @@ class PrimitiveTypeInfo;
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+/**
+ * @class
+ * RttiLazyRegistration
+ *
+ * @brief
+ * Deferred reflection registration of a class or enum.
+ *
+ * Instances are created as static objects by be_begin_class and be_begin_enum. Creating one only
+ * links it into the pending list of the RttiTypeServer, the registration function runs on the first
+ * lookup of the type, which keeps static initialization cheap.
+ */
+class RttiLazyRegistration : public NonCopyable {
+
+  friend class RttiTypeServer;
+
+public:
+
+  /**
+   * @brief
+   * Kind of the registered type
+   */
+  enum class EKind {
+    Class,
+    Enum
+  };
+
+public:
+
+  /**
+   * @brief
+   * Adds the registration to the pending list of the RttiTypeServer.
+   *
+   * @param kind
+   * Kind of the registered type.
+   * @param name
+   * Fully qualified name of the type, must be a string literal.
+   * @param registerFunction
+   * Function declaring the reflection of the type.
+   */
+  RttiLazyRegistration(EKind kind, const char* name, void (*registerFunction)());
+
+private:
+
+  /** Fully qualified name of the type */
+  const char* mName;
+  /** Function declaring the reflection of the type */
+  void (*mRegisterFunction)();
+  /** Next pending registration of the same kind */
+  RttiLazyRegistration* mNext;
+};
+
 /**
  * @class
  * RttiTypeServer
@@ -66,6 +120,12 @@ class PrimitiveTypeInfo;
  *
  * This class is the central location for registering RTTI types. It provides
  * methods for registering primitive types, class types and enum types.
+ *
+ * @note
+ * - The reflection of classes and enums is registered lazily on the first lookup, see RttiLazyRegistration
+ * - Lookups may be called from several threads, while registrations are pending they serialize on a
+ *   mutex, afterwards they don't lock at all
+ * - Registering types directly through the register_*() methods is not thread-safe
  */
 class RttiTypeServer : public ServerImpl {
 public:
@@ -124,6 +184,20 @@ public:
    */
   PrimitiveTypeInfo* get_primitive_type(const String& name);
 
+  /**
+   * @brief
+   * Retrieves the PrimitiveTypeInfo object associated with the specified interned primitive type name,
+   * without hashing a string.
+   *
+   * @param name
+   * The name of the primitive type.
+   *
+   * @return A pointer to the PrimitiveTypeInfo object associated with the specified
+   * primitive type name, or nullptr if the primitive type is not registered with the
+   * RttiTypeServer.
+   */
+  PrimitiveTypeInfo* get_primitive_type(Name name);
+
 
   /**
    * @brief
@@ -149,6 +223,20 @@ public:
    */
   ClassTypeInfo* get_class_type(const String& name);
 
+  /**
+   * @brief
+   * Retrieves the ClassTypeInfo object associated with the specified interned class type name,
+   * without hashing a string.
+   *
+   * @param name
+   * The name of the class type.
+   *
+   * @return A pointer to the ClassTypeInfo object associated with the specified
+   * class type name, or nullptr if the class type is not registered with the
+   * RttiTypeServer.
+   */
+  ClassTypeInfo* get_class_type(Name name);
+
 
   /**
    * @brief
@@ -174,14 +262,89 @@ public:
    */
   EnumTypeInfo* get_enum_type(const String& name);
 
+  /**
+   * @brief
+   * Retrieves the EnumTypeInfo object associated with the specified interned enum type name,
+   * without hashing a string.
+   *
+   * @param name
+   * The name of the enum type.
+   *
+   * @return A pointer to the EnumTypeInfo object associated with the specified
+   * enum type name, or nullptr if the enum type is not registered with the
+   * RttiTypeServer.
+   */
+  EnumTypeInfo* get_enum_type(Name name);
+
+  /**
+   * @brief
+   * Adds a lazy registration to the pending registrations, called by RttiLazyRegistration.
+   *
+   * @param registration
+   * The registration, must stay valid until it's executed.
+   * @param kind
+   * Kind of the registered type.
+   */
+  void add_lazy_registration(RttiLazyRegistration& registration, RttiLazyRegistration::EKind kind);
+
+  /**
+   * @brief
+   * Executes all pending lazy registrations, e.g. before enumerating all types.
+   */
+  void register_pending_types();
+
+  /**
+   * @brief
+   * Collects all registered class types, pending registrations are executed first.
+   *
+   * @param classTypes
+   * Receives the class types, in no particular order.
+   */
+  void get_class_types(Vector<ClassTypeInfo*>& classTypes);
+
+  /**
+   * @brief
+   * Collects all registered enum types, pending registrations are executed first.
+   *
+   * @param enumTypes
+   * Receives the enum types, in no particular order.
+   */
+  void get_enum_types(Vector<EnumTypeInfo*>& enumTypes);
+
+private:
+
+  /** Pending registrations by name hash, registrations with colliding hashes are chained */
+  typedef core::hash_map<uint64, RttiLazyRegistration*> PendingMap;
+
+  /**
+   * @brief
+   * Executes the pending registration of a type, if there's one, the caller holds mPendingMutex.
+   *
+   * @param pendingMap
+   * Pending registrations to search in.
+   * @param name
+   * The name of the type.
+   * @param length
+   * The length of the name.
+   */
+  void register_pending_type(PendingMap& pendingMap, const char* name, sizeT length);
+
 private:
 
   /** Maps primitive type names to PrimitiveTypeInfo objects. */
-  core::hash_map<String, PrimitiveTypeInfo*> mPrimitiveTypesMap;
+  core::hash_map<Name, PrimitiveTypeInfo*> mPrimitiveTypesMap;
   /** Maps class type names to ClassTypeInfo objects. */
-  core::hash_map<String, ClassTypeInfo*> mClassTypeMap;
+  core::hash_map<Name, ClassTypeInfo*> mClassTypeMap;
   /** Maps enum type names to EnumTypeInfo objects. */
-  core::hash_map<String, EnumTypeInfo*> mEnumTypeMap;
+  core::hash_map<Name, EnumTypeInfo*> mEnumTypeMap;
+  /** Classes which haven't been registered yet */
+  PendingMap mPendingClasses;
+  /** Enums which haven't been registered yet */
+  PendingMap mPendingEnums;
+  /** Number of registrations which haven't finished yet, lookups don't lock once it's 0 */
+  atomic<uint32> mNumPendingTypes;
+  /** Serializes lookups and registrations while registrations are pending */
+  Mutex mPendingMutex;
 };
 
 
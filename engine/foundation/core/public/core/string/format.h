@@ -0,0 +1,517 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+#include <type_traits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Color4;
+class Stream;
+template<typename TType> class Mat44;
+template<typename TType> class Vec3;
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+/** Largest field width accepted in a format specification */
+static constexpr uint32 MaxFormatWidth = 4096;
+
+/** Largest precision accepted in a format specification */
+static constexpr uint32 MaxFormatPrecision = 64;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @struct
+ * FormatSpec
+ *
+ * @brief
+ * Options of a single replacement field, '{:[[fill]align][0][width][.precision][type]}'.
+ */
+struct FormatSpec {
+  /** Character used to pad up to the width */
+  char Fill = ' ';
+  /** '<' left, '>' right, '^' centered or '\0' for the default of the type */
+  char Align = '\0';
+  /** Pad numbers with zeros between sign and digits */
+  bool Zero = false;
+  /** Minimum number of characters written */
+  uint32 Width = 0;
+  /** Digits after the decimal point or maximum string length, -1 if not given */
+  int32 Precision = -1;
+  /** Presentation type or '\0' for the default of the type */
+  char Type = '\0';
+};
+
+/**
+ * @class
+ * FormatOutput
+ *
+ * @brief
+ * Buffered character sink the formatter writes into.
+ *
+ * The output writes into a caller provided buffer. When the buffer is full flush() is called to
+ * hand the content on; the default implementation refuses, which turns the buffer into a
+ * fixed-size destination whose overflowing characters are only counted.
+ */
+class FormatOutput {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Constructor.
+   *
+   * @param[in] buffer
+   * Destination buffer, must stay valid during the lifetime of the output
+   * @param[in] capacity
+   * Size of the buffer in characters
+   */
+  FormatOutput(char* buffer, sizeT capacity);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~FormatOutput();
+
+  /**
+   * @brief
+   * Writes a single character.
+   */
+  inline void put(char c);
+
+  /**
+   * @brief
+   * Writes a sequence of characters.
+   */
+  inline void put(const char* data, sizeT size);
+
+  /**
+   * @brief
+   * Writes a character repeatedly.
+   */
+  void put_fill(char c, sizeT count);
+
+  /**
+   * @brief
+   * Writes text padded up to the width of the specification.
+   *
+   * @param[in] spec
+   * Specification providing fill, alignment and width
+   * @param[in] data
+   * Text to write
+   * @param[in] size
+   * Length of the text
+   * @param[in] defaultAlign
+   * Alignment used if the specification does not give one
+   */
+  void put_padded(const FormatSpec& spec, const char* data, sizeT size, char defaultAlign);
+
+  /**
+   * @brief
+   * Returns the number of characters written so far, including those which did not fit.
+   */
+  [[nodiscard]] inline sizeT get_size() const;
+
+  /**
+   * @brief
+   * Returns the number of characters currently held by the buffer.
+   */
+  [[nodiscard]] inline sizeT get_buffer_used() const;
+
+  //[-------------------------------------------------------]
+  //[ Protected virtual FormatOutput functions              ]
+  //[-------------------------------------------------------]
+protected:
+  /**
+   * @brief
+   * Hands the content of the full buffer on and empties it.
+   *
+   * @return
+   * 'true' if the buffer was emptied, 'false' if further output is to be dropped
+   */
+  virtual bool flush();
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  void put_overflow(const char* data, sizeT size);
+
+  //[-------------------------------------------------------]
+  //[ Protected data                                        ]
+  //[-------------------------------------------------------]
+protected:
+  /** Destination buffer */
+  char* mBuffer;
+  /** Size of the buffer */
+  sizeT mCapacity;
+  /** Characters held by the buffer */
+  sizeT mUsed;
+  /** Characters written in total */
+  sizeT mSize;
+};
+
+namespace internal {
+
+/**
+ * @brief
+ * Writes an integer given as sign and magnitude.
+ */
+void format_integer(FormatOutput& output, const FormatSpec& spec, uint64 magnitude, bool negative);
+
+}
+
+/**
+ * @struct
+ * Formatter
+ *
+ * @brief
+ * Formats values of a type, specialize it to make further types formattable.
+ *
+ * A specialization provides the presentation types it accepts, which are checked at compile
+ * time, and the function writing a value:
+ * @code
+ * template<>
+ * struct Formatter<MyType> {
+ *   static constexpr const char* Types = "s";
+ *   static void format(FormatOutput& output, const FormatSpec& spec, const MyType& value);
+ * };
+ * @endcode
+ */
+template<typename TType, typename TEnable = void>
+struct Formatter;
+
+template<typename TType>
+struct Formatter<TType, std::enable_if_t<std::is_integral_v<TType> && !std::is_same_v<TType, bool> && !std::is_same_v<TType, char>>> {
+  static constexpr const char* Types = "dxXboc";
+  static inline void format(FormatOutput& output, const FormatSpec& spec, TType value) {
+    if constexpr (std::is_signed_v<TType>) {
+      internal::format_integer(output, spec, value < 0 ? 0 - static_cast<uint64>(value) : static_cast<uint64>(value), value < 0);
+    } else {
+      internal::format_integer(output, spec, static_cast<uint64>(value), false);
+    }
+  }
+};
+
+template<>
+struct Formatter<bool> {
+  static constexpr const char* Types = "sdxXbo";
+  static void format(FormatOutput& output, const FormatSpec& spec, bool value);
+};
+
+template<>
+struct Formatter<char> {
+  static constexpr const char* Types = "cdxXbo";
+  static void format(FormatOutput& output, const FormatSpec& spec, char value);
+};
+
+template<>
+struct Formatter<float> {
+  static constexpr const char* Types = "feg";
+  static void format(FormatOutput& output, const FormatSpec& spec, float value);
+};
+
+template<>
+struct Formatter<double> {
+  static constexpr const char* Types = "feg";
+  static void format(FormatOutput& output, const FormatSpec& spec, double value);
+};
+
+template<>
+struct Formatter<const char*> {
+  static constexpr const char* Types = "s";
+  static void format(FormatOutput& output, const FormatSpec& spec, const char* value);
+};
+
+template<>
+struct Formatter<char*> : public Formatter<const char*> {
+};
+
+template<>
+struct Formatter<StringView> {
+  static constexpr const char* Types = "s";
+  static void format(FormatOutput& output, const FormatSpec& spec, StringView value);
+};
+
+template<>
+struct Formatter<String> {
+  static constexpr const char* Types = "s";
+  static void format(FormatOutput& output, const FormatSpec& spec, const String& value);
+};
+
+template<>
+struct Formatter<const void*> {
+  static constexpr const char* Types = "p";
+  static void format(FormatOutput& output, const FormatSpec& spec, const void* value);
+};
+
+template<>
+struct Formatter<void*> : public Formatter<const void*> {
+};
+
+template<>
+struct Formatter<std::nullptr_t> {
+  static constexpr const char* Types = "p";
+  static void format(FormatOutput& output, const FormatSpec& spec, std::nullptr_t value);
+};
+
+/**
+ * @brief
+ * Writes '(x, y, z)', the specification applies to every component.
+ */
+template<typename TType>
+struct Formatter<Vec3<TType>> {
+  static constexpr const char* Types = Formatter<TType>::Types;
+  static inline void format(FormatOutput& output, const FormatSpec& spec, const Vec3<TType>& value);
+};
+
+/**
+ * @brief
+ * Writes the rows '((xx, xy, xz, xw), (yx, ...), ...)', the specification applies to every
+ * component.
+ */
+template<typename TType>
+struct Formatter<Mat44<TType>> {
+  static constexpr const char* Types = Formatter<TType>::Types;
+  static inline void format(FormatOutput& output, const FormatSpec& spec, const Mat44<TType>& value);
+};
+
+/**
+ * @brief
+ * Writes '(r, g, b, a)', the specification applies to every component.
+ */
+template<>
+struct Formatter<Color4> {
+  static constexpr const char* Types = "feg";
+  static void format(FormatOutput& output, const FormatSpec& spec, const Color4& value);
+};
+
+
+//[-------------------------------------------------------]
+//[ Internal                                              ]
+//[-------------------------------------------------------]
+namespace internal {
+
+/**
+ * @brief
+ * Type erased reference to a format argument.
+ */
+struct FormatArgument {
+  /** The argument */
+  const void* Value;
+  /** Formats the argument */
+  void (*Format)(FormatOutput& output, const FormatSpec& spec, const void* value);
+};
+
+/**
+ * @brief
+ * Parses a replacement field behind the opening brace.
+ *
+ * @return
+ * Pointer behind the closing brace, null pointer if the field is malformed
+ */
+constexpr const char* parse_format_spec(const char* first, const char* last, FormatSpec& spec);
+
+/**
+ * @brief
+ * Reports an error in a format string.
+ *
+ * @note
+ * - Deliberately not constexpr: reaching it during the compile-time check of a format string
+ *   makes the compilation fail with the message in the diagnostic
+ */
+void format_string_error(const char* message);
+
+template<typename... TArgs>
+consteval void check_format_string(const char* format, sizeT length);
+
+template<typename TType>
+inline FormatArgument make_format_argument(const TType& value);
+
+void vformat_to(FormatOutput& output, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments);
+
+void vformat_to(String& destination, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments);
+
+sizeT vformat_to(char* buffer, sizeT size, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments);
+
+void vformat_to(Stream& stream, const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments);
+
+sizeT vformatted_size(const char* format, sizeT length, const FormatArgument* arguments, sizeT numArguments);
+
+}
+
+/**
+ * @class
+ * FormatString
+ *
+ * @brief
+ * Format string checked against the argument types at compile time.
+ *
+ * Replacement fields are '{}' or '{:spec}' and consume the arguments in order, '{{' and '}}'
+ * write literal braces. Unbalanced braces, a wrong number of fields, malformed specifications
+ * and presentation types the argument does not support are compile errors.
+ */
+template<typename... TArgs>
+class FormatString {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Constructor, checks the format string.
+   *
+   * @param[in] format
+   * Null terminated format string literal
+   */
+  consteval FormatString(const char* format);
+
+  /**
+   * @brief
+   * Returns the format string.
+   */
+  [[nodiscard]] constexpr const char* get() const;
+
+  /**
+   * @brief
+   * Returns the length of the format string.
+   */
+  [[nodiscard]] constexpr sizeT size() const;
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** The format string */
+  const char* mFormat;
+  /** Length of the format string */
+  sizeT mLength;
+};
+
+/** Format string checked against the given arguments */
+template<typename... TArgs>
+using FormatStringFor = FormatString<std::type_identity_t<TArgs>...>;
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Formats the arguments into a new string.
+ *
+ * Usage:
+ * @code
+ * String text = format("{} at {:.2f}, {:>8}", name, time, position);
+ * @endcode
+ */
+template<typename... TArgs>
+[[nodiscard]] inline String format(FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+/**
+ * @brief
+ * Appends the formatted arguments to a string.
+ *
+ * @note
+ * - The text is assembled in a stack buffer and appended in chunks
+ */
+template<typename... TArgs>
+inline String& format_to(String& destination, FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+/**
+ * @brief
+ * Formats the arguments into a caller provided buffer, like snprintf().
+ *
+ * @param[out] buffer
+ * Destination, always null terminated if the size is not 0
+ * @param[in] size
+ * Size of the buffer in characters
+ *
+ * @return
+ * Length of the complete formatted text without terminator, the text was truncated if this is
+ * not smaller than the size
+ */
+template<typename... TArgs>
+inline sizeT format_to(char* buffer, sizeT size, FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+/**
+ * @brief
+ * Writes the formatted arguments to a stream.
+ *
+ * @note
+ * - The text is assembled in a stack buffer and written in chunks
+ */
+template<typename... TArgs>
+inline void format_to(Stream& stream, FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+/**
+ * @brief
+ * Writes the formatted arguments to a format output.
+ */
+template<typename... TArgs>
+inline void format_to(FormatOutput& output, FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+/**
+ * @brief
+ * Returns the length of the formatted text without writing it anywhere.
+ */
+template<typename... TArgs>
+[[nodiscard]] inline sizeT formatted_size(FormatStringFor<TArgs...> formatString, const TArgs&... args);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/string/format.inl"
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/memory/memory.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline void FormatOutput::put(char c) {
+  ++mSize;
+  if (mUsed == mCapacity && !flush()) {
+    return;
+  }
+  mBuffer[mUsed++] = c;
+}
+
+inline void FormatOutput::put(const char* data, sizeT size) {
+  if (size <= mCapacity - mUsed) {
+    Memory::copy(mBuffer + mUsed, data, static_cast<uint32>(size));
+    mUsed += size;
+    mSize += size;
+  } else {
+    put_overflow(data, size);
+  }
+}
+
+inline sizeT FormatOutput::get_size() const {
+  return mSize;
+}
+
+inline sizeT FormatOutput::get_buffer_used() const {
+  return mUsed;
+}
+
+template<typename TType>
+inline void Formatter<Vec3<TType>>::format(FormatOutput& output, const FormatSpec& spec, const Vec3<TType>& value) {
+  output.put('(');
+  for (uint32 i = 0; i < 3; ++i) {
+    if (i > 0) {
+      output.put(", ", 2);
+    }
+    Formatter<TType>::format(output, spec, value.v[i]);
+  }
+  output.put(')');
+}
+
+template<typename TType>
+inline void Formatter<Mat44<TType>>::format(FormatOutput& output, const FormatSpec& spec, const Mat44<TType>& value) {
+  output.put('(');
+  for (uint32 row = 0; row < 4; ++row) {
+    output.put(row > 0 ? ", (" : "(", row > 0 ? 3 : 1);
+    for (uint32 column = 0; column < 4; ++column) {
+      if (column > 0) {
+        output.put(", ", 2);
+      }
+      // Column-major storage
+      Formatter<TType>::format(output, spec, value.mM[row + 4 * column]);
+    }
+    output.put(')');
+  }
+  output.put(')');
+}
+
+
+//[-------------------------------------------------------]
+//[ Internal                                              ]
+//[-------------------------------------------------------]
+namespace internal {
+
+constexpr const char* parse_format_spec(const char* first, const char* last, FormatSpec& spec) {
+  if (first == last) {
+    return nullptr;
+  }
+  if (*first == '}') {
+    return first + 1;
+  }
+  if (*first != ':') {
+    return nullptr;
+  }
+  ++first;
+
+  // [[fill]align]
+  const auto isAlign = [](char c) { return c == '<' || c == '>' || c == '^'; };
+  if (last - first >= 2 && isAlign(first[1]) && first[0] != '{' && first[0] != '}') {
+    spec.Fill = first[0];
+    spec.Align = first[1];
+    first += 2;
+  } else if (first != last && isAlign(*first)) {
+    spec.Align = *first;
+    ++first;
+  }
+
+  // [0][width]
+  if (first != last && *first == '0') {
+    spec.Zero = true;
+    ++first;
+  }
+  while (first != last && *first >= '0' && *first <= '9') {
+    spec.Width = spec.Width * 10 + static_cast<uint32>(*first - '0');
+    if (spec.Width > MaxFormatWidth) {
+      return nullptr;
+    }
+    ++first;
+  }
+
+  // [.precision]
+  if (first != last && *first == '.') {
+    ++first;
+    if (first == last || *first < '0' || *first > '9') {
+      return nullptr;
+    }
+    spec.Precision = 0;
+    while (first != last && *first >= '0' && *first <= '9') {
+      spec.Precision = spec.Precision * 10 + (*first - '0');
+      if (spec.Precision > static_cast<int32>(MaxFormatPrecision)) {
+        return nullptr;
+      }
+      ++first;
+    }
+  }
+
+  // [type]
+  if (first != last && *first != '}') {
+    spec.Type = *first;
+    ++first;
+  }
+  if (first == last || *first != '}') {
+    return nullptr;
+  }
+  return first + 1;
+}
+
+template<typename... TArgs>
+consteval void check_format_string(const char* format, sizeT length) {
+  // The trailing entry keeps the array from being empty
+  constexpr const char* types[] = { Formatter<std::decay_t<TArgs>>::Types..., "" };
+  constexpr sizeT numArguments = sizeof...(TArgs);
+
+  sizeT argumentIndex = 0;
+  const char* position = format;
+  const char* last = format + length;
+  while (position != last) {
+    const char c = *position++;
+    if (c == '{') {
+      if (position != last && *position == '{') {
+        ++position;
+        continue;
+      }
+      if (argumentIndex == numArguments) {
+        format_string_error("more replacement fields than arguments");
+      }
+
+      FormatSpec spec;
+      position = parse_format_spec(position, last, spec);
+      if (position == nullptr) {
+        format_string_error("malformed replacement field");
+      }
+      if (spec.Type != '\0') {
+        bool supported = false;
+        for (const char* type = types[argumentIndex]; *type != '\0'; ++type) {
+          supported = supported || (*type == spec.Type);
+        }
+        if (!supported) {
+          format_string_error("presentation type not supported by the argument");
+        }
+      }
+      ++argumentIndex;
+    } else if (c == '}') {
+      if (position == last || *position != '}') {
+        format_string_error("unmatched '}' in format string");
+      }
+      ++position;
+    }
+  }
+  if (argumentIndex != numArguments) {
+    format_string_error("fewer replacement fields than arguments");
+  }
+}
+
+template<typename TType>
+void format_argument(FormatOutput& output, const FormatSpec& spec, const void* value) {
+  if constexpr (std::is_array_v<TType>) {
+    Formatter<const char*>::format(output, spec, static_cast<const char*>(value));
+  } else {
+    Formatter<TType>::format(output, spec, *static_cast<const TType*>(value));
+  }
+}
+
+template<typename TType>
+inline FormatArgument make_format_argument(const TType& value) {
+  return FormatArgument { &value, &format_argument<TType> };
+}
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+template<typename... TArgs>
+consteval FormatString<TArgs...>::FormatString(const char* format)
+: mFormat(format)
+, mLength(0) {
+  while (format[mLength] != '\0') {
+    ++mLength;
+  }
+  internal::check_format_string<TArgs...>(mFormat, mLength);
+}
+
+template<typename... TArgs>
+constexpr const char* FormatString<TArgs...>::get() const {
+  return mFormat;
+}
+
+template<typename... TArgs>
+constexpr sizeT FormatString<TArgs...>::size() const {
+  return mLength;
+}
+
+template<typename... TArgs>
+inline String format(FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  String result;
+  format_to(result, formatString, args...);
+  return result;
+}
+
+template<typename... TArgs>
+inline String& format_to(String& destination, FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  const internal::FormatArgument arguments[] = { internal::make_format_argument(args)..., { nullptr, nullptr } };
+  internal::vformat_to(destination, formatString.get(), formatString.size(), arguments, sizeof...(TArgs));
+  return destination;
+}
+
+template<typename... TArgs>
+inline sizeT format_to(char* buffer, sizeT size, FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  const internal::FormatArgument arguments[] = { internal::make_format_argument(args)..., { nullptr, nullptr } };
+  return internal::vformat_to(buffer, size, formatString.get(), formatString.size(), arguments, sizeof...(TArgs));
+}
+
+template<typename... TArgs>
+inline void format_to(Stream& stream, FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  const internal::FormatArgument arguments[] = { internal::make_format_argument(args)..., { nullptr, nullptr } };
+  internal::vformat_to(stream, formatString.get(), formatString.size(), arguments, sizeof...(TArgs));
+}
+
+template<typename... TArgs>
+inline void format_to(FormatOutput& output, FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  const internal::FormatArgument arguments[] = { internal::make_format_argument(args)..., { nullptr, nullptr } };
+  internal::vformat_to(output, formatString.get(), formatString.size(), arguments, sizeof...(TArgs));
+}
+
+template<typename... TArgs>
+inline sizeT formatted_size(FormatStringFor<TArgs...> formatString, const TArgs&... args) {
+  const internal::FormatArgument arguments[] = { internal::make_format_argument(args)..., { nullptr, nullptr } };
+  return internal::vformatted_size(formatString.get(), formatString.size(), arguments, sizeof...(TArgs));
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
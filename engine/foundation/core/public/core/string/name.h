@@ -0,0 +1,325 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/platform/mutex.h"
+#include "core/std/atomic.h"
+#include "core/std/hash.h"
+#include "core/string/string.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * NameTable
+ *
+ * @brief
+ * Process wide table of interned strings behind core::Name.
+ *
+ * Every distinct string is stored once and gets a dense 32 bit id, id 0 is the empty string.
+ * Texts and entries are never moved or freed, so pointers to them stay valid for the lifetime
+ * of the process.
+ *
+ * Looking up a string which is already interned and resolving an id never lock: the hash table
+ * is an open addressing array of ids which is only ever appended to and replaced as a whole when
+ * it grows, the entries live in fixed-size chunks. Adding a new string takes a mutex.
+ *
+ * NameTable is a singleton class, so you can use the instance() method to access it.
+ */
+class NameTable {
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Number of entries per chunk */
+  static constexpr uint32 EntriesPerChunk = 4096;
+  /** Maximum number of chunks, limiting the table to 4M names */
+  static constexpr uint32 MaxChunks = 1024;
+  /** Size of the blocks holding the texts */
+  static constexpr uint32 TextBlockSize = 64 * 1024;
+
+  /**
+   * @brief
+   * An interned string.
+   */
+  struct Entry {
+    /** Null terminated text */
+    const char* Text;
+    /** Length of the text */
+    uint32 Size;
+    /** string_hash() of the text */
+    uint64 Hash;
+  };
+
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Retrieves the instance of the name table.
+   */
+  static NameTable& instance();
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Returns the id of a string, adding it if it is not known yet.
+   */
+  uint32 intern(const char* text, sizeT size);
+
+  /**
+   * @brief
+   * Returns the id of a string without adding it.
+   *
+   * @return
+   * The id, 0 if the string has not been interned
+   */
+  [[nodiscard]] uint32 find(const char* text, sizeT size);
+
+  /**
+   * @brief
+   * Returns the entry of an id, never locks.
+   */
+  [[nodiscard]] inline const Entry& get_entry(uint32 id) const;
+
+  /**
+   * @brief
+   * Returns the number of interned strings including the empty one.
+   */
+  [[nodiscard]] inline uint32 get_num_names() const;
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  /**
+   * @brief
+   * Open addressing hash table of ids, 0 marks a free slot.
+   */
+  struct Table {
+    /** Capacity minus one, the capacity is a power of two */
+    uint32 Mask;
+    /** The slots */
+    atomic<uint32>* Slots;
+  };
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  NameTable();
+
+  ~NameTable();
+
+  [[nodiscard]] uint32 probe(const char* text, sizeT size, uint64 hash) const;
+
+  [[nodiscard]] const char* store_text(const char* text, sizeT size);
+
+  void insert_slot(Table* table, uint32 id, uint64 hash);
+
+  void grow();
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Chunks of entries, indexed by id / EntriesPerChunk */
+  atomic<Entry*> mChunks[MaxChunks];
+  /** Number of entries */
+  atomic<uint32> mNumNames;
+  /** The current hash table */
+  atomic<Table*> mTable;
+  /** Replaced hash tables, kept alive for concurrent readers */
+  Vector<Table*> mRetiredTables;
+  /** Blocks holding the texts */
+  Vector<char*> mTextBlocks;
+  /** Free space in the current text block */
+  char* mTextCursor;
+  /** Size of the free space */
+  sizeT mTextRemaining;
+  /** Serializes adding names */
+  Mutex mMutex;
+};
+
+/**
+ * @class
+ * Name
+ *
+ * @brief
+ * Interned string used as identifier.
+ *
+ * A name is a 32 bit id into the NameTable: copying, comparing and hashing never touch the
+ * text. Use it for keys which are looked up far more often than they are created, like type,
+ * server and mount point names. Creating a name from a string costs a hash and a lookup, so
+ * keep names around instead of recreating them.
+ *
+ * @note
+ * - Ordering compares ids and is only stable within the running process; it is not alphabetical
+ * - Names are never released, don't intern unbounded data like user input
+ */
+class Name {
+
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Returns the name of a string if it has been interned before.
+   *
+   * @return
+   * The name, empty name if the string is unknown; doesn't add anything to the table
+   */
+  [[nodiscard]] static inline Name find(StringView text);
+
+  [[nodiscard]] static inline Name find(const String& text);
+
+  [[nodiscard]] static inline Name find(const char* text);
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor, the empty name.
+   */
+  inline Name();
+
+  /**
+   * @brief
+   * Constructor interning a string.
+   */
+  inline explicit Name(const char* text);
+
+  inline explicit Name(StringView text);
+
+  inline explicit Name(const String& text);
+
+  /**
+   * @brief
+   * Returns the id of the name, 0 for the empty name.
+   */
+  [[nodiscard]] inline uint32 get_id() const;
+
+  /**
+   * @brief
+   * Returns whether this is the empty name.
+   */
+  [[nodiscard]] inline bool is_empty() const;
+
+  /**
+   * @brief
+   * Returns the null terminated text, valid for the lifetime of the process.
+   */
+  [[nodiscard]] inline const char* c_str() const;
+
+  /**
+   * @brief
+   * Returns the length of the text.
+   */
+  [[nodiscard]] inline uint32 size() const;
+
+  /**
+   * @brief
+   * Returns the text as view.
+   */
+  [[nodiscard]] inline StringView view() const;
+
+  /**
+   * @brief
+   * Returns a copy of the text.
+   */
+  [[nodiscard]] inline String to_string() const;
+
+  /**
+   * @brief
+   * Returns a hash of the id.
+   */
+  [[nodiscard]] inline sizeT get_hash() const;
+
+  [[nodiscard]] inline bool operator==(const Name& other) const;
+
+  [[nodiscard]] inline bool operator!=(const Name& other) const;
+
+  [[nodiscard]] inline bool operator<(const Name& other) const;
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  /** Id in the name table */
+  uint32 mId;
+};
+
+template<>
+struct hash<Name> {
+  sizeT operator()(const Name& name) const {
+    return name.get_hash();
+  }
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+namespace std {
+
+template<>
+struct hash<core::Name> {
+  size_t operator()(const core::Name& name) const {
+    return name.get_hash();
+  }
+};
+
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/string/name.inl"
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline const NameTable::Entry& NameTable::get_entry(uint32 id) const {
+  return mChunks[id / EntriesPerChunk].load(std::memory_order_acquire)[id % EntriesPerChunk];
+}
+
+inline uint32 NameTable::get_num_names() const {
+  return mNumNames.load(std::memory_order_acquire);
+}
+
+inline Name Name::find(StringView text) {
+  Name name;
+  name.mId = NameTable::instance().find(text.data(), text.size());
+  return name;
+}
+
+inline Name Name::find(const String& text) {
+  Name name;
+  name.mId = NameTable::instance().find(text.c_str(), text.size());
+  return name;
+}
+
+inline Name Name::find(const char* text) {
+  Name name;
+  name.mId = NameTable::instance().find(text, char_strlen(text));
+  return name;
+}
+
+inline Name::Name()
+: mId(0) {
+}
+
+inline Name::Name(const char* text)
+: mId(NameTable::instance().intern(text, char_strlen(text))) {
+}
+
+inline Name::Name(StringView text)
+: mId(NameTable::instance().intern(text.data(), text.size())) {
+}
+
+inline Name::Name(const String& text)
+: mId(NameTable::instance().intern(text.c_str(), text.size())) {
+}
+
+inline uint32 Name::get_id() const {
+  return mId;
+}
+
+inline bool Name::is_empty() const {
+  return (0 == mId);
+}
+
+inline const char* Name::c_str() const {
+  return NameTable::instance().get_entry(mId).Text;
+}
+
+inline uint32 Name::size() const {
+  return NameTable::instance().get_entry(mId).Size;
+}
+
+inline StringView Name::view() const {
+  const NameTable::Entry& entry = NameTable::instance().get_entry(mId);
+  return StringView(entry.Text, entry.Size);
+}
+
+inline String Name::to_string() const {
+  const NameTable::Entry& entry = NameTable::instance().get_entry(mId);
+  return String(entry.Text, entry.Size);
+}
+
+inline sizeT Name::get_hash() const {
+  // Ids are dense, Fibonacci hashing spreads them over all bits
+  return static_cast<sizeT>(static_cast<uint64>(mId) * 0x9e3779b97f4a7c15ull);
+}
+
+inline bool Name::operator==(const Name& other) const {
+  return (mId == other.mId);
+}
+
+inline bool Name::operator!=(const Name& other) const {
+  return (mId != other.mId);
+}
+
+inline bool Name::operator<(const Name& other) const {
+  return (mId < other.mId);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
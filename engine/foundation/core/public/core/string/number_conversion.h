@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+/** Buffer size which is sufficient for every number written by to_chars() */
+static constexpr uint32 MaxNumberChars = 32;
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes the decimal representation of an integer, no null terminator is written.
+ *
+ * @param[in] first
+ * Begin of the destination buffer
+ * @param[in] last
+ * End of the destination buffer
+ * @param[in] value
+ * The value to write
+ *
+ * @return
+ * Pointer behind the last written character, null pointer if the buffer is too small
+ *
+ * @note
+ * - Two digits are produced at a time from a lookup table
+ */
+char* to_chars(char* first, char* last, uint32 value);
+
+char* to_chars(char* first, char* last, uint64 value);
+
+char* to_chars(char* first, char* last, int32 value);
+
+char* to_chars(char* first, char* last, int64 value);
+
+/**
+ * @brief
+ * Writes the shortest representation of a floating point value which reads back to the very
+ * same value, no null terminator is written.
+ *
+ * @return
+ * Pointer behind the last written character, null pointer if the buffer is too small
+ *
+ * @note
+ * - Uses the Ryu based shortest round-trip conversion of the C++ standard library, no locale
+ *   is involved
+ * - Integral values are written without fraction, e.g. "3"; large and small values use
+ *   exponent notation, e.g. "1e+20"
+ */
+char* to_chars(char* first, char* last, float value);
+
+char* to_chars(char* first, char* last, double value);
+
+/**
+ * @brief
+ * Reads a decimal integer with optional leading '-'.
+ *
+ * @param[in] first
+ * Begin of the text
+ * @param[in] last
+ * End of the text
+ * @param[out] value
+ * Receives the value, untouched on failure
+ *
+ * @return
+ * Pointer behind the last consumed character, null pointer if there is no number or it does
+ * not fit into the type
+ */
+const char* from_chars(const char* first, const char* last, uint32& value);
+
+const char* from_chars(const char* first, const char* last, uint64& value);
+
+const char* from_chars(const char* first, const char* last, int32& value);
+
+const char* from_chars(const char* first, const char* last, int64& value);
+
+/**
+ * @brief
+ * Reads a floating point value in fixed or exponent notation, correctly rounded.
+ *
+ * @return
+ * Pointer behind the last consumed character, null pointer if there is no number
+ *
+ * @note
+ * - Uses the Eisel-Lemire based conversion of the C++ standard library, no locale is involved
+ */
+const char* from_chars(const char* first, const char* last, float& value);
+
+const char* from_chars(const char* first, const char* last, double& value);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
@@ -31,7 +31,11 @@
 #include "core/core.h"
 #include "core/container/vector.h"
 #include "core/container/hash_map.h"
+#include "core/core/ptr.h"
+#include "core/core/refcounted.h"
+#include "core/platform/mutex.h"
 #include "core/string/string.h"
+#include "core/string/string_view.h"
 
 
 //[-------------------------------------------------------]
@@ -51,6 +55,344 @@ namespace core {
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+/**
+*  @brief
+*    Compiled PCRE pattern
+*
+*  @remarks
+*    Immutable once created, so one pattern is shared by all regular expressions with the same
+*    expression and options and can be used from several threads at the same time. Patterns are
+*    studied with the PCRE JIT compiler where the library supports it.
+*/
+class RegExPattern : public RefCounted {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Compile options
+  */
+  enum EOptions {
+    OptionCaseless	= 1,	/** Letters match both cases */
+    OptionMultiline	= 2,	/** '^' and '$' also match at internal newlines */
+    OptionDotAll	= 4,	/** '.' also matches newlines */
+    OptionUngreedy	= 8		/** Quantifiers are not greedy by default */
+  };
+
+  /** Maximum number of capturing groups a match reports, the whole match not included */
+  static constexpr uint32 MaxGroups = 11;
+  /** Size of the offset vector exec() fills */
+  static constexpr uint32 OffsetsSize = (MaxGroups + 1) * 3;
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Constructor, compiles the expression
+  *
+  *  @param[in] sExpression
+  *    Regular expression
+  *  @param[in] nOptions
+  *    Compile options (combination of EOptions values)
+  */
+  RegExPattern(const String &sExpression, int nOptions);
+
+  /**
+  *  @brief
+  *    Returns whether the expression compiled
+  */
+  [[nodiscard]] inline bool is_valid() const;
+
+  /**
+  *  @brief
+  *    Returns whether the pattern runs as JIT compiled machine code
+  */
+  [[nodiscard]] inline bool is_jit_compiled() const;
+
+  [[nodiscard]] inline const String &get_expression() const;
+
+  [[nodiscard]] inline int get_options() const;
+
+  /**
+  *  @brief
+  *    Returns the compile error, a null pointer if the expression is valid
+  */
+  [[nodiscard]] inline const char *get_error() const;
+
+  /**
+  *  @brief
+  *    Returns the byte offset of the compile error in the expression
+  */
+  [[nodiscard]] inline int get_error_offset() const;
+
+  /**
+  *  @brief
+  *    Matches the pattern against a subject
+  *
+  *  @param[in]  pszSubject
+  *    Subject, doesn't need to be null terminated
+  *  @param[in]  nSize
+  *    Size of the subject in bytes
+  *  @param[in]  nPosition
+  *    Byte position to start at
+  *  @param[out] pnOffsets
+  *    Receives begin and end offset of the match and the groups, OffsetsSize elements
+  *
+  *  @return
+  *    Number of set offset pairs, 0 or less if there is no match
+  */
+  int exec(const char *pszSubject, sizeT nSize, sizeT nPosition, int *pnOffsets) const;
+
+  /**
+  *  @brief
+  *    Returns the number of named groups
+  */
+  [[nodiscard]] uint32 get_num_names() const;
+
+  /**
+  *  @brief
+  *    Returns a named group
+  *
+  *  @param[in]  nIndex
+  *    Index of the name, below get_num_names()
+  *  @param[out] nGroup
+  *    Receives the group index of the name
+  *
+  *  @return
+  *    The name
+  */
+  [[nodiscard]] const char *get_name(uint32 nIndex, int &nGroup) const;
+
+  /**
+  *  @brief
+  *    Returns the group index of a name, -1 if there is no such group
+  */
+  [[nodiscard]] int get_group_index(const char *pszName) const;
+
+
+  //[-------------------------------------------------------]
+  //[ Protected functions                                   ]
+  //[-------------------------------------------------------]
+protected:
+  ~RegExPattern() override;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  String		 m_sExpression;		/** Regular expression */
+  int			 m_nOptions;		/** Compile options (combination of EOptions values) */
+  pcre		*m_pPCRE;			/** PCRE expression, can be a null pointer */
+  pcre_extra	*m_pExtra;			/** PCRE study data, can be a null pointer */
+  bool		 m_bJit;			/** Studied with the JIT compiler? */
+  const char	*m_pszError;		/** Compile error, can be a null pointer */
+  int			 m_nErrorOffset;	/** Byte offset of the compile error */
+};
+
+/**
+*  @brief
+*    Process wide cache of compiled patterns
+*
+*  @remarks
+*    Keyed by expression and compile options. When full the least recently used pattern is
+*    dropped from the cache, regular expressions still using it keep it alive.
+*/
+class RegExCache {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /** Number of patterns kept by default */
+  static constexpr uint32 DefaultCapacity = 64;
+
+
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  static RegExCache &instance();
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Returns the compiled pattern, compiles it on a miss
+  *
+  *  @param[in] sExpression
+  *    Regular expression
+  *  @param[in] nOptions
+  *    Compile options (combination of RegExPattern::EOptions values)
+  *
+  *  @return
+  *    The pattern, never a null pointer; check is_valid() for compile errors
+  */
+  Ptr<RegExPattern> get_pattern(const String &sExpression, int nOptions);
+
+  /**
+  *  @brief
+  *    Sets the maximum number of cached patterns, 0 disables the cache
+  */
+  void set_capacity(uint32 nCapacity);
+
+  [[nodiscard]] uint32 get_capacity() const;
+
+  [[nodiscard]] uint32 get_num_patterns() const;
+
+  /**
+  *  @brief
+  *    Returns the number of lookups which found a compiled pattern
+  */
+  [[nodiscard]] uint64 get_num_hits() const;
+
+  /**
+  *  @brief
+  *    Returns the number of lookups which had to compile
+  */
+  [[nodiscard]] uint64 get_num_misses() const;
+
+  /**
+  *  @brief
+  *    Drops all patterns from the cache
+  */
+  void clear();
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  struct Key {
+    String	Expression;
+    int		Options;
+
+    bool operator==(const Key &cOther) const {
+      return (Options == cOther.Options && Expression == cOther.Expression);
+    }
+  };
+
+  struct KeyHash {
+    sizeT operator()(const Key &cKey) const {
+      return std::hash<String>()(cKey.Expression) ^ static_cast<sizeT>(cKey.Options);
+    }
+  };
+
+  struct Entry {
+    Ptr<RegExPattern>	Pattern;
+    uint64				LastUse;
+  };
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  RegExCache();
+
+  ~RegExCache();
+
+  void evict(uint32 nCapacity);
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  mutable Mutex					 m_cMutex;
+  hash_map<Key, Entry, KeyHash>	 m_mapPatterns;
+  uint32							 m_nCapacity;
+  uint64							 m_nUseCounter;
+  uint64							 m_nHits;
+  uint64							 m_nMisses;
+};
+
+/**
+*  @brief
+*    Result of a match on a string view
+*
+*  @remarks
+*    Groups are spans in the subject, nothing is copied. The subject has to stay alive as long as
+*    the groups are used.
+*/
+class RegExMatch {
+
+
+  //[-------------------------------------------------------]
+  //[ Friends                                               ]
+  //[-------------------------------------------------------]
+  template<typename TCharType> friend class BasicRegEx;
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  inline RegExMatch();
+
+  /**
+  *  @brief
+  *    Returns the number of groups, the whole match is group 0; 0 if there is no match
+  */
+  [[nodiscard]] inline uint32 get_num_groups() const;
+
+  /**
+  *  @brief
+  *    Returns whether a group took part in the match
+  */
+  [[nodiscard]] inline bool has_group(uint32 nIndex) const;
+
+  /**
+  *  @brief
+  *    Returns the byte offset of a group in the subject
+  */
+  [[nodiscard]] inline sizeT get_group_offset(uint32 nIndex) const;
+
+  /**
+  *  @brief
+  *    Returns the byte size of a group
+  */
+  [[nodiscard]] inline sizeT get_group_size(uint32 nIndex) const;
+
+  /**
+  *  @brief
+  *    Returns a group as view into the subject, empty if it didn't take part in the match
+  */
+  [[nodiscard]] inline StringView get_group(uint32 nIndex) const;
+
+  /**
+  *  @brief
+  *    Returns a named group as view into the subject
+  */
+  [[nodiscard]] inline StringView get_named_group(const char *pszName) const;
+
+  /**
+  *  @brief
+  *    Returns the byte position behind the match, where to continue matching
+  */
+  [[nodiscard]] inline sizeT get_end() const;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  const char			*m_pszSubject;							/** Subject of the match */
+  Ptr<RegExPattern>	 m_pPattern;							/** Pattern which matched */
+  uint32				 m_nNumGroups;							/** Number of groups including the whole match */
+  int					 m_nOffsets[RegExPattern::OffsetsSize];	/** Begin and end offsets of the groups */
+};
+
 /**
 *  @brief
 *    Regular expression class (PCRE syntax)
@@ -230,10 +572,8 @@ public:
   *    Analyze the regular expression and store additional internal information
   *
   *  @remarks
-  *    This function analyses and stores additional internal information about the
-  *    regular expression, which is later used to speed up processing. So you should
-  *    call this e.g. for rather complicated expressions and/or expressions that
-  *    are used many times.
+  *    Kept for compatibility, expressions are studied (and JIT compiled where available) once
+  *    when the shared pattern is compiled.
   */
   CORE_API void study();
 
@@ -256,6 +596,26 @@ public:
   */
   CORE_API bool match(const BasicString<TCharType> &sSubject, uint32 nPosition = 0);
 
+  /**
+  *  @brief
+  *    Check if a string view matches the given regular expression, without copying
+  *
+  *  @param[in]  sSubject
+  *    Subject to test, must outlive the result
+  *  @param[in]  nPosition
+  *    start byte position in the subject, for instance a value received by 'RegExMatch::get_end()'
+  *  @param[out] cMatch
+  *    Receives the groups as spans in the subject
+  *
+  *  @return
+  *    'true' if the subject matches, else 'false'
+  *
+  *  @note
+  *    - Doesn't touch the results of this instance, so a constant regular expression can be
+  *      used from several threads at the same time
+  */
+  bool match(StringView sSubject, uint32 nPosition, RegExMatch &cMatch) const;
+
   /**
   *  @brief
   *    get current byte position in the subject string
@@ -329,13 +689,13 @@ public:
 private:
   /**
   *  @brief
-  *    Compiles the PCRE expression
+  *    Gets the compiled PCRE expression from the pattern cache
   */
   void compile_pcre();
 
   /**
   *  @brief
-  *    Deletes the PCRE expression
+  *    Releases the PCRE expression
   */
   void free_pcre();
 
@@ -346,8 +706,7 @@ private:
 private:
   // Regular expression
   BasicString<TCharType>					 m_sExpression;		/** Regular expression */
-  pcre					*m_pPCRE;			/** PCRE expression, can be a null pointer */
-  pcre_extra				*m_pExtra;			/** PCRE extra data, can be a null pointer */
+  Ptr<RegExPattern>		 m_pPattern;		/** Shared compiled pattern, can be a null pointer */
   uint32					 m_nFlags;			/** Processing mode and encoding (combination of EFlags values) */
 
   // Matches
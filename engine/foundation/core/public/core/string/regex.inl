@@ -19,12 +19,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-//[-------------------------------------------------------]
-//[ Includes                                              ]
-//[-------------------------------------------------------]
-#include <pcre.h>
-
-
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -32,16 +26,67 @@ namespace core {
 
 
 //[-------------------------------------------------------]
-//[ Definitions                                           ]
+//[ Classes                                               ]
 //[-------------------------------------------------------]
-// Maximum number of arguments we can set
-static const int MaxGroups	= 11;
-static const int VecSize	= (MaxGroups+1) * 3;
+inline bool RegExPattern::is_valid() const {
+  return (m_pPCRE != nullptr);
+}
 
+inline bool RegExPattern::is_jit_compiled() const {
+  return m_bJit;
+}
+
+inline const String &RegExPattern::get_expression() const {
+  return m_sExpression;
+}
+
+inline int RegExPattern::get_options() const {
+  return m_nOptions;
+}
+
+inline const char *RegExPattern::get_error() const {
+  return m_pszError;
+}
+
+inline int RegExPattern::get_error_offset() const {
+  return m_nErrorOffset;
+}
+
+inline RegExMatch::RegExMatch() :
+m_pszSubject(nullptr),
+m_nNumGroups(0) {
+
+}
+
+inline uint32 RegExMatch::get_num_groups() const {
+  return m_nNumGroups;
+}
+
+inline bool RegExMatch::has_group(uint32 nIndex) const {
+  return (nIndex < m_nNumGroups && m_nOffsets[nIndex*2] >= 0);
+}
+
+inline sizeT RegExMatch::get_group_offset(uint32 nIndex) const {
+  return has_group(nIndex) ? static_cast<sizeT>(m_nOffsets[nIndex*2]) : 0;
+}
+
+inline sizeT RegExMatch::get_group_size(uint32 nIndex) const {
+  return has_group(nIndex) ? static_cast<sizeT>(m_nOffsets[nIndex*2+1] - m_nOffsets[nIndex*2]) : 0;
+}
+
+inline StringView RegExMatch::get_group(uint32 nIndex) const {
+  return has_group(nIndex) ? StringView(m_pszSubject + m_nOffsets[nIndex*2], get_group_size(nIndex)) : StringView();
+}
+
+inline StringView RegExMatch::get_named_group(const char *pszName) const {
+  const int nIndex = m_pPattern ? m_pPattern->get_group_index(pszName) : -1;
+  return (nIndex >= 0) ? get_group(static_cast<uint32>(nIndex)) : StringView();
+}
+
+inline sizeT RegExMatch::get_end() const {
+  return (m_nNumGroups > 0) ? static_cast<sizeT>(m_nOffsets[1]) : 0;
+}
 
-//[-------------------------------------------------------]
-//[ Classes                                               ]
-//[-------------------------------------------------------]
 template<typename TCharType>
 BasicString<TCharType> BasicRegEx<TCharType>::wildcard_to_regex(const BasicString<TCharType> &sWildcard) {
   BasicString<TCharType> sString = '^';
@@ -81,8 +126,6 @@ BasicString<TCharType> BasicRegEx<TCharType>::wildcard_to_regex(const BasicStrin
 
 template<typename TCharType>
 BasicRegEx<TCharType>::BasicRegEx() :
-m_pPCRE(nullptr),
-m_pExtra(nullptr),
 m_nFlags(MatchCaseSensitive | MatchGreedy),
 m_nPosition(0) {
 
@@ -90,8 +133,6 @@ m_nPosition(0) {
 
 template<typename TCharType>
 BasicRegEx<TCharType>::BasicRegEx(const BasicString<TCharType> &sExpression, uint32 nFlags) :
-m_pPCRE(nullptr),
-m_pExtra(nullptr),
 m_nFlags(nFlags),
 m_nPosition(0) {
   // Set expression
@@ -100,8 +141,6 @@ m_nPosition(0) {
 
 template<typename TCharType>
 BasicRegEx<TCharType>::BasicRegEx(const BasicRegEx &cRegEx) :
-m_pPCRE(nullptr),
-m_pExtra(nullptr),
 m_nFlags(cRegEx.m_nFlags),
 m_nPosition(0) {
   // Copy expression
@@ -154,7 +193,7 @@ void BasicRegEx<TCharType>::set_expression(const BasicString<TCharType> &sExpres
 template<typename TCharType>
 bool BasicRegEx<TCharType>::is_valid() const {
   // Return valid flag
-  return (m_pPCRE != nullptr);
+  return (m_pPattern && m_pPattern->is_valid());
 }
 
 template<typename TCharType>
@@ -184,91 +223,42 @@ bool BasicRegEx<TCharType>::is_utf8() const {
 
 template<typename TCharType>
 void BasicRegEx<TCharType>::study() {
-  if (m_pPCRE) {
-    const char *pszError;
-    m_pExtra = pcre_study(m_pPCRE, 0, &pszError);
-  }
+  // The shared pattern has been studied when it was compiled
 }
 
 template<typename TCharType>
 bool BasicRegEx<TCharType>::match(const BasicString<TCharType> &sSubject, uint32 nPosition) {
-  if (m_pPCRE) {
+  if (m_pPattern) {
     // Clear results of last operation
     clear_results();
 
-    // Early escape test: In case we try matching when we are already at the end of the string, we know the result without doing any matches
-    if (nPosition < sSubject.length()) {
-      // Match pattern
-      int nMatches[VecSize];
-      int nMatchCount = pcre_exec(
-        m_pPCRE,								// PCRE expression
-        m_pExtra,								// Extra data
-        sSubject.data(),					// Subject string
-        sSubject.size(),	// Subject length in bytes
-        nPosition,								// start at byte position
-        0,										// Default options
-        nMatches,								// Output vector with offsets in bytes
-        VecSize									// Size of output vector
-      );
-
-      // Output vector too small?
-      if (nMatchCount == 0) {
-        // Allocate big enough output vector and retry
-        // [TODO]
-        nMatchCount = MaxGroups;
+    RegExMatch cMatch;
+    if (match(StringView(sSubject.data(), sSubject.size()), nPosition, cMatch)) {
+      // Save new byte position within the string
+      m_nPosition = static_cast<int>(cMatch.get_end());
+
+      // The first group is the result string which was matched by the expression
+      // e.g. source string is: "Hallo World!", the expression is "Hal+o" -> first element = "Hallo"
+      const StringView sMatch = cMatch.get_group(0);
+      m_sMatchResult = BasicString<TCharType>(sMatch.data(), sMatch.size());
+
+      // Save matching substrings which have a group description in the expression by index
+      m_lstGroups.resize(cMatch.get_num_groups() - 1);
+      for (uint32 i=1; i<cMatch.get_num_groups(); i++) {
+        const StringView sGroup = cMatch.get_group(i);
+        m_lstGroups[i-1] = BasicString<TCharType>(sGroup.data(), sGroup.size());
       }
 
-      // Check result
-      if (nMatchCount > 0) {
-        // Save new byte position within the string
-        m_nPosition = nMatches[1];
-
-        // get pointer to subject string
-        const char *pszSubject = sSubject.c_str();
-        // The first two elements in nMatches describe the result string which was matched by the expression
-        // e.g. source string is: "Hallo World!", the expression is "Hal+o" -> first element = "Hallo"
-        //m_sMatchResult.copy(&pszSubject[nMatches[0]], nMatches[1] - nMatches[0]);
-        m_sMatchResult = sSubject.substr(nMatches[0], nMatches[1] - nMatches[0]);
-
-        // Save matching substrings which have a group description in the expression by index
-        m_lstGroups.resize(nMatchCount-1);
-        for (int i=1; i<nMatchCount; i++) {
-          //m_lstGroups[i-1].copy(&pszSubject[nMatches[i*2]], nMatches[i*2+1] - nMatches[i*2]);
-          m_lstGroups[i-1] = sSubject.substr(nMatches[i*2], nMatches[i*2+1] - nMatches[i*2]);
-        }
-        // get named groups
-        int nNameCount;
-        pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMECOUNT, &nNameCount);
-        const char *pszNameTable;
-        pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMETABLE, &pszNameTable);
-        int nNameEntrySize;
-        pcre_fullinfo(m_pPCRE, m_pExtra, PCRE_INFO_NAMEENTRYSIZE, &nNameEntrySize);
-
-        // Return matching substrings by name
-        for (int i=0; i<nNameCount; i++) {
-          // get pointer to current entry
-          const char *pszEntry = &pszNameTable[i*nNameEntrySize];
-
-          // get number
-          const int nNum = (pszEntry[0] << 8) | pszEntry[1];
-
-          // get name
-          const BasicString<TCharType> sName = &pszEntry[2];
-
-          // get substring
-          const int nIndex0 = nMatches[nNum*2];
-          const int nIndex1 = nMatches[nNum*2+1];
-
-          // Add name->substring to map
-          if (nIndex0 >= 0 && nIndex1 >= 0)
-            m_mapGroups.emplace(sName, String(&pszSubject[nIndex0], true, nIndex1 - nIndex0));
-          else
-            m_mapGroups.emplace(sName, "");
-        }
-
-        // Done
-        return true;
+      // Return matching substrings by name
+      for (uint32 i=0, nNameCount=m_pPattern->get_num_names(); i<nNameCount; i++) {
+        int nGroup = 0;
+        const BasicString<TCharType> sName = m_pPattern->get_name(i, nGroup);
+        const StringView sGroup = cMatch.get_group(static_cast<uint32>(nGroup));
+        m_mapGroups.emplace(sName, BasicString<TCharType>(sGroup.data(), sGroup.size()));
       }
+
+      // Done
+      return true;
     }
   }
 
@@ -276,6 +266,27 @@ bool BasicRegEx<TCharType>::match(const BasicString<TCharType> &sSubject, uint32
   return false;
 }
 
+template<typename TCharType>
+bool BasicRegEx<TCharType>::match(StringView sSubject, uint32 nPosition, RegExMatch &cMatch) const {
+  cMatch.m_pszSubject = sSubject.data();
+  cMatch.m_nNumGroups = 0;
+
+  // Early escape test: In case we try matching when we are already at the end of the string, we know the result without doing any matches
+  if (m_pPattern && nPosition < sSubject.size()) {
+    const int nMatchCount = m_pPattern->exec(sSubject.data(), sSubject.size(), nPosition, cMatch.m_nOffsets);
+
+    // Output vector too small? Then it's completely filled.
+    if (nMatchCount >= 0) {
+      cMatch.m_pPattern = m_pPattern;
+      cMatch.m_nNumGroups = (nMatchCount == 0) ? RegExPattern::MaxGroups + 1 : static_cast<uint32>(nMatchCount);
+      return true;
+    }
+  }
+
+  // No match
+  return false;
+}
+
 template<typename TCharType>
 int BasicRegEx<TCharType>::get_position() const {
   return m_nPosition;
@@ -321,36 +332,21 @@ void BasicRegEx<TCharType>::clear_results() {
 
 template<typename TCharType>
 void BasicRegEx<TCharType>::compile_pcre() {
-  // Free former expression
-  free_pcre();
-
   // Set options
-  int nOptions = (is_case_sensitive() ? 0 : PCRE_CASELESS) | (is_greedy() ? 0 : PCRE_UNGREEDY);
+  int nOptions = (is_case_sensitive() ? 0 : RegExPattern::OptionCaseless) | (is_greedy() ? 0 : RegExPattern::OptionUngreedy);
   if (m_nFlags & Multiline)
-    nOptions |= PCRE_MULTILINE;
+    nOptions |= RegExPattern::OptionMultiline;
   if (m_nFlags & DotAll)
-    nOptions |= PCRE_DOTALL;
-
-  const char *pszError;
-  int nErrorOffset;
-
-  // Compile regular expression
-  m_pPCRE = pcre_compile(m_sExpression.c_str(), nOptions, &pszError, &nErrorOffset, nullptr);
+    nOptions |= RegExPattern::OptionDotAll;
 
-
-  if (!m_pPCRE) {
-    // Error!
-  }
+  // get the compiled regular expression, patterns used before are not compiled again
+  m_pPattern = RegExCache::instance().get_pattern(m_sExpression, nOptions);
 }
 
 template<typename TCharType>
 void BasicRegEx<TCharType>::free_pcre() {
-  // Free PCRE expression
-  if (m_pPCRE) {
-    pcre_free(m_pPCRE);
-    m_pPCRE  = nullptr;
-    m_pExtra = nullptr;
-  }
+  // release PCRE expression
+  m_pPattern = nullptr;
 }
 
 
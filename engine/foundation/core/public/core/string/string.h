@@ -33,6 +33,7 @@
 #include "core/memory/memory.h"
 #include "core/memory/std_allocator.h"
 #include "core/std/compressed_pair.h"
+#include "core/string/number_conversion.h"
 #include "core/string/string_utils.h"
 #include "core/std/hash.h"
 #include "core/std/iterator.h"
@@ -778,6 +779,8 @@ protected:
 
   void size_initialize(SizeType n, ValueType c);
 
+  ThisType &append_number(const char *pBegin, const char *pEnd);
+
 protected:
 
   CompressedPair<Layout, AllocatorType> mPair;
@@ -940,7 +943,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, float b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%g", b);
+  result.append(b);
 
   return result;
 }
@@ -949,7 +952,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, double b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%g", b);
+  result.append(b);
 
   return result;
 }
@@ -958,7 +961,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, uint8 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -967,7 +970,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, uint16 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -976,7 +979,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, uint32 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -985,7 +988,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, uint64 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -994,7 +997,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, int16 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -1003,7 +1006,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, int32 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -1012,7 +1015,7 @@ template<typename TType, typename TAllocator>
 inline BasicString<TType, TAllocator> operator+(const BasicString<TType, TAllocator> &a, int64 b) {
   BasicString<TType, TAllocator> result(a);
 
-  result.append_format("%d", b);
+  result.append(b);
 
   return result;
 }
@@ -1025,8 +1028,8 @@ typedef BasicString<char32_t> U32String;
 
 template<>
 struct hash<core::String> {
-  size_t operator()(core::String &p) const {
-    return (size_t) hash<char *>()(p.c_str());
+  size_t operator()(const core::String &p) const {
+    return (size_t) string_hash(p.data(), p.size());
   }
 };
 
@@ -1054,23 +1057,23 @@ struct hash<core::U32String> {
 
 
 inline String to_string(int value)
-{ return String().append_format("%d", value); }
+{ return String().append(static_cast<int32>(value)); }
 inline String to_string(long value)
-{ return String().append_format("%ld", value); }
+{ return String().append(static_cast<int64>(value)); }
 inline String to_string(long long value)
-{ return String().append_format("%lld", value); }
+{ return String().append(static_cast<int64>(value)); }
 inline String to_string(unsigned value)
-{ return String().append_format("%u", value); }
+{ return String().append(static_cast<uint32>(value)); }
 inline String to_string(unsigned long value)
-{ return String().append_format("%lu", value); }
+{ return String().append(static_cast<uint64>(value)); }
 inline String to_string(unsigned long long value)
-{ return String().append_format("%llu", value); }
+{ return String().append(static_cast<uint64>(value)); }
 inline String to_string(float value)
-{ return String().append_format("%f", value); }
+{ return String().append(value); }
 inline String to_string(double value)
-{ return String().append_format("%f", value); }
+{ return String().append(value); }
 inline String to_string(long double value)
-{ return String().append_format("%Lf", value); }
+{ return String().append(static_cast<double>(value)); }
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -1083,7 +1086,7 @@ namespace std {
 template<>
 struct hash<core::String> {
   size_t operator()(const core::String &p) const {
-    return (size_t) core::hash<char *>()(p.c_str());
+    return (size_t) core::string_hash(p.data(), p.size());
   }
 };
 
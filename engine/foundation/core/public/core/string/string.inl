@@ -507,47 +507,47 @@ typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::opera
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(uint8 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(uint16 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(uint32 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(uint64 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(int16 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(int32 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(int64 c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(float c) {
-  return *this;
+  return this->append(c);
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::operator+=(double c) {
-  return *this;
+  return this->append(c);
 }
 
 
@@ -572,17 +572,42 @@ bool BasicString<T, TAllocator>::get_bool() const {
 
 template<typename T, typename TAllocator>
 sizeT BasicString<T, TAllocator>::get_int() const {
-  return atoi(this->InternalLayout().BeginPtr());
+  const char* begin = this->InternalLayout().BeginPtr();
+  const char* end = this->InternalLayout().EndPtr();
+  while (begin != end && isspace(static_cast<unsigned char>(*begin))) {
+    ++begin;
+  }
+  // from_chars only knows '-', atoi did accept an explicit '+' as well
+  if (begin != end && *begin == '+') {
+    ++begin;
+  }
+  int64 value = 0;
+  core::from_chars(begin, end, value);
+  return static_cast<sizeT>(value);
 }
 
 template<typename T, typename TAllocator>
 float BasicString<T, TAllocator>::get_float() const {
-  return atof(this->InternalLayout().BeginPtr());
+  return static_cast<float>(this->get_double());
 }
 
 template<typename T, typename TAllocator>
 double BasicString<T, TAllocator>::get_double() const {
-  return atof(this->InternalLayout().BeginPtr());
+  const char* begin = this->InternalLayout().BeginPtr();
+  const char* end = this->InternalLayout().EndPtr();
+  while (begin != end && isspace(static_cast<unsigned char>(*begin))) {
+    ++begin;
+  }
+  if (begin != end && *begin == '+') {
+    ++begin;
+  }
+  double value = 0.0;
+  if (nullptr == core::from_chars(begin, end, value) || (end - begin > 1 && *begin == '0' && (begin[1] == 'x' || begin[1] == 'X'))) {
+    // Fall back to strtod for everything the fast path rejects or would cut short,
+    // e.g. hexadecimal floats, so the accepted input stays the same as with atof
+    value = strtod(this->InternalLayout().BeginPtr(), nullptr);
+  }
+  return value;
 }
 
 template<typename T, typename TAllocator>
@@ -991,20 +1016,27 @@ typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::appen
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append_format_valist(const ValueType *pFormat, va_list cArguments) {
-  SizeType len_ = vsnprintf(nullptr, 0, pFormat, cArguments);
-
-  if (len_ > 0) {
-    char * pNewString = reinterpret_cast<char*>(this->get_allocator().allocate(sizeof(T) * (len_ + 1)));
+  // Most results fit into a small stack buffer and only need a single formatting pass
+  char buffer[256];
+  va_list arguments;
+  va_copy(arguments, cArguments);
+  const int length = vsnprintf(buffer, sizeof(buffer), pFormat, arguments);
+  va_end(arguments);
 
-    //va_start(cArguments, pFormat);
-    vsprintf(pNewString, pFormat, cArguments);
-    //va_end(cArguments);
+  if (length > 0) {
+    if (static_cast<sizeT>(length) < sizeof(buffer)) {
+      this->append(buffer, static_cast<SizeType>(length));
+    } else {
+      char * pNewString = reinterpret_cast<char*>(this->get_allocator().allocate(sizeof(T) * (length + 1)));
 
-    pNewString[len_] = 0;
+      va_copy(arguments, cArguments);
+      vsnprintf(pNewString, length + 1, pFormat, arguments);
+      va_end(arguments);
 
-    this->append(pNewString);
+      this->append(pNewString, static_cast<SizeType>(length));
 
-    this->get_allocator().deallocate(pNewString, 1);
+      this->get_allocator().deallocate(pNewString, 1);
+    }
   }
 
   return *this;
@@ -1014,23 +1046,9 @@ template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append_format(const ValueType *pFormat, ...) {
   va_list lstArgs;
   va_start(lstArgs, pFormat);
-  SizeType len_ = vsnprintf(nullptr, 0, pFormat, lstArgs);
+  this->append_format_valist(pFormat, lstArgs);
   va_end(lstArgs);
 
-  if (len_ > 0) {
-    char * pNewString = reinterpret_cast<char*>(this->get_allocator().allocate(sizeof(T) * (len_ + 1)));
-
-    va_start(lstArgs, pFormat);
-    vsprintf(pNewString, pFormat, lstArgs);
-    va_end(lstArgs);
-
-    pNewString[len_] = 0;
-
-    this->append(pNewString);
-
-    this->get_allocator().deallocate(pNewString, 1);
-  }
-
   return *this;
 }
 
@@ -1065,56 +1083,70 @@ typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::appen
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(uint8 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%d", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, static_cast<uint32>(c)));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(uint16 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%d", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, static_cast<uint32>(c)));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(uint32 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%d", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(uint64 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%ld", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(int16 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%d", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, static_cast<int32>(c)));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(int32 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%d", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(int64 c) {
-  this->append(BasicString<T, TAllocator>().append_format("%ld", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(float c) {
-  this->append(BasicString<T, TAllocator>().append_format("%g", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append(double c) {
-  this->append(BasicString<T, TAllocator>().append_format("%g", c));
-  return *this;
+  char buffer[MaxNumberChars];
+  return this->append_number(buffer, core::to_chars(buffer, buffer + MaxNumberChars, c));
+}
+
+template<typename T, typename TAllocator>
+typename BasicString<T, TAllocator>::ThisType &BasicString<T, TAllocator>::append_number(const char *pBegin, const char *pEnd) {
+  if constexpr (sizeof(ValueType) == sizeof(char)) {
+    return this->append(reinterpret_cast<const ValueType*>(pBegin), static_cast<SizeType>(pEnd - pBegin));
+  } else {
+    // Digits are plain ASCII, widening is a simple cast
+    ValueType buffer[MaxNumberChars];
+    for (const char* p = pBegin; p != pEnd; ++p) {
+      buffer[p - pBegin] = static_cast<ValueType>(*p);
+    }
+    return this->append(buffer, static_cast<SizeType>(pEnd - pBegin));
+  }
 }
 
 
@@ -1411,7 +1443,7 @@ typename BasicString<T, TAllocator>::SizeType
 BasicString<T, TAllocator>::find(const ValueType *p, SizeType position, SizeType n) const {
 
   if (((NPOS - n) >= position) && (position + n) <= this->InternalLayout().GetSize()) {
-    const ValueType * const pT = core::search(this->InternalLayout().BeginPtr() + position, this->InternalLayout().EndPtr(), p, p + n);
+    const ValueType * const pT = char_type_string_search(this->InternalLayout().BeginPtr() + position, this->InternalLayout().EndPtr(), p, p + n);
 
     if ((pT != this->InternalLayout().EndPtr()) || (n == 0)) {
       return SizeType (pT - this->InternalLayout().BeginPtr());
@@ -1425,14 +1457,10 @@ template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::SizeType
 BasicString<T, TAllocator>::find(ValueType c, SizeType position) const noexcept {
   if (position < this->InternalLayout().GetSize()) {
-    const ConstIterator pIter = core::find(this->InternalLayout().BeginPtr() + position, this->InternalLayout().EndPtr(), c);
-
-    if (pIter != this->InternalLayout().EndPtr()) {
-      return SizeType(pIter - this->InternalLayout().BeginPtr());
-    }
+    const ValueType * const pResult = core::find(this->InternalLayout().BeginPtr() + position, c, this->InternalLayout().GetSize() - position);
 
-    if (pIter != this->InternalLayout().EndPtr()) {
-      return SizeType (pIter - this->InternalLayout().BeginPtr());
+    if (pResult != nullptr) {
+      return SizeType(pResult - this->InternalLayout().BeginPtr());
     }
   }
 
@@ -1853,24 +1881,18 @@ const typename BasicString<T, TAllocator>::ValueType *BasicString<T, TAllocator>
 
 template<typename T, typename TAllocator>
 void BasicString<T, TAllocator>::make_lower() {
-  for (Pointer p = this->InternalLayout().BeginPtr(); p < this->InternalLayout().EndPtr(); ++p) {
-    *p = (ValueType) char_to_lower(*p);
-  }
+  char_string_to_lower(this->InternalLayout().BeginPtr(), this->InternalLayout().GetSize());
 }
 
 template<typename T, typename TAllocator>
 void BasicString<T, TAllocator>::make_upper() {
-  for (Pointer p = this->InternalLayout().BeginPtr(); p < this->InternalLayout().EndPtr(); ++p) {
-    *p = (ValueType) char_to_upper(*p);
-  }
+  char_string_to_upper(this->InternalLayout().BeginPtr(), this->InternalLayout().GetSize());
 }
 
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType BasicString<T, TAllocator>::to_lower() const {
   BasicString<T, TAllocator>::ThisType result(*this);
-  for (Pointer p = result.InternalLayout().BeginPtr(); p < result.InternalLayout().EndPtr(); ++p) {
-    *p = (ValueType) char_to_lower(*p);
-  }
+  result.make_lower();
 
   return result;
 }
@@ -1878,9 +1900,7 @@ typename BasicString<T, TAllocator>::ThisType BasicString<T, TAllocator>::to_low
 template<typename T, typename TAllocator>
 typename BasicString<T, TAllocator>::ThisType BasicString<T, TAllocator>::to_upper() const {
   BasicString<T, TAllocator>::ThisType result(*this);
-  for (Pointer p = result.InternalLayout().BeginPtr(); p < result.InternalLayout().EndPtr(); ++p) {
-    *p = (ValueType) char_to_upper(*p);
-  }
+  result.make_upper();
 
   return result;
 }
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Set of 8-bit characters for the find_first_of() style scans.
+ *
+ * @remarks
+ * Membership is a 256 bit table. Sets of up to MaxVectorChars distinct characters also keep the
+ * list of characters, the scans then compare whole blocks against each of them.
+ */
+class CharacterSet {
+public:
+  /** Maximum number of distinct characters for the vectorized scans */
+  static constexpr uint32 MaxVectorChars = 16;
+
+public:
+  /**
+   * @brief
+   * Default constructor, the empty set.
+   */
+  CharacterSet();
+
+  /**
+   * @brief
+   * Constructor adding the given characters.
+   */
+  CharacterSet(const char* chars, sizeT count);
+
+  void clear();
+
+  void add(char c);
+
+  void add(const char* chars, sizeT count);
+
+  [[nodiscard]] bool contains(char c) const {
+    const uint8 index = static_cast<uint8>(c);
+    return (mBits[index >> 6] >> (index & 63)) & 1;
+  }
+
+  [[nodiscard]] bool is_empty() const {
+    return mNumChars == 0;
+  }
+
+  /**
+   * @brief
+   * Returns whether the scans can compare whole blocks, which needs at most MaxVectorChars characters.
+   */
+  [[nodiscard]] bool is_vectorizable() const {
+    return mNumChars <= MaxVectorChars;
+  }
+
+  [[nodiscard]] uint32 get_num_chars() const {
+    return mNumChars;
+  }
+
+  /**
+   * @brief
+   * Returns the characters of the set, only valid if is_vectorizable() is true.
+   */
+  [[nodiscard]] const char* get_chars() const {
+    return mChars;
+  }
+
+private:
+  /** Membership table */
+  uint64 mBits[4];
+  /** The first MaxVectorChars distinct characters */
+  char mChars[MaxVectorChars];
+  /** Number of distinct characters */
+  uint32 mNumChars;
+};
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+// Vectorized kernels behind the 8-bit string functions. They work on 16 byte blocks with SSE2
+// or NEON and fall back to scalar code elsewhere; single character searches and plain
+// comparisons go to the C library, whose implementations are already dispatched at runtime.
+// Results are exactly those of the scalar string functions, case folding is ASCII only like
+// tolower() and toupper() in the "C" locale the engine runs in.
+
+/**
+ * @brief
+ * Finds the last occurrence of a character.
+ *
+ * @return
+ * Pointer to the character, null pointer if not found
+ */
+const char* string_rfind_char(const char* first, const char* last, char c);
+
+/**
+ * @brief
+ * Finds the first character which is part of a set.
+ *
+ * @return
+ * Pointer to the character, 'last' if there is none
+ */
+const char* string_find_first_of(const char* first, const char* last, const CharacterSet& set);
+
+/**
+ * @brief
+ * Finds the first character which is not part of a set.
+ *
+ * @return
+ * Pointer to the character, 'last' if there is none
+ */
+const char* string_find_first_not_of(const char* first, const char* last, const CharacterSet& set);
+
+/**
+ * @brief
+ * Counts the occurrences of a character, e.g. the line breaks in a range of text.
+ */
+sizeT string_count_char(const char* first, const char* last, char c);
+
+/**
+ * @brief
+ * Finds the first occurrence of a pattern.
+ *
+ * @return
+ * Pointer to the first match, 'last' if there is none; 'first' for an empty pattern
+ */
+const char* string_search(const char* first, const char* last, const char* patternFirst, const char* patternLast);
+
+/**
+ * @brief
+ * Compares two ranges byte-wise as unsigned characters.
+ *
+ * @return
+ * -1, 0 or 1
+ */
+int string_compare(const char* p1, const char* p2, sizeT n);
+
+/**
+ * @brief
+ * Compares two ranges as unsigned characters, ignoring ASCII case.
+ *
+ * @return
+ * -1, 0 or 1, the lower case characters decide the order
+ */
+int string_compare_i(const char* p1, const char* p2, sizeT n);
+
+/**
+ * @brief
+ * Converts ASCII characters to lower case in place.
+ */
+void string_to_lower(char* p, sizeT n);
+
+/**
+ * @brief
+ * Converts ASCII characters to upper case in place.
+ */
+void string_to_upper(char* p, sizeT n);
+
+/**
+ * @brief
+ * Fast non-cryptographic 64 bit hash of a byte range.
+ *
+ * @note
+ * - Based on wyhash: 16 bytes per 64x64->128 bit multiplication, three independent lanes for
+ *   long input; not stable across versions of the engine, do not persist the values
+ */
+uint64 string_hash(const void* data, sizeT size, uint64 seed = 0);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
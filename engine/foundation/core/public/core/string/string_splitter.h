@@ -31,6 +31,7 @@
 #include "core/core.h"
 #include "core/container/vector.h"
 #include "core/string/string.h"
+#include "core/string/string_view.h"
 
 
 //[-------------------------------------------------------]
@@ -70,6 +71,19 @@ public:
    */
   static Vector<BasicString<TType>> split(const BasicString<TType> & str, const BasicString<TType>& splitter);
 
+  /**
+   * @brief
+   * Splits a string into views of the substrings without copying them.
+   *
+   * Only available for 8-bit strings, the views point into `str`.
+   *
+   * @param[in] str The input string to be split.
+   * @param[in] splitter The characters which separate the substrings.
+
+   * @return A vector containing views of the substrings.
+   */
+  static Vector<BasicStringView<TType>> split_view(BasicStringView<TType> str, const BasicString<TType>& splitter);
+
 private:
 };
 
@@ -23,6 +23,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/string/tokenizer.h"
+#include "core/string/view_tokenizer.h"
+#include <type_traits>
 
 
 //[-------------------------------------------------------]
@@ -36,8 +38,31 @@ namespace core {
 //[-------------------------------------------------------]
 template<typename TType>
 Vector<BasicString<TType>> BasicStringSplitter<TType>::split(const BasicString<TType> & str, const BasicString<TType>& splitter) {
-  BasicTokenizer<TType> tokenizer;
+  if constexpr (std::is_same_v<TType, char>) {
+    Vector<BasicString<TType>> result;
+    for (const StringView& token : split_view(StringView(str.data(), str.size()), splitter)) {
+      result.emplace_back(token.data(), token.size());
+    }
+    return result;
+  } else {
+    BasicTokenizer<TType> tokenizer;
+    tokenizer.set_delimiters(splitter);
+    tokenizer.set_single_line_comment("");
+    tokenizer.set_quotes("");
+    tokenizer.set_single_chars("");
+    tokenizer.start(str);
+
+    return tokenizer.get_tokens();
+  }
+}
+
+template<typename TType>
+Vector<BasicStringView<TType>> BasicStringSplitter<TType>::split_view(BasicStringView<TType> str, const BasicString<TType>& splitter) {
+  static_assert(std::is_same_v<TType, char>, "Only 8-bit strings can be split into views");
+
+  ViewTokenizer tokenizer;
   tokenizer.set_delimiters(splitter);
+  tokenizer.set_comment_start_tag("");
   tokenizer.set_single_line_comment("");
   tokenizer.set_quotes("");
   tokenizer.set_single_chars("");
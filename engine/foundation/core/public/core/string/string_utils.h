@@ -29,6 +29,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "core/core.h"
+#include "core/string/string_simd.h"
 #include "core/std/typetraits/is_unsigned.h"
 #include <cctype>
 #include <cstring>
@@ -167,6 +168,50 @@ inline const wchar_t *find(const wchar_t *p, wchar_t c, sizeT n) {
 }
 
 
+//
+// hex_digit_value
+//
+inline int hex_digit_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+
+//
+// encode_utf8, writes up to 4 bytes and returns the number of bytes written
+//
+inline uint32 encode_utf8(uint32 codePoint, char *pDst) {
+  if (codePoint < 0x80) {
+    pDst[0] = (char) codePoint;
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    pDst[0] = (char) (0xc0 | (codePoint >> 6));
+    pDst[1] = (char) (0x80 | (codePoint & 0x3f));
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    pDst[0] = (char) (0xe0 | (codePoint >> 12));
+    pDst[1] = (char) (0x80 | ((codePoint >> 6) & 0x3f));
+    pDst[2] = (char) (0x80 | (codePoint & 0x3f));
+    return 3;
+  }
+  pDst[0] = (char) (0xf0 | (codePoint >> 18));
+  pDst[1] = (char) (0x80 | ((codePoint >> 12) & 0x3f));
+  pDst[2] = (char) (0x80 | ((codePoint >> 6) & 0x3f));
+  pDst[3] = (char) (0x80 | (codePoint & 0x3f));
+  return 4;
+}
+
+
 //
 //
 //
@@ -242,6 +287,11 @@ const T *char_type_string_find_end(const T *pBegin, const T *pEnd, T c) {
   return pEnd;
 }
 
+inline const char *char_type_string_find_end(const char *pBegin, const char *pEnd, char c) {
+  const char *pResult = string_rfind_char(pBegin, pEnd, c);
+  return (pResult != nullptr) ? pResult : pEnd;
+}
+
 template<typename T>
 const T *char_type_string_rsearch(const T *p1Begin, const T *p1End,
                                   const T *p2Begin, const T *p2End) {
@@ -307,6 +357,11 @@ inline const T *char_type_string_rfind(const T *pRBegin, const T *pREnd, const T
   return pREnd;
 }
 
+inline const char *char_type_string_rfind(const char *pRBegin, const char *pREnd, const char c) {
+  const char *pResult = string_rfind_char(pREnd, pRBegin, c);
+  return (pResult != nullptr) ? pResult + 1 : pREnd;
+}
+
 
 inline char *char_string_uninitialized_fill_n(char *pDestination, sizeT n, const char c) {
   if (n) {
@@ -406,6 +461,60 @@ int char_string_compare_i(const T *p1, const T *p2, sizeT n) {
   return false;
 }
 
+inline int char_string_compare(const char *p1, const char *p2, sizeT n) {
+  return string_compare(p1, p2, n);
+}
+
+inline int char_string_compare_i(const char *p1, const char *p2, sizeT n) {
+  return string_compare_i(p1, p2, n);
+}
+
+//
+// char_type_string_search
+//
+template<typename T>
+inline const T *char_type_string_search(const T *p1Begin, const T *p1End, const T *p2Begin, const T *p2End) {
+  const sizeT n = (sizeT) (p2End - p2Begin);
+  if (n == 0) {
+    return p1Begin;
+  }
+  for (const T *p = p1Begin; (sizeT) (p1End - p) >= n; ++p) {
+    if (*p == *p2Begin && char_string_compare(p + 1, p2Begin + 1, n - 1) == 0) {
+      return p;
+    }
+  }
+  return p1End;
+}
+
+inline const char *char_type_string_search(const char *p1Begin, const char *p1End, const char *p2Begin, const char *p2End) {
+  return string_search(p1Begin, p1End, p2Begin, p2End);
+}
+
+//
+// char_string_to_lower / char_string_to_upper
+//
+template<typename T>
+inline void char_string_to_lower(T *p, sizeT n) {
+  for (; n > 0; --n, ++p) {
+    *p = (T) char_to_lower(*p);
+  }
+}
+
+inline void char_string_to_lower(char *p, sizeT n) {
+  string_to_lower(p, n);
+}
+
+template<typename T>
+inline void char_string_to_upper(T *p, sizeT n) {
+  for (; n > 0; --n, ++p) {
+    *p = (T) char_to_upper(*p);
+  }
+}
+
+inline void char_string_to_upper(char *p, sizeT n) {
+  string_to_upper(p, n);
+}
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,391 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include "core/container/vector.h"
+#include "core/core/ptr.h"
+#include "core/string/string.h"
+#include "core/string/string_simd.h"
+#include "core/string/string_view.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Stream;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * ViewTokenizer
+ *
+ * @brief
+ * Tokenizer working in place on contiguous text.
+ *
+ * @remarks
+ * Splits the text like Tokenizer and understands the same settings, but the tokens are views
+ * into the text instead of strings built character by character. Runs of delimiters, quoted
+ * strings and comments are skipped with the block scans of string_simd.h, line breaks are
+ * counted on the way so every token knows its line and column for error messages.
+ *
+ * The text has to stay alive and unchanged as long as the tokens are used, a mapped stream
+ * stays mapped until stop() is called.
+ *
+ * @verbatim
+ *   ViewTokenizer tokenizer;
+ *   tokenizer.start("position = [1, 2, 3]");
+ *   StringView token = tokenizer.get_next_token(); // 'position'
+ *   token = tokenizer.get_next_token();            // '='
+ * @endverbatim
+ */
+class ViewTokenizer {
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+   * @brief
+   * Default constructor.
+   */
+  ViewTokenizer();
+
+  /**
+   * @brief
+   * Destructor, calls stop().
+   */
+  ~ViewTokenizer();
+
+  /**
+   * @brief
+   * Characters which separate tokens and are skipped, default " \t\r\n".
+   */
+  [[nodiscard]] inline const String& get_delimiters() const;
+
+  void set_delimiters(const String& delimiters);
+
+  /**
+   * @brief
+   * Characters which are tokens on their own, default "{}()[]<*>/=,;\"".
+   */
+  [[nodiscard]] inline const String& get_single_chars() const;
+
+  void set_single_chars(const String& singleChars);
+
+  /**
+   * @brief
+   * Characters which start and end a quoted string, default "\"'".
+   */
+  [[nodiscard]] inline const String& get_quotes() const;
+
+  void set_quotes(const String& quotes);
+
+  /**
+   * @brief
+   * Tag which starts a multi-line comment, default slash-star.
+   */
+  [[nodiscard]] inline const String& get_comment_start_tag() const;
+
+  void set_comment_start_tag(const String& commentStartTag);
+
+  /**
+   * @brief
+   * Tag which ends a multi-line comment, default star-slash.
+   */
+  [[nodiscard]] inline const String& get_comment_end_tag() const;
+
+  void set_comment_end_tag(const String& commentEndTag);
+
+  /**
+   * @brief
+   * Tag which starts a single-line comment, default "//".
+   */
+  [[nodiscard]] inline const String& get_single_line_comment() const;
+
+  void set_single_line_comment(const String& singleLineComment);
+
+  /**
+   * @brief
+   * Whether compare_token() and friends are case sensitive, default false.
+   */
+  [[nodiscard]] inline bool is_case_sensitive() const;
+
+  inline void set_case_sensitive(bool caseSensitive);
+
+  /**
+   * @brief
+   * Starts the tokenizer on a text, which is not copied.
+   */
+  void start(StringView text);
+
+  /**
+   * @brief
+   * Starts the tokenizer on the memory of a mapped stream.
+   *
+   * @param[in] stream
+   * Stream opened for reading, it is mapped until stop() is called
+   *
+   * @return
+   * 'false' if the stream can't be mapped
+   */
+  bool start_mapped(const Ptr<Stream>& stream);
+
+  /**
+   * @brief
+   * Stops the tokenizer and unmaps the stream.
+   */
+  void stop();
+
+  /**
+   * @brief
+   * Reads all tokens until the end of the text.
+   */
+  [[nodiscard]] Vector<StringView> get_tokens();
+
+  /**
+   * @brief
+   * Reads the next token.
+   *
+   * @return
+   * The token, empty at the end of the text
+   */
+  StringView get_next_token();
+
+  /**
+   * @brief
+   * Reads the next token if it equals the expected one.
+   *
+   * @return
+   * 'true' if the token was read, else the tokenizer stays where it is
+   */
+  bool expect_token(StringView expected);
+
+  /**
+   * @brief
+   * Reads tokens until the expected one is the next token.
+   *
+   * @return
+   * 'true' if found, the next get_next_token() returns it
+   */
+  bool find_token(StringView expected);
+
+  /**
+   * @brief
+   * Returns the current token.
+   */
+  [[nodiscard]] inline StringView get_token() const;
+
+  /**
+   * @brief
+   * Compares the current token with the given string, see set_case_sensitive().
+   */
+  [[nodiscard]] bool compare_token(StringView expected) const;
+
+  /**
+   * @brief
+   * Returns the text the tokenizer works on.
+   */
+  [[nodiscard]] inline StringView get_text() const;
+
+  /**
+   * @brief
+   * Returns the read position as offset into the text.
+   */
+  [[nodiscard]] inline sizeT get_position() const;
+
+  /**
+   * @brief
+   * Returns the line of the read position, starting at 1.
+   */
+  [[nodiscard]] inline uint32 get_line() const;
+
+  /**
+   * @brief
+   * Returns the column of the read position, starting at 1.
+   */
+  [[nodiscard]] inline uint32 get_column() const;
+
+  /**
+   * @brief
+   * Returns the line of the current token, starting at 1.
+   */
+  [[nodiscard]] inline uint32 get_token_line() const;
+
+  /**
+   * @brief
+   * Returns the column of the current token, starting at 1.
+   */
+  [[nodiscard]] inline uint32 get_token_column() const;
+
+  /**
+   * @brief
+   * Saves the current state on the state stack.
+   */
+  inline void push_state();
+
+  /**
+   * @brief
+   * Restores the last saved state.
+   */
+  inline void pop_state();
+
+  /**
+   * @brief
+   * Removes the last saved state without restoring it.
+   */
+  inline void drop_state();
+
+  /**
+   * @brief
+   * Reads the next token as number.
+   *
+   * @return
+   * 'true' if the whole token is a number, else the tokenizer stays where it is
+   */
+  bool parse_number(int32& number);
+
+  bool parse_number(float& number);
+
+  bool parse_number(double& number);
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  enum class EParseMode {
+    /** Skipping delimiters and comments up to the next token */
+    EatGarbage,
+    /** Behind an opening quote */
+    ReadQuoteInside,
+    /** In front of a closing quote */
+    ReadQuoteEnd
+  };
+
+  /**
+   * @brief
+   * Everything push_state() has to save.
+   */
+  struct State {
+    sizeT Position;
+    sizeT LineStart;
+    uint32 Line;
+    EParseMode Mode;
+    char Quote;
+    StringView Token;
+    uint32 TokenLine;
+    uint32 TokenColumn;
+  };
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  /**
+   * @brief
+   * Rebuilds the character sets after a setting changed.
+   */
+  void update_character_sets();
+
+  /**
+   * @brief
+   * Moves the read position forward, counting the line breaks passed.
+   */
+  void advance(sizeT position);
+
+  /**
+   * @brief
+   * Makes [position, position + size) the current token.
+   */
+  StringView set_token(sizeT position, sizeT size);
+
+  [[nodiscard]] inline bool is_tag_at(sizeT position, const String& tag) const;
+
+  /**
+   * @brief
+   * Returns whether the character at the given position ends a word.
+   */
+  [[nodiscard]] bool is_word_end(sizeT position) const;
+
+  /**
+   * @brief
+   * Skips the comment starting at the read position, if there is one.
+   */
+  bool skip_comment();
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  String mDelimiters;
+  String mSingleChars;
+  String mQuotes;
+  String mCommentStartTag;
+  String mCommentEndTag;
+  String mSingleLineComment;
+  bool mCaseSensitive;
+
+  CharacterSet mDelimiterSet;
+  /** Delimiters which neither start a quote nor a comment, skipped in one go */
+  CharacterSet mSkipSet;
+  /** Characters which end a word */
+  CharacterSet mWordEndSet;
+  CharacterSet mSingleCharSet;
+  CharacterSet mQuoteSet;
+
+  /** The text */
+  const char* mText;
+  sizeT mSize;
+  /** Mapped stream the text comes from, can be a null pointer */
+  Ptr<Stream> mStream;
+
+  State mState;
+  Vector<State> mStateStack;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/string/view_tokenizer.inl"
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+inline const String& ViewTokenizer::get_delimiters() const {
+  return mDelimiters;
+}
+
+inline const String& ViewTokenizer::get_single_chars() const {
+  return mSingleChars;
+}
+
+inline const String& ViewTokenizer::get_quotes() const {
+  return mQuotes;
+}
+
+inline const String& ViewTokenizer::get_comment_start_tag() const {
+  return mCommentStartTag;
+}
+
+inline const String& ViewTokenizer::get_comment_end_tag() const {
+  return mCommentEndTag;
+}
+
+inline const String& ViewTokenizer::get_single_line_comment() const {
+  return mSingleLineComment;
+}
+
+inline bool ViewTokenizer::is_case_sensitive() const {
+  return mCaseSensitive;
+}
+
+inline void ViewTokenizer::set_case_sensitive(bool caseSensitive) {
+  mCaseSensitive = caseSensitive;
+}
+
+inline StringView ViewTokenizer::get_token() const {
+  return mState.Token;
+}
+
+inline StringView ViewTokenizer::get_text() const {
+  return StringView(mText, mSize);
+}
+
+inline sizeT ViewTokenizer::get_position() const {
+  return mState.Position;
+}
+
+inline uint32 ViewTokenizer::get_line() const {
+  return mState.Line;
+}
+
+inline uint32 ViewTokenizer::get_column() const {
+  return static_cast<uint32>(mState.Position - mState.LineStart) + 1;
+}
+
+inline uint32 ViewTokenizer::get_token_line() const {
+  return mState.TokenLine;
+}
+
+inline uint32 ViewTokenizer::get_token_column() const {
+  return mState.TokenColumn;
+}
+
+inline void ViewTokenizer::push_state() {
+  mStateStack.push_back(mState);
+}
+
+inline void ViewTokenizer::pop_state() {
+  if (!mStateStack.empty()) {
+    mState = mStateStack.back();
+    mStateStack.pop_back();
+  }
+}
+
+inline void ViewTokenizer::drop_state() {
+  if (!mStateStack.empty()) {
+    mStateStack.pop_back();
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+inline bool ViewTokenizer::is_tag_at(sizeT position, const String& tag) const {
+  return !tag.empty() && tag.size() <= mSize - position && memcmp(mText + position, tag.data(), tag.size()) == 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+}
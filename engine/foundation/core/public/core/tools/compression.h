@@ -37,6 +37,19 @@
 namespace core {
 
 
+//[-------------------------------------------------------]
+//[ Enumerations                                          ]
+//[-------------------------------------------------------]
+enum class ECompressionCodec : uint8 {
+  /** LZ4, very fast to compress and to decompress, the level is the acceleration (1 and up) */
+  LZ4,
+  /** LZ4 high compression, slow to compress but as fast to decompress as LZ4, levels 3 to 12 */
+  LZ4HC,
+  /** zlib deflate, best ratio but slowest to decompress, levels 1 to 9 */
+  Zlib
+};
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -48,6 +61,22 @@ namespace core {
  * Abstract compression implementation.
  */
 class Compression {
+public:
+
+  /**
+   * @brief
+   * Creates the compression implementation of the given codec.
+   *
+   * @param[in] codec
+   * The codec
+   * @param[in] level
+   * Codec specific level, see ECompressionCodec, 0 for the default of the codec
+   *
+   * @return
+   * The new compression, destroyed by the caller
+   */
+  [[nodiscard]] static Compression* create(ECompressionCodec codec, int32 level = 0);
+
 public:
 
   /**
@@ -65,7 +94,7 @@ public:
 
   /**
    * @brief
-   * Compresses the input data using the LZ4 algorithm.
+   * Compresses the input data.
    *
    * Compresses the data in `src` and stores the compressed output in `dst`.
    *
@@ -74,13 +103,13 @@ public:
    * @param[in] srcSize Size of the input data in bytes.
    * @param[in] dstCapacity Size of the destination buffer in bytes.
    *
-   * @return The size of the compressed data written to `dst`.
+   * @return The size of the compressed data written to `dst`, 0 on failure.
    */
   virtual core::sizeT compress(core::uint8* dst, const core::uint8* src, core::sizeT srcSize, core::sizeT dstCapacity) const = 0;
 
   /**
    * @brief
-   * Decompresses the input data using the LZ4 algorithm.
+   * Decompresses the input data.
    *
    * Decompresses the data in `src` and stores the decompressed output in `dst`.
    *
@@ -89,7 +118,7 @@ public:
    * @param[in] srcSize Size of the compressed data in bytes.
    * @param[in] dstSize Expected size of the decompressed data in bytes.
    *
-   * @return The size of the decompressed data written to `dst`.
+   * @return The size of the decompressed data written to `dst`, 0 on failure.
    */
   virtual core::sizeT decompress(core::uint8* dst, const core::uint8* src, core::sizeT srcSize, core::sizeT dstSize) const = 0;
 
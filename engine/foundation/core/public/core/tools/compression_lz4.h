@@ -49,15 +49,30 @@ namespace core {
  * Provides an implementation of the LZ4 compression algorithm. This class
  * defines methods for compressing and decompressing data, along with a method
  * to calculate the maximum required buffer size for compression.
+ *
+ * Both modes produce the same format, high compression only spends more time
+ * on compressing, decompression is equally fast.
  */
 class CompressionLZ4 : public Compression {
+public:
+
+  /** Acceleration of the fast mode, higher is faster with a worse ratio */
+  static constexpr int32 DefaultAcceleration = 1;
+  /** Level of the high compression mode, same as LZ4HC_CLEVEL_MAX */
+  static constexpr int32 DefaultHighCompressionLevel = 12;
+
 public:
 
   /**
    * @brief
    * Constructor.
+   *
+   * @param[in] highCompression
+   * 'true' to use LZ4HC, 'false' for the fast LZ4 compressor
+   * @param[in] level
+   * LZ4HC level (3 to 12) or acceleration of the fast mode (1 and up)
    */
-  CompressionLZ4() = default;
+  explicit CompressionLZ4(bool highCompression = true, int32 level = DefaultHighCompressionLevel);
 
   /**
    * @brief
@@ -108,6 +123,11 @@ public:
    * @return The maximum size in bytes that the compressed data may occupy.
    */
   [[nodiscard]] core::sizeT compress_bound(core::uint32 srcSize) const override;
+
+private:
+
+  bool mHighCompression;
+  int32 mLevel;
 };
 
 
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "core/core.h"
+#include <type_traits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * ByteSwap
+ *
+ * @brief
+ * Reverses the byte order of single values and of whole arrays.
+ *
+ * The array versions work on 16 byte blocks with SSE2 or NEON where available, so converting
+ * large arrays between byte orders runs close to memory bandwidth.
+ */
+class ByteSwap {
+public:
+  /**
+   * @brief
+   * Returns whether values of the given type have a byte order, that's arithmetic and enumeration
+   * types of 2, 4 or 8 bytes.
+   */
+  template<typename T>
+  [[nodiscard]] static constexpr bool is_swappable();
+
+  /**
+   * @brief
+   * Reverses the byte order of a 16 bit value.
+   */
+  [[nodiscard]] static inline uint16 swap16(uint16 value);
+
+  /**
+   * @brief
+   * Reverses the byte order of a 32 bit value.
+   */
+  [[nodiscard]] static inline uint32 swap32(uint32 value);
+
+  /**
+   * @brief
+   * Reverses the byte order of a 64 bit value.
+   */
+  [[nodiscard]] static inline uint64 swap64(uint64 value);
+
+  /**
+   * @brief
+   * Reverses the byte order of every element of an array in place.
+   *
+   * @param[in, out] data
+   * Elements to swap, no alignment required
+   * @param[in] numberOfElements
+   * Number of elements
+   * @param[in] elementSize
+   * Size of one element in bytes, 2, 4 or 8; other sizes are left untouched
+   */
+  static void swap_array(void* data, uint64 numberOfElements, uint32 elementSize);
+
+  /**
+   * @brief
+   * Copies an array while reversing the byte order of every element.
+   *
+   * @param[out] destination
+   * Receives the swapped elements, may be identical to the source but must not partially overlap it
+   * @param[in] source
+   * Elements to swap
+   * @param[in] numberOfElements
+   * Number of elements
+   * @param[in] elementSize
+   * Size of one element in bytes, 2, 4 or 8; other sizes are copied unchanged
+   */
+  static void copy_swapped(void* destination, const void* source, uint64 numberOfElements, uint32 elementSize);
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "core/utility/byte_swap.inl"
@@ -53,6 +53,7 @@ void EngineCore::clear() {
   }
 
   mServersList.clear();
+  mServersMap.clear();
 }
 
 
@@ -69,17 +70,27 @@ const core::ServerImpl* EngineCore::get_server_by_index(core::uint32 index) cons
 }
 
 const core::ServerImpl* EngineCore::get_server_by_name(const core::String& name) const {
-  return mServersMap[name];
+  return get_server_by_name(core::Name::find(name));
+}
+
+const core::ServerImpl* EngineCore::get_server_by_name(core::Name name) const {
+  const auto server = mServersMap.find(name);
+  return (server != mServersMap.end()) ? server.value() : nullptr;
 }
 
 bool EngineCore::has_server_with_name(const core::String& name) const {
+  return has_server_with_name(core::Name::find(name));
+}
+
+bool EngineCore::has_server_with_name(core::Name name) const {
   return mServersMap.find(name) != mServersMap.end();
 }
 
 void EngineCore::register_server(core::ServerImpl* server, const core::String& name) {
-  if (mServersMap.find(name) != mServersMap.end()) {
+  const core::Name serverName(name);
+  if (mServersMap.find(serverName) == mServersMap.end()) {
     mServersList.push_back(server);
-    mServersMap[name] = server;
+    mServersMap[serverName] = server;
   }
 }
 
@@ -31,6 +31,7 @@
 #include "engine/engine.h"
 #include <core/container/map.h>
 #include <core/container/vector.h>
+#include <core/string/name.h>
 #include <core/string/string.h>
 
 
@@ -70,8 +71,32 @@ public:
 
   [[nodiscard]] const core::ServerImpl* get_server_by_name(const core::String& name) const;
 
+  /**
+   * @brief
+   * Returns the server registered under the given interned name.
+   *
+   * @param[in] name
+   * Name the server has been registered with
+   *
+   * @return
+   * The server, null pointer if there's none with this name
+   */
+  [[nodiscard]] const core::ServerImpl* get_server_by_name(core::Name name) const;
+
   [[nodiscard]] bool has_server_with_name(const core::String& name) const;
 
+  /**
+   * @brief
+   * Returns whether a server is registered under the given interned name.
+   *
+   * @param[in] name
+   * Name the server has been registered with
+   *
+   * @return
+   * 'true' if there's such a server, 'false' otherwise
+   */
+  [[nodiscard]] bool has_server_with_name(core::Name name) const;
+
 
   void register_server(core::ServerImpl* server, const core::String& name);
 
@@ -81,6 +106,32 @@ public:
   template<typename TServer>
   TServer* get_server(const core::String& name);
 
+  /**
+   * @brief
+   * Returns the server registered under the given interned name, cast to its type.
+   *
+   * @param[in] name
+   * Name the server has been registered with
+   *
+   * @return
+   * The server, null pointer if there's none with this name
+   */
+  template<typename TServer>
+  const TServer* get_server(core::Name name) const;
+
+  /**
+   * @brief
+   * Returns the server registered under the given interned name, cast to its type.
+   *
+   * @param[in] name
+   * Name the server has been registered with
+   *
+   * @return
+   * The server, null pointer if there's none with this name
+   */
+  template<typename TServer>
+  TServer* get_server(core::Name name);
+
 protected:
 
   void register_core_services();
@@ -88,7 +139,7 @@ protected:
 private:
 
   core::Vector<core::ServerImpl*> mServersList;
-  core::Map<core::String, core::ServerImpl*> mServersMap;
+  core::Map<core::Name, core::ServerImpl*> mServersMap;
 };
 
 
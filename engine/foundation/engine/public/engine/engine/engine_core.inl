@@ -35,19 +35,25 @@ namespace engine {
 //[-------------------------------------------------------]
 template<typename TServer>
 const TServer* EngineCore::get_server(const core::String& name) const {
-  if (has_server_with_name(name)) {
-    return static_cast<const TServer*>(get_server_by_name(name));
-  }
-  return nullptr;
+  return get_server<TServer>(core::Name::find(name));
 }
 
 
 template<typename TServer>
 TServer* EngineCore::get_server(const core::String& name) {
-  if (has_server_with_name(name)) {
-    return static_cast<TServer*>(get_server_by_name(name));
-  }
-  return nullptr;
+  return get_server<TServer>(core::Name::find(name));
+}
+
+
+template<typename TServer>
+const TServer* EngineCore::get_server(core::Name name) const {
+  return static_cast<const TServer*>(get_server_by_name(name));
+}
+
+
+template<typename TServer>
+TServer* EngineCore::get_server(core::Name name) {
+  return const_cast<TServer*>(static_cast<const TServer*>(get_server_by_name(name)));
 }
 
 
@@ -56,6 +56,7 @@ set(FILES
   private/widget/button/small_button.cpp
   private/widget/container/compound.cpp
   private/widget/container/null_widget.cpp
+  private/widget/debug/metrics_overlay.cpp
   private/widget/input/text_area_input.cpp
   private/widget/layout/box_layout.cpp
   private/widget/layout/horizontal_box_layout.cpp
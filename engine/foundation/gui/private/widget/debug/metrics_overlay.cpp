@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "gui/widget/debug/metrics_overlay.h"
+#include <core/profiling/metrics.h>
+#include <imgui.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace gui {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+MetricsOverlay::MetricsOverlay()
+: mIsOpen(true) {
+
+}
+
+MetricsOverlay::~MetricsOverlay() {
+
+}
+
+
+void MetricsOverlay::construct(ConstructionArguments args) {
+  mTitle = args.getTitle();
+}
+
+void MetricsOverlay::on_update(float deltaTime) {
+  // Nothing to do here
+}
+
+void MetricsOverlay::on_draw() {
+  if (!mIsOpen) {
+    return;
+  }
+
+  const core::Metrics& metrics = core::Metrics::instance();
+  const core::MetricsFrame* latestFrame = metrics.get_frame(0);
+  const core::uint32 numFrames = metrics.get_num_frames();
+  if (mPlotValues.size() < metrics.get_history_size()) {
+    mPlotValues.resize(metrics.get_history_size());
+  }
+
+  if (ImGui::Begin(mTitle.c_str(), &mIsOpen, ImGuiWindowFlags_AlwaysAutoResize)) {
+    if (latestFrame) {
+      for (core::uint32 id = 0; id < latestFrame->numMetrics; ++id) {
+        const core::EMetricType type = metrics.get_type(id);
+        const core::MetricSample& latest = latestFrame->samples[id];
+
+        // Gather the history, oldest frame first
+        core::uint32 numValues = 0;
+        for (core::uint32 age = numFrames; age > 0; --age) {
+          const core::MetricsFrame* frame = metrics.get_frame(age - 1);
+          if (id < frame->numMetrics) {
+            const core::MetricSample& sample = frame->samples[id];
+            mPlotValues[numValues++] = static_cast<float>((type == core::EMetricType::Counter) ? sample.delta : (type == core::EMetricType::Gauge) ? sample.value : sample.mean);
+          }
+        }
+
+        char overlay[64];
+        if (type == core::EMetricType::Histogram) {
+          snprintf(overlay, sizeof(overlay), "mean %.2f (%.0f samples)", latest.mean, latest.delta);
+        } else if (type == core::EMetricType::Counter) {
+          snprintf(overlay, sizeof(overlay), "%.0f/frame (total %.0f)", latest.delta, latest.value);
+        } else {
+          snprintf(overlay, sizeof(overlay), "%.3f", latest.value);
+        }
+        ImGui::PlotLines(metrics.get_name(id).c_str(), mPlotValues.data(), static_cast<int>(numValues), 0, overlay, FLT_MAX, FLT_MAX, ImVec2(240.0f, 40.0f));
+      }
+    } else {
+      ImGui::TextUnformatted("No metrics snapshot taken yet");
+    }
+  }
+  ImGui::End();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // gui
@@ -39,6 +39,7 @@
 #include "rhi/state/rhicompute_pipeline_state.h"
 #include "rhi/state/rhigraphics_pipeline_state.h"
 #include "rhi/query/rhiquery_pool.h"
+#include <core/memory/no_alloc_scope.h>
 
 
 //[-------------------------------------------------------]
@@ -308,6 +309,7 @@ public:
     if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes) {
       // Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
       const core::uint32 newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
+      BE_TRACK_NO_ALLOC(newCommandPacketBufferNumberOfBytes, "RHICommandBuffer")
       core::uint8 *newCommandPacketBuffer = new core::uint8[newCommandPacketBufferNumberOfBytes];
 
       // Copy over current command package buffer content and free it, if required
@@ -389,6 +391,7 @@ public:
     if (commandBuffer.mCommandPacketBufferNumberOfBytes < commandBuffer.mCurrentCommandPacketByteIndex + numberOfCommandBytes) {
       // Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
       const core::uint32 newCommandPacketBufferNumberOfBytes = commandBuffer.mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
+      BE_TRACK_NO_ALLOC(newCommandPacketBufferNumberOfBytes, "RHICommandBuffer")
       core::uint8 *newCommandPacketBuffer = new core::uint8[newCommandPacketBufferNumberOfBytes];
 
       // Copy over current command package buffer content and free it, if required
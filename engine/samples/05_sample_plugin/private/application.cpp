@@ -44,7 +44,11 @@ void Application::main() {
   printf("Hello Plugin :)\n");
 
   core::String pluginPath = core::Platform::instance().get_shared_library_prefix() + "sample_plugin." + core::Platform::instance().get_shared_library_extension();
-  mEnginePluginServer.load_plugin("sample_plugin", pluginPath);
+  // Registered plugins are only loaded when they are used for the first time
+  mEnginePluginServer.register_plugin("sample_plugin", pluginPath);
+  if (nullptr == mEnginePluginServer.get_plugin("sample_plugin")) {
+    printf("Failed to load '%s'\n", pluginPath.c_str());
+  }
 
 }
 
@@ -33,12 +33,25 @@ set(FILES
   private/core/ptr.cpp
   private/core/weak_ptr.cpp
 
+  private/io/async_file_io.cpp
   private/io/binaryreaderwriter.cpp
+  private/io/chained_memory_stream.cpp
+  private/io/chunked_compressed_stream.cpp
+  private/io/directory_scanner.cpp
+  private/io/file_stream.cpp
+  private/io/file_watch_service.cpp
+  private/io/json_stream.cpp
   #private/io/compressedreaderwriter.cpp
   private/io/mount_point_registry.cpp
+  private/io/pack_archive.cpp
   private/io/path.cpp
+  private/io/path_view.cpp
   private/io/textreaderwriter.cpp
 
+  private/json/json_binary.cpp
+  private/json/json_document.cpp
+  private/json/json_parser.cpp
+
   private/math/mat33.cpp
   private/math/mat44.cpp
   private/math/quaternion.cpp
@@ -47,12 +60,24 @@ set(FILES
   private/math/vec3.cpp
   private/math/vec4.cpp
 
+  private/memory/no_alloc_scope.cpp
+
+  private/profiling/metrics.cpp
+  private/profiling/startup_tracer.cpp
+  private/profiling/telemetry_server.cpp
+
   private/rtti/constructor.cpp
   private/rtti/destructor.cpp
   private/rtti/dynamic_object.cpp
   private/rtti/enum.cpp
   private/rtti/function_signature.cpp
 
+  private/string/format.cpp
+  private/string/name.cpp
+  private/string/number_conversion.cpp
+  private/string/regex.cpp
   private/string/string.cpp
+  private/string/string_simd.cpp
   private/string/string_view.cpp
+  private/string/view_tokenizer.cpp
 )
\ No newline at end of file
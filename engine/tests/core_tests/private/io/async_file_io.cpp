@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/async_file_io.h"
+#include <core/io/async_file_io.h>
+#include <core/io/file_stream.h>
+#include <core/string/format.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/** Number of files read in a batch */
+static constexpr core::uint32 NumFiles = 64;
+/** Size of each file in bytes */
+static constexpr core::uint32 FileSize = 3000;
+
+static core::String get_async_filename(core::uint32 index) {
+  return core::format("./sample_data/async_file_io_{}.bin", index);
+}
+
+static core::uint8 get_async_byte(core::uint32 fileIndex, core::uint32 offset) {
+  return static_cast<core::uint8>(fileIndex * 31 + offset * 7);
+}
+
+/**
+ * @brief
+ * Reads all files in one batch and checks the content.
+ */
+static bool read_batch() {
+  core::Vector<core::uint8> buffers;
+  buffers.resize(NumFiles * FileSize);
+
+  core::AsyncReadRequest requests[NumFiles];
+  for (core::uint32 i = 0; i < NumFiles; ++i) {
+    requests[i].filename = get_async_filename(i);
+    requests[i].buffer = buffers.data() + i * FileSize;
+    requests[i].numberOfBytes = FileSize;
+  }
+  core::Vector<core::Ptr<core::AsyncFileRead>> reads;
+  core::AsyncFileIo::instance().read(requests, NumFiles, reads);
+  core::AsyncFileIo::instance().wait_all();
+
+  if (reads.size() != NumFiles || core::AsyncFileIo::instance().get_num_outstanding() != 0) {
+    return false;
+  }
+  for (core::uint32 i = 0; i < NumFiles; ++i) {
+    if (reads[i]->get_status() != core::EAsyncIoStatus::Completed || reads[i]->get_number_of_read_bytes() != FileSize) {
+      return false;
+    }
+    for (core::uint32 offset = 0; offset < FileSize; ++offset) {
+      if (buffers[i * FileSize + offset] != get_async_byte(i, offset)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+AsyncFileIoTests::AsyncFileIoTests()
+: UnitTest("core::AsyncFileIoTests") {
+
+}
+
+AsyncFileIoTests::~AsyncFileIoTests() {
+
+}
+
+void AsyncFileIoTests::test() {
+  core::uint8 content[FileSize];
+  for (core::uint32 i = 0; i < NumFiles; ++i) {
+    for (core::uint32 offset = 0; offset < FileSize; ++offset) {
+      content[offset] = get_async_byte(i, offset);
+    }
+    core::FileStream file;
+    file.set_path(core::Path(get_async_filename(i)));
+    file.set_access_mode(core::EFileMode::Write);
+    be_expect_true(file.open())
+    file.write(content, FileSize);
+    file.close();
+  }
+
+  core::AsyncFileIo& asyncFileIo = core::AsyncFileIo::instance();
+
+  // Both backends, io_uring silently falls back to the thread pool where it's unavailable
+  {
+    be_expect_true(asyncFileIo.start(core::EAsyncIoBackend::ThreadPool, 3))
+    be_expect(asyncFileIo.get_backend() == core::EAsyncIoBackend::ThreadPool)
+    be_expect_false(asyncFileIo.start())
+    be_expect_true(read_batch())
+    asyncFileIo.stop();
+    be_expect(asyncFileIo.get_backend() == core::EAsyncIoBackend::None)
+
+    // io_uring is only used when asked for
+    be_expect_true(asyncFileIo.start())
+    be_expect(asyncFileIo.get_backend() == core::EAsyncIoBackend::ThreadPool)
+    asyncFileIo.stop();
+
+    be_expect_true(asyncFileIo.start(core::EAsyncIoBackend::IoUring))
+    be_expect(asyncFileIo.get_backend() != core::EAsyncIoBackend::None)
+    be_expect_true(read_batch())
+  }
+
+  // Offsets, end of file, empty reads and missing files
+  {
+    core::uint8 buffer[64];
+    core::AsyncReadRequest request;
+    request.filename = get_async_filename(5);
+    request.buffer = buffer;
+    request.offset = FileSize - 10;
+    request.numberOfBytes = sizeof(buffer);
+
+    core::uint32 numCallbacks = 0;
+    request.callback = [&numCallbacks](core::AsyncFileRead& read) {
+      ++numCallbacks;
+    };
+    core::Ptr<core::AsyncFileRead> read = asyncFileIo.read(request);
+    be_expect(read->wait() == core::EAsyncIoStatus::Completed)
+    be_expect(read->get_number_of_read_bytes() == 10)
+    be_expect(buffer[0] == get_async_byte(5, FileSize - 10))
+    be_expect(numCallbacks == 1)
+    be_expect_false(read->cancel())
+
+    request.numberOfBytes = 0;
+    request.callback = nullptr;
+    be_expect(asyncFileIo.read(request)->wait() == core::EAsyncIoStatus::Completed)
+
+    request.filename = "./sample_data/async_file_io_missing.bin";
+    request.numberOfBytes = sizeof(buffer);
+    read = asyncFileIo.read(request);
+    be_expect(read->wait() == core::EAsyncIoStatus::Failed)
+    be_expect(read->get_error() == ENOENT)
+  }
+  asyncFileIo.stop();
+
+  // Priorities and cancellation, a single worker is kept busy while the reads get queued
+  {
+    be_expect_true(asyncFileIo.start(core::EAsyncIoBackend::ThreadPool, 1))
+
+    core::atomic<bool> blocked(true);
+    core::uint8 buffer[4][16];
+    core::AsyncReadRequest request;
+    request.filename = get_async_filename(0);
+    request.numberOfBytes = 16;
+    request.buffer = buffer[0];
+    request.callback = [&blocked](core::AsyncFileRead& read) {
+      while (blocked.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    };
+    core::Ptr<core::AsyncFileRead> blocker = asyncFileIo.read(request);
+    while (blocker->get_status() == core::EAsyncIoStatus::Pending) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    core::String order;
+    const core::EAsyncIoPriority priorities[] = { core::EAsyncIoPriority::Low, core::EAsyncIoPriority::High, core::EAsyncIoPriority::Normal };
+    const char names[] = { 'l', 'h', 'n' };
+    core::Ptr<core::AsyncFileRead> reads[3];
+    for (core::uint32 i = 0; i < 3; ++i) {
+      request.buffer = buffer[i + 1];
+      request.priority = priorities[i];
+      const char name = names[i];
+      request.callback = [&order, name](core::AsyncFileRead& read) {
+        order += name;
+      };
+      reads[i] = asyncFileIo.read(request);
+    }
+    request.priority = core::EAsyncIoPriority::High;
+    request.callback = [&order](core::AsyncFileRead& read) {
+      order += 'c';
+    };
+    core::Ptr<core::AsyncFileRead> cancelled = asyncFileIo.read(request);
+    be_expect(asyncFileIo.get_num_outstanding() == 5)
+    be_expect_true(cancelled->cancel())
+    be_expect(cancelled->get_status() == core::EAsyncIoStatus::Cancelled)
+    be_expect(order == "c")
+
+    blocked.store(false);
+    asyncFileIo.wait_all();
+    be_expect(order == "chnl")
+    be_expect(reads[0]->get_status() == core::EAsyncIoStatus::Completed)
+
+    // Stopping cancels what hasn't been started
+    blocked.store(true);
+    request.callback = [&blocked](core::AsyncFileRead& read) {
+      while (blocked.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    };
+    blocker = asyncFileIo.read(request);
+    while (blocker->get_status() == core::EAsyncIoStatus::Pending) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    request.callback = nullptr;
+    core::Ptr<core::AsyncFileRead> queued = asyncFileIo.read(request);
+    blocked.store(false);
+    asyncFileIo.stop();
+    be_expect(blocker->get_status() == core::EAsyncIoStatus::Completed)
+    be_expect_true(queued->is_done())
+  }
+}
+
+be_unittest_autoregister(AsyncFileIoTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -25,6 +25,11 @@
 #include "io/binaryreaderwriter.h"
 #include <core/io/binary_reader.h>
 #include <core/io/binary_writer.h>
+#include <core/io/file_stream.h>
+#include <core/io/path.h>
+#include <core/utility/byte_swap.h>
+#include <cstdint>
+#include <cstring>
 
 
 //[-------------------------------------------------------]
@@ -33,6 +38,42 @@
 namespace core_tests {
 
 
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Creates a file stream for the given sample file.
+ */
+static core::Ptr<core::Stream> create_binary_stream(const char* filename) {
+  core::Ptr<core::Stream> stream(new core::FileStream());
+  stream->set_path(core::Path(filename));
+  return stream;
+}
+
+/**
+ * @brief
+ * Reads back the content written by the test through the given reader.
+ */
+static bool read_binary_content(core::BinaryReader& reader, const core::uint32* values, core::uint32 numberOfValues) {
+  bool isValid = (reader.read_char() == 'B') && (reader.read_short() == -2) && (reader.read_int() == 123456789);
+  isValid = isValid && (reader.read<double>() == 0.25) && (reader.read<core::uint64>() == 0x0102030405060708ull);
+
+  core::Vector<core::uint32> readValues;
+  readValues.resize(numberOfValues);
+  isValid = isValid && (reader.read_array(readValues.data(), numberOfValues) == numberOfValues);
+  isValid = isValid && (memcmp(readValues.data(), values, numberOfValues * sizeof(core::uint32)) == 0);
+
+  isValid = isValid && (reader.read_varuint() == 0) && (reader.read_varuint() == 127) && (reader.read_varuint() == 300);
+  isValid = isValid && (reader.read_varuint() == ~0ull) && (reader.read_varint() == -1) && (reader.read_varint() == -1000000);
+  isValid = isValid && (reader.read_varint() == INT64_MIN);
+
+  char text[4] = {};
+  isValid = isValid && (reader.read_bytes(text, 3) == 3) && (strcmp(text, "end") == 0);
+  return isValid && !reader.has_error();
+}
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -46,7 +87,130 @@ BinaryReaderWriterTests::~BinaryReaderWriterTests() {
 }
 
 void BinaryReaderWriterTests::test() {
-  
+  // Swapping, including the scalar tails behind the 16 byte blocks
+  {
+    be_expect(core::ByteSwap::swap16(0x0102) == 0x0201)
+    be_expect(core::ByteSwap::swap32(0x01020304u) == 0x04030201u)
+    be_expect(core::ByteSwap::swap64(0x0102030405060708ull) == 0x0807060504030201ull)
+
+    core::uint16 shorts[11];
+    core::uint32 ints[7];
+    core::uint64 longs[5];
+    core::uint64 swappedLongs[5];
+    for (core::uint32 i = 0; i < 11; ++i) {
+      shorts[i] = static_cast<core::uint16>(0x0102 * (i + 1));
+    }
+    for (core::uint32 i = 0; i < 7; ++i) {
+      ints[i] = 0x01020304u * (i + 1);
+    }
+    for (core::uint32 i = 0; i < 5; ++i) {
+      longs[i] = 0x0102030405060708ull * (i + 1);
+    }
+    core::ByteSwap::swap_array(shorts, 11, sizeof(core::uint16));
+    core::ByteSwap::swap_array(ints, 7, sizeof(core::uint32));
+    core::ByteSwap::copy_swapped(swappedLongs, longs, 5, sizeof(core::uint64));
+    bool isSwapped = true;
+    for (core::uint32 i = 0; i < 11; ++i) {
+      isSwapped = isSwapped && shorts[i] == core::ByteSwap::swap16(static_cast<core::uint16>(0x0102 * (i + 1)));
+    }
+    for (core::uint32 i = 0; i < 7; ++i) {
+      isSwapped = isSwapped && ints[i] == core::ByteSwap::swap32(0x01020304u * (i + 1));
+    }
+    for (core::uint32 i = 0; i < 5; ++i) {
+      isSwapped = isSwapped && swappedLongs[i] == core::ByteSwap::swap64(longs[i]);
+    }
+    be_expect_true(isSwapped)
+  }
+
+  core::Vector<core::uint32> values;
+  for (core::uint32 i = 0; i < 1000; ++i) {
+    values.push_back(i * 2654435761u);
+  }
+
+  // Native and big endian files with the same content
+  const char* filenames[] = { "./sample_data/binary_native.bin", "./sample_data/binary_big.bin" };
+  for (core::uint32 i = 0; i < 2; ++i) {
+    core::BinaryWriter writer;
+    writer.set_stream(create_binary_stream(filenames[i]));
+    writer.set_byte_order((0 == i) ? core::EByteOrder::Native : core::EByteOrder::Big);
+    be_expect_true(writer.open())
+    writer.write_char('B');
+    writer.write_short(-2);
+    writer.write_int(123456789);
+    writer.write(0.25);
+    writer.write<core::uint64>(0x0102030405060708ull);
+    writer.write_array(values.data(), values.size());
+    writer.write_varuint(0);
+    writer.write_varuint(127);
+    writer.write_varuint(300);
+    writer.write_varuint(~0ull);
+    writer.write_varint(-1);
+    writer.write_varint(-1000000);
+    writer.write_varint(INT64_MIN);
+    writer.write_bytes("end", 3);
+    writer.close();
+  }
+
+  // Read back through the stream and through the mapping
+  for (core::uint32 i = 0; i < 4; ++i) {
+    core::BinaryReader reader;
+    reader.set_stream(create_binary_stream(filenames[i / 2]));
+    reader.set_byte_order((i < 2) ? core::EByteOrder::Native : core::EByteOrder::Big);
+    reader.set_memory_mapping_enabled(1 == (i % 2));
+    be_expect_true(reader.open())
+    be_expect(reader.is_mapped() == (1 == (i % 2)))
+    be_expect_true(read_binary_content(reader, values.data(), values.size()))
+    reader.close();
+  }
+
+  // The big endian file really is big endian
+  {
+    core::BinaryReader reader;
+    reader.set_stream(create_binary_stream("./sample_data/binary_big.bin"));
+    reader.set_memory_mapping_enabled(true);
+    be_expect_true(reader.open())
+    be_expect(reader.read_char() == 'B')
+    const core::uint8* bytes = static_cast<const core::uint8*>(reader.map_bytes(2));
+    be_expect(bytes != nullptr && bytes[0] == 0xff && bytes[1] == 0xfe)
+    reader.close();
+  }
+
+  // Reading past the end is caught and leaves zeroed values
+  for (core::uint32 i = 0; i < 2; ++i) {
+    core::BinaryReader reader;
+    reader.set_stream(create_binary_stream("./sample_data/binary_native.bin"));
+    reader.set_memory_mapping_enabled(1 == i);
+    be_expect_true(reader.open())
+    be_expect_true(reader.skip(reader.get_stream()->get_size() - 6))
+    be_expect_false(reader.has_error())
+    core::uint32 tail[3] = { 1, 2, 3 };
+    be_expect(reader.read_array(tail, 3) == 1)
+    be_expect(tail[1] == 0 && tail[2] == 0)
+    be_expect_true(reader.has_error())
+    be_expect(reader.read_int() == 0)
+    be_expect(reader.read_varuint() == 0)
+    be_expect_false(reader.skip(1))
+    be_expect(reader.map_bytes(1) == nullptr)
+    reader.close();
+  }
+
+  // Overlong varints are refused
+  {
+    core::BinaryWriter writer;
+    writer.set_stream(create_binary_stream("./sample_data/binary_varint.bin"));
+    be_expect_true(writer.open())
+    const core::uint8 overlong[11] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+    writer.write_array(overlong, 11);
+    writer.close();
+
+    core::BinaryReader reader;
+    reader.set_stream(create_binary_stream("./sample_data/binary_varint.bin"));
+    reader.set_memory_mapping_enabled(true);
+    be_expect_true(reader.open())
+    be_expect(reader.read_varuint() == 0)
+    be_expect_true(reader.has_error())
+    reader.close();
+  }
 }
 
 be_unittest_autoregister(BinaryReaderWriterTests)
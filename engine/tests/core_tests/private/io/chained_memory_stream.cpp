@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/chained_memory_stream.h"
+#include <core/io/binary_reader.h>
+#include <core/io/binary_writer.h>
+#include <core/io/chained_memory_stream.h>
+#include <core/io/file.h>
+#include <core/io/file_stream.h>
+#include <core/io/path.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Returns the expected byte at the given position of the test content.
+ */
+static core::uint8 chained_content_byte(core::sizeT position) {
+  return static_cast<core::uint8>((position * 31) ^ (position >> 11));
+}
+
+/**
+ * @brief
+ * Returns whether the given bytes match the test content starting at the given position.
+ */
+static bool is_chained_content(const core::uint8* data, core::sizeT position, core::sizeT numberOfBytes) {
+  for (core::sizeT i = 0; i < numberOfBytes; ++i) {
+    if (data[i] != chained_content_byte(position + i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+ChainedMemoryStreamTests::ChainedMemoryStreamTests()
+: UnitTest("core::ChainedMemoryStreamTests") {
+
+}
+
+ChainedMemoryStreamTests::~ChainedMemoryStreamTests() {
+
+}
+
+void ChainedMemoryStreamTests::test() {
+  // Content spanning several segments, written in odd sized pieces
+  const core::sizeT size = core::ChainedMemoryStream::SegmentSize * 3 + 1234;
+  core::Vector<core::uint8> content;
+  content.resize(size);
+  for (core::sizeT i = 0; i < size; ++i) {
+    content[i] = chained_content_byte(i);
+  }
+
+  core::Ptr<core::ChainedMemoryStream> stream(new core::ChainedMemoryStream());
+  stream->set_access_mode(core::EFileMode::Write);
+  be_expect_true(stream->open())
+  for (core::sizeT position = 0; position < size; ) {
+    const core::sizeT numberOfBytes = (size - position < 7777) ? size - position : 7777;
+    stream->write(content.data() + position, numberOfBytes);
+    position += numberOfBytes;
+  }
+  be_expect(stream->get_size() == size)
+  be_expect(stream->get_num_segments() == 4)
+  core::sizeT lastSegmentSize = 0;
+  be_expect(stream->get_segment(3, lastSegmentSize) != nullptr)
+  be_expect(lastSegmentSize == 1234)
+
+  // Overwriting across a segment border keeps the size
+  const core::uint8 patch[4] = { 0xde, 0xad, 0xbe, 0xef };
+  stream->seek(core::ChainedMemoryStream::SegmentSize - 2, core::EFileSeek::Set);
+  stream->write(patch, sizeof(patch));
+  be_expect(stream->get_size() == size)
+  stream->seek(core::ChainedMemoryStream::SegmentSize - 2, core::EFileSeek::Set);
+  stream->write(content.data() + core::ChainedMemoryStream::SegmentSize - 2, sizeof(patch));
+  stream->close();
+
+  // Reading across segments, seeking and clamping
+  {
+    stream->set_access_mode(core::EFileMode::Read);
+    be_expect_true(stream->open())
+    core::Vector<core::uint8> readContent;
+    readContent.resize(size + 100);
+    be_expect(stream->read(readContent.data(), readContent.size()) == size)
+    be_expect(memcmp(readContent.data(), content.data(), size) == 0)
+    be_expect_true(stream->eof())
+
+    stream->seek(static_cast<core::sizeT>(-10), core::EFileSeek::End);
+    core::uint8 tail[10];
+    be_expect(stream->read(tail, sizeof(tail)) == 10)
+    be_expect_true(is_chained_content(tail, size - 10, 10))
+    stream->seek(size * 2, core::EFileSeek::Set);
+    be_expect(stream->get_position() == size)
+
+    // Flattened lazily and only while mapped
+    const core::uint8* data = static_cast<const core::uint8*>(stream->map());
+    be_expect(data != nullptr && memcmp(data, content.data(), size) == 0)
+    be_expect_true(stream->is_mapped())
+    stream->unmap();
+    be_expect(stream->get_content_as_string().length() == size)
+    stream->close();
+  }
+
+  // Appending and reading through the binary reader and writer
+  {
+    core::BinaryWriter writer;
+    stream->set_access_mode(core::EFileMode::Append);
+    be_expect_true(stream->open())
+    writer.set_stream(stream);
+    be_expect_true(writer.open())
+    writer.write<core::uint32>(0x12345678u);
+    writer.close();
+    stream->close();
+    be_expect(stream->get_size() == size + 4)
+
+    core::BinaryReader reader;
+    reader.set_stream(stream);
+    reader.set_memory_mapping_enabled(true);
+    be_expect_true(reader.open())
+    be_expect_true(reader.is_mapped())
+    be_expect_true(reader.skip(size))
+    be_expect(reader.read<core::uint32>() == 0x12345678u)
+    reader.close();
+  }
+
+  // Gather write into a file
+  {
+    core::Ptr<core::Stream> fileStream(new core::FileStream());
+    fileStream->set_path(core::Path("./sample_data/chained_memory_stream.bin"));
+    fileStream->set_access_mode(core::EFileMode::Write);
+    be_expect_true(fileStream->open())
+    fileStream->write("head", 4);
+    stream->write_to(*fileStream);
+    fileStream->close();
+
+    core::File file;
+    be_expect_true(file.open("./sample_data/chained_memory_stream.bin", core::EFileMode::Read))
+    be_expect(file.get_number_of_bytes() == size + 8)
+    core::Vector<core::uint8> fileContent;
+    fileContent.resize(size + 8);
+    be_expect(file.read(fileContent.data(), size + 8) == size + 8)
+    file.close();
+    be_expect(memcmp(fileContent.data(), "head", 4) == 0)
+    be_expect(memcmp(fileContent.data() + 4, content.data(), size) == 0)
+  }
+
+  // Small and empty streams
+  {
+    stream->clear();
+    be_expect(stream->get_size() == 0)
+    be_expect(stream->get_num_segments() == 0)
+    stream->set_access_mode(core::EFileMode::Write);
+    be_expect_true(stream->open())
+    be_expect(stream->map() == nullptr)
+    stream->unmap();
+    stream->write("abc", 3);
+    be_expect(memcmp(stream->map(), "abc", 3) == 0)
+    stream->unmap();
+    stream->close();
+  }
+}
+
+be_unittest_autoregister(ChainedMemoryStreamTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
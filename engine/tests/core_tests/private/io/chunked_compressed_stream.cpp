@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/chunked_compressed_stream.h"
+#include <core/io/chunked_compressed_stream.h>
+#include <core/io/file.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes the content in uneven pieces into a chunked compressed file.
+ */
+static bool write_chunked_file(const char* filename, const core::uint8* data, core::sizeT numberOfBytes, core::ECompressionCodec codec, core::uint32 numberOfThreads) {
+  core::ChunkedCompressedStream stream;
+  stream.set_path(core::Path(filename));
+  stream.set_access_mode(core::EFileMode::Write);
+  stream.set_codec(codec);
+  stream.set_block_size(64 * 1024);
+  stream.set_number_of_threads(numberOfThreads);
+  if (!stream.open()) {
+    return false;
+  }
+  core::sizeT offset = 0;
+  core::sizeT pieceSize = 1000;
+  while (offset < numberOfBytes) {
+    const core::sizeT numberOfPieceBytes = (numberOfBytes - offset < pieceSize) ? numberOfBytes - offset : pieceSize;
+    stream.write(data + offset, numberOfPieceBytes);
+    offset += numberOfPieceBytes;
+    pieceSize = pieceSize * 3 + 7;
+  }
+  stream.close();
+  return !stream.has_write_failed();
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+ChunkedCompressedStreamTests::ChunkedCompressedStreamTests()
+: UnitTest("core::ChunkedCompressedStreamTests") {
+
+}
+
+ChunkedCompressedStreamTests::~ChunkedCompressedStreamTests() {
+
+}
+
+void ChunkedCompressedStreamTests::test() {
+  // Compressible text followed by noise which has to be stored as is, the last block is partial
+  const core::sizeT numberOfBytes = 5 * 64 * 1024 + 123;
+  core::uint8* content = new core::uint8[numberOfBytes];
+  const char* sentence = "The quick brown fox jumps over the lazy dog. ";
+  const core::sizeT sentenceLength = strlen(sentence);
+  core::uint32 state = 0x12345678u;
+  for (core::sizeT i = 0; i < numberOfBytes; ++i) {
+    if (i < 3 * 64 * 1024) {
+      content[i] = static_cast<core::uint8>(sentence[i % sentenceLength]);
+    } else {
+      state = state * 1664525u + 1013904223u;
+      content[i] = static_cast<core::uint8>(state >> 24);
+    }
+  }
+  core::uint8* buffer = new core::uint8[numberOfBytes];
+
+  const core::ECompressionCodec codecs[] = { core::ECompressionCodec::LZ4, core::ECompressionCodec::LZ4HC, core::ECompressionCodec::Zlib };
+  for (core::ECompressionCodec codec : codecs) {
+    be_expect_true(write_chunked_file("./sample_data/chunked_compressed.bin", content, numberOfBytes, codec, 3))
+
+    // The compressible part shrinks, the noise doesn't grow
+    {
+      core::File file;
+      be_expect_true(file.open("./sample_data/chunked_compressed.bin", core::EFileMode::Read))
+      be_expect(file.get_number_of_bytes() < numberOfBytes)
+      file.close();
+    }
+
+    core::ChunkedCompressedStream stream;
+    stream.set_path(core::Path("./sample_data/chunked_compressed.bin"));
+    stream.set_access_mode(core::EFileMode::Read);
+    stream.set_number_of_threads(3);
+    be_expect_true(stream.open())
+    be_expect_true(stream.can_seek())
+    be_expect(stream.get_codec() == codec)
+    be_expect(stream.get_size() == numberOfBytes)
+    be_expect(stream.get_number_of_blocks() == 6)
+
+    // Everything at once, decompressed in parallel
+    memset(buffer, 0, numberOfBytes);
+    be_expect(stream.read(buffer, numberOfBytes + 100) == numberOfBytes)
+    be_expect(memcmp(buffer, content, numberOfBytes) == 0)
+    be_expect_true(stream.eof())
+    be_expect(stream.read(buffer, 10) == 0)
+
+    // Random access, crossing block borders and ending in the partial last block
+    const core::sizeT offsets[] = { 65530, 7, 3 * 64 * 1024 - 1, 128 * 1024, numberOfBytes - 50, 200000 };
+    for (core::sizeT offset : offsets) {
+      stream.seek(offset, core::EFileSeek::Set);
+      be_expect(stream.get_position() == offset)
+      const core::sizeT expected = (numberOfBytes - offset < 300) ? numberOfBytes - offset : 300;
+      be_expect(stream.read(buffer, 300) == expected)
+      be_expect(memcmp(buffer, content + offset, expected) == 0)
+    }
+
+    // Block aligned read of whole blocks followed by part of the next one
+    stream.seek(64 * 1024, core::EFileSeek::Set);
+    be_expect(stream.read(buffer, 2 * 64 * 1024 + 10) == 2 * 64 * 1024 + 10)
+    be_expect(memcmp(buffer, content + 64 * 1024, 2 * 64 * 1024 + 10) == 0)
+
+    stream.seek(static_cast<core::sizeT>(-10), core::EFileSeek::End);
+    be_expect(stream.get_content_as_string() == core::String(reinterpret_cast<const char*>(content + numberOfBytes - 10), 10))
+    stream.close();
+  }
+
+  // Single threaded writing and reading of an empty file
+  {
+    be_expect_true(write_chunked_file("./sample_data/chunked_compressed_empty.bin", content, 0, core::ECompressionCodec::LZ4, 1))
+    core::ChunkedCompressedStream stream;
+    stream.set_path(core::Path("./sample_data/chunked_compressed_empty.bin"));
+    stream.set_access_mode(core::EFileMode::Read);
+    be_expect_true(stream.open())
+    be_expect(stream.get_size() == 0)
+    be_expect(stream.read(buffer, 10) == 0)
+    be_expect_true(stream.eof())
+    stream.close();
+  }
+
+  // Anything else is rejected
+  {
+    core::File file;
+    be_expect_true(file.open("./sample_data/chunked_compressed_invalid.bin", core::EFileMode::Write))
+    file.write(content, 4096);
+    file.close();
+
+    core::ChunkedCompressedStream stream;
+    stream.set_path(core::Path("./sample_data/chunked_compressed_invalid.bin"));
+    stream.set_access_mode(core::EFileMode::Read);
+    be_expect_false(stream.open())
+    be_expect_false(stream.is_open())
+  }
+
+  delete[] buffer;
+  delete[] content;
+}
+
+be_unittest_autoregister(ChunkedCompressedStreamTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
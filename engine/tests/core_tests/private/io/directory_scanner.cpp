@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/directory_scanner.h"
+#include <core/io/directory_scanner.h>
+#include <core/io/file.h>
+#include <core/io/filesystem.h>
+#include <core/platform/platform.h>
+#include <cstdio>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes or appends the given text to a native file.
+ */
+static bool write_scanned_file(const char* filename, const char* text, core::EFileMode fileMode = core::EFileMode::Write) {
+  core::File file;
+  if (!file.open(filename, fileMode)) {
+    return false;
+  }
+  file.write(text, strlen(text));
+  file.close();
+  return true;
+}
+
+/**
+ * @brief
+ * Returns whether the view holds the given text.
+ */
+static bool is_scanned_text(const core::StringView& view, const char* text) {
+  return view.size() == strlen(text) && 0 == memcmp(view.data(), text, view.size());
+}
+
+/**
+ * @brief
+ * Returns the index of the entry with the given path, core::DirectoryScanResult::InvalidIndex if there is none.
+ */
+static core::uint32 find_scanned_entry(const core::DirectoryScanResult& result, const char* path) {
+  for (core::uint32 i = 0; i < result.get_num_entries(); ++i) {
+    if (is_scanned_text(result.get_path(i), path)) {
+      return i;
+    }
+  }
+  return core::DirectoryScanResult::InvalidIndex;
+}
+
+/**
+ * @brief
+ * Returns whether the parents and children of all entries refer to each other.
+ */
+static bool is_linked(const core::DirectoryScanResult& result) {
+  for (core::uint32 i = 1; i < result.get_num_entries(); ++i) {
+    const core::DirectoryEntry& parent = result.get_entry(result.get_entry(i).parent);
+    if (i < parent.firstChild || i >= parent.firstChild + parent.numberOfChildren) {
+      return false;
+    }
+  }
+  return core::DirectoryScanResult::InvalidIndex == result.get_entry(0).parent;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+DirectoryScannerTests::DirectoryScannerTests()
+: UnitTest("core::DirectoryScannerTests") {
+
+}
+
+DirectoryScannerTests::~DirectoryScannerTests() {
+
+}
+
+void DirectoryScannerTests::test() {
+  core::Filesystem filesystem;
+  std::remove("./sample_data/scan_root/sub/new.txt");
+  filesystem.create_directory("./sample_data/scan_root");
+  filesystem.create_directory("./sample_data/scan_root/sub");
+  filesystem.create_directory("./sample_data/scan_root/sub/deep");
+  filesystem.create_directory("./sample_data/scan_root/empty");
+  be_expect_true(write_scanned_file("./sample_data/scan_root/a.txt", "alpha"))
+  be_expect_true(write_scanned_file("./sample_data/scan_root/.hidden", "h"))
+  be_expect_true(write_scanned_file("./sample_data/scan_root/sub/b.txt", "bravo!"))
+  be_expect_true(write_scanned_file("./sample_data/scan_root/sub/deep/c.txt", "c"))
+
+  core::DirectoryScanner scanner;
+  scanner.set_number_of_threads(3);
+  scanner.set_read_metadata(true);
+  scanner.set_timestamp_granularity(50);
+
+  // Whole tree, from several threads, once the directory timestamps can be trusted by later scans
+  core::Platform::instance().sleep(100);
+  core::DirectoryScanResult result;
+  be_expect_false(scanner.scan("./sample_data/scan_root/missing", result))
+  be_expect_true(scanner.scan("./sample_data/scan_root/", result))
+  be_expect(result.get_num_entries() == 8)
+  be_expect(scanner.get_num_read_directories() == 4)
+  be_expect(result.get_num_changed() == 8)
+  be_expect_true(is_linked(result))
+  be_expect_true(is_scanned_text(result.get_path(0), "./sample_data/scan_root"))
+  be_expect_true(is_scanned_text(result.get_name(0), "scan_root"))
+  const core::uint32 bIndex = find_scanned_entry(result, "./sample_data/scan_root/sub/b.txt");
+  be_expect(bIndex != core::DirectoryScanResult::InvalidIndex)
+  be_expect_true(is_scanned_text(result.get_name(bIndex), "b.txt"))
+  be_expect(result.get_entry(bIndex).type == core::EDirectoryEntryType::File)
+  be_expect(result.get_entry(bIndex).size == 6)
+  be_expect(result.get_entry(bIndex).modificationTime > 0)
+  const core::uint32 subIndex = find_scanned_entry(result, "./sample_data/scan_root/sub");
+  be_expect(result.get_entry(subIndex).type == core::EDirectoryEntryType::Directory)
+  be_expect(result.get_entry(subIndex).numberOfChildren == 2)
+  be_expect(result.get_entry(bIndex).parent == subIndex)
+  be_expect(result.get_entry(find_scanned_entry(result, "./sample_data/scan_root/empty")).numberOfChildren == 0)
+
+  scanner.set_skip_hidden(true);
+  core::DirectoryScanResult visibleResult;
+  be_expect_true(scanner.scan("./sample_data/scan_root", visibleResult))
+  be_expect(visibleResult.get_num_entries() == 7)
+  be_expect(find_scanned_entry(visibleResult, "./sample_data/scan_root/.hidden") == core::DirectoryScanResult::InvalidIndex)
+  scanner.set_skip_hidden(false);
+
+  // Persisted cache
+  be_expect_true(result.save("./sample_data/scan_root.cache"))
+  core::DirectoryScanResult cache;
+  be_expect_true(cache.load("./sample_data/scan_root.cache"))
+  be_expect(cache.get_num_entries() == result.get_num_entries())
+  be_expect(cache.get_scan_time() == result.get_scan_time())
+  be_expect_true(is_linked(cache))
+  be_expect_true(is_scanned_text(cache.get_name(0), "scan_root"))
+  const core::uint32 cachedIndex = find_scanned_entry(cache, "./sample_data/scan_root/sub/deep/c.txt");
+  be_expect(cachedIndex != core::DirectoryScanResult::InvalidIndex)
+  be_expect(cache.get_entry(cachedIndex).size == 1)
+  be_expect_false(cache.load("./sample_data/scan_root/a.txt"))
+  be_expect(cache.get_num_entries() == 0)
+
+  // Corrupt caches, an entry count the file can't hold and an unnamed root
+  {
+    core::File file;
+    be_expect_true(file.open("./sample_data/scan_root.cache", core::EFileMode::Read))
+    core::Vector<core::uint8> data;
+    data.resize(static_cast<core::uint32>(file.get_number_of_bytes()));
+    be_expect(file.read(data.data(), data.size()) == data.size())
+    file.close();
+
+    const core::uint32 numberOfEntries = 0x7fffffff;
+    memcpy(data.data() + 8, &numberOfEntries, sizeof(numberOfEntries));
+    be_expect_true(file.open("./sample_data/scan_root_corrupt.cache", core::EFileMode::Write))
+    file.write(data.data(), data.size());
+    file.close();
+    be_expect_false(cache.load("./sample_data/scan_root_corrupt.cache"))
+
+    const core::uint32 validNumberOfEntries = result.get_num_entries();
+    const core::uint32 nameLength = 0;
+    memcpy(data.data() + 8, &validNumberOfEntries, sizeof(validNumberOfEntries));
+    memcpy(data.data() + 24 + 4, &nameLength, sizeof(nameLength));
+    be_expect_true(file.open("./sample_data/scan_root_corrupt.cache", core::EFileMode::Write))
+    file.write(data.data(), data.size());
+    file.close();
+    be_expect_false(cache.load("./sample_data/scan_root_corrupt.cache"))
+    be_expect(cache.get_num_entries() == 0)
+    std::remove("./sample_data/scan_root_corrupt.cache");
+  }
+  be_expect_true(cache.load("./sample_data/scan_root.cache"))
+
+  // Nothing changed, no directory is read again
+  core::DirectoryScanResult rescanResult;
+  be_expect_true(scanner.scan("./sample_data/scan_root", rescanResult, &cache))
+  be_expect(rescanResult.get_num_entries() == 8)
+  be_expect(scanner.get_num_read_directories() == 0)
+  be_expect(scanner.get_num_reused_directories() == 4)
+  be_expect(rescanResult.get_num_changed() == 0)
+  be_expect_true(is_linked(rescanResult))
+
+  // Only the changed directory is read again, changed files are flagged
+  be_expect_true(write_scanned_file("./sample_data/scan_root/sub/b.txt", " more", core::EFileMode::Append))
+  be_expect_true(write_scanned_file("./sample_data/scan_root/sub/new.txt", "new"))
+  core::DirectoryScanResult changedResult;
+  be_expect_true(scanner.scan("./sample_data/scan_root", changedResult, &rescanResult))
+  be_expect(changedResult.get_num_entries() == 9)
+  be_expect(scanner.get_num_read_directories() == 1)
+  be_expect(scanner.get_num_reused_directories() == 3)
+  be_expect(changedResult.get_num_changed() == 3)
+  be_expect((changedResult.get_entry(find_scanned_entry(changedResult, "./sample_data/scan_root/sub/b.txt")).flags & core::DirectoryEntry::Changed) != 0)
+  be_expect((changedResult.get_entry(find_scanned_entry(changedResult, "./sample_data/scan_root/sub/new.txt")).flags & core::DirectoryEntry::Changed) != 0)
+  be_expect((changedResult.get_entry(find_scanned_entry(changedResult, "./sample_data/scan_root/a.txt")).flags & core::DirectoryEntry::Changed) == 0)
+
+  // Previous results of other directories are ignored
+  core::DirectoryScanResult subResult;
+  be_expect_true(scanner.scan("./sample_data/scan_root/sub", subResult, &cache))
+  be_expect(scanner.get_num_reused_directories() == 0)
+  be_expect(subResult.get_num_entries() == 5)
+  std::remove("./sample_data/scan_root/sub/new.txt");
+}
+
+be_unittest_autoregister(DirectoryScannerTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
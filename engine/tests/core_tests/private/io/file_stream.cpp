@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/file_stream.h"
+#include <core/io/binary_reader.h>
+#include <core/io/file.h>
+#include <core/io/file_stream.h>
+#include <core/io/json_reader.h>
+#include <cstring>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes the given bytes into a new file.
+ */
+static bool write_file(const char* filename, const void* data, core::sizeT numberOfBytes) {
+  core::FileStream file;
+  file.set_path(core::Path(filename));
+  file.set_access_mode(core::EFileMode::Write);
+  if (!file.open()) {
+    return false;
+  }
+  file.write(data, numberOfBytes);
+  file.close();
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+FileStreamTests::FileStreamTests()
+: UnitTest("core::FileStreamTests") {
+
+}
+
+FileStreamTests::~FileStreamTests() {
+
+}
+
+void FileStreamTests::test() {
+  core::int32 values[1024];
+  for (core::int32 i = 0; i < 1024; ++i) {
+    values[i] = i * 7 - 300;
+  }
+  be_expect_true(write_file("./sample_data/file_stream.bin", values, sizeof(values)))
+
+  // Plain reads and seeking
+  {
+    core::FileStream file;
+    file.set_path(core::Path("./sample_data/file_stream.bin"));
+    file.set_access_mode(core::EFileMode::Read);
+    be_expect_true(file.open())
+    be_expect(file.get_size() == sizeof(values))
+
+    core::int32 value = 0;
+    be_expect(file.read(&value, sizeof(value)) == sizeof(value))
+    be_expect(value == values[0])
+    file.seek(8, core::EFileSeek::Current);
+    be_expect(file.read(&value, sizeof(value)) == sizeof(value))
+    be_expect(value == values[3])
+    file.seek(static_cast<core::sizeT>(-4), core::EFileSeek::End);
+    be_expect(file.read(&value, sizeof(value)) == sizeof(value))
+    be_expect(value == values[1023])
+
+    // Short reads report the number of bytes actually read
+    file.seek(sizeof(values) - 2, core::EFileSeek::Set);
+    be_expect(file.read(&value, sizeof(value)) == 2)
+    file.close();
+  }
+
+  // Positional reads from several threads sharing a single handle
+  {
+    core::File file;
+    be_expect_true(file.open("./sample_data/file_stream.bin", core::EFileMode::Read))
+
+    bool matches[4] = { false, false, false, false };
+    std::thread workers[4];
+    for (core::uint32 t = 0; t < 4; ++t) {
+      workers[t] = std::thread([&file, &values, &matches, t]() {
+        core::int32 chunk[256];
+        bool match = true;
+        for (core::uint32 pass = 0; pass < 64; ++pass) {
+          const core::uint32 first = ((t + pass) % 4) * 256;
+          match = match && file.read_at(first * sizeof(core::int32), chunk, sizeof(chunk)) == sizeof(chunk);
+          match = match && memcmp(chunk, values + first, sizeof(chunk)) == 0;
+        }
+        matches[t] = match;
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    be_expect_true(matches[0] && matches[1] && matches[2] && matches[3])
+
+    // The shared cursor isn't touched, reads past the end are short
+    be_expect(file.tell() == 0)
+    core::int32 value = 0;
+    be_expect(file.read_at(sizeof(values) - 2, &value, sizeof(value)) == 2)
+    be_expect(file.read_at(sizeof(values), &value, sizeof(value)) == 0)
+    be_expect(file.read(&value, sizeof(value)) == sizeof(value))
+    be_expect(value == values[0])
+    file.close();
+    be_expect(file.read_at(0, &value, sizeof(value)) == 0)
+  }
+
+  // Positional writes of disjoint ranges, filled back to front
+  {
+    core::File file;
+    be_expect_true(file.open("./sample_data/file_stream_at.bin", core::EFileMode::Write))
+    for (core::int32 i = 3; i >= 0; --i) {
+      be_expect(file.write_at(i * 256 * sizeof(core::int32), values + i * 256, 256 * sizeof(core::int32)) == 256 * sizeof(core::int32))
+    }
+    be_expect(file.get_number_of_bytes() == sizeof(values))
+    file.close();
+
+    core::int32 readValues[1024];
+    be_expect_true(file.open("./sample_data/file_stream_at.bin", core::EFileMode::Read))
+    be_expect(file.read(readValues, sizeof(readValues)) == sizeof(readValues))
+    be_expect(memcmp(readValues, values, sizeof(values)) == 0)
+    file.close();
+  }
+
+  // Positional writes between buffered ones
+  {
+    core::File file;
+    be_expect_true(file.open("./sample_data/file_stream_mixed.bin", core::EFileMode::Write))
+    be_expect(file.write("AAAAAAAAAAAAAAAA", 16) == 16)
+    be_expect(file.write_at(4, "BBBB", 4) == 4)
+    be_expect(file.write("CC", 2) == 2)
+    file.close();
+
+    char content[19] = {};
+    be_expect_true(file.open("./sample_data/file_stream_mixed.bin", core::EFileMode::Read))
+    be_expect(file.read(content, 18) == 18)
+    be_expect(strcmp(content, "AAAABBBBAAAAAAAACC") == 0)
+    file.close();
+  }
+
+  // Memory mapped
+  {
+    core::FileStream file;
+    file.set_path(core::Path("./sample_data/file_stream.bin"));
+    file.set_access_mode(core::EFileMode::Read);
+    file.set_access_pattern(core::EAccessPattern::WillNeed);
+    be_expect_true(file.open())
+
+    const void* data = file.memory_map();
+    be_expect(data != nullptr)
+    be_expect_true(file.is_mapped())
+    be_expect(memcmp(data, values, sizeof(values)) == 0)
+    be_expect(file.get_content_as_string().size() == sizeof(values))
+    file.memory_unmap();
+    be_expect_false(file.is_mapped())
+
+    // Closing releases a mapping which is still alive
+    be_expect(file.map() != nullptr)
+    file.close();
+    be_expect_false(file.is_mapped())
+  }
+
+  // Files opened for writing and empty files can't be mapped
+  {
+    core::FileStream file;
+    file.set_path(core::Path("./sample_data/file_stream_empty.bin"));
+    file.set_access_mode(core::EFileMode::Write);
+    be_expect_true(file.open())
+    be_expect(file.memory_map() == nullptr)
+    be_expect_false(file.is_mapped())
+    file.close();
+
+    file.set_access_mode(core::EFileMode::Read);
+    be_expect_true(file.open())
+    be_expect(file.memory_map() == nullptr)
+    file.close();
+  }
+
+  // Binary reader serving reads from the mapping
+  {
+    core::Ptr<core::Stream> stream(new core::FileStream());
+    stream->set_path(core::Path("./sample_data/file_stream.bin"));
+    stream->set_access_mode(core::EFileMode::Read);
+
+    core::BinaryReader reader;
+    reader.set_memory_mapping_enabled(true);
+    reader.set_stream(stream);
+    be_expect_true(reader.open())
+    be_expect_true(reader.is_mapped())
+    be_expect(reader.read_int() == values[0])
+    be_expect(reader.read_int() == values[1])
+    be_expect(reader.read_short() == static_cast<short>(values[2] & 0xffff))
+    reader.close();
+    be_expect_false(stream->is_mapped())
+
+    reader.set_memory_mapping_enabled(false);
+    be_expect_true(reader.open())
+    be_expect_false(reader.is_mapped())
+    be_expect(reader.read_int() == values[0])
+    reader.close();
+  }
+
+  // Json reader parsing straight from the mapping
+  {
+    const char* text = "{\"name\": \"bitray\", \"list\": [1, 2, 3]}";
+    be_expect_true(write_file("./sample_data/file_stream.json", text, strlen(text)))
+
+    core::Ptr<core::Stream> stream(new core::FileStream());
+    stream->set_path(core::Path("./sample_data/file_stream.json"));
+    stream->set_access_mode(core::EFileMode::Read);
+
+    core::JsonReader reader;
+    reader.set_stream(stream);
+    be_expect_true(reader.open())
+    const core::JsonValue value = reader.read();
+    be_expect(value["name"].to_string() == "bitray")
+    be_expect(value["list"](2).to_integer() == 3)
+    be_expect_false(stream->is_mapped())
+    reader.close();
+  }
+}
+
+be_unittest_autoregister(FileStreamTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
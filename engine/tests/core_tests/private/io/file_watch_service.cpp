@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/file_watch_service.h"
+#include <core/io/file.h>
+#include <core/io/file_watch_service.h>
+#include <core/io/filesystem.h>
+#include <core/platform/platform.h>
+#include <core/threading/lock_guard.h>
+#include <cstdio>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Appends the given text to a native file.
+ */
+static bool append_watched_file(const char* filename, const char* text) {
+  core::File file;
+  if (!file.open(filename, core::EFileMode::Append)) {
+    return false;
+  }
+  file.write(text, strlen(text));
+  file.close();
+  return true;
+}
+
+/**
+ * @brief
+ * Returns the flags reported for the path, 0 if it's not part of the changes.
+ */
+static core::uint32 find_change_flags(const core::Vector<core::FileChange>& changes, const char* path) {
+  for (const core::FileChange& change : changes) {
+    if (change.path == path) {
+      return change.flags;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief
+ * Waits until the number of received batches differs from the given one, gives up after two seconds.
+ */
+static bool wait_for_batch(core::Mutex& mutex, const core::uint32& numberOfBatches, core::uint32 previousNumberOfBatches) {
+  for (core::uint32 i = 0; i < 200; ++i) {
+    {
+      core::LockGuard<core::Mutex> lock(mutex);
+      if (numberOfBatches != previousNumberOfBatches) {
+        return true;
+      }
+    }
+    core::Platform::instance().sleep(10);
+  }
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+FileWatchServiceTests::FileWatchServiceTests()
+: UnitTest("core::FileWatchServiceTests") {
+
+}
+
+FileWatchServiceTests::~FileWatchServiceTests() {
+
+}
+
+void FileWatchServiceTests::test() {
+  // Leftovers of a previous run
+  std::remove("./sample_data/watch_root/created.txt");
+  std::remove("./sample_data/watch_root/sub/nested.txt");
+  std::remove("./sample_data/watch_root/sub");
+  std::remove("./sample_data/watch_root/existing.txt");
+
+  core::Filesystem filesystem;
+  filesystem.create_directory("./sample_data/watch_root");
+  be_expect_true(append_watched_file("./sample_data/watch_root/existing.txt", "existing"))
+
+  core::FileWatchService& service = core::FileWatchService::instance();
+  service.set_debounce_time(50, 500);
+  be_expect_false(service.watch("./sample_data/watch_root/missing"))
+  be_expect_true(service.watch("./sample_data/watch_root/"))
+  be_expect_true(service.is_running())
+  be_expect(service.get_num_watched_directories() == 1)
+
+  // Callbacks run on the watcher thread
+  core::Mutex mutex;
+  core::uint32 numberOfBatches = 0;
+  core::Vector<core::FileChange> changes;
+  const core::uint32 subscription = service.subscribe("./sample_data/watch_root", [&](const core::Vector<core::FileChange>& batch) {
+    core::LockGuard<core::Mutex> lock(mutex);
+    ++numberOfBatches;
+    for (const core::FileChange& change : batch) {
+      changes.push_back(change);
+    }
+  });
+  be_expect(subscription != core::FileWatchService::InvalidSubscription)
+
+  // A burst is coalesced per path, files of a new directory are reported even if they are created before its watch
+  be_expect_true(append_watched_file("./sample_data/watch_root/created.txt", "first"))
+  be_expect_true(append_watched_file("./sample_data/watch_root/created.txt", "second"))
+  be_expect_true(append_watched_file("./sample_data/watch_root/transient.txt", "gone"))
+  be_expect(std::remove("./sample_data/watch_root/transient.txt") == 0)
+  be_expect(std::remove("./sample_data/watch_root/existing.txt") == 0)
+  be_expect_true(filesystem.create_directory("./sample_data/watch_root/sub"))
+  be_expect_true(append_watched_file("./sample_data/watch_root/sub/nested.txt", "nested"))
+  be_expect_true(wait_for_batch(mutex, numberOfBatches, 0))
+  core::Platform::instance().sleep(100);
+  {
+    core::LockGuard<core::Mutex> lock(mutex);
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/created.txt") == core::FileChange::Added)
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/existing.txt") == core::FileChange::Removed)
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/transient.txt") == 0)
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/sub") == (core::FileChange::Added | core::FileChange::Directory))
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/sub/nested.txt") == core::FileChange::Added)
+    be_expect(changes.size() == 4)
+    changes.clear();
+  }
+  be_expect(service.get_num_watched_directories() == 2)
+
+  // Modifications and saving by rename
+  core::uint32 previousNumberOfBatches = 0;
+  {
+    core::LockGuard<core::Mutex> lock(mutex);
+    previousNumberOfBatches = numberOfBatches;
+  }
+  be_expect_true(append_watched_file("./sample_data/watch_root/sub/nested.txt", " more"))
+  be_expect_true(append_watched_file("./sample_data/watch_root/saved.tmp", "replacement"))
+  be_expect(std::rename("./sample_data/watch_root/saved.tmp", "./sample_data/watch_root/created.txt") == 0)
+  be_expect_true(wait_for_batch(mutex, numberOfBatches, previousNumberOfBatches))
+  {
+    core::LockGuard<core::Mutex> lock(mutex);
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/sub/nested.txt") == core::FileChange::Modified)
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/created.txt") == core::FileChange::Modified)
+    be_expect(find_change_flags(changes, "./sample_data/watch_root/saved.tmp") == 0)
+    changes.clear();
+  }
+
+  // Removed directories drop their watches, nothing is delivered after unsubscribing
+  be_expect(std::remove("./sample_data/watch_root/sub/nested.txt") == 0)
+  be_expect(std::remove("./sample_data/watch_root/sub") == 0)
+  core::Platform::instance().sleep(200);
+  be_expect(service.get_num_watched_directories() == 1)
+  service.unsubscribe(subscription);
+  {
+    core::LockGuard<core::Mutex> lock(mutex);
+    previousNumberOfBatches = numberOfBatches;
+    changes.clear();
+  }
+  be_expect_true(append_watched_file("./sample_data/watch_root/created.txt", "unobserved"))
+  core::Platform::instance().sleep(200);
+  {
+    core::LockGuard<core::Mutex> lock(mutex);
+    be_expect(numberOfBatches == previousNumberOfBatches)
+  }
+  be_expect(service.get_num_batches() >= 3)
+  be_expect(service.get_num_events() > 0)
+
+  // Nested roots share their watches, a directory stays watched while any root covers it
+  be_expect_true(filesystem.create_directory("./sample_data/watch_root/sub"))
+  core::Platform::instance().sleep(200);
+  be_expect(service.get_num_watched_directories() == 2)
+  be_expect_true(service.watch("./sample_data/watch_root/sub"))
+  service.unwatch("./sample_data/watch_root/sub");
+  be_expect(service.get_num_watched_directories() == 2)
+  be_expect_true(service.watch("./sample_data/watch_root/sub"))
+  service.unwatch("./sample_data/watch_root");
+  be_expect(service.get_num_watched_directories() == 1)
+  service.unwatch("./sample_data/watch_root/sub");
+  be_expect(service.get_num_watched_directories() == 0)
+  be_expect(std::remove("./sample_data/watch_root/sub") == 0)
+
+  service.stop();
+  be_expect_false(service.is_running())
+  std::remove("./sample_data/watch_root/created.txt");
+}
+
+be_unittest_autoregister(FileWatchServiceTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/json_stream.h"
+#include <core/io/json_stream_reader.h>
+#include <core/io/json_stream_writer.h>
+#include <core/io/memory_stream.h>
+#include <core/json/json.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local classes                                         ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Records all events as compact text.
+ */
+class RecordingHandler : public core::JsonSaxHandler {
+public:
+  bool on_null() override { mEvents += "n "; return true; }
+  bool on_bool(bool value) override { mEvents += value ? "t " : "f "; return true; }
+  bool on_integer(core::int64 value) override { mEvents.append_format("i%lld ", static_cast<long long>(value)); return true; }
+  bool on_number(double value) override { mEvents.append_format("d%g ", value); return true; }
+  bool on_string(core::StringView value, bool rawText) override { return append(rawText ? 'r' : 's', value); }
+  bool on_key(core::StringView name) override { return append('k', name); }
+  bool on_begin_object() override { mEvents += "{ "; return true; }
+  bool on_end_object() override { mEvents += "} "; return true; }
+  bool on_begin_array() override { mEvents += "[ "; return true; }
+  bool on_end_array() override { mEvents += "] "; return true; }
+
+  bool append(char prefix, core::StringView value) {
+    mEvents += prefix;
+    for (core::sizeT i = 0; i < value.size(); ++i) {
+      mEvents += value.data()[i];
+    }
+    mEvents += ' ';
+    return true;
+  }
+
+  core::String mEvents;
+};
+
+/**
+ * @brief
+ * Reads the whole stream with the given chunk size and returns the recorded events.
+ */
+bool read_events(const core::Ptr<core::Stream>& stream, core::uint32 chunkSize, core::String& events) {
+  core::JsonStreamReader reader(chunkSize);
+  reader.set_stream(stream);
+  if (!reader.open()) {
+    return false;
+  }
+  RecordingHandler handler;
+  const bool result = reader.read(handler);
+  reader.close();
+  events = handler.mEvents;
+  return result;
+}
+
+/**
+ * @brief
+ * Returns the whole content of the stream.
+ */
+core::String read_text(const core::Ptr<core::Stream>& stream) {
+  core::String text;
+  stream->set_access_mode(core::EFileMode::Read);
+  stream->open();
+  char buffer[64];
+  core::sizeT numBytes = 0;
+  while ((numBytes = stream->read(buffer, sizeof(buffer))) > 0) {
+    for (core::sizeT i = 0; i < numBytes; ++i) {
+      text += buffer[i];
+    }
+  }
+  stream->close();
+  return text;
+}
+
+/**
+ * @brief
+ * Puts the text into a fresh memory stream.
+ */
+core::Ptr<core::Stream> make_stream(const char* text) {
+  core::Ptr<core::Stream> stream(new core::MemoryStream());
+  stream->set_access_mode(core::EFileMode::Write);
+  stream->open();
+  stream->write(text, strlen(text));
+  stream->close();
+  return stream;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+JsonStreamTests::JsonStreamTests()
+: UnitTest("core::JsonStreamTests") {
+
+}
+
+JsonStreamTests::~JsonStreamTests() {
+
+}
+
+void JsonStreamTests::test() {
+  // Write a document through a tiny buffer, so the output is flushed many times
+  core::Ptr<core::Stream> stream(new core::MemoryStream());
+  {
+    core::JsonStreamWriter writer(0, 5);
+    writer.set_stream(stream);
+    be_expect_true(writer.open())
+    writer.begin_object();
+    writer.key("name");
+    writer.write_string("bit\"ray\n\t\x01");
+    writer.key("values");
+    writer.begin_array();
+    writer.write_integer(-42);
+    writer.write_number(2.5);
+    writer.write_number(3.0);
+    writer.write_bool(true);
+    writer.write_null();
+    writer.begin_array();
+    writer.end_array();
+    writer.end_array();
+    writer.key("raw");
+    writer.write_string("a \"quoted\"\nblock", true);
+    writer.key("empty");
+    writer.begin_object();
+    writer.end_object();
+    writer.end_object();
+    writer.close();
+  }
+  {
+    const core::String text = read_text(stream);
+    be_expect(text == "{\"name\":\"bit\\\"ray\\n\\t\\u0001\",\"values\":[-42,2.5,3.0,true,null,[]],\"raw\":\"\"\"a \"quoted\"\nblock\"\"\",\"empty\":{}}")
+  }
+
+  // Read it back with chunks much smaller than most tokens
+  const char* expected = "{ kname sbit\"ray\n\t\x01 kvalues [ i-42 d2.5 d3 t n [ ] ] kraw ra \"quoted\"\nblock kempty { } } ";
+  for (core::uint32 chunkSize : {1u, 3u, 7u, 4096u}) {
+    core::String events;
+    be_expect_true(read_events(stream, chunkSize, events))
+    be_expect(events == expected)
+  }
+
+  // Pretty printed output reads back identically
+  {
+    core::Ptr<core::Stream> pretty(new core::MemoryStream());
+    core::JsonStreamWriter writer(2);
+    writer.set_stream(pretty);
+    be_expect_true(writer.open())
+    writer.begin_object();
+    writer.key("list");
+    writer.begin_array();
+    writer.write_integer(1);
+    writer.write_integer(2);
+    writer.end_array();
+    writer.end_object();
+    writer.close();
+
+    const core::String text = read_text(pretty);
+    be_expect(text == "{\n  \"list\": [\n    1,\n    2\n  ]\n}")
+
+    core::String events;
+    be_expect_true(read_events(pretty, 3, events))
+    be_expect(events == "{ klist [ i1 i2 ] } ")
+  }
+
+  // Relaxed dialect: implicit root, unquoted keys, optional commas, comments and unicode escapes
+  {
+    core::String events;
+    be_expect_true(read_events(make_stream("# comment\nfirst key: 1\nsecond: [true false]\nthird: \"\\u00e4\\ud83d\\ude00\"\n"), 4, events))
+    be_expect(events == "{ kfirst key i1 ksecond [ t f ] kthird s\xc3\xa4\xf0\x9f\x98\x80 } ")
+  }
+
+  // A DOM value is written as a whole
+  {
+    core::JsonValue value = core::JsonParser::parse("{\"a\": [1, \"x\"]}", 15);
+    core::Ptr<core::Stream> output(new core::MemoryStream());
+    core::JsonStreamWriter writer(0);
+    writer.set_stream(output);
+    be_expect_true(writer.open())
+    writer.write_value(value);
+    writer.close();
+
+    core::String events;
+    be_expect_true(read_events(output, 2, events))
+    be_expect(events == "{ ka [ i1 sx ] } ")
+  }
+
+  // Errors are reported with their offset
+  {
+    core::String events;
+    be_expect_false(read_events(make_stream("{\"a\": [1, 2}"), 3, events))
+    be_expect_false(read_events(make_stream("{\"a\": \"unterminated"), 3, events))
+    be_expect_false(read_events(make_stream("[1] 2"), 3, events))
+
+    core::JsonStreamReader reader(4);
+    reader.set_stream(make_stream("[1, 2, ?]"));
+    be_expect_true(reader.open())
+    RecordingHandler handler;
+    be_expect_false(reader.read(handler))
+    be_expect(reader.get_error_offset() == 7)
+    reader.close();
+  }
+}
+
+be_unittest_autoregister(JsonStreamTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
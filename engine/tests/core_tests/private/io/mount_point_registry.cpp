@@ -94,6 +94,51 @@ void MountPointRegistryTests::test() {
       mpr.resolve_path(core::Path(wrongPath)).get_native_path().c_str());
 
   }
+
+  // Mounts referring to mounts which are added later
+  {
+    core::MountPointRegistry registry;
+    registry.add_mount_point("late", "base:assets/late");
+    be_expect_str_eq("base:assets/late/file.txt", registry.resolve_path(core::String("late:file.txt")).c_str())
+    registry.add_mount_point("base", "/opt/game");
+    be_expect_str_eq("/opt/game/assets/late/file.txt", registry.resolve_path(core::String("late:file.txt")).c_str())
+    be_expect_str_eq("/opt/game/assets/late/file.txt", registry.resolve_path(core::PathView("late:file.txt")).c_str())
+
+    // Reverse lookup picks the innermost mount
+    core::PathView relativePath;
+    const core::MountPoint* mountPoint = registry.find_mount_point_of("/opt/game/assets/late/sub/file.txt", relativePath);
+    be_expect_true(mountPoint != nullptr)
+    be_expect_str_eq("late", mountPoint->get_mount().c_str())
+    be_expect_str_eq("sub/file.txt", relativePath.to_string().c_str())
+    mountPoint = registry.find_mount_point_of("/opt/game/assets/other.txt", relativePath);
+    be_expect_true(mountPoint != nullptr)
+    be_expect_str_eq("base", mountPoint->get_mount().c_str())
+    be_expect_str_eq("assets/other.txt", relativePath.to_string().c_str())
+    be_expect_true(registry.find_mount_point_of("/opt/gamex/file.txt", relativePath) == nullptr)
+    be_expect_true(registry.find_mount_point_of("opt/game/file.txt", relativePath) == nullptr)
+
+    // Repeated resolves are answered by the cache, which is dropped once the mounts change
+    core::String realPath;
+    core::String entryName;
+    const core::uint64 numHits = registry.get_num_cache_hits();
+    be_expect_true(registry.resolve_path(core::PathView("base:a.txt"), realPath, entryName) == nullptr)
+    be_expect_true(registry.resolve_path(core::PathView("base:a.txt"), realPath, entryName) == nullptr)
+    be_expect_str_eq("/opt/game/a.txt", realPath.c_str())
+    be_expect(registry.get_num_cache_hits() == numHits + 1)
+    registry.remove_mount_point("base");
+    be_expect_true(registry.resolve_path(core::PathView("base:a.txt"), realPath, entryName) == nullptr)
+    be_expect_str_eq("base:a.txt", realPath.c_str())
+
+    // Bounded in size
+    registry.set_cache_capacity(4);
+    for (core::uint32 i = 0; i < 16; ++i) {
+      core::String path("late:");
+      path += i;
+      be_expect_true(registry.resolve_path(core::PathView(path), realPath, entryName) == nullptr)
+    }
+    be_expect_true(registry.resolve_path(core::PathView("late:0"), realPath, entryName) == nullptr)
+    be_expect_str_eq("base:assets/late/0", realPath.c_str())
+  }
 }
 
 be_unittest_autoregister(MountPointRegistryTests)
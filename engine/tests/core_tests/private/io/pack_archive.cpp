@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/pack_archive.h"
+#include <core/io/file.h>
+#include <core/io/filesystem.h>
+#include <core/io/io_server.h>
+#include <core/io/pack_archive.h>
+#include <core/io/pack_archive_writer.h>
+#include <core/io/stream.h>
+#include <cerrno>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes the given text into a new native file.
+ */
+static bool write_pack_source(const char* filename, const char* text) {
+  core::File file;
+  if (!file.open(filename, core::EFileMode::Write)) {
+    return false;
+  }
+  file.write(text, strlen(text));
+  file.close();
+  return true;
+}
+
+/**
+ * @brief
+ * Returns whether the names contain the given one.
+ */
+static bool contains_name(const core::Vector<core::String>& names, const char* name) {
+  for (const core::String& element : names) {
+    if (element == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+PackArchiveTests::PackArchiveTests()
+: UnitTest("core::PackArchiveTests") {
+
+}
+
+PackArchiveTests::~PackArchiveTests() {
+
+}
+
+void PackArchiveTests::test() {
+  // Highly compressible text next to data LZ4 can't shrink
+  core::String text;
+  for (core::uint32 i = 0; i < 512; ++i) {
+    text += "The quick brown fox jumps over the lazy dog. ";
+  }
+  core::uint8 noise[4096];
+  core::uint32 state = 0x12345678u;
+  for (core::uint8& value : noise) {
+    state = state * 1664525u + 1013904223u;
+    value = static_cast<core::uint8>(state >> 24);
+  }
+
+  // Loose files picked up as directory
+  core::Filesystem filesystem;
+  filesystem.create_directory("./sample_data/pack_source");
+  filesystem.create_directory("./sample_data/pack_source/sub");
+  be_expect_true(write_pack_source("./sample_data/pack_source/readme.txt", "Loose readme"))
+  be_expect_true(write_pack_source("./sample_data/pack_source/sub/nested.txt", "Nested file"))
+  be_expect_true(write_pack_source("./sample_data/pack_source/empty.txt", ""))
+
+  {
+    core::PackArchiveWriter writer;
+    writer.set_compression(core::EPackCompression::LZ4);
+    writer.set_alignment(256);
+    be_expect(writer.add_directory("./sample_data/pack_source", "loose") == 3)
+    be_expect_true(writer.add_data("text/fox.txt", text.c_str(), text.length()))
+    be_expect_true(writer.add_data("/textures/noise.bin", noise, sizeof(noise)))
+    be_expect_true(writer.add_data("textures/detail/more.bin", noise, 100))
+    be_expect_false(writer.add_data("text/fox.txt", "x", 1))
+    be_expect_false(writer.add_data("", "x", 1))
+    be_expect(writer.get_num_entries() == 6)
+    be_expect_true(writer.write("./sample_data/pack_archive.bpak"))
+  }
+
+  // Lookup and content
+  {
+    core::PackArchive archive;
+    be_expect_true(archive.open("./sample_data/pack_archive.bpak"))
+    be_expect(archive.get_num_entries() == 6)
+
+    const core::uint32 foxIndex = archive.find_entry("text/fox.txt");
+    be_expect(foxIndex != core::PackArchive::InvalidIndex)
+    be_expect(archive.find_entry("/text/fox.txt") == foxIndex)
+    be_expect(archive.find_entry("text/fox") == core::PackArchive::InvalidIndex)
+    be_expect(archive.get_entry(foxIndex).compression == core::EPackCompression::LZ4)
+    be_expect(archive.get_entry(foxIndex).storedSize < text.length() / 4)
+    be_expect(archive.get_entry(foxIndex).size == text.length())
+
+    const core::uint32 noiseIndex = archive.find_entry("textures/noise.bin");
+    be_expect(archive.get_entry(noiseIndex).compression == core::EPackCompression::None)
+    be_expect(memcmp(archive.get_stored_data(noiseIndex), noise, sizeof(noise)) == 0)
+
+    bool isAligned = true;
+    bool isIntact = true;
+    for (core::uint32 i = 0; i < archive.get_num_entries(); ++i) {
+      isAligned = isAligned && (archive.get_entry(i).offset % 256) == 0;
+      isIntact = isIntact && archive.verify_entry(i);
+    }
+    be_expect_true(isAligned)
+    be_expect_true(isIntact)
+
+    core::String content;
+    content.resize(text.length());
+    be_expect_true(archive.read_entry(foxIndex, &content[0]))
+    be_expect(content == text)
+
+    be_expect_true(archive.has_entry("loose/sub/nested.txt"))
+    be_expect(archive.get_entry(archive.find_entry("loose/empty.txt")).size == 0)
+    be_expect_true(archive.has_directory("textures"))
+    be_expect_true(archive.has_directory("/textures/detail/"))
+    be_expect_false(archive.has_directory("textures/noise.bin"))
+    be_expect_false(archive.has_directory("text/fox"))
+
+    core::Vector<core::String> names;
+    archive.enumerate("pack:", "", core::EEnumerationMode::Files, names, true, true);
+    be_expect(names.size() == 6)
+    names.clear();
+    archive.enumerate("pack:", "textures", core::EEnumerationMode::All, names, false, true);
+    be_expect(names.size() == 2)
+    be_expect_true(contains_name(names, "noise.bin"))
+    be_expect_true(contains_name(names, "detail"))
+    names.clear();
+    archive.enumerate("pack:loose", "loose", core::EEnumerationMode::Directories, names, true, false);
+    be_expect(names.size() == 1)
+    be_expect_true(contains_name(names, "pack:loose/sub"))
+  }
+
+  // Streams over stored and compressed entries
+  {
+    core::Ptr<core::PackArchive> archive(new core::PackArchive());
+    be_expect_true(archive->open("./sample_data/pack_archive.bpak"))
+
+    core::Ptr<core::Stream> stream = archive->create_stream(archive->find_entry("text/fox.txt"));
+    be_expect_true(stream->open())
+    be_expect(stream->get_size() == text.length())
+    char buffer[9] = {};
+    be_expect(stream->read(buffer, 8) == 8)
+    be_expect(strcmp(buffer, "The quic") == 0)
+    stream->seek(static_cast<core::sizeT>(-4), core::EFileSeek::End);
+    be_expect(stream->get_content_as_string() == "og. ")
+    stream->close();
+
+    stream = archive->create_stream(archive->find_entry("loose/readme.txt"));
+    stream->set_access_mode(core::EFileMode::Write);
+    be_expect_false(stream->open())
+    stream->set_access_mode(core::EFileMode::Read);
+    be_expect_true(stream->open())
+    be_expect(memcmp(stream->map(), "Loose readme", 12) == 0)
+    stream->close();
+  }
+
+  // Damaged archives are refused
+  {
+    core::File source;
+    be_expect_true(source.open("./sample_data/pack_archive.bpak", core::EFileMode::Read))
+    core::Vector<core::uint8> data;
+    data.resize(static_cast<core::sizeT>(source.get_number_of_bytes()));
+    source.read(data.data(), data.size());
+    source.close();
+
+    core::File damaged;
+    be_expect_true(damaged.open("./sample_data/pack_archive_damaged.bpak", core::EFileMode::Write))
+    damaged.write(data.data(), 300);
+    damaged.close();
+
+    core::PackArchive archive;
+    be_expect_false(archive.open("./sample_data/pack_archive_damaged.bpak"))
+    be_expect_false(archive.is_open())
+    be_expect_false(archive.open("./sample_data/pack_source/readme.txt"))
+  }
+
+  // Mounted through the io server
+  {
+    core::IoServer* ioServer = core::IoServer::instance();
+    be_expect_true(ioServer->mount("./sample_data/pack_archive.bpak", "packtest", false))
+    be_expect_true(ioServer->file_exists(core::Path("packtest:text/fox.txt")))
+    be_expect_true(ioServer->is_file(core::Path("packtest:loose/sub/nested.txt")))
+    be_expect_false(ioServer->file_exists(core::Path("packtest:text/missing.txt")))
+    be_expect_true(ioServer->is_directory(core::Path("packtest:textures")))
+    be_expect(ioServer->get_file_size("packtest:textures/noise.bin") == sizeof(noise))
+
+    core::Vector<core::String> names;
+    ioServer->enumerate_files("packtest:textures", "packtest:textures", core::EEnumerationMode::Files, names, true, false);
+    be_expect(names.size() == 2)
+    be_expect_true(contains_name(names, "packtest:textures/detail/more.bin"))
+
+    core::Ptr<core::Stream> stream = ioServer->create_stream(core::Path("packtest:loose/sub/nested.txt"));
+    be_expect_true(stream.is_valid())
+    be_expect_true(stream->open())
+    be_expect(stream->get_content_as_string() == "Nested file")
+    stream->close();
+    be_expect_false(ioServer->create_stream(core::Path("packtest:text/fox.txt"), core::EFileMode::Write).is_valid())
+
+    // Stored entries are read asynchronously straight from the archive file
+    core::uint8 buffer[64];
+    core::AsyncReadRequest request;
+    request.filename = "packtest:textures/noise.bin";
+    request.buffer = buffer;
+    request.offset = sizeof(noise) - 32;
+    request.numberOfBytes = sizeof(buffer);
+    core::Ptr<core::AsyncFileRead> read = ioServer->read_async(request);
+    read->wait();
+    be_expect(read->get_number_of_read_bytes() == 32)
+    be_expect(memcmp(buffer, noise + sizeof(noise) - 32, 32) == 0)
+
+    // Compressed entries can't be read as a range of the archive file and fail right away
+    bool isCallbackCalled = false;
+    request.filename = "packtest:text/fox.txt";
+    request.offset = 0;
+    request.callback = [&isCallbackCalled](core::AsyncFileRead&) { isCallbackCalled = true; };
+    read = ioServer->read_async(request);
+    be_expect_true(isCallbackCalled)
+    be_expect(read->wait() == core::EAsyncIoStatus::Failed)
+    be_expect(read->get_error() == ENOTSUP)
+    be_expect(read->get_number_of_read_bytes() == 0)
+
+    // Batches keep their order when some of the reads fail
+    core::uint8 batchBuffer[2][16];
+    core::AsyncReadRequest requests[2];
+    requests[0].filename = "packtest:text/fox.txt";
+    requests[0].buffer = batchBuffer[0];
+    requests[0].numberOfBytes = sizeof(batchBuffer[0]);
+    requests[1].filename = "packtest:textures/noise.bin";
+    requests[1].buffer = batchBuffer[1];
+    requests[1].numberOfBytes = sizeof(batchBuffer[1]);
+    core::Vector<core::Ptr<core::AsyncFileRead>> reads;
+    ioServer->read_async(requests, 2, reads);
+    be_expect(reads.size() == 2)
+    be_expect(reads[0]->wait() == core::EAsyncIoStatus::Failed)
+    be_expect(reads[1]->wait() == core::EAsyncIoStatus::Completed)
+    be_expect(memcmp(batchBuffer[1], noise, sizeof(batchBuffer[1])) == 0)
+
+    be_expect_true(ioServer->unmount("packtest"))
+    be_expect_false(ioServer->file_exists(core::Path("packtest:text/fox.txt")))
+  }
+}
+
+be_unittest_autoregister(PackArchiveTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "io/path_view.h"
+#include <core/io/path_view.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Returns whether the view has exactly the given text.
+ */
+static bool path_view_equals(core::StringView view, const char* text) {
+  return (view.length() == strlen(text) && memcmp(view.data(), text, view.length()) == 0);
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+PathViewTests::PathViewTests()
+: UnitTest("core::PathViewTests") {
+
+}
+
+PathViewTests::~PathViewTests() {
+
+}
+
+void PathViewTests::test() {
+  // Mount qualified file
+  {
+    const core::String text("content:core/shader_pieces//sp_common.shader_piece");
+    const core::PathView path(text);
+    be_expect(path.data() == text.c_str())
+    be_expect(path.length() == text.length())
+    be_expect_true(path.has_mount())
+    be_expect_false(path.is_absolute())
+    be_expect_false(path.is_directory())
+    be_expect_true(path_view_equals(path.get_mount_name(), "content"))
+    be_expect_true(path_view_equals(path.get_mount_relative_path().get_view(), "core/shader_pieces//sp_common.shader_piece"))
+    be_expect_true(path_view_equals(path.get_directory().get_view(), "content:core/shader_pieces//"))
+    be_expect_true(path_view_equals(path.get_filename(), "sp_common.shader_piece"))
+    be_expect_true(path_view_equals(path.get_extension(), ".shader_piece"))
+    be_expect_true(path_view_equals(path.get_title(), "sp_common"))
+    be_expect(path.get_num_parts() == 3)
+    be_expect_true(path_view_equals(path.get_part(0), "core"))
+    be_expect_true(path_view_equals(path.get_part(1), "shader_pieces"))
+    be_expect_true(path_view_equals(path.get_part(2), "sp_common.shader_piece"))
+    be_expect_true(path.get_part(3).empty())
+    be_expect_true(path.to_string() == text)
+  }
+
+  // Absolute directory without mount, the ':' after a separator isn't a mount
+  {
+    const core::PathView path("/some/dir:name/");
+    be_expect_false(path.has_mount())
+    be_expect_true(path.is_absolute())
+    be_expect_true(path.is_directory())
+    be_expect_true(path.get_filename().empty())
+    be_expect_true(path.get_extension().empty())
+    be_expect(path.get_mount_relative_path() == path)
+    be_expect(path.get_num_parts() == 2)
+    be_expect_true(path_view_equals(path.get_part(1), "dir:name"))
+  }
+
+  // Mount root and plain filenames
+  {
+    const core::PathView mountRoot("textures:");
+    be_expect_true(path_view_equals(mountRoot.get_mount_name(), "textures"))
+    be_expect_true(mountRoot.get_mount_relative_path().is_empty())
+    be_expect_true(mountRoot.get_filename().empty())
+    be_expect(mountRoot.get_num_parts() == 0)
+
+    const core::PathView filename("archive.tar.gz");
+    be_expect_true(filename.get_directory().is_empty())
+    be_expect_true(path_view_equals(filename.get_filename(), "archive.tar.gz"))
+    be_expect_true(path_view_equals(filename.get_extension(), ".gz"))
+    be_expect_true(path_view_equals(filename.get_title(), "archive"))
+
+    const core::PathView mountFile("textures:stone.png");
+    be_expect_true(path_view_equals(mountFile.get_filename(), "stone.png"))
+    be_expect_true(mountFile.get_directory().is_empty())
+
+    const core::PathView empty;
+    be_expect_true(empty.is_empty())
+    be_expect_false(empty.has_mount())
+    be_expect(empty.get_num_parts() == 0)
+    be_expect(empty != filename)
+  }
+}
+
+be_unittest_autoregister(PathViewTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "json/json_binary.h"
+#include <core/config/config.h>
+#include <core/config/config_reader.h>
+#include <core/io/file_stream.h>
+#include <core/io/json_stream_writer.h>
+#include <core/io/memory_stream.h>
+#include <core/json/json.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Writes the element as compact JSON text.
+ */
+template<typename TElement>
+static core::String to_text(const TElement& element) {
+  core::Ptr<core::Stream> stream(new core::MemoryStream());
+  {
+    core::JsonStreamWriter writer(0);
+    writer.set_stream(stream);
+    writer.open();
+    writer.write_value(element);
+    writer.close();
+  }
+
+  core::String text;
+  stream->set_access_mode(core::EFileMode::Read);
+  stream->open();
+  char buffer[64];
+  core::sizeT numBytes = 0;
+  while ((numBytes = stream->read(buffer, sizeof(buffer))) > 0) {
+    for (core::sizeT i = 0; i < numBytes; ++i) {
+      text += buffer[i];
+    }
+  }
+  stream->close();
+  return text;
+}
+
+static bool contains(const core::Vector<core::uint8>& data, const core::uint8* pattern, core::uint32 size) {
+  for (core::uint32 i = 0; i + size <= data.size(); ++i) {
+    if (memcmp(data.data() + i, pattern, size) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+JsonBinaryTests::JsonBinaryTests()
+: UnitTest("core::JsonBinaryTests") {
+
+}
+
+JsonBinaryTests::~JsonBinaryTests() {
+
+}
+
+void JsonBinaryTests::test() {
+  const char* input =
+    "{\"name\": \"bitray\", \"big\": {\"first\": \"a long string which makes the object wrapped\", \"list\": [1, 2, 3]},"
+    " \"values\": [0, 23, 24, -1, -25, 65536, -9223372036854775807, 2.5, 0.1, true, false, null],"
+    " \"raw\": \"\"\"raw \"text\" block\"\"\", \"empty\": {}, \"last\": 7}";
+
+  core::JsonDocument document;
+  be_expect_true(document.parse(input, strlen(input)))
+
+  core::Vector<core::uint8> encoded;
+  be_expect_true(core::JsonBinary::encode_text(input, strlen(input), encoded))
+  be_expect_true(core::JsonBinary::is_binary(encoded.data(), encoded.size()))
+
+  // Self-describe tag in front, the big nested object is wrapped in tag 24
+  const core::uint8 magic[] = { 0xd9, 0xd9, 0xf7 };
+  be_expect(memcmp(encoded.data(), magic, sizeof(magic)) == 0)
+  const core::uint8 wrapped[] = { 0xd8, 0x18, 0x58 };
+  be_expect_true(contains(encoded, wrapped, sizeof(wrapped)))
+
+  // Random access without building a DOM
+  {
+    core::JsonBinaryDocument binary;
+    be_expect_true(binary.load(encoded.data(), encoded.size()))
+    be_expect_false(binary.is_mapped())
+
+    const core::JsonBinaryElement root = binary.get_root();
+    be_expect_true(root.is_object())
+    be_expect(root.get_size() == 6)
+    be_expect(root["name"].to_string().compare("bitray") == 0)
+    be_expect(root["last"].to_integer() == 7)
+    be_expect(root["big"]["list"](2).to_integer() == 3)
+    be_expect(root["big"]["first"].to_string().size() == 44)
+    be_expect_false(root["missing"].is_valid())
+    be_expect_false(root["name"]["deeper"].is_valid())
+    be_expect_true(root["raw"].is_raw_text())
+    be_expect(root["raw"].to_string().compare("raw \"text\" block") == 0)
+    be_expect(root["empty"].get_size() == 0)
+    be_expect_false(root["empty"].get_first().is_valid())
+    be_expect(root.get_member_name(4).compare("empty") == 0)
+    be_expect(root.get_member_value(0).to_string().compare("bitray") == 0)
+
+    const core::JsonBinaryElement values = root["values"];
+    be_expect(values.get_size() == 12)
+    be_expect(values(2).to_integer() == 24)
+    be_expect(values(4).to_integer() == -25)
+    be_expect(values(5).to_integer() == 65536)
+    be_expect(values(6).to_integer() == -9223372036854775807LL)
+    be_expect(values(7).to_number() == 2.5)
+    be_expect(values(8).to_number() == 0.1)
+    be_expect_true(values(9).to_bool())
+    be_expect_false(values(10).to_bool())
+    be_expect_true(values(11).is_null())
+    be_expect_false(values(12).is_valid())
+
+    // Converting back to text gives the same as writing the parsed document
+    be_expect(to_text(root) == to_text(document.get_root()))
+
+    // Into a DOM and back to binary again
+    const core::JsonValue value = core::JsonBinary::decode(root);
+    be_expect(value["name"].to_string() == "bitray")
+    be_expect(value["big"]["list"](1).to_integer() == 2)
+    be_expect_true(value["raw"].is_raw_text())
+
+    core::Vector<core::uint8> reencoded;
+    core::JsonBinary::encode(value, reencoded);
+    core::JsonBinaryDocument second;
+    be_expect_true(second.load(reencoded.data(), reencoded.size()))
+    be_expect(to_text(second.get_root()) == to_text(value))
+  }
+
+  // Malformed data is rejected
+  {
+    core::sizeT errorOffset = 0;
+    be_expect_true(core::JsonBinary::validate(encoded.data(), encoded.size(), errorOffset))
+    be_expect_false(core::JsonBinary::validate(encoded.data(), encoded.size() - 1, errorOffset))
+    be_expect_false(core::JsonBinary::validate(encoded.data() + 1, encoded.size() - 1, errorOffset))
+    be_expect(errorOffset == 0)
+
+    // Indefinite length array, and trailing data behind the root
+    const core::uint8 indefinite[] = { 0xd9, 0xd9, 0xf7, 0x9f, 0x01, 0xff };
+    be_expect_false(core::JsonBinary::validate(indefinite, sizeof(indefinite), errorOffset))
+    be_expect(errorOffset == 3)
+    const core::uint8 trailing[] = { 0xd9, 0xd9, 0xf7, 0x81, 0x01, 0x02 };
+    be_expect_false(core::JsonBinary::validate(trailing, sizeof(trailing), errorOffset))
+    be_expect(errorOffset == 5)
+
+    // Member names have to be strings
+    const core::uint8 integerName[] = { 0xd9, 0xd9, 0xf7, 0xa1, 0x01, 0x02 };
+    be_expect_false(core::JsonBinary::validate(integerName, sizeof(integerName), errorOffset))
+    be_expect(errorOffset == 4)
+
+    core::JsonBinaryDocument binary;
+    be_expect_false(binary.load(trailing, sizeof(trailing)))
+    be_expect_false(binary.get_root().is_valid())
+  }
+
+  // Memory mapped from a file
+  {
+    core::FileStream file;
+    file.set_path(core::Path("./sample_data/json_binary.bin"));
+    file.set_access_mode(core::EFileMode::Write);
+    be_expect_true(file.open())
+    file.write(encoded.data(), encoded.size());
+    file.close();
+
+    core::JsonBinaryDocument binary;
+    be_expect_true(binary.open("./sample_data/json_binary.bin"))
+    be_expect(binary.get_size() == encoded.size())
+    be_expect(binary.get_root()["big"]["list"](0).to_integer() == 1)
+    binary.close();
+    be_expect_false(binary.is_valid())
+  }
+
+  // Config reading maintains a binary copy next to the text file
+  {
+    core::FileStream file;
+    file.set_path(core::Path("./sample_data/json_binary_config.json"));
+    file.set_access_mode(core::EFileMode::Write);
+    be_expect_true(file.open())
+    const char* configText = "window: { width: 1280, height: 720 }\ntitle: \"bitray\"\n";
+    file.write(configText, strlen(configText));
+    file.close();
+
+    core::Config config;
+    core::ConfigReader reader;
+    be_expect_true(reader.read("./sample_data/json_binary_config.json", config, true))
+    be_expect(config["window"]["width"].to_integer() == 1280)
+
+    core::JsonBinaryDocument binary;
+    be_expect_true(binary.open(core::ConfigReader::get_binary_cache_filename("./sample_data/json_binary_config.json")))
+    be_expect(binary.get_root()["window"]["height"].to_integer() == 720)
+    be_expect(binary.get_root()["title"].to_string().compare("bitray") == 0)
+  }
+}
+
+be_unittest_autoregister(JsonBinaryTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "json/json_document.h"
+#include <core/json/json.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+JsonDocumentTests::JsonDocumentTests()
+: UnitTest("core::JsonDocumentTests") {
+
+}
+
+JsonDocumentTests::~JsonDocumentTests() {
+
+}
+
+void JsonDocumentTests::test() {
+  core::JsonDocument document;
+  be_expect_false(document.is_valid())
+  be_expect_false(document.get_root().is_valid())
+
+  // Retained input, the document does not depend on the source string
+  {
+    core::String input = "{\"name\": \"bitray\", \"escaped\": \"a\\tb\", \"values\": [1, 2.5, true, null], \"child\": {\"x\": -7}}";
+    be_expect_true(document.parse(input))
+    input = "overwritten";
+
+    const core::JsonElement root = document.get_root();
+    be_expect_true(root.is_object())
+    be_expect(root.get_size() == 4)
+    be_expect(root["name"].to_string().compare("bitray") == 0)
+    be_expect(root["escaped"].to_string().compare("a\tb") == 0)
+    be_expect(root["values"].get_size() == 4)
+    be_expect(root["values"](0).to_integer() == 1)
+    be_expect(root["values"](1).to_number() == 2.5)
+    be_expect_true(root["values"](2).to_bool())
+    be_expect_true(root["values"](3).is_null())
+    be_expect_false(root["values"](4).is_valid())
+    be_expect(root["child"]["x"].to_integer() == -7)
+    be_expect_false(root["child"]["missing"]["deeper"].is_valid())
+    be_expect_true(root.has_member("child"))
+    be_expect(root.get_member_name(1).compare("escaped") == 0)
+    be_expect(root.get_member_value(3)["x"].to_integer() == -7)
+  }
+
+  // Without retaining, strings are views into the input
+  {
+    const core::String input = "{\"key\": \"value\"}";
+    be_expect_true(document.parse(input, false))
+    const core::StringView value = document.get_root()["key"].to_string();
+    be_expect(value.data() == input.c_str() + 9)
+    be_expect(value.size() == 5)
+  }
+
+  // Large objects are looked up through the hash index, the arena is reused
+  {
+    core::String input = "{";
+    for (core::uint32 i = 0; i < 100; ++i) {
+      input.append_format("\"key%u\": %u, ", i, i);
+    }
+    input += "\"key0\": 1000}";
+
+    be_expect_true(document.parse(input))
+    const core::sizeT memoryUsage = document.get_memory_usage();
+    const core::JsonElement root = document.get_root();
+    be_expect(root.get_size() == 101)
+    bool found = true;
+    for (core::uint32 i = 0; i < 100; ++i) {
+      core::String key;
+      key.append_format("key%u", i);
+      found = found && root[core::StringView(key.c_str(), key.size())].to_integer() == i;
+    }
+    be_expect_true(found)
+    be_expect_false(root["key100"].is_valid())
+
+    be_expect_true(document.parse(input))
+    be_expect(document.get_memory_usage() == memoryUsage)
+  }
+
+  // Errors leave the document empty
+  be_expect_false(document.parse(core::String("{\"a\": [1, 2}")))
+  be_expect_false(document.is_valid())
+  be_expect(document.get_memory_usage() == 0)
+}
+
+be_unittest_autoregister(JsonDocumentTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "json/json_parser.h"
+#include <core/json/json.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+JsonParserTests::JsonParserTests()
+: UnitTest("core::JsonParserTests") {
+
+}
+
+JsonParserTests::~JsonParserTests() {
+
+}
+
+void JsonParserTests::test() {
+  // Standard json, parsed by the vectorized stage one
+  {
+    const core::String input =
+      "{\"name\": \"bitray\", \"count\": -42, \"scale\": 2.5e1, \"big\": 18446744073709551616,"
+      " \"flags\": [true, false, null], \"nested\": {\"escaped\": \"a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00\"},"
+      " \"empty\": [], \"padding\": \"a string which is long enough to cross the first block\"}";
+
+    core::JsonTape tape;
+    be_expect_true(tape.parse(input))
+    be_expect_true(tape.is_vectorized())
+    be_expect(tape.get_type(0) == core::EJsonTapeType::ObjectBegin)
+    be_expect(tape.get_num_elements(0) == 8)
+    be_expect(tape.get_next(0) == tape.get_size())
+
+    core::JsonValue root = core::JsonParser::parse(input);
+    be_expect_true(root.is_object())
+    be_expect(root["name"].to_string() == "bitray")
+    be_expect(root["count"].to_integer() == -42)
+    be_expect(root["scale"].to_number() == 25.0f)
+    be_expect_true(root["big"].is_number())
+    be_expect(root["flags"].get_size() == 3)
+    be_expect_true(root["flags"](0).to_bool())
+    be_expect_false(root["flags"](1).to_bool())
+    be_expect_true(root["flags"](2).is_null())
+    be_expect(root["nested"]["escaped"].to_string() == "a\"b\\c\n\xc3\xa9\xf0\x9f\x98\x80")
+    be_expect_true(root["empty"].is_array())
+    be_expect(root["empty"].get_size() == 0)
+  }
+
+  // Relaxed dialect: root without braces, unquoted keys, optional commas, comments and raw text
+  {
+    const core::String input =
+      "# Comment with a \"quote\n"
+      "name: \"bitray\"\n"
+      "multi word key: 3\n"
+      "list: [1 2 3]\n"
+      "text: \"\"\"raw \"quoted\" text\"\"\"\n";
+
+    core::JsonTape tape;
+    be_expect_true(tape.parse(input))
+    be_expect_false(tape.is_vectorized())
+
+    core::JsonValue root = core::JsonParser::parse(input);
+    be_expect(root["name"].to_string() == "bitray")
+    be_expect(root["multi word key"].to_integer() == 3)
+    be_expect(root["list"].get_size() == 3)
+    be_expect(root["list"](2).to_integer() == 3)
+    be_expect_true(root["text"].is_raw_text())
+    be_expect(root["text"].to_string() == "raw \"quoted\" text")
+  }
+
+  // The vectorized and the scalar stage one produce the same tape, also across block boundaries
+  {
+    core::String input = "{\"a\": \"";
+    for (core::uint32 i = 0; i < 300; ++i) {
+      input += ((i % 61) == 0) ? "\\\\\\\"" : "x";
+    }
+    input += "\", \"b\": [1, 2.5, \"c\", {\"d\": null}]}";
+
+    core::JsonTape vectorized;
+    be_expect_true(vectorized.parse(input))
+    be_expect_true(vectorized.is_vectorized())
+
+    // A trailing comment forces the scalar pass
+    const core::String commented = input + " # comment";
+    core::JsonTape scalar;
+    be_expect_true(scalar.parse(commented))
+    be_expect_false(scalar.is_vectorized())
+
+    be_expect(vectorized.get_size() == scalar.get_size())
+    bool equal = true;
+    for (core::uint32 i = 0; i < vectorized.get_size();) {
+      const core::EJsonTapeType type = vectorized.get_type(i);
+      equal = equal && type == scalar.get_type(i);
+      if (type == core::EJsonTapeType::String) {
+        equal = equal && vectorized.get_string(i).compare(scalar.get_string(i)) == 0;
+      }
+      // Step into containers instead of skipping them
+      i = (type == core::EJsonTapeType::ObjectBegin || type == core::EJsonTapeType::ArrayBegin) ? i + 1 : vectorized.get_next(i);
+    }
+    be_expect_true(equal)
+  }
+
+  // Malformed documents
+  {
+    core::JsonTape tape;
+    be_expect_false(tape.parse(core::String("{\"a\": \"unterminated}")))
+    be_expect(strcmp(tape.get_error(), "Unterminated string") == 0)
+    be_expect_false(tape.parse(core::String("{\"a\": 1.2.3}")))
+    be_expect(tape.get_error_offset() == 6)
+    be_expect_false(tape.parse(core::String("{\"a\": \"\xc0\xaf\"}")))
+    be_expect_false(tape.is_valid())
+  }
+
+  // Printed numbers are the shortest form of the stored float and read back unchanged
+  {
+    const core::JsonValue root = core::JsonParser::parse(core::String("{\"a\": 0.1, \"b\": -2.75, \"c\": 3.0}"));
+    core::JsonPrinter printer;
+    const core::String printed = printer.convert_to_string(root);
+    be_expect(strstr(printed.c_str(), "0.1") != nullptr)
+    be_expect(strstr(printed.c_str(), "0.100") == nullptr)
+    be_expect(strstr(printed.c_str(), "-2.75") != nullptr)
+
+    const core::JsonValue reparsed = core::JsonParser::parse(printed);
+    be_expect(reparsed["a"].to_number() == root["a"].to_number())
+    be_expect(reparsed["b"].to_number() == root["b"].to_number())
+    be_expect_true(reparsed["c"].is_number())
+    be_expect(reparsed["c"].to_number() == 3.0f)
+  }
+}
+
+be_unittest_autoregister(JsonParserTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
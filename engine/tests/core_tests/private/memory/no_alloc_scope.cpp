@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "memory/no_alloc_scope.h"
+#include <core/memory/no_alloc_scope.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+NoAllocScopeTests::NoAllocScopeTests()
+: UnitTest("core::NoAllocScopeTests") {
+
+}
+
+NoAllocScopeTests::~NoAllocScopeTests() {
+
+}
+
+void NoAllocScopeTests::test() {
+  be_expect(core::NoAllocScope::get_violation_mode() == core::NoAllocScope::EViolationMode::Report)
+
+  // Allocations outside of a scope are fine
+  const core::uint32 numViolations = core::NoAllocScope::get_num_violations();
+  be_expect_false(core::NoAllocScope::is_active())
+  core::NoAllocScope::on_allocation(16, "NoAllocScopeTests");
+  be_expect(core::NoAllocScope::get_num_violations() == numViolations)
+
+  // Allocations inside of a scope are reported
+  {
+    const core::NoAllocScope outerScope("NoAllocScopeTests::outer", __FILE__, __LINE__);
+    be_expect_true(core::NoAllocScope::is_active())
+    core::NoAllocScope::on_allocation(16, "NoAllocScopeTests");
+    be_expect(core::NoAllocScope::get_num_violations() == numViolations + 1)
+
+    // Nested scopes restore the outer scope
+    {
+      const core::NoAllocScope innerScope("NoAllocScopeTests::inner", __FILE__, __LINE__);
+      core::NoAllocScope::on_allocation(32, "NoAllocScopeTests");
+      be_expect(core::NoAllocScope::get_num_violations() == numViolations + 2)
+    }
+    be_expect_true(core::NoAllocScope::is_active())
+  }
+  be_expect_false(core::NoAllocScope::is_active())
+}
+
+be_unittest_autoregister(NoAllocScopeTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
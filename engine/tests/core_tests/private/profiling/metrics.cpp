@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "profiling/metrics.h"
+#include <core/profiling/metrics.h>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+MetricsTests::MetricsTests()
+: UnitTest("core::MetricsTests") {
+
+}
+
+MetricsTests::~MetricsTests() {
+
+}
+
+void MetricsTests::test() {
+  core::Metrics& metrics = core::Metrics::instance();
+
+  // Registration
+  {
+    const core::MetricId counter = metrics.register_counter("tests.counter");
+    be_expect(counter != core::InvalidMetricId)
+    be_expect(metrics.register_counter("tests.counter") == counter)
+    be_expect(metrics.register_gauge("tests.counter") == core::InvalidMetricId)
+    be_expect(metrics.find("tests.counter") == counter)
+    be_expect(metrics.find("tests.unknown") == core::InvalidMetricId)
+    be_expect(metrics.get_type(counter) == core::EMetricType::Counter)
+    be_expect(metrics.get_name(counter) == "tests.counter")
+  }
+
+  // Counters are summed up over all threads, deltas are per snapshot
+  {
+    const core::MetricId counter = metrics.register_counter("tests.threaded_counter");
+    metrics.snapshot();
+
+    metrics.increment(counter, 5);
+    std::thread worker([&metrics, counter]() {
+      for (int i = 0; i < 1000; ++i) {
+        metrics.increment(counter);
+      }
+    });
+    worker.join();
+    metrics.snapshot();
+
+    const core::MetricsFrame* frame = metrics.get_frame(0);
+    be_expect(frame != nullptr)
+    be_expect(frame->samples[counter].value == 1005.0)
+    be_expect(frame->samples[counter].delta == 1005.0)
+
+    metrics.increment(counter, 2);
+    metrics.snapshot();
+    be_expect(metrics.get_frame(0)->samples[counter].delta == 2.0)
+    be_expect(metrics.get_frame(1)->frameIndex + 1 == metrics.get_frame(0)->frameIndex)
+  }
+
+  // Gauges
+  {
+    const core::MetricId gauge = metrics.register_gauge("tests.gauge");
+    metrics.set_gauge(gauge, 4.0);
+    metrics.snapshot();
+    metrics.set_gauge(gauge, 1.5);
+    metrics.snapshot();
+    be_expect(metrics.get_frame(0)->samples[gauge].value == 1.5)
+    be_expect(metrics.get_frame(0)->samples[gauge].delta == -2.5)
+  }
+
+  // Histograms
+  {
+    const core::MetricId histogram = metrics.register_histogram("tests.histogram");
+    metrics.record(histogram, 0);
+    metrics.record(histogram, 3);
+    metrics.record(histogram, 9);
+    metrics.snapshot();
+
+    const core::MetricSample& sample = metrics.get_frame(0)->samples[histogram];
+    be_expect(sample.delta == 3.0)
+    be_expect(sample.mean == 4.0)
+
+    core::uint64 buckets[core::Metrics::NumHistogramBuckets];
+    be_expect_true(metrics.get_histogram_buckets(histogram, buckets))
+    be_expect(buckets[0] == 1)
+    be_expect(buckets[2] == 1)
+    be_expect(buckets[4] == 1)
+  }
+
+  // Ring buffer
+  {
+    metrics.set_history_size(4);
+    be_expect(metrics.get_num_frames() == 0)
+    be_expect(metrics.get_frame(0) == nullptr)
+    for (int i = 0; i < 6; ++i) {
+      metrics.snapshot();
+    }
+    be_expect(metrics.get_num_frames() == 4)
+    be_expect(metrics.get_frame(4) == nullptr)
+    be_expect(metrics.to_json().find("\"tests.histogram\"") != core::String::NPOS)
+    metrics.set_history_size(120);
+  }
+
+  // Names are escaped inside of the JSON output
+  {
+    metrics.register_counter("tests.\"quoted\\name\"");
+    metrics.snapshot();
+    be_expect(metrics.to_json().find("\"tests.\\\"quoted\\\\name\\\"\"") != core::String::NPOS)
+  }
+}
+
+be_unittest_autoregister(MetricsTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
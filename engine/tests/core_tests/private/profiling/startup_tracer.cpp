@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "profiling/startup_tracer.h"
+#include <core/profiling/startup_tracer.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+StartupTracerTests::StartupTracerTests()
+: UnitTest("core::StartupTracerTests") {
+
+}
+
+StartupTracerTests::~StartupTracerTests() {
+
+}
+
+void StartupTracerTests::test() {
+  core::StartupTracer& startupTracer = core::StartupTracer::instance();
+
+  // The unit tests never reach a main loop, so the tracer is still recording
+  be_expect_true(startupTracer.is_tracing())
+  const core::uint32 firstEntry = startupTracer.get_num_entries();
+  {
+    BE_STARTUP_SCOPE("StartupTracerTests::outer")
+    {
+      BE_STARTUP_SCOPE("StartupTracerTests::inner")
+    }
+  }
+  be_expect(startupTracer.get_num_entries() == firstEntry + 2)
+  const core::StartupTracer::Entry& outer = startupTracer.get_entry(firstEntry);
+  const core::StartupTracer::Entry& inner = startupTracer.get_entry(firstEntry + 1);
+  be_expect(strcmp(outer.name, "StartupTracerTests::outer") == 0)
+  be_expect(strcmp(inner.name, "StartupTracerTests::inner") == 0)
+  be_expect(inner.depth == outer.depth + 1)
+  be_expect(inner.begin >= outer.begin)
+  be_expect(outer.duration >= inner.duration)
+  be_expect(startupTracer.to_string().find("  StartupTracerTests::inner") != core::String::NPOS)
+
+  // Nothing is recorded after the main loop has been reached
+  startupTracer.finish(false);
+  be_expect_false(startupTracer.is_tracing())
+  {
+    BE_STARTUP_SCOPE("StartupTracerTests::late")
+  }
+  be_expect(startupTracer.get_num_entries() == firstEntry + 2)
+}
+
+be_unittest_autoregister(StartupTracerTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
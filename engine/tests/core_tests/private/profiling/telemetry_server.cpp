@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "profiling/telemetry_server.h"
+#include <core/profiling/telemetry_server.h>
+#include <core/platform/platform.h>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+TelemetryServerTests::TelemetryServerTests()
+: UnitTest("core::TelemetryServerTests") {
+
+}
+
+TelemetryServerTests::~TelemetryServerTests() {
+
+}
+
+void TelemetryServerTests::test() {
+  core::TelemetryServer& telemetryServer = core::TelemetryServer::instance();
+  const core::String socketPath = "/tmp/core_tests_" + core::to_string(static_cast<core::uint32>(getpid())) + ".telemetry";
+
+  be_expect_false(telemetryServer.is_running())
+  be_expect_true(telemetryServer.start(socketPath))
+  be_expect_true(telemetryServer.is_running())
+  be_expect_false(telemetryServer.has_clients())
+
+  // Attach a viewer
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path, socketPath.c_str(), socketPath.length());
+  const int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  be_expect(::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+  for (int i = 0; i < 500 && !telemetryServer.has_clients(); ++i) {
+    core::Platform::instance().sleep(2);
+  }
+  be_expect_true(telemetryServer.has_clients())
+
+  // The stream starts with the hello packet
+  core::TelemetryPacketHeader header;
+  core::TelemetryHello hello;
+  be_expect(::recv(socket, &header, sizeof(header), MSG_WAITALL) == sizeof(header))
+  be_expect(header.type == static_cast<core::uint16>(core::ETelemetryPacket::Hello))
+  be_expect(header.payloadSize == sizeof(hello))
+  be_expect(::recv(socket, &hello, sizeof(hello), MSG_WAITALL) == sizeof(hello))
+  be_expect(hello.magic == core::TelemetryMagic)
+  be_expect(hello.version == core::TelemetryVersion)
+
+  // Published packets follow after the announced metrics
+  telemetryServer.publish_zone("TelemetryServerTests", 10, 20);
+  bool zoneFound = false;
+  for (int i = 0; i < 1000 && !zoneFound; ++i) {
+    if (::recv(socket, &header, sizeof(header), MSG_WAITALL) != sizeof(header)) {
+      break;
+    }
+    char payload[1024];
+    if (header.payloadSize > sizeof(payload) || ::recv(socket, payload, header.payloadSize, MSG_WAITALL) != header.payloadSize) {
+      break;
+    }
+    if (header.type == static_cast<core::uint16>(core::ETelemetryPacket::Zone)) {
+      core::TelemetryZone zone;
+      memcpy(&zone, payload, sizeof(zone));
+      zoneFound = (zone.begin == 10 && zone.end == 20 &&
+                   core::String(payload + sizeof(zone), header.payloadSize - sizeof(zone)) == "TelemetryServerTests");
+    }
+  }
+  be_expect_true(zoneFound)
+
+  ::close(socket);
+  telemetryServer.stop();
+  be_expect_false(telemetryServer.is_running())
+  be_expect_false(telemetryServer.has_clients())
+  be_expect(access(socketPath.c_str(), F_OK) != 0)
+}
+
+be_unittest_autoregister(TelemetryServerTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -54,6 +54,21 @@ EnumTests::~EnumTests() {
 void EnumTests::test() {
   core::RttiTypeServer& rtti = core::RttiTypeServer::instance();
 
+  // Enumerating registers the types nobody looked up yet
+  {
+    core::Vector<core::EnumTypeInfo*> enumTypes;
+    rtti.get_enum_types(enumTypes);
+    bool found = false;
+    for (const core::EnumTypeInfo* enumTypeInfo : enumTypes) {
+      found = found || (enumTypeInfo->get_name() == "core_tests::SomeEnum");
+    }
+    be_expect_true(found)
+
+    core::Vector<core::ClassTypeInfo*> classTypes;
+    rtti.get_class_types(classTypes);
+    be_expect_false(classTypes.empty())
+  }
+
   {
     core::EnumTypeInfo* enumTypeInfo = rtti.get_enum_type("core_tests::SomeEnum");
     const core::Enum* enm = enumTypeInfo->get_enum();
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/format.h"
+#include <core/color/color4.h>
+#include <core/core/ptr.h>
+#include <core/io/memory_stream.h>
+#include <core/math/mat44.h>
+#include <core/math/vec3.h>
+#include <core/string/format.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+FormatTests::FormatTests()
+: UnitTest("core::FormatTests") {
+
+}
+
+FormatTests::~FormatTests() {
+
+}
+
+void FormatTests::test() {
+  // Plain arguments and escapes
+  be_expect(core::format("plain") == "plain")
+  be_expect(core::format("{} + {} = {}", 1, 2, 3) == "1 + 2 = 3")
+  be_expect(core::format("{{{}}}", 7) == "{7}")
+  be_expect(core::format("{}", -9223372036854775807LL - 1) == "-9223372036854775808")
+  be_expect(core::format("{}", 18446744073709551615ULL) == "18446744073709551615")
+  be_expect(core::format("{} {}", true, 'x') == "true x")
+  be_expect(core::format("{}", 0.1) == "0.1")
+  be_expect(core::format("{}", 2.5f) == "2.5")
+
+  // Strings of every kind
+  const core::String string("bitray");
+  const core::StringView view(string.c_str(), 3);
+  char mutableText[] = "mutable";
+  be_expect(core::format("{}|{}|{}|{}", "literal", string, view, mutableText) == "literal|bitray|bit|mutable")
+  be_expect(core::format("{:.3}", string) == "bit")
+
+  // Specifications
+  be_expect(core::format("[{:5}]", 42) == "[   42]")
+  be_expect(core::format("[{:<5}]", 42) == "[42   ]")
+  be_expect(core::format("[{:*^7}]", "ab") == "[**ab***]")
+  be_expect(core::format("[{:6}]", "ab") == "[ab    ]")
+  be_expect(core::format("[{:05}]", -42) == "[-0042]")
+  be_expect(core::format("{:x} {:X} {:b} {:o}", 255, 255, 5, 8) == "ff FF 101 10")
+  be_expect(core::format("{:x}", -255) == "-ff")
+  be_expect(core::format("{:c}{:d}", 65, 'A') == "A65")
+  be_expect(core::format("{:.2f}", 3.14159) == "3.14")
+  be_expect(core::format("{:8.3f}", -1.5) == "  -1.500")
+  be_expect(core::format("{:08.3f}", -1.5) == "-001.500")
+  be_expect(core::format("{:.2e}", 12345.0) == "1.23e+04")
+  be_expect(core::format("{:p}", static_cast<const void*>(nullptr)) == "0x0")
+  be_expect(core::format("{:d}", false) == "0")
+
+  // Math and color types, the specification applies per component
+  be_expect(core::format("{}", core::Vec3f(1.0f, 2.5f, -3.0f)) == "(1, 2.5, -3)")
+  be_expect(core::format("{:.1f}", core::Color4(1.0f, 0.5f, 0.25f, 1.0f)) == "(1.0, 0.5, 0.2, 1.0)")
+  be_expect(core::format("{}", core::Mat44f::Identity) == "((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (0, 0, 0, 1))")
+
+  // Appending to a string, longer than the stack buffer
+  {
+    core::String text("start ");
+    core::format_to(text, "{:>300}", "end");
+    be_expect(text.size() == 306)
+    be_expect(strcmp(text.c_str() + 303, "end") == 0)
+    be_expect(core::formatted_size("{:>300}", "end") == 300)
+  }
+
+  // Fixed buffer, truncation reports the full length
+  {
+    char buffer[8];
+    be_expect(core::format_to(buffer, sizeof(buffer), "{}-{}", 12, 34) == 5)
+    be_expect(strcmp(buffer, "12-34") == 0)
+    be_expect(core::format_to(buffer, sizeof(buffer), "value {}", 123456) == 12)
+    be_expect(strcmp(buffer, "value 1") == 0)
+    be_expect(core::format_to(buffer, 0, "{}", 1) == 1)
+  }
+
+  // Stream
+  {
+    core::Ptr<core::MemoryStream> stream(new core::MemoryStream());
+    stream->set_access_mode(core::EFileMode::Write);
+    be_expect_true(stream->open())
+    core::format_to(*stream, "{} {}", "stream", 1);
+    be_expect(stream->get_size() == 8)
+    be_expect(memcmp(stream->get_raw_pointer(), "stream 1", 8) == 0)
+    stream->close();
+  }
+}
+
+be_unittest_autoregister(FormatTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/name.h"
+#include <core/container/hash_map.h>
+#include <core/io/mount_point_registry.h>
+#include <core/rtti/rtti_type_server.h>
+#include <core/string/format.h>
+#include <core/string/name.h>
+#include <cstring>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+NameTests::NameTests()
+: UnitTest("core::NameTests") {
+
+}
+
+NameTests::~NameTests() {
+
+}
+
+void NameTests::test() {
+  // Interning the same text from different sources gives the same name
+  {
+    const core::Name first("name_tests_first");
+    const core::Name second(core::String("name_tests_first"));
+    const core::Name third(core::StringView("name_tests_first_and_more", 16));
+    be_expect(first == second)
+    be_expect(first == third)
+    be_expect(first.get_id() != 0)
+    be_expect(first.c_str() == second.c_str())
+    be_expect(strcmp(first.c_str(), "name_tests_first") == 0)
+    be_expect(first.size() == 16)
+    be_expect(first.to_string() == "name_tests_first")
+    be_expect(first.get_hash() == second.get_hash())
+
+    const core::Name other("name_tests_second");
+    be_expect(first != other)
+    be_expect((first < other) != (other < first))
+  }
+
+  // The empty name
+  {
+    const core::Name empty;
+    be_expect_true(empty.is_empty())
+    be_expect(empty.get_id() == 0)
+    be_expect(empty.size() == 0)
+    be_expect(strcmp(empty.c_str(), "") == 0)
+    be_expect(core::Name("") == empty)
+  }
+
+  // Finding never inserts
+  {
+    const core::uint32 numNames = core::NameTable::instance().get_num_names();
+    be_expect_true(core::Name::find("name_tests_never_interned").is_empty())
+    be_expect(core::NameTable::instance().get_num_names() == numNames)
+
+    const core::Name interned("name_tests_interned");
+    be_expect(core::Name::find("name_tests_interned") == interned)
+    be_expect(core::NameTable::instance().get_num_names() == numNames + 1)
+  }
+
+  // The text of a name stays valid while the table grows
+  {
+    const core::Name stable("name_tests_stable");
+    const char* text = stable.c_str();
+    for (core::uint32 i = 0; i < 10000; ++i) {
+      core::Name(core::format("name_tests_grow_{}", i));
+    }
+    be_expect(core::Name("name_tests_stable").c_str() == text)
+    be_expect(core::Name::find("name_tests_grow_9999").to_string() == "name_tests_grow_9999")
+  }
+
+  // Concurrent interning agrees on the ids
+  {
+    core::uint32 ids[4][256];
+    std::thread workers[4];
+    for (core::uint32 t = 0; t < 4; ++t) {
+      workers[t] = std::thread([&ids, t]() {
+        for (core::uint32 i = 0; i < 256; ++i) {
+          ids[t][i] = core::Name(core::format("name_tests_thread_{}", i)).get_id();
+        }
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    bool same = true;
+    for (core::uint32 t = 1; t < 4; ++t) {
+      same = same && (memcmp(ids[0], ids[t], sizeof(ids[0])) == 0);
+    }
+    be_expect_true(same)
+  }
+
+  // Names as hash map keys
+  {
+    core::hash_map<core::Name, core::int32> map;
+    map[core::Name("name_tests_key_a")] = 1;
+    map[core::Name("name_tests_key_b")] = 2;
+    be_expect(map.size() == 2)
+    be_expect(map[core::Name("name_tests_key_b")] == 2)
+    be_expect(map.find(core::Name::find("name_tests_key_c")) == map.end())
+  }
+
+  // Registries look their entries up by name
+  {
+    core::MountPointRegistry registry;
+    registry.add_mount_point("name_tests_mount", "/tmp/name_tests");
+    be_expect_true(registry.has_mount_point("name_tests_mount"))
+    be_expect_false(registry.has_mount_point("name_tests_unknown_mount"))
+    be_expect(registry.resolve_path(core::String("name_tests_mount:data/file.txt")) == "/tmp/name_tests/data/file.txt")
+    be_expect(registry.resolve_path(core::String("name_tests_unknown_mount:file.txt")) == "name_tests_unknown_mount:file.txt")
+    be_expect_true(core::Name::find("name_tests_unknown_mount").is_empty())
+
+    core::RttiTypeServer& rtti = core::RttiTypeServer::instance();
+    be_expect(rtti.get_enum_type("core_tests::SomeEnum") != nullptr)
+    be_expect(rtti.get_enum_type(core::Name("core_tests::SomeEnum")) == rtti.get_enum_type("core_tests::SomeEnum"))
+    be_expect(rtti.get_class_type("core_tests::NameTestsUnknownClass") == nullptr)
+  }
+}
+
+be_unittest_autoregister(NameTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/number_conversion.h"
+#include <core/string/number_conversion.h>
+#include <core/string/string.h>
+#include <cstring>
+#include <limits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+template<typename TType>
+static bool writes(TType value, const char* expected) {
+  char buffer[core::MaxNumberChars];
+  const char* end = core::to_chars(buffer, buffer + core::MaxNumberChars, value);
+  return end != nullptr && static_cast<size_t>(end - buffer) == strlen(expected) && memcmp(buffer, expected, end - buffer) == 0;
+}
+
+template<typename TType>
+static bool round_trips(TType value) {
+  char buffer[core::MaxNumberChars];
+  const char* end = core::to_chars(buffer, buffer + core::MaxNumberChars, value);
+  TType result = 0;
+  return end != nullptr && core::from_chars(buffer, end, result) == end && memcmp(&result, &value, sizeof(TType)) == 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+NumberConversionTests::NumberConversionTests()
+: UnitTest("core::NumberConversionTests") {
+
+}
+
+NumberConversionTests::~NumberConversionTests() {
+
+}
+
+void NumberConversionTests::test() {
+  // Integer formatting
+  be_expect_true(writes(core::uint32(0), "0"))
+  be_expect_true(writes(core::uint32(9), "9"))
+  be_expect_true(writes(core::uint32(10), "10"))
+  be_expect_true(writes(core::uint32(4294967295u), "4294967295"))
+  be_expect_true(writes(core::int32(-2147483647 - 1), "-2147483648"))
+  be_expect_true(writes(core::uint64(18446744073709551615ull), "18446744073709551615"))
+  be_expect_true(writes(std::numeric_limits<core::int64>::min(), "-9223372036854775808"))
+  be_expect_true(writes(core::int64(-100), "-100"))
+  for (core::uint64 value = 1; value < 10000000000000000000ull; value *= 10) {
+    be_expect_true(round_trips(value - 1))
+    be_expect_true(round_trips(value))
+    be_expect_true(round_trips(static_cast<core::int64>(value) * -1))
+  }
+
+  // Too small buffers are reported
+  {
+    char buffer[4];
+    be_expect(core::to_chars(buffer, buffer + 4, core::uint32(12345)) == nullptr)
+    be_expect(core::to_chars(buffer, buffer + 4, core::int32(-1234)) == nullptr)
+    be_expect(core::to_chars(buffer, buffer + 4, core::int32(-123)) == buffer + 4)
+  }
+
+  // Integer parsing stops at the first non digit and rejects overflows
+  {
+    const char* text = "1234,";
+    core::int32 value = 0;
+    be_expect(core::from_chars(text, text + 5, value) == text + 4)
+    be_expect(value == 1234)
+
+    const char* overflow = "4294967296";
+    core::uint32 unsignedValue = 7;
+    be_expect(core::from_chars(overflow, overflow + 10, unsignedValue) == nullptr)
+    be_expect(unsignedValue == 7)
+
+    const char* minimum = "-9223372036854775808";
+    core::int64 signedValue = 0;
+    be_expect(core::from_chars(minimum, minimum + 20, signedValue) == minimum + 20)
+    be_expect(signedValue == std::numeric_limits<core::int64>::min())
+    const char* maximum = minimum + 1;
+    be_expect(core::from_chars(maximum, maximum + 19, signedValue) == nullptr)
+    be_expect(core::from_chars(minimum, minimum + 1, signedValue) == nullptr)
+
+    const char* noDigits = "-x";
+    be_expect(core::from_chars(noDigits, noDigits + 2, signedValue) == nullptr)
+  }
+
+  // Shortest round-trip floats
+  be_expect_true(writes(0.1, "0.1"))
+  be_expect_true(writes(2.5f, "2.5"))
+  be_expect_true(writes(3.0, "3"))
+  be_expect_true(writes(-1e20, "-1e+20"))
+  be_expect_true(writes(5e-324, "5e-324"))
+  be_expect_true(round_trips(0.1 + 0.2))
+  be_expect_true(round_trips(std::numeric_limits<double>::max()))
+  be_expect_true(round_trips(std::numeric_limits<double>::denorm_min()))
+  be_expect_true(round_trips(std::numeric_limits<float>::max()))
+  be_expect_true(round_trips(1.0f / 3.0f))
+  {
+    // Pseudo random bit patterns
+    core::uint64 state = 0x9e3779b97f4a7c15ull;
+    bool allRoundTrip = true;
+    for (int i = 0; i < 10000; ++i) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      double value;
+      memcpy(&value, &state, sizeof(value));
+      if (value == value && value - value == 0.0) {
+        allRoundTrip = allRoundTrip && round_trips(value);
+      }
+    }
+    be_expect_true(allRoundTrip)
+
+    const char* text = "1.5e3]";
+    double value = 0.0;
+    be_expect(core::from_chars(text, text + 6, value) == text + 5)
+    be_expect(value == 1500.0)
+  }
+
+  // Strings append numbers in place
+  {
+    core::String string = "x";
+    string += core::int32(-42);
+    string += core::uint64(18446744073709551615ull);
+    string += 0.5;
+    string += core::uint8(7);
+    be_expect(string == "x-42184467440737095516150.57")
+    be_expect((core::String("n=") + core::int64(-9)) == "n=-9")
+    be_expect(core::to_string(1234567.0) == "1234567")
+    be_expect(core::to_string(42) == "42")
+    be_expect(core::String("  -17").get_int() == static_cast<core::sizeT>(-17))
+    be_expect(core::String("2.25").get_float() == 2.25f)
+    be_expect(core::String("abc").get_double() == 0.0)
+
+    // Input the former atoi/atof based parsing accepted
+    be_expect(core::String("+17").get_int() == 17)
+    be_expect(core::String(" +2.5").get_double() == 2.5)
+    be_expect(core::String("0x1p3").get_double() == 8.0)
+    be_expect(core::String("inf").get_double() > 1.0e308)
+    be_expect(core::String("-infinity").get_double() < -1.0e308)
+    be_expect(core::String("nan").get_double() != core::String("nan").get_double())
+
+    // Results longer than the internal formatting buffer
+    core::String formatted;
+    formatted.append_format("%0300d|%s", 5, "end");
+    be_expect(formatted.length() == 304)
+    be_expect(formatted[299] == '5')
+  }
+}
+
+be_unittest_autoregister(NumberConversionTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
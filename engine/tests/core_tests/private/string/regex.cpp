@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/regex.h"
+#include <core/string/regex.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static bool view_is(const core::StringView& view, const char* expected) {
+  return view.size() == strlen(expected) && memcmp(view.data(), expected, view.size()) == 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+RegExTests::RegExTests()
+: UnitTest("core::RegExTests") {
+
+}
+
+RegExTests::~RegExTests() {
+
+}
+
+void RegExTests::test() {
+  // Classic matching with copied results
+  {
+    core::CRegEx regex("^\\s*cpu MHz\\s*:\\s*(\\d+(\\.\\d+)).*$");
+    be_expect_true(regex.is_valid())
+    be_expect_true(regex.match("cpu MHz\t\t: 2400.125"))
+    be_expect(regex.get_results().size() == 2)
+    be_expect(regex.get_result(0) == "2400.125")
+    be_expect(regex.get_result(1) == ".125")
+    be_expect_false(regex.match("model name : cpu"))
+  }
+
+  // Matching a view, groups are spans in the subject
+  {
+    const core::CRegEx regex("(\\w+)=(\\d+)?");
+    const char* text = "width=1280 height= depth=24";
+    const core::StringView subject(text, strlen(text));
+
+    core::RegExMatch match;
+    be_expect_true(regex.match(subject, 0, match))
+    be_expect(match.get_num_groups() == 3)
+    be_expect(match.get_group(0).data() == text)
+    be_expect_true(view_is(match.get_group(1), "width"))
+    be_expect(match.get_group_offset(2) == 6)
+    be_expect(match.get_group_size(2) == 4)
+
+    be_expect_true(regex.match(subject, static_cast<core::uint32>(match.get_end()), match))
+    be_expect_true(view_is(match.get_group(1), "height"))
+    be_expect_false(match.has_group(2))
+    be_expect_true(match.get_group(2).empty())
+
+    be_expect_true(regex.match(subject, static_cast<core::uint32>(match.get_end()), match))
+    be_expect_true(view_is(match.get_group(2), "24"))
+    be_expect(match.get_end() == subject.size())
+    be_expect_false(regex.match(subject, static_cast<core::uint32>(match.get_end()), match))
+    be_expect(match.get_num_groups() == 0)
+
+    // Only part of a larger buffer is looked at
+    be_expect_false(regex.match(core::StringView(text, 5), 0, match))
+  }
+
+  // Case insensitive matching gets its own pattern
+  {
+    core::CRegEx regex("^bitray$", core::CRegEx::MatchGreedy);
+    be_expect_true(regex.match("BitRay"))
+    core::CRegEx sensitive("^bitray$");
+    be_expect_false(sensitive.match("BitRay"))
+  }
+
+  // Compiled patterns are shared through the cache
+  {
+    core::RegExCache& cache = core::RegExCache::instance();
+    cache.clear();
+    const core::uint64 misses = cache.get_num_misses();
+    const core::uint64 hits = cache.get_num_hits();
+
+    core::CRegEx first("regex_tests_[a-z]+");
+    core::CRegEx second("regex_tests_[a-z]+");
+    be_expect(cache.get_num_misses() == misses + 1)
+    be_expect(cache.get_num_hits() == hits + 1)
+    be_expect(cache.get_num_patterns() == 1)
+    be_expect_true(second.match("x regex_tests_abc"))
+
+    // Least recently used patterns go first
+    cache.set_capacity(2);
+    core::CRegEx third("regex_tests_third");
+    core::CRegEx again("regex_tests_[a-z]+");
+    core::CRegEx fourth("regex_tests_fourth");
+    be_expect(cache.get_num_patterns() == 2)
+    const core::uint64 missesBefore = cache.get_num_misses();
+    core::CRegEx stillCached("regex_tests_[a-z]+");
+    be_expect(cache.get_num_misses() == missesBefore)
+    core::CRegEx evicted("regex_tests_third");
+    be_expect(cache.get_num_misses() == missesBefore + 1)
+
+    // Evicted patterns stay alive as long as they are used
+    cache.clear();
+    be_expect_true(first.match("regex_tests_abc"))
+    cache.set_capacity(core::RegExCache::DefaultCapacity);
+  }
+}
+
+be_unittest_autoregister(RegExTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
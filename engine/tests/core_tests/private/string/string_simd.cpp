@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/string_simd.h"
+#include <core/container/hash_map.h>
+#include <core/string/string.h>
+#include <core/string/string_simd.h>
+#include <cctype>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+ * @brief
+ * Small deterministic generator, the alphabet is kept tiny so that matches are frequent.
+ */
+static core::uint32 next_random(core::uint32& state) {
+  state = state * 1664525u + 1013904223u;
+  return state >> 8;
+}
+
+static char random_char(core::uint32& state) {
+  static const char alphabet[] = { 'a', 'b', 'A', 'B', 'z', 'Z', '@', '[', '`', '{', '\0', static_cast<char>(0xc1), static_cast<char>(0xe1) };
+  return alphabet[next_random(state) % sizeof(alphabet)];
+}
+
+static const char* reference_search(const char* first, const char* last, const char* patternFirst, const char* patternLast) {
+  const core::sizeT patternSize = patternLast - patternFirst;
+  for (const char* position = first; static_cast<core::sizeT>(last - position) >= patternSize; ++position) {
+    if (memcmp(position, patternFirst, patternSize) == 0) {
+      return position;
+    }
+  }
+  return last;
+}
+
+static int reference_compare_i(const char* p1, const char* p2, core::sizeT n) {
+  for (core::sizeT i = 0; i < n; ++i) {
+    const unsigned char c1 = static_cast<unsigned char>(tolower(static_cast<unsigned char>(p1[i])));
+    const unsigned char c2 = static_cast<unsigned char>(tolower(static_cast<unsigned char>(p2[i])));
+    if (c1 != c2) {
+      return (c1 < c2) ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+StringSimdTests::StringSimdTests()
+: UnitTest("core::StringSimdTests") {
+
+}
+
+StringSimdTests::~StringSimdTests() {
+
+}
+
+void StringSimdTests::test() {
+  core::uint32 state = 12345;
+  bool searchMatches = true;
+  bool compareMatches = true;
+  bool caseMatches = true;
+  bool rfindMatches = true;
+  for (core::uint32 round = 0; round < 2000; ++round) {
+    char text[100];
+    char other[100];
+    const core::uint32 size = next_random(state) % sizeof(text);
+    for (core::uint32 i = 0; i < size; ++i) {
+      text[i] = random_char(state);
+      other[i] = (next_random(state) % 8 == 0) ? random_char(state) : static_cast<char>(text[i] ^ ((isalpha(static_cast<unsigned char>(text[i])) && next_random(state) % 2) ? 0x20 : 0));
+    }
+
+    // Search, with patterns taken from the text and random ones
+    const core::uint32 patternSize = next_random(state) % 6;
+    char pattern[8];
+    if (size >= patternSize && next_random(state) % 2) {
+      memcpy(pattern, text + next_random(state) % (size - patternSize + 1), patternSize);
+    } else {
+      for (core::uint32 i = 0; i < patternSize; ++i) {
+        pattern[i] = random_char(state);
+      }
+    }
+    searchMatches = searchMatches && core::string_search(text, text + size, pattern, pattern + patternSize) == reference_search(text, text + size, pattern, pattern + patternSize);
+
+    // Case insensitive compare
+    compareMatches = compareMatches && core::string_compare_i(text, other, size) == reference_compare_i(text, other, size);
+
+    // Case conversion
+    char lower[100];
+    char upper[100];
+    memcpy(lower, text, size);
+    memcpy(upper, text, size);
+    core::string_to_lower(lower, size);
+    core::string_to_upper(upper, size);
+    for (core::uint32 i = 0; i < size; ++i) {
+      caseMatches = caseMatches && lower[i] == static_cast<char>(tolower(static_cast<unsigned char>(text[i])));
+      caseMatches = caseMatches && upper[i] == static_cast<char>(toupper(static_cast<unsigned char>(text[i])));
+    }
+
+    // Reverse character search
+    const char c = random_char(state);
+    const char* expected = nullptr;
+    for (core::uint32 i = size; i > 0 && expected == nullptr; --i) {
+      expected = (text[i - 1] == c) ? text + i - 1 : nullptr;
+    }
+    rfindMatches = rfindMatches && core::string_rfind_char(text, text + size, c) == expected;
+  }
+  be_expect_true(searchMatches)
+  be_expect_true(compareMatches)
+  be_expect_true(caseMatches)
+  be_expect_true(rfindMatches)
+
+  // The string functions on top of the kernels
+  core::String path("/Engine/Data/Textures/Terrain/Grass_Diffuse.png");
+  be_expect(path.find("Terrain") == 22)
+  be_expect(path.find("Terrain", 23) == core::String::NPOS)
+  be_expect(path.find('/', 1) == 7)
+  be_expect(path.rfind('/') == 29)
+  be_expect(path.rfind("a") == 32)
+  be_expect(path.find("") == 0)
+  be_expect(path.to_lower() == "/engine/data/textures/terrain/grass_diffuse.png")
+  be_expect(path.to_upper() == "/ENGINE/DATA/TEXTURES/TERRAIN/GRASS_DIFFUSE.PNG")
+  be_expect(path.comparei("/ENGINE/DATA/TEXTURES/TERRAIN/GRASS_DIFFUSE.PNG") == 0)
+  be_expect(path.comparei("/engine/data/textures/terrain/grass_diffuse.pnh") < 0)
+  be_expect(path.compare("/Engine/Data/Textures/Terrain/Grass_Diffuse.png") == 0)
+  be_expect(path.compare("/Engine/Data/Textures/Terrain/Grass_Diffuse.pn") > 0)
+  be_expect(core::String("\xe1") .compare("a") > 0)
+
+  // Hashing covers the whole string and works as container key
+  const core::String first("identifier_with_some_length_0001");
+  const core::String second("identifier_with_some_length_0002");
+  be_expect(core::hash<core::String>()(first) == core::hash<core::String>()(core::String(first.c_str())))
+  be_expect(core::hash<core::String>()(first) != core::hash<core::String>()(second))
+  be_expect(core::string_hash("", 0) != core::string_hash("a", 1))
+  be_expect(core::string_hash("abc", 3) != core::string_hash("abc", 3, 1))
+  core::hash_map<core::String, core::uint32> map;
+  for (core::uint32 i = 0; i < 200; ++i) {
+    map[core::to_string(i) + "_key"] = i;
+  }
+  be_expect(map.size() == 200)
+  be_expect(map[core::String("123_key")] == 123)
+}
+
+be_unittest_autoregister(StringSimdTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "string/view_tokenizer.h"
+#include <core/io/memory_stream.h>
+#include <core/string/string_splitter.h>
+#include <core/string/view_tokenizer.h>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace core_tests {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+static bool token_is(const core::StringView& token, const char* expected) {
+  return token.size() == strlen(expected) && memcmp(token.data(), expected, token.size()) == 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+ViewTokenizerTests::ViewTokenizerTests()
+: UnitTest("core::ViewTokenizerTests") {
+
+}
+
+ViewTokenizerTests::~ViewTokenizerTests() {
+
+}
+
+void ViewTokenizerTests::test() {
+  // Character set scans
+  {
+    const char* text = "identifier_with_a_long_name   \t\n  {next}";
+    const core::CharacterSet small(" \t\n", 3);
+    const core::CharacterSet large("{}()[]<*>/=,;\"' \t\r\n", 20);
+    be_expect_true(small.is_vectorizable())
+    be_expect_false(large.is_vectorizable())
+    be_expect(core::string_find_first_of(text, text + strlen(text), small) == text + 27)
+    be_expect(core::string_find_first_of(text, text + strlen(text), large) == text + 27)
+    be_expect(core::string_find_first_not_of(text + 27, text + strlen(text), small) == text + 34)
+    be_expect(core::string_find_first_not_of(text + 27, text + strlen(text), large) == text + 35)
+    be_expect(core::string_find_first_of(text, text + 20, small) == text + 20)
+    be_expect(core::string_count_char(text, text + strlen(text), '\n') == 1)
+    be_expect(core::string_count_char(text, text + strlen(text), '_') == 4)
+  }
+
+  // Default settings split source like text
+  {
+    const char* text =
+      "shader main { /* block\n comment */ vec3 color = \"red\"; // line comment\n"
+      "  float values[3] = { 1.5, -2, 3e2 }; 'single' path/to/file }\n";
+    const char* expected[] = {
+      "shader", "main", "{", "vec3", "color", "=", "\"", "red", "\"", ";", "float", "values", "[", "3", "]", "=", "{",
+      "1.5", ",", "-2", ",", "3e2", "}", ";", "'", "single", "'", "path", "/", "to", "/", "file", "}"
+    };
+
+    core::ViewTokenizer tokenizer;
+    tokenizer.start(text);
+    const core::Vector<core::StringView> tokens = tokenizer.get_tokens();
+
+    bool same = (tokens.size() == sizeof(expected) / sizeof(expected[0]));
+    for (core::uint32 i = 0; same && i < tokens.size(); ++i) {
+      same = token_is(tokens[i], expected[i]);
+    }
+    be_expect_true(same)
+    be_expect(tokens[0].data() == text)
+  }
+
+  // Quotes, line and column tracking
+  {
+    const char* text = "first second\n  \"quoted\ntext\" /* a\nb */ third\n\n// comment\n  last";
+    core::ViewTokenizer tokenizer;
+    tokenizer.start(text);
+
+    be_expect_true(token_is(tokenizer.get_next_token(), "first"))
+    be_expect(tokenizer.get_token_line() == 1)
+    be_expect(tokenizer.get_token_column() == 1)
+    be_expect_true(token_is(tokenizer.get_next_token(), "second"))
+    be_expect(tokenizer.get_token_column() == 7)
+    be_expect_true(token_is(tokenizer.get_next_token(), "\""))
+    be_expect(tokenizer.get_token_line() == 2)
+    be_expect(tokenizer.get_token_column() == 3)
+    be_expect_true(token_is(tokenizer.get_next_token(), "quoted\ntext"))
+    be_expect_true(token_is(tokenizer.get_next_token(), "\""))
+    be_expect(tokenizer.get_token_line() == 3)
+    be_expect(tokenizer.get_token_column() == 5)
+    be_expect_true(token_is(tokenizer.get_next_token(), "third"))
+    be_expect(tokenizer.get_token_line() == 4)
+    be_expect(tokenizer.get_token_column() == 6)
+    be_expect_true(token_is(tokenizer.get_next_token(), "last"))
+    be_expect(tokenizer.get_token_line() == 7)
+    be_expect(tokenizer.get_token_column() == 3)
+    be_expect(tokenizer.get_line() == 7)
+    be_expect(tokenizer.get_column() == 7)
+    be_expect_true(tokenizer.get_next_token().empty())
+  }
+
+  // Expecting, finding and parsing with the state stack
+  {
+    core::ViewTokenizer tokenizer;
+    tokenizer.start("Width = 1280 height = 720.5 name = bitray");
+
+    be_expect_false(tokenizer.expect_token("height"))
+    be_expect_true(tokenizer.expect_token("width"))
+    be_expect_true(tokenizer.expect_token("="))
+    core::int32 width = 0;
+    be_expect_true(tokenizer.parse_number(width))
+    be_expect(width == 1280)
+
+    tokenizer.set_case_sensitive(true);
+    be_expect_false(tokenizer.expect_token("HEIGHT"))
+    be_expect_true(tokenizer.find_token("="))
+    be_expect_true(tokenizer.expect_token("="))
+    double height = 0.0;
+    be_expect_true(tokenizer.parse_number(height))
+    be_expect(height == 720.5)
+
+    tokenizer.push_state();
+    be_expect_true(token_is(tokenizer.get_next_token(), "name"))
+    tokenizer.pop_state();
+    be_expect_true(token_is(tokenizer.get_next_token(), "name"))
+    be_expect_true(tokenizer.expect_token("="))
+    core::int32 name = 0;
+    be_expect_false(tokenizer.parse_number(name))
+    be_expect_true(token_is(tokenizer.get_next_token(), "bitray"))
+  }
+
+  // Splitting into views
+  {
+    const core::String path = "/data//textures/*.png/";
+    const core::Vector<core::StringView> parts = core::StringSplitter::split_view(core::StringView(path.data(), path.size()), "/");
+    be_expect(parts.size() == 3)
+    be_expect_true(token_is(parts[0], "data"))
+    be_expect_true(token_is(parts[2], "*.png"))
+    be_expect(parts[1].data() == path.data() + 7)
+
+    const core::Vector<core::String> strings = core::StringSplitter::split(path, "/");
+    be_expect(strings.size() == 3)
+    be_expect(strings[1] == "textures")
+  }
+
+  // Tokens straight from the memory of a stream
+  {
+    core::Ptr<core::Stream> stream(new core::MemoryStream());
+    stream->set_access_mode(core::EFileMode::Write);
+    stream->open();
+    const char* text = "mesh { vertices 3 }";
+    stream->write(text, strlen(text));
+    stream->close();
+    stream->set_access_mode(core::EFileMode::Read);
+    stream->open();
+
+    core::ViewTokenizer tokenizer;
+    be_expect_true(tokenizer.start_mapped(stream))
+    const core::Vector<core::StringView> tokens = tokenizer.get_tokens();
+    be_expect(tokens.size() == 5)
+    be_expect_true(token_is(tokens[2], "vertices"))
+    tokenizer.stop();
+    stream->close();
+  }
+}
+
+be_unittest_autoregister(ViewTokenizerTests)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // core_tests
@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "application.h"
+#include <core/io/file.h>
+#include <core/io/filesystem.h>
+#include <core/io/filesystem_helper.h>
+#include <core/io/pack_archive.h>
+#include <core/io/pack_archive_writer.h>
+#include <core/time/stopwatch.h>
+#include <cstdio>
+#include <cstdlib>
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application() {
+  mCommandLine.add_argument("Input", "Directory to pack, or the archive to list", "", true);
+  mCommandLine.add_argument("Output", "Filename of the archive to write", "", false);
+  mCommandLine.add_flag("Compress", "-c", "--compress", "Store entries LZ4 compressed if that makes them smaller");
+  mCommandLine.add_parameter("Alignment", "-a", "--alignment", "Alignment of the entries inside the archive in bytes, power of two", "64");
+  mCommandLine.add_flag("List", "-l", "--list", "List the entries of the archive given as input");
+  mCommandLine.add_flag("Verify", "", "--verify", "Check the content hashes while listing");
+  mCommandLine.add_flag("Benchmark", "-b", "--benchmark", "Compare reading the loose files against reading them from the written archive");
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  const core::String input = mCommandLine.get_value("Input");
+  if (mCommandLine.is_value_set("--list")) {
+    mExitCode = list(input, mCommandLine.is_value_set("--verify")) ? 0 : 1;
+    return;
+  }
+
+  const core::String output = mCommandLine.get_value("Output");
+  if (output.empty()) {
+    printf("No archive filename given\n");
+    mExitCode = 1;
+    return;
+  }
+  if (!pack(input, output)) {
+    mExitCode = 1;
+    return;
+  }
+  if (mCommandLine.is_value_set("--benchmark")) {
+    benchmark(input, output);
+  }
+}
+
+bool Application::pack(const core::String& directory, const core::String& archiveFilename) {
+  const long alignment = strtol(mCommandLine.get_value("--alignment").c_str(), nullptr, 10);
+  if (alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+    printf("The alignment must be a power of two\n");
+    return false;
+  }
+
+  core::PackArchiveWriter writer;
+  writer.set_alignment(static_cast<core::uint32>(alignment));
+  writer.set_compression(mCommandLine.is_value_set("--compress") ? core::EPackCompression::LZ4 : core::EPackCompression::None);
+  const core::uint32 numberOfFiles = writer.add_directory(directory);
+  if (!writer.write(archiveFilename)) {
+    printf("Failed to write '%s'\n", archiveFilename.c_str());
+    return false;
+  }
+
+  core::File archiveFile;
+  archiveFile.open(archiveFilename, core::EFileMode::Read);
+  printf("Packed %u files into '%s' (%llu bytes)\n", numberOfFiles, archiveFilename.c_str(), static_cast<unsigned long long>(archiveFile.get_number_of_bytes()));
+  return true;
+}
+
+bool Application::list(const core::String& archiveFilename, bool verify) {
+  core::PackArchive archive;
+  if (!archive.open(archiveFilename)) {
+    printf("'%s' is no valid pack archive\n", archiveFilename.c_str());
+    return false;
+  }
+
+  bool result = true;
+  for (core::uint32 i = 0; i < archive.get_num_entries(); ++i) {
+    const core::PackEntry& entry = archive.get_entry(i);
+    const bool isIntact = !verify || archive.verify_entry(i);
+    printf("%12llu %12llu %4s %s%s\n",
+           static_cast<unsigned long long>(entry.size),
+           static_cast<unsigned long long>(entry.storedSize),
+           (core::EPackCompression::LZ4 == entry.compression) ? "lz4" : "-",
+           archive.get_entry_name(i),
+           isIntact ? "" : "  [damaged]");
+    result = result && isIntact;
+  }
+  return result;
+}
+
+void Application::benchmark(const core::String& directory, const core::String& archiveFilename) {
+  const core::String normalizedDirectory = core::FilesystemHelper::normalize(directory);
+  core::Vector<core::String> filenames;
+  core::Filesystem().enumerate_files(normalizedDirectory, normalizedDirectory, core::EEnumerationMode::Files, filenames, true, false);
+  if (filenames.empty()) {
+    return;
+  }
+
+  core::PackArchive archive;
+  if (!archive.open(archiveFilename)) {
+    return;
+  }
+
+  // Second round of each is measured, the first one brings everything into the page cache
+  core::Vector<core::uint8> buffer;
+  core::uint64 looseTime = 0;
+  core::uint64 packedTime = 0;
+  for (core::uint32 round = 0; round < 2; ++round) {
+    core::Stopwatch looseStopwatch(true);
+    for (const core::String& filename : filenames) {
+      core::File file;
+      if (file.open(filename, core::EFileMode::Read)) {
+        buffer.resize(static_cast<core::sizeT>(file.get_number_of_bytes()));
+        file.read(buffer.data(), buffer.size());
+        file.close();
+      }
+    }
+    looseStopwatch.stop();
+    looseTime = looseStopwatch.get_microseconds();
+
+    core::Stopwatch packedStopwatch(true);
+    for (const core::String& filename : filenames) {
+      const core::uint32 index = archive.find_entry(filename.substr(normalizedDirectory.length()));
+      if (core::PackArchive::InvalidIndex != index) {
+        buffer.resize(static_cast<core::sizeT>(archive.get_entry(index).size));
+        archive.read_entry(index, buffer.data());
+      }
+    }
+    packedStopwatch.stop();
+    packedTime = packedStopwatch.get_microseconds();
+  }
+
+  printf("Loose files:  %.2f us per file\n", static_cast<double>(looseTime) / static_cast<double>(filenames.size()));
+  printf("Pack archive: %.2f us per file\n", static_cast<double>(packedTime) / static_cast<double>(filenames.size()));
+}
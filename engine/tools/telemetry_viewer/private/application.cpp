@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "application.h"
+#include <core/log/log.h>
+#include <core/profiling/telemetry.h>
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+//[-------------------------------------------------------]
+//[ Local data                                            ]
+//[-------------------------------------------------------]
+/** Microseconds between two summaries */
+static constexpr core::uint64 SummaryInterval = 1000000;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: mFrameIndex(0)
+, mLastSummary(0) {
+  mCommandLine.add_argument("Socket", "Path of the telemetry socket, see the --telemetry parameter of the observed application", "", true);
+  mCommandLine.add_parameter("Record", "-r", "--record", "Record the raw telemetry stream into the given file", "");
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  // Connect to the observed application
+  const core::String socketPath = mCommandLine.get_value("Socket");
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  if (socketPath.empty() || socketPath.length() >= sizeof(address.sun_path)) {
+    printf("Invalid socket path '%s'\n", socketPath.c_str());
+    mExitCode = 1;
+    return;
+  }
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path, socketPath.c_str(), socketPath.length());
+
+  const int socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (socket < 0 || ::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+    printf("Failed to connect to '%s'\n", socketPath.c_str());
+    if (socket >= 0) {
+      ::close(socket);
+    }
+    mExitCode = 1;
+    return;
+  }
+
+  if (mCommandLine.is_value_set("--record") && !mRecordFile.open(mCommandLine.get_value("--record"), core::EFileMode::Write)) {
+    printf("Failed to open the record file '%s'\n", mCommandLine.get_value("--record").c_str());
+  }
+
+  // Receive until the observed application goes away
+  core::Vector<core::uint8> buffer;
+  core::uint8 chunk[64 * 1024];
+  for (;;) {
+    const ssize_t numReceived = ::recv(socket, chunk, sizeof(chunk), 0);
+    if (numReceived <= 0) {
+      break;
+    }
+    if (!mRecordFile.is_invalid()) {
+      mRecordFile.write(chunk, static_cast<core::uint64>(numReceived));
+    }
+
+    const core::sizeT offset = buffer.size();
+    buffer.resize(offset + static_cast<core::sizeT>(numReceived));
+    memcpy(buffer.data() + offset, chunk, static_cast<core::sizeT>(numReceived));
+
+    // Process all complete packets, keep the incomplete rest for the next round
+    core::sizeT position = 0;
+    while (buffer.size() - position >= sizeof(core::TelemetryPacketHeader)) {
+      core::TelemetryPacketHeader header;
+      memcpy(&header, buffer.data() + position, sizeof(header));
+      if (buffer.size() - position - sizeof(header) < header.payloadSize) {
+        break;
+      }
+      process_packet(header.type, buffer.data() + position + sizeof(header), header.payloadSize);
+      position += sizeof(header) + header.payloadSize;
+    }
+    const core::sizeT remaining = buffer.size() - position;
+    memmove(buffer.data(), buffer.data() + position, remaining);
+    buffer.resize(remaining);
+  }
+
+  ::close(socket);
+  if (!mRecordFile.is_invalid()) {
+    mRecordFile.close();
+  }
+  printf("Connection closed\n");
+}
+
+void Application::process_packet(core::uint16 type, const core::uint8* payload, core::uint32 payloadSize) {
+  switch (static_cast<core::ETelemetryPacket>(type)) {
+    case core::ETelemetryPacket::Hello: {
+      core::TelemetryHello hello;
+      if (payloadSize < sizeof(hello)) {
+        break;
+      }
+      memcpy(&hello, payload, sizeof(hello));
+      if (core::TelemetryMagic != hello.magic || core::TelemetryVersion != hello.version) {
+        printf("Unsupported telemetry stream (version %u)\n", hello.version);
+      } else {
+        printf("Attached to process %llu\n", static_cast<unsigned long long>(hello.processId));
+      }
+      break;
+    }
+
+    case core::ETelemetryPacket::MetricInfo: {
+      core::TelemetryMetricInfo metricInfo;
+      if (payloadSize < sizeof(metricInfo)) {
+        break;
+      }
+      memcpy(&metricInfo, payload, sizeof(metricInfo));
+      if (metricInfo.id >= mMetricNames.size()) {
+        mMetricNames.resize(metricInfo.id + 1);
+      }
+      mMetricNames[metricInfo.id] = core::String(reinterpret_cast<const char*>(payload + sizeof(metricInfo)), payloadSize - sizeof(metricInfo));
+      break;
+    }
+
+    case core::ETelemetryPacket::MetricsFrame: {
+      core::TelemetryMetricsFrame metricsFrame;
+      if (payloadSize < sizeof(metricsFrame)) {
+        break;
+      }
+      memcpy(&metricsFrame, payload, sizeof(metricsFrame));
+      if (payloadSize < sizeof(metricsFrame) + metricsFrame.numMetrics * sizeof(core::MetricSample)) {
+        break;
+      }
+      mSamples.resize(metricsFrame.numMetrics);
+      memcpy(mSamples.data(), payload + sizeof(metricsFrame), metricsFrame.numMetrics * sizeof(core::MetricSample));
+      mFrameIndex = metricsFrame.frameIndex;
+
+      // The frame is the heartbeat of the stream, use it to print the summary once in a while
+      if (metricsFrame.timestamp - mLastSummary >= SummaryInterval) {
+        mLastSummary = metricsFrame.timestamp;
+        print_summary();
+      }
+      break;
+    }
+
+    case core::ETelemetryPacket::Zone: {
+      core::TelemetryZone zone;
+      if (payloadSize < sizeof(zone)) {
+        break;
+      }
+      memcpy(&zone, payload, sizeof(zone));
+      const core::String name(reinterpret_cast<const char*>(payload + sizeof(zone)), payloadSize - sizeof(zone));
+      const core::uint64 duration = zone.end - zone.begin;
+      ZoneStatistics& statistics = mZones[name];
+      ++statistics.count;
+      statistics.totalTime += duration;
+      statistics.maximumTime = (duration > statistics.maximumTime) ? duration : statistics.maximumTime;
+      break;
+    }
+
+    case core::ETelemetryPacket::Log: {
+      core::TelemetryLog log;
+      if (payloadSize < sizeof(log)) {
+        break;
+      }
+      memcpy(&log, payload, sizeof(log));
+      const core::String text(reinterpret_cast<const char*>(payload + sizeof(log)), payloadSize - sizeof(log));
+      printf("[%s]: %s\n", core::Log::instance().log_level_to_string(static_cast<core::uint8>(log.logLevel)).c_str(), text.c_str());
+      break;
+    }
+
+    default:
+      // Unknown packets of newer versions are skipped
+      break;
+  }
+}
+
+void Application::print_summary() {
+  printf("--- Frame %llu ---\n", static_cast<unsigned long long>(mFrameIndex));
+  for (core::uint32 id = 0; id < mSamples.size(); ++id) {
+    const core::MetricSample& sample = mSamples[id];
+    const char* name = (id < mMetricNames.size()) ? mMetricNames[id].c_str() : "<unknown>";
+    printf("  %-32s %14.2f  (%+.2f, mean %.2f)\n", name, sample.value, sample.delta, sample.mean);
+  }
+  for (auto iterator = mZones.begin(); iterator != mZones.end(); ++iterator) {
+    const ZoneStatistics& statistics = iterator->second;
+    printf("  %-32s %8llu calls  avg %8.1f us  max %8llu us\n", iterator->first.c_str(),
+           static_cast<unsigned long long>(statistics.count),
+           static_cast<double>(statistics.totalTime) / static_cast<double>(statistics.count),
+           static_cast<unsigned long long>(statistics.maximumTime));
+  }
+  mZones.clear();
+  fflush(stdout);
+}
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <core/app/core_application.h>
+#include <core/container/hash_map.h>
+#include <core/container/vector.h>
+#include <core/io/file.h>
+#include <core/profiling/metrics.h>
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * Application
+ *
+ * @brief
+ * Attaches to the telemetry socket of a running application, prints its log lines and
+ * a per-second summary of its metrics and profiler zones, and optionally records the
+ * raw stream into a file.
+ *
+ * Usage: telemetry_viewer <socket path> [--record <file>]
+ */
+class Application : public core::CoreApplication {
+public:
+
+  Application();
+
+  ~Application() override;
+
+public:
+
+  void main() override;
+
+private:
+
+  /**
+   * @struct
+   * ZoneStatistics
+   *
+   * @brief
+   * Accumulated timings of a profiler zone since the last summary.
+   */
+  struct ZoneStatistics {
+    core::uint64 count = 0;
+    core::uint64 totalTime = 0;
+    core::uint64 maximumTime = 0;
+  };
+
+private:
+
+  void process_packet(core::uint16 type, const core::uint8* payload, core::uint32 payloadSize);
+
+  void print_summary();
+
+private:
+
+  core::File mRecordFile;
+  core::Vector<core::String> mMetricNames;
+  core::Vector<core::MetricSample> mSamples;
+  core::hash_map<core::String, ZoneStatistics> mZones;
+  core::uint64 mFrameIndex;
+  core::uint64 mLastSummary;
+};